@@ -0,0 +1,114 @@
+#include "limo/analysis/Duality.hpp"
+#include "limo/simplex/ModifiedSimplexSolver.hpp"
+
+#include "BenchmarkProblems.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <optional>
+#include <random>
+#include <vector>
+
+using limo::analysis::Duality;
+using limo::core::BasisState;
+using limo::numerics::SparseMatrix;
+using limo::simplex::ModifiedSimplexSolver;
+using limo::simplex::StandardForm;
+using limo::simplex::benchmarks::addRandomColumns;
+
+namespace {
+
+/**
+ * Random feasible, bounded problem (b = A p for a point p inside the box
+ * [0, 4]) whose last `cuts` rows are cuts wᵀx + s = wᵀx* - 1 through the
+ * optimum x* of the problem without them, each with its own slack column.
+ * Returns the problem and the optimal basis of the uncut one.
+ */
+std::pair<StandardForm<double>, BasisState> cutProblem(std::size_t rows, std::size_t cols, std::size_t cuts) {
+    std::mt19937 rng(37);
+    std::uniform_real_distribution<double> coefficient(-1.0, 1.0);
+    std::uniform_real_distribution<double> weight(0.0, 1.0);
+
+    SparseMatrix<double>::Builder uncutBuilder(rows, cols);
+    std::vector<double> rhs(rows, 0.0);
+    std::vector<double> costs(cols);
+    addRandomColumns(
+        rng, uncutBuilder, rows, cols, 3, rhs, costs, [](std::size_t) { return 1.0; },
+        [&](std::size_t, std::size_t) { return coefficient(rng); }, [&](std::size_t) { return coefficient(rng); });
+    const SparseMatrix<double> columns = uncutBuilder.build();
+    const auto build = [&](std::size_t extraRows, const std::vector<std::vector<double>>& weights,
+                           const std::vector<double>& limits) {
+        SparseMatrix<double>::Builder builder(rows + extraRows, cols + extraRows);
+        for (std::size_t col = 0; col < cols; ++col) {
+            const auto indices = columns.column_indices(col);
+            const auto values = columns.column_values(col);
+            for (std::size_t k = 0; k < indices.size(); ++k) {
+                builder.add(indices[k], col, values[k]);
+            }
+            for (std::size_t k = 0; k < extraRows; ++k) {
+                builder.add(rows + k, col, weights[k][col]);
+            }
+        }
+        StandardForm<double> problem{{}, rhs, costs, std::vector<std::optional<double>>(cols, 4.0)};
+        for (std::size_t k = 0; k < extraRows; ++k) {
+            builder.add(rows + k, cols + k, 1.0);
+            problem.rhs.push_back(limits[k]);
+            problem.costs.push_back(0.0);
+            problem.upperBounds.emplace_back();
+        }
+        problem.constraints = builder.build();
+        return problem;
+    };
+
+    const auto uncut = ModifiedSimplexSolver().solve(build(0, {}, {}));
+    std::vector<std::vector<double>> weights(cuts, std::vector<double>(cols));
+    std::vector<double> limits(cuts, -1.0);
+    for (std::size_t k = 0; k < cuts; ++k) {
+        for (std::size_t col = 0; col < cols; ++col) {
+            weights[k][col] = weight(rng);
+            limits[k] += weights[k][col] * uncut.values[col];
+        }
+    }
+    return {build(cuts, weights, limits), uncut.basisState};
+}
+
+// range(0): rows (columns are three times as many), range(1): cuts added.
+// Cold primal re-solve of the cut problem. Reports the iteration count.
+void BM_PrimalAfterCuts(benchmark::State& state) {
+    const auto [problem, start] = cutProblem(static_cast<std::size_t>(state.range(0)),
+                                             3 * static_cast<std::size_t>(state.range(0)),
+                                             static_cast<std::size_t>(state.range(1)));
+    const ModifiedSimplexSolver solver;
+    std::size_t iterations = 0;
+    for (auto _ : state) {
+        const auto solution = solver.solve(problem);
+        iterations = solution.iterations;
+        benchmark::DoNotOptimize(solution.objective);
+    }
+    state.counters["iterations"] = static_cast<double>(iterations);
+}
+
+// As above, reoptimized by the dual simplex from the uncut optimal basis;
+// range(2) switches the bound-flipping ratio test off (0) or on (1).
+void BM_DualAfterCuts(benchmark::State& state) {
+    const auto [problem, start] = cutProblem(static_cast<std::size_t>(state.range(0)),
+                                             3 * static_cast<std::size_t>(state.range(0)),
+                                             static_cast<std::size_t>(state.range(1)));
+    Duality::Options options;
+    options.boundFlipping = state.range(2) != 0;
+    const Duality duality(options);
+    std::size_t iterations = 0;
+    for (auto _ : state) {
+        const auto solution = duality.reoptimize(problem, start);
+        iterations = solution.iterations;
+        benchmark::DoNotOptimize(solution.objective);
+    }
+    state.SetLabel(options.boundFlipping ? "bound flipping" : "textbook");
+    state.counters["iterations"] = static_cast<double>(iterations);
+}
+
+} // namespace
+
+BENCHMARK(BM_PrimalAfterCuts)->ArgsProduct({{50, 100, 200}, {1, 5}})->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_DualAfterCuts)->ArgsProduct({{50, 100, 200}, {1, 5}, {0, 1}})->Unit(benchmark::kMillisecond);
@@ -0,0 +1,123 @@
+#include "limo/analysis/Sensitivity.hpp"
+#include "limo/simplex/ModifiedSimplexSolver.hpp"
+#include "limo/thread_pool/ThreadPool.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstddef>
+#include <map>
+#include <optional>
+#include <random>
+#include <vector>
+
+using limo::analysis::Sensitivity;
+using limo::core::Solution;
+using limo::numerics::SparseMatrix;
+using limo::simplex::ModifiedSimplexSolver;
+using limo::simplex::StandardForm;
+using limo::thread_pool::ThreadPool;
+
+namespace {
+
+constexpr std::size_t kRows = 100;
+
+// Random feasible, bounded problem (b = A p for a point p inside the box
+// [0, 4]) with kRows rows and about four non-zeros per column. One column in
+// twenty has a negative cost, so the optimum moves few columns off zero and
+// the solve stays short enough to benchmark at 100k columns.
+StandardForm<double> wideProblem(std::size_t cols) {
+    std::mt19937 rng(47);
+    std::uniform_real_distribution<double> coefficient(-1.0, 1.0);
+    std::uniform_int_distribution<std::size_t> row(0, kRows - 1);
+    SparseMatrix<double>::Builder builder(kRows, cols);
+    std::vector<double> rhs(kRows, 0.0);
+    std::vector<double> costs(cols);
+    for (std::size_t col = 0; col < cols; ++col) {
+        std::vector<char> used(kRows, 0);
+        for (std::size_t k = 0; k < 4; ++k) {
+            const std::size_t r = k == 0 ? col % kRows : row(rng);
+            if (used[r] == 0) {
+                used[r] = 1;
+                const double value = coefficient(rng);
+                builder.add(r, col, value);
+                rhs[r] += value;
+            }
+        }
+        costs[col] = col % 20 == 0 ? -std::abs(coefficient(rng)) : std::abs(coefficient(rng));
+    }
+    return {builder.build(), std::move(rhs), std::move(costs), std::vector<std::optional<double>>(cols, 4.0)};
+}
+
+ModifiedSimplexSolver solver() {
+    ModifiedSimplexSolver::Options options;
+    options.pricing = limo::simplex::PricingRule::Devex;
+    options.maxIterations = 1000000;
+    return ModifiedSimplexSolver(options);
+}
+
+struct Solved {
+    StandardForm<double> problem;
+    Solution<double> solution;
+};
+
+// Solves wideProblem(cols) once per process; the ranging benchmarks share it.
+const Solved& solved(std::size_t cols) {
+    static std::map<std::size_t, Solved> cache;
+    auto found = cache.find(cols);
+    if (found == cache.end()) {
+        StandardForm<double> problem = wideProblem(cols);
+        Solution<double> solution = solver().solve(problem);
+        found = cache.emplace(cols, Solved{std::move(problem), std::move(solution)}).first;
+    }
+    return found->second;
+}
+
+// range(0): columns. The solve full ranging is compared against.
+void BM_Solve(benchmark::State& state) {
+    const StandardForm<double> problem = wideProblem(static_cast<std::size_t>(state.range(0)));
+    std::size_t iterations = 0;
+    for (auto _ : state) {
+        const auto solution = solver().solve(problem);
+        iterations = solution.iterations;
+        benchmark::DoNotOptimize(solution.objective);
+    }
+    state.counters["iterations"] = static_cast<double>(iterations);
+}
+
+// range(0): columns, range(1): worker threads (0 keeps it on the calling
+// thread). Cost and rhs ranges of every column and row, factorization included.
+void BM_FullRanging(benchmark::State& state) {
+    const auto& [problem, solution] = solved(static_cast<std::size_t>(state.range(0)));
+    std::optional<ThreadPool> pool;
+    Sensitivity::Options options;
+    if (state.range(1) > 0) {
+        pool.emplace(static_cast<std::size_t>(state.range(1)));
+        options.parallel.pool = &*pool;
+    }
+    const Sensitivity sensitivity(options);
+    for (auto _ : state) {
+        const auto ranging = sensitivity.analyze(problem, solution);
+        const auto costs = ranging.costRanges();
+        const auto rhs = ranging.rhsRanges();
+        benchmark::DoNotOptimize(costs.data());
+        benchmark::DoNotOptimize(rhs.data());
+    }
+}
+
+// range(0): columns. Ranges ten basic columns only.
+void BM_LazyRanging(benchmark::State& state) {
+    const auto& [problem, solution] = solved(static_cast<std::size_t>(state.range(0)));
+    const std::vector<std::size_t> columns(solution.basis.begin(), solution.basis.begin() + 10);
+    for (auto _ : state) {
+        const auto ranging = Sensitivity().analyze(problem, solution);
+        const auto costs = ranging.costRanges(columns);
+        benchmark::DoNotOptimize(costs.data());
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_Solve)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_FullRanging)->ArgsProduct({{10000, 100000}, {0, 4}})->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_LazyRanging)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
@@ -1,13 +1,71 @@
 #pragma once
 
-#include "limo/core/LinearProgram.hpp"
 #include "limo/core/Solution.hpp"
+#include "limo/simplex/StandardForm.hpp"
+
+#include <cstddef>
 
 namespace limo::analysis {
 
+/**
+ * @brief Dual simplex reoptimization of a StandardForm problem.
+ *
+ * Meant for re-solving after the problem changed in ways that keep an
+ * earlier optimal basis dual feasible but break its primal feasibility:
+ * an added row (a cut, with its own slack column), a tightened upper bound
+ * or a changed right-hand side. The dual simplex then walks from that
+ * basis back to feasibility, which typically takes a handful of pivots
+ * where a primal solve from scratch takes many.
+ *
+ * The method works over the same BasisFactorization as
+ * simplex::ModifiedSimplexSolver. The leaving row is the one with the
+ * largest bound violation, and the ratio test is a bound-flipping one:
+ * boxed nonbasic columns whose breakpoints the dual step passes move to
+ * their opposite bound instead of ending the step, so one iteration can
+ * absorb many short steps.
+ */
 class Duality {
 public:
+    struct Options {
+        std::size_t maxIterations{100000};
+        /// Number of eta updates after which the basis is refactorized.
+        std::size_t refactorizationInterval{64};
+        double feasibilityTolerance{1e-9};
+        double optimalityTolerance{1e-9};
+        /// Smallest magnitude accepted as a pivot in the ratio test.
+        double pivotTolerance{1e-9};
+        /// Passes breakpoints of boxed columns by flipping them; off gives
+        /// the textbook ratio test that stops at the first breakpoint.
+        bool boundFlipping{true};
+    };
+
     Duality() = default;
+    explicit Duality(Options options);
+
+    const Options& getOptions() const;
+
+    /**
+     * @brief Reoptimizes `problem` from `start`, typically the basisState of
+     * the optimal solution before the change.
+     *
+     * `start` may describe only the leading columns and rows of `problem`;
+     * columns and rows appended since (cuts and their slacks) start out
+     * nonbasic, and each appended row keeps its logical in the basis unless
+     * a column marked basic takes it. Basic columns are pivoted in as far as
+     * they are independent, and nonbasic boxed columns go to the bound their
+     * reduced cost asks for. If that basis is still not dual feasible, the
+     * problem is handed to simplex::ModifiedSimplexSolver warm-started from
+     * the same statuses.
+     *
+     * @throws std::invalid_argument if the problem is malformed (see
+     * StandardForm::validate) or `start` has more statuses than the problem
+     * has columns or rows.
+     */
+    core::Solution<double> reoptimize(const simplex::StandardForm<double>& problem,
+                                      const core::BasisState& start) const;
+
+private:
+    Options options;
 };
 
 } // namespace limo::analysis
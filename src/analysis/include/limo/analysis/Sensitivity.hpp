@@ -1,13 +1,121 @@
 #pragma once
 
-#include "limo/core/LinearProgram.hpp"
 #include "limo/core/Solution.hpp"
+#include "limo/simplex/BasisFactorization.hpp"
+#include "limo/simplex/ParallelScan.hpp"
+#include "limo/simplex/StandardForm.hpp"
+
+#include <cstddef>
+#include <span>
+#include <vector>
 
 namespace limo::analysis {
 
+/**
+ * @brief Closed interval [lower, upper]; either end may be infinite.
+ */
+struct Range {
+    double lower;
+    double upper;
+};
+
+class Ranging;
+
+/**
+ * @brief Sensitivity analysis of an optimal StandardForm solution from its
+ * final basis, without re-solving.
+ *
+ * analyze() factorizes the basis once; the returned Ranging then answers
+ * shadow prices and reduced costs directly and computes ranges on demand:
+ * - the cost range of a column is the interval its cost can move in while
+ *   the basis stays optimal. For a nonbasic column that is one bound from
+ *   its reduced cost; a basic column needs its row of B⁻¹A, i.e. one BTRAN
+ *   and a ratio scan over the reduced costs of the nonbasic columns.
+ * - the rhs range of a row is the interval its right-hand side can move in
+ *   while the basis stays feasible, so its shadow price stays valid: one
+ *   FTRAN and a ratio scan over the basic values.
+ * Basic columns are ranged in batches that share one pass over A, and
+ * batches spread over the thread pool of the options.
+ */
 class Sensitivity {
 public:
+    struct Options {
+        /// Basic columns or rows ranged together by one task.
+        std::size_t batchSize{32};
+        /// Pool for the batches; here the cutoff counts batches, not elements.
+        simplex::ParallelOptions parallel{nullptr, 2};
+        /// Entries of B⁻¹A or B⁻¹eᵢ at most this large are treated as zero.
+        double pivotTolerance{1e-9};
+    };
+
     Sensitivity() = default;
+    explicit Sensitivity(Options options);
+
+    const Options& getOptions() const;
+
+    /**
+     * @brief Factorizes the final basis of `solution`, an optimal solution of
+     * `problem` from one of the simplex solvers. `problem` must outlive the
+     * returned Ranging.
+     * @throws std::invalid_argument if the problem is malformed, the solution
+     * is not optimal or its basis and values do not fit the problem.
+     */
+    Ranging analyze(const simplex::StandardForm<double>& problem, const core::Solution<double>& solution) const;
+
+private:
+    Options options;
+};
+
+/**
+ * @brief Ranging over one factorized optimal basis; see Sensitivity.
+ *
+ * The overloads taking indices are the lazy mode: they only range the
+ * columns or rows asked for. Every query is const and may run concurrently.
+ */
+class Ranging {
+public:
+    /// Dual values y with reduced costs d = c - Aᵀy.
+    const std::vector<double>& shadowPrices() const;
+    const std::vector<double>& reducedCosts() const;
+
+    /// Cost ranges of every column.
+    std::vector<Range> costRanges() const;
+    /**
+     * @throws std::out_of_range if a column index is out of range.
+     */
+    std::vector<Range> costRanges(std::span<const std::size_t> columns) const;
+
+    /// Rhs ranges of every row.
+    std::vector<Range> rhsRanges() const;
+    /**
+     * @throws std::out_of_range if a row index is out of range.
+     */
+    std::vector<Range> rhsRanges(std::span<const std::size_t> rows) const;
+
+private:
+    friend class Sensitivity;
+
+    Ranging(const simplex::StandardForm<double>& problem, const core::Solution<double>& solution,
+            const Sensitivity::Options& options);
+
+    double columnDot(const std::vector<double>& y, std::size_t variable) const;
+    bool isBasic(std::size_t variable) const;
+    bool atUpper(std::size_t variable) const;
+
+    const simplex::StandardForm<double>* problem;
+    Sensitivity::Options options;
+    std::size_t rows;
+    std::size_t cols;
+    /// Variables 0..cols-1 are the columns, cols + i the logical of row i.
+    std::vector<std::size_t> basis;
+    /// Basis row of every variable, or rows if it is nonbasic.
+    std::vector<std::size_t> positions;
+    std::vector<char> upperStates;
+    std::vector<double> upper;
+    std::vector<double> basicValues;
+    std::vector<double> duals;
+    std::vector<double> reduced;
+    simplex::BasisFactorization factorization;
 };
 
 } // namespace limo::analysis
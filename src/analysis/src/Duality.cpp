@@ -1 +1,412 @@
 #include "limo/analysis/Duality.hpp"
+
+#include "limo/simplex/BasisFactorization.hpp"
+#include "limo/simplex/ModifiedSimplexSolver.hpp"
+#include "limo/simplex/WarmStart.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace limo::analysis {
+
+namespace {
+
+constexpr std::size_t kNone = std::numeric_limits<std::size_t>::max();
+constexpr double kInfinity = std::numeric_limits<double>::infinity();
+
+enum class VariableState {
+    Basic,
+    AtLower,
+    AtUpper,
+};
+
+// A nonbasic column the dual step reaches at `ratio`; `alpha` is its entry
+// in the pivot row.
+struct Breakpoint {
+    std::size_t variable;
+    double ratio;
+    double alpha;
+};
+
+/**
+ * State of one reoptimization. Variables 0..n-1 are the structural columns
+ * and n + i is the logical e_i of row i, fixed at zero: it may sit in the
+ * basis (where any non-zero value is a violation) but never enters.
+ */
+class DualSimplex {
+public:
+    DualSimplex(const simplex::StandardForm<double>& problem, const Duality::Options& options)
+        : problem(problem),
+          options(options),
+          rows(problem.rows()),
+          cols(problem.cols()),
+          upper(cols + rows, 0.0),
+          costs(cols + rows, 0.0),
+          state(cols + rows, VariableState::AtLower),
+          reducedCosts(cols + rows, 0.0),
+          basis(rows),
+          basicValues(rows),
+          factorization(options.refactorizationInterval) {
+        for (std::size_t j = 0; j < cols; ++j) {
+            upper[j] = problem.hasUpperBound(j) ? *problem.upperBounds[j] : kInfinity;
+            costs[j] = problem.costs[j];
+        }
+        for (std::size_t i = 0; i < rows; ++i) {
+            basis[i] = cols + i;
+            state[cols + i] = VariableState::Basic;
+        }
+    }
+
+    /**
+     * Builds the starting basis from `start` and puts nonbasic boxed columns
+     * on the bound their reduced cost asks for. Returns false if a column
+     * without an upper bound still prices out negative, i.e. the start is
+     * not dual feasible.
+     */
+    bool crash(const core::BasisState& start) {
+        for (std::size_t j = 0; j < start.columns.size(); ++j) {
+            if (start.columns[j] == core::BasisStatus::AtUpper && upper[j] < kInfinity) {
+                state[j] = VariableState::AtUpper;
+            }
+        }
+        refactorize();
+        simplex::crashBasis(
+            start, cols, basis, factorization, options.pivotTolerance,
+            [this](std::vector<double>& column, std::size_t variable) { loadColumn(column, variable); },
+            [this](std::size_t row, std::size_t column, const std::vector<double>& alpha) {
+                state[basis[row]] = VariableState::AtLower;
+                state[column] = VariableState::Basic;
+                basis[row] = column;
+                factorization.update(row, alpha);
+                if (factorization.needsRefactorization()) {
+                    refactorize();
+                }
+            });
+        refactorize();
+        for (std::size_t j = 0; j < cols; ++j) {
+            if (state[j] != VariableState::Basic && reducedCosts[j] < -options.optimalityTolerance &&
+                upper[j] == kInfinity) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    core::Solution<double> run() {
+        std::vector<double> rho(rows);
+        std::vector<double> rowAlpha(cols + rows, 0.0);
+        std::vector<double> alpha(rows);
+        std::vector<double> flips(rows);
+        std::vector<Breakpoint> breakpoints;
+        while (true) {
+            const std::size_t r = leavingRow();
+            if (r == kNone) {
+                return finish(core::SolutionStatus::Optimal);
+            }
+            if (iterations >= options.maxIterations) {
+                return finish(core::SolutionStatus::IterationLimit);
+            }
+            const std::size_t leaving = basis[r];
+            const bool toUpper = basicValues[r] > upper[leaving];
+            const double target = toUpper ? upper[leaving] : 0.0;
+            // The dual step moves y by sign * t * rho with t >= 0, so that the
+            // leaving variable's reduced cost takes the sign of its new bound.
+            const double sign = toUpper ? 1.0 : -1.0;
+
+            std::fill(rho.begin(), rho.end(), 0.0);
+            rho[r] = 1.0;
+            factorization.btran(rho);
+            breakpoints.clear();
+            for (std::size_t j = 0; j < cols + rows; ++j) {
+                if (state[j] == VariableState::Basic) {
+                    continue;
+                }
+                rowAlpha[j] = columnDot(rho, j);
+                const double direction = sign * rowAlpha[j];
+                if (upper[j] <= 0.0 || std::abs(rowAlpha[j]) <= options.pivotTolerance) {
+                    continue;
+                }
+                if (state[j] == VariableState::AtLower && direction > 0.0) {
+                    breakpoints.push_back({j, std::max(reducedCosts[j], 0.0) / direction, rowAlpha[j]});
+                } else if (state[j] == VariableState::AtUpper && direction < 0.0) {
+                    breakpoints.push_back({j, std::min(reducedCosts[j], 0.0) / direction, rowAlpha[j]});
+                }
+            }
+
+            const std::size_t chosen = ratioTest(breakpoints, std::abs(basicValues[r] - target));
+            if (chosen == kNone) {
+                // No combination of nonbasic moves repairs row r: the dual is
+                // unbounded and the problem infeasible.
+                return finish(core::SolutionStatus::Infeasible);
+            }
+            const std::size_t entering = breakpoints[chosen].variable;
+
+            // Breakpoints passed before the entering one flip to their other bound.
+            std::fill(flips.begin(), flips.end(), 0.0);
+            bool flipped = false;
+            for (std::size_t k = 0; k < chosen; ++k) {
+                const std::size_t j = breakpoints[k].variable;
+                const bool wasUpper = state[j] == VariableState::AtUpper;
+                addColumn(flips, j, wasUpper ? -upper[j] : upper[j]);
+                state[j] = wasUpper ? VariableState::AtLower : VariableState::AtUpper;
+                flipped = true;
+            }
+            if (flipped) {
+                factorization.ftran(flips);
+                for (std::size_t i = 0; i < rows; ++i) {
+                    basicValues[i] -= flips[i];
+                }
+            }
+
+            loadColumn(alpha, entering);
+            factorization.ftran(alpha);
+            const double primalStep = (basicValues[r] - target) / alpha[r];
+            for (std::size_t i = 0; i < rows; ++i) {
+                basicValues[i] -= primalStep * alpha[i];
+            }
+            const double enteringValue = nonbasicValue(entering) + primalStep;
+
+            const double dualStep = sign * breakpoints[chosen].ratio;
+            for (std::size_t j = 0; j < cols + rows; ++j) {
+                if (state[j] != VariableState::Basic) {
+                    reducedCosts[j] -= dualStep * rowAlpha[j];
+                }
+            }
+            reducedCosts[leaving] = -dualStep;
+            reducedCosts[entering] = 0.0;
+            state[leaving] = toUpper && !isLogical(leaving) ? VariableState::AtUpper : VariableState::AtLower;
+            state[entering] = VariableState::Basic;
+            basis[r] = entering;
+            basicValues[r] = enteringValue;
+            factorization.update(r, alpha);
+            ++iterations;
+            if (factorization.needsRefactorization()) {
+                refactorize();
+            }
+        }
+    }
+
+private:
+    const simplex::StandardForm<double>& problem;
+    const Duality::Options& options;
+    std::size_t rows;
+    std::size_t cols;
+    std::vector<double> upper;
+    std::vector<double> costs;
+    std::vector<VariableState> state;
+    std::vector<double> reducedCosts;
+    std::vector<std::size_t> basis;
+    std::vector<double> basicValues;
+    simplex::BasisFactorization factorization;
+    std::size_t iterations{0};
+
+    bool isLogical(std::size_t variable) const { return variable >= cols; }
+
+    double nonbasicValue(std::size_t variable) const {
+        return state[variable] == VariableState::AtUpper ? upper[variable] : 0.0;
+    }
+
+    double columnDot(const std::vector<double>& y, std::size_t variable) const {
+        if (isLogical(variable)) {
+            return y[variable - cols];
+        }
+        const auto indices = problem.constraints.column_indices(variable);
+        const auto values = problem.constraints.column_values(variable);
+        double sum = 0.0;
+        for (std::size_t k = 0; k < indices.size(); ++k) {
+            sum += values[k] * y[indices[k]];
+        }
+        return sum;
+    }
+
+    void addColumn(std::vector<double>& target, std::size_t variable, double factor) const {
+        if (isLogical(variable)) {
+            target[variable - cols] += factor;
+            return;
+        }
+        const auto indices = problem.constraints.column_indices(variable);
+        const auto values = problem.constraints.column_values(variable);
+        for (std::size_t k = 0; k < indices.size(); ++k) {
+            target[indices[k]] += factor * values[k];
+        }
+    }
+
+    void loadColumn(std::vector<double>& target, std::size_t variable) const {
+        std::fill(target.begin(), target.end(), 0.0);
+        addColumn(target, variable, 1.0);
+    }
+
+    std::vector<double> duals() const {
+        std::vector<double> y(rows);
+        for (std::size_t i = 0; i < rows; ++i) {
+            y[i] = costs[basis[i]];
+        }
+        factorization.btran(y);
+        return y;
+    }
+
+    // Refactors the current basis and recomputes reduced costs and basic
+    // values from scratch. Boxed columns whose reduced cost drifted to the
+    // wrong sign are moved to the other bound first, which keeps the basis
+    // dual feasible.
+    void refactorize() {
+        simplex::factorizeBasis(factorization, basis, [this](std::vector<double>& column, std::size_t variable) {
+            loadColumn(column, variable);
+        });
+
+        const std::vector<double> y = duals();
+        for (std::size_t j = 0; j < cols + rows; ++j) {
+            if (state[j] == VariableState::Basic) {
+                reducedCosts[j] = 0.0;
+                continue;
+            }
+            reducedCosts[j] = costs[j] - columnDot(y, j);
+            if (upper[j] < kInfinity && upper[j] > 0.0) {
+                if (reducedCosts[j] < -options.optimalityTolerance) {
+                    state[j] = VariableState::AtUpper;
+                } else if (reducedCosts[j] > options.optimalityTolerance) {
+                    state[j] = VariableState::AtLower;
+                }
+            }
+        }
+
+        basicValues = problem.rhs;
+        for (std::size_t j = 0; j < cols; ++j) {
+            if (state[j] == VariableState::AtUpper) {
+                addColumn(basicValues, j, -upper[j]);
+            }
+        }
+        factorization.ftran(basicValues);
+    }
+
+    // The basic row with the largest bound violation, or kNone if the basis is primal feasible.
+    std::size_t leavingRow() const {
+        std::size_t row = kNone;
+        double worst = 0.0;
+        for (std::size_t i = 0; i < rows; ++i) {
+            const double value = basicValues[i];
+            const double bound = upper[basis[i]];
+            double violation = 0.0;
+            if (value < -options.feasibilityTolerance) {
+                violation = -value;
+            } else if (value > bound + options.feasibilityTolerance * std::max(1.0, bound)) {
+                violation = value - bound;
+            }
+            if (violation > worst) {
+                worst = violation;
+                row = i;
+            }
+        }
+        return row;
+    }
+
+    /**
+     * Bound-flipping ratio test. Walks the breakpoints in order of ratio;
+     * passing a boxed column's breakpoint flips it to its other bound, which
+     * lowers the rate at which the dual objective improves (the remaining
+     * violation) by |alpha| times its range. The entering column is the one
+     * at which that rate stops being positive, or the first one that cannot
+     * flip. Sorts `breakpoints` and returns the index of the entering one, or
+     * kNone if every breakpoint flips and the violation remains.
+     */
+    std::size_t ratioTest(std::vector<Breakpoint>& breakpoints, double violation) const {
+        std::sort(breakpoints.begin(), breakpoints.end(), [](const Breakpoint& a, const Breakpoint& b) {
+            return a.ratio != b.ratio ? a.ratio < b.ratio : std::abs(a.alpha) > std::abs(b.alpha);
+        });
+        double slope = violation;
+        for (std::size_t k = 0; k < breakpoints.size(); ++k) {
+            const double range = upper[breakpoints[k].variable];
+            if (!options.boundFlipping || range == kInfinity) {
+                return k;
+            }
+            slope -= std::abs(breakpoints[k].alpha) * range;
+            if (slope <= 0.0) {
+                return k;
+            }
+        }
+        return kNone;
+    }
+
+    core::Solution<double> finish(core::SolutionStatus status) const {
+        core::Solution<double> solution;
+        solution.status = status;
+        solution.iterations = iterations;
+        solution.basis = basis;
+        solution.values.assign(cols, 0.0);
+        for (std::size_t j = 0; j < cols; ++j) {
+            solution.values[j] = nonbasicValue(j);
+        }
+        for (std::size_t i = 0; i < rows; ++i) {
+            if (!isLogical(basis[i])) {
+                solution.values[basis[i]] = basicValues[i];
+            }
+        }
+        for (std::size_t j = 0; j < cols; ++j) {
+            solution.objective += problem.costs[j] * solution.values[j];
+        }
+        const auto statusOf = [&](std::size_t variable) {
+            switch (state[variable]) {
+            case VariableState::Basic:
+                return core::BasisStatus::Basic;
+            case VariableState::AtUpper:
+                return core::BasisStatus::AtUpper;
+            case VariableState::AtLower:
+                break;
+            }
+            return core::BasisStatus::AtLower;
+        };
+        solution.basisState.columns.resize(cols);
+        for (std::size_t j = 0; j < cols; ++j) {
+            solution.basisState.columns[j] = statusOf(j);
+        }
+        solution.basisState.rows.resize(rows);
+        for (std::size_t i = 0; i < rows; ++i) {
+            solution.basisState.rows[i] = statusOf(cols + i);
+        }
+        if (status == core::SolutionStatus::Optimal) {
+            solution.duals = duals();
+            solution.reducedCosts.resize(cols);
+            for (std::size_t j = 0; j < cols; ++j) {
+                solution.reducedCosts[j] = problem.costs[j] - columnDot(solution.duals, j);
+            }
+        }
+        return solution;
+    }
+};
+
+} // namespace
+
+Duality::Duality(Options options) : options(options) {}
+
+const Duality::Options& Duality::getOptions() const {
+    return options;
+}
+
+core::Solution<double> Duality::reoptimize(const simplex::StandardForm<double>& problem,
+                                           const core::BasisState& start) const {
+    problem.validate();
+    if (start.columns.size() > problem.cols() || start.rows.size() > problem.rows()) {
+        throw std::invalid_argument("Duality starting basis has more statuses than the problem has columns or rows");
+    }
+
+    DualSimplex dual(problem, options);
+    if (dual.crash(start)) {
+        return dual.run();
+    }
+
+    core::BasisState padded = start;
+    padded.columns.resize(problem.cols(), core::BasisStatus::AtLower);
+    padded.rows.resize(problem.rows(), core::BasisStatus::AtLower);
+    simplex::ModifiedSimplexSolver::Options primal;
+    primal.maxIterations = options.maxIterations;
+    primal.refactorizationInterval = options.refactorizationInterval;
+    primal.feasibilityTolerance = options.feasibilityTolerance;
+    primal.optimalityTolerance = options.optimalityTolerance;
+    primal.pivotTolerance = options.pivotTolerance;
+    return simplex::ModifiedSimplexSolver(primal).solve(problem, padded);
+}
+
+} // namespace limo::analysis
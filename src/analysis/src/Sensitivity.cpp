@@ -1 +1,275 @@
 #include "limo/analysis/Sensitivity.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace limo::analysis {
+
+namespace {
+
+constexpr double kInfinity = std::numeric_limits<double>::infinity();
+
+// A nonbasic value this close (relative) to its upper bound sits on it;
+// only used when the solution carries no basis statuses.
+constexpr double kOnBoundTolerance = 1e-9;
+
+std::size_t batchCount(std::size_t count, std::size_t batchSize) {
+    return (count + batchSize - 1) / batchSize;
+}
+
+} // namespace
+
+Sensitivity::Sensitivity(Options options) : options(options) {}
+
+const Sensitivity::Options& Sensitivity::getOptions() const {
+    return options;
+}
+
+Ranging Sensitivity::analyze(const simplex::StandardForm<double>& problem,
+                             const core::Solution<double>& solution) const {
+    problem.validate();
+    if (solution.status != core::SolutionStatus::Optimal) {
+        throw std::invalid_argument("Sensitivity analysis requires an optimal solution");
+    }
+    if (solution.basis.size() != problem.rows() || solution.values.size() != problem.cols()) {
+        throw std::invalid_argument("Sensitivity analysis requires a basis and values that fit the problem");
+    }
+    return Ranging(problem, solution, options);
+}
+
+Ranging::Ranging(const simplex::StandardForm<double>& problem, const core::Solution<double>& solution,
+                 const Sensitivity::Options& options)
+    : problem(&problem),
+      options(options),
+      rows(problem.rows()),
+      cols(problem.cols()),
+      basis(solution.basis),
+      positions(cols + rows, rows),
+      upperStates(cols + rows, 0),
+      upper(cols + rows, 0.0),
+      basicValues(problem.rhs),
+      duals(rows),
+      reduced(cols, 0.0) {
+    if (this->options.batchSize == 0) {
+        this->options.batchSize = 1;
+    }
+    for (std::size_t i = 0; i < rows; ++i) {
+        if (basis[i] >= cols + rows || positions[basis[i]] != rows) {
+            throw std::invalid_argument("Sensitivity analysis requires a basis of distinct variables");
+        }
+        positions[basis[i]] = i;
+    }
+    const bool hasStatuses = solution.basisState.columns.size() == cols;
+    for (std::size_t j = 0; j < cols; ++j) {
+        upper[j] = problem.hasUpperBound(j) ? *problem.upperBounds[j] : kInfinity;
+        if (isBasic(j) || upper[j] == kInfinity) {
+            continue;
+        }
+        upperStates[j] = hasStatuses ? solution.basisState.columns[j] == core::BasisStatus::AtUpper
+                                     : solution.values[j] >= upper[j] - kOnBoundTolerance * (1.0 + upper[j]);
+    }
+
+    numerics::Matrix<double> basisMatrix(rows, rows);
+    for (std::size_t i = 0; i < rows; ++i) {
+        if (basis[i] >= cols) {
+            basisMatrix(basis[i] - cols, i) = 1.0;
+            continue;
+        }
+        const auto indices = problem.constraints.column_indices(basis[i]);
+        const auto values = problem.constraints.column_values(basis[i]);
+        for (std::size_t k = 0; k < indices.size(); ++k) {
+            basisMatrix(indices[k], i) = values[k];
+        }
+    }
+    factorization.factorize(basisMatrix);
+
+    for (std::size_t i = 0; i < rows; ++i) {
+        duals[i] = basis[i] < cols ? problem.costs[basis[i]] : 0.0;
+    }
+    factorization.btran(duals);
+    for (std::size_t j = 0; j < cols; ++j) {
+        if (!isBasic(j)) {
+            reduced[j] = problem.costs[j] - columnDot(duals, j);
+        }
+        if (atUpper(j)) {
+            const auto indices = problem.constraints.column_indices(j);
+            const auto values = problem.constraints.column_values(j);
+            for (std::size_t k = 0; k < indices.size(); ++k) {
+                basicValues[indices[k]] -= values[k] * upper[j];
+            }
+        }
+    }
+    factorization.ftran(basicValues);
+}
+
+const std::vector<double>& Ranging::shadowPrices() const {
+    return duals;
+}
+
+const std::vector<double>& Ranging::reducedCosts() const {
+    return reduced;
+}
+
+double Ranging::columnDot(const std::vector<double>& y, std::size_t variable) const {
+    const auto indices = problem->constraints.column_indices(variable);
+    const auto values = problem->constraints.column_values(variable);
+    double sum = 0.0;
+    for (std::size_t k = 0; k < indices.size(); ++k) {
+        sum += values[k] * y[indices[k]];
+    }
+    return sum;
+}
+
+bool Ranging::isBasic(std::size_t variable) const {
+    return positions[variable] != rows;
+}
+
+bool Ranging::atUpper(std::size_t variable) const {
+    return upperStates[variable] != 0;
+}
+
+std::vector<Range> Ranging::costRanges() const {
+    std::vector<std::size_t> all(cols);
+    for (std::size_t j = 0; j < cols; ++j) {
+        all[j] = j;
+    }
+    return costRanges(all);
+}
+
+std::vector<Range> Ranging::costRanges(std::span<const std::size_t> columns) const {
+    std::vector<Range> ranges(columns.size());
+    // Requests for basic columns, as (index into `columns`, basis row).
+    std::vector<std::pair<std::size_t, std::size_t>> basic;
+    for (std::size_t k = 0; k < columns.size(); ++k) {
+        const std::size_t j = columns[k];
+        if (j >= cols) {
+            throw std::out_of_range("Sensitivity column index " + std::to_string(j) + " is out of range");
+        }
+        const double cost = problem->costs[j];
+        if (isBasic(j)) {
+            basic.emplace_back(k, positions[j]);
+        } else if (atUpper(j)) {
+            ranges[k] = {-kInfinity, cost - std::min(reduced[j], 0.0)};
+        } else {
+            ranges[k] = {cost - std::max(reduced[j], 0.0), kInfinity};
+        }
+    }
+
+    // Moving the cost of the basic column of row r by delta moves every
+    // reduced cost d_j by -delta * (B⁻¹A)_rj; the range ends where the first
+    // nonbasic one changes sign. A batch keeps its BTRAN'd rows interleaved
+    // (rho[i * size + t]) so one pass over A yields the whole batch's pivot rows.
+    const std::size_t batchSize = options.batchSize;
+    simplex::parallelFor(options.parallel, batchCount(basic.size(), batchSize), [&](std::size_t first,
+                                                                                   std::size_t last) {
+        std::vector<double> rho;
+        std::vector<double> unit(rows);
+        std::vector<double> alpha;
+        std::vector<double> below;
+        std::vector<double> above;
+        for (std::size_t batch = first; batch < last; ++batch) {
+            const std::size_t begin = batch * batchSize;
+            const std::size_t size = std::min(batchSize, basic.size() - begin);
+            rho.assign(rows * size, 0.0);
+            for (std::size_t t = 0; t < size; ++t) {
+                std::fill(unit.begin(), unit.end(), 0.0);
+                unit[basic[begin + t].second] = 1.0;
+                factorization.btran(unit);
+                for (std::size_t i = 0; i < rows; ++i) {
+                    rho[i * size + t] = unit[i];
+                }
+            }
+            below.assign(size, -kInfinity);
+            above.assign(size, kInfinity);
+            for (std::size_t j = 0; j < cols; ++j) {
+                if (isBasic(j) || upper[j] <= 0.0) {
+                    continue;
+                }
+                alpha.assign(size, 0.0);
+                const auto indices = problem->constraints.column_indices(j);
+                const auto values = problem->constraints.column_values(j);
+                for (std::size_t k = 0; k < indices.size(); ++k) {
+                    const double* row = &rho[indices[k] * size];
+                    for (std::size_t t = 0; t < size; ++t) {
+                        alpha[t] += values[k] * row[t];
+                    }
+                }
+                const double d = atUpper(j) ? std::min(reduced[j], 0.0) : std::max(reduced[j], 0.0);
+                for (std::size_t t = 0; t < size; ++t) {
+                    if (std::abs(alpha[t]) <= options.pivotTolerance) {
+                        continue;
+                    }
+                    // At lower d_j - delta alpha >= 0, at upper <= 0.
+                    const double ratio = d / alpha[t];
+                    if ((alpha[t] > 0.0) != atUpper(j)) {
+                        above[t] = std::min(above[t], ratio);
+                    } else {
+                        below[t] = std::max(below[t], ratio);
+                    }
+                }
+            }
+            for (std::size_t t = 0; t < size; ++t) {
+                const std::size_t k = basic[begin + t].first;
+                const double cost = problem->costs[columns[k]];
+                ranges[k] = {cost + below[t], cost + above[t]};
+            }
+        }
+    });
+    return ranges;
+}
+
+std::vector<Range> Ranging::rhsRanges() const {
+    std::vector<std::size_t> all(rows);
+    for (std::size_t i = 0; i < rows; ++i) {
+        all[i] = i;
+    }
+    return rhsRanges(all);
+}
+
+std::vector<Range> Ranging::rhsRanges(std::span<const std::size_t> requested) const {
+    for (const std::size_t row : requested) {
+        if (row >= rows) {
+            throw std::out_of_range("Sensitivity row index " + std::to_string(row) + " is out of range");
+        }
+    }
+
+    // Moving b_i by delta moves the basic values by delta * B⁻¹e_i; the
+    // range ends where the first one reaches a bound.
+    std::vector<Range> ranges(requested.size());
+    const std::size_t batchSize = options.batchSize;
+    simplex::parallelFor(options.parallel, batchCount(requested.size(), batchSize), [&](std::size_t first,
+                                                                                       std::size_t last) {
+        std::vector<double> column(rows);
+        for (std::size_t k = first * batchSize; k < std::min(last * batchSize, requested.size()); ++k) {
+            std::fill(column.begin(), column.end(), 0.0);
+            column[requested[k]] = 1.0;
+            factorization.ftran(column);
+            double below = -kInfinity;
+            double above = kInfinity;
+            for (std::size_t p = 0; p < rows; ++p) {
+                if (std::abs(column[p]) <= options.pivotTolerance) {
+                    continue;
+                }
+                const double bound = upper[basis[p]];
+                const double value = std::clamp(basicValues[p], 0.0, bound);
+                const double toLower = -value / column[p];
+                const double toUpper = (bound - value) / column[p];
+                if (column[p] > 0.0) {
+                    below = std::max(below, toLower);
+                    above = std::min(above, toUpper);
+                } else {
+                    below = std::max(below, toUpper);
+                    above = std::min(above, toLower);
+                }
+            }
+            const double rhs = problem->rhs[requested[k]];
+            ranges[k] = {rhs + below, rhs + above};
+        }
+    });
+    return ranges;
+}
+
+} // namespace limo::analysis
@@ -0,0 +1,213 @@
+#include "limo/analysis/Duality.hpp"
+#include "limo/simplex/ModifiedSimplexSolver.hpp"
+
+#include "TestProblems.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using limo::analysis::Duality;
+using limo::core::BasisState;
+using limo::core::BasisStatus;
+using limo::core::Solution;
+using limo::core::SolutionStatus;
+using limo::numerics::Matrix;
+using limo::numerics::SparseMatrix;
+using limo::simplex::ModifiedSimplexSolver;
+using limo::simplex::StandardForm;
+using limo::simplex::testing::makeProblem;
+using limo::simplex::testing::randomFeasibleProblem;
+using limo::simplex::testing::textbookProblem;
+using limo::simplex::testing::transportationProblem;
+
+namespace {
+
+// Appends the cut  aᵀx + s = rhs  with a new slack column s >= 0.
+StandardForm<double> addCut(const StandardForm<double>& problem, const std::vector<double>& a, double rhs) {
+    const std::size_t rows = problem.rows();
+    const std::size_t cols = problem.cols();
+    SparseMatrix<double>::Builder builder(rows + 1, cols + 1);
+    for (std::size_t col = 0; col < cols; ++col) {
+        const auto indices = problem.constraints.column_indices(col);
+        const auto values = problem.constraints.column_values(col);
+        for (std::size_t k = 0; k < indices.size(); ++k) {
+            builder.add(indices[k], col, values[k]);
+        }
+        if (col < a.size() && a[col] != 0.0) {
+            builder.add(rows, col, a[col]);
+        }
+    }
+    builder.add(rows, cols, 1.0);
+
+    StandardForm<double> cut{builder.build(), problem.rhs, problem.costs, problem.upperBounds};
+    cut.rhs.push_back(rhs);
+    cut.costs.push_back(0.0);
+    if (!cut.upperBounds.empty()) {
+        cut.upperBounds.emplace_back();
+    }
+    return cut;
+}
+
+void expectFeasible(const StandardForm<double>& problem, const Solution<double>& solution) {
+    const std::vector<double> activity = problem.constraints.multiply(solution.values);
+    for (std::size_t i = 0; i < problem.rows(); ++i) {
+        EXPECT_NEAR(activity[i], problem.rhs[i], 1e-7);
+    }
+    for (std::size_t j = 0; j < problem.cols(); ++j) {
+        EXPECT_GE(solution.values[j], -1e-8);
+        if (problem.hasUpperBound(j)) {
+            EXPECT_LE(solution.values[j], *problem.upperBounds[j] + 1e-8);
+        }
+    }
+}
+
+} // namespace
+
+TEST(DualityTests, ReoptimizesAfterACut) {
+    const auto problem = textbookProblem();
+    const auto before = ModifiedSimplexSolver().solve(problem);
+    ASSERT_EQ(before.status, SolutionStatus::Optimal);
+
+    // x + y <= 7 cuts off the old optimum (2, 6).
+    const auto cut = addCut(problem, {1, 1}, 7);
+    const auto after = Duality().reoptimize(cut, before.basisState);
+    ASSERT_EQ(after.status, SolutionStatus::Optimal);
+    EXPECT_NEAR(after.objective, ModifiedSimplexSolver().solve(cut).objective, 1e-9);
+    EXPECT_NEAR(after.objective, -33.0, 1e-9);
+    EXPECT_NEAR(after.values[0], 1.0, 1e-9);
+    EXPECT_NEAR(after.values[1], 6.0, 1e-9);
+    EXPECT_LE(after.iterations, 2u);
+    expectFeasible(cut, after);
+
+    // Duals satisfy d = c - Aᵀy with d >= 0 at the optimum of this bound-free problem.
+    ASSERT_EQ(after.duals.size(), 4u);
+    for (const double reducedCost : after.reducedCosts) {
+        EXPECT_GE(reducedCost, -1e-9);
+    }
+    EXPECT_EQ(after.basisState.columns.size(), 6u);
+    EXPECT_EQ(after.basisState.rows.size(), 4u);
+}
+
+TEST(DualityTests, ReoptimizesTheTransportationProblem) {
+    const auto problem = transportationProblem();
+    const auto before = ModifiedSimplexSolver().solve(problem);
+    ASSERT_EQ(before.status, SolutionStatus::Optimal);
+
+    // x23 <= 10 makes plant 1 serve 5 of market 3's demand, taken from market 2.
+    const auto cut = addCut(problem, {0, 0, 0, 0, 0, 1}, 10);
+    const auto after = Duality().reoptimize(cut, before.basisState);
+    ASSERT_EQ(after.status, SolutionStatus::Optimal);
+    EXPECT_NEAR(after.objective, 480.0, 1e-9);
+    EXPECT_NEAR(after.objective, ModifiedSimplexSolver().solve(cut).objective, 1e-9);
+    const std::vector<double> expected{0, 15, 5, 10, 10, 10};
+    for (std::size_t j = 0; j < expected.size(); ++j) {
+        EXPECT_NEAR(after.values[j], expected[j], 1e-9) << "column " << j;
+    }
+    expectFeasible(cut, after);
+
+    // Market 2 cannot be served once x22 <= 2 as well.
+    const auto infeasible = addCut(cut, {0, 0, 0, 0, 1}, 2);
+    EXPECT_EQ(Duality().reoptimize(infeasible, after.basisState).status, SolutionStatus::Infeasible);
+}
+
+TEST(DualityTests, ReoptimizesAfterTighteningBoundsWithFlips) {
+    // min -sum x_j  s.t.  sum x_j + s = 10,  0 <= x_j <= u_j: at the optimum
+    // most columns sit at their upper bound.
+    const std::size_t cols = 8;
+    Matrix<double> constraints(1, cols + 1);
+    std::vector<double> costs(cols + 1, 0.0);
+    std::vector<std::optional<double>> upper(cols + 1);
+    for (std::size_t j = 0; j < cols; ++j) {
+        constraints(0, j) = 1.0;
+        costs[j] = -1.0 - 0.1 * static_cast<double>(j);
+        upper[j] = 2.0;
+    }
+    constraints(0, cols) = 1.0;
+    auto problem = makeProblem(constraints, {10}, costs, upper);
+    const auto before = ModifiedSimplexSolver().solve(problem);
+    ASSERT_EQ(before.status, SolutionStatus::Optimal);
+
+    // Shrinking the capacity makes several columns at their upper bound
+    // flip back in one dual iteration.
+    problem.rhs[0] = 3.0;
+    const auto flipping = Duality().reoptimize(problem, before.basisState);
+    Duality::Options textbook;
+    textbook.boundFlipping = false;
+    const auto stepping = Duality(textbook).reoptimize(problem, before.basisState);
+    const auto cold = ModifiedSimplexSolver().solve(problem);
+    for (const auto& solution : {flipping, stepping}) {
+        ASSERT_EQ(solution.status, SolutionStatus::Optimal);
+        EXPECT_NEAR(solution.objective, cold.objective, 1e-9);
+        expectFeasible(problem, solution);
+    }
+    EXPECT_LT(flipping.iterations, stepping.iterations);
+}
+
+TEST(DualityTests, DetectsInfeasibleCuts) {
+    // x + y >= 20 is out of reach once x <= 4 and y <= 6.
+    const auto problem = textbookProblem();
+    const auto before = ModifiedSimplexSolver().solve(problem);
+    const auto cut = addCut(problem, {-1, -1}, -20);
+    EXPECT_EQ(Duality().reoptimize(cut, before.basisState).status, SolutionStatus::Infeasible);
+}
+
+TEST(DualityTests, FallsBackToThePrimalForDualInfeasibleStarts) {
+    // The old optimum is no longer optimal once y costs +5: the start is
+    // primal feasible but not dual feasible.
+    auto problem = textbookProblem();
+    const auto before = ModifiedSimplexSolver().solve(problem);
+    problem.costs[1] = 5.0;
+    const auto solution = Duality().reoptimize(problem, before.basisState);
+    ASSERT_EQ(solution.status, SolutionStatus::Optimal);
+    EXPECT_NEAR(solution.objective, ModifiedSimplexSolver().solve(problem).objective, 1e-9);
+
+    BasisState tooLong = before.basisState;
+    tooLong.rows.push_back(BasisStatus::Basic);
+    EXPECT_THROW(Duality().reoptimize(problem, tooLong), std::invalid_argument);
+}
+
+TEST(DualityTests, AddsCutsIncrementallyOnRandomProblems) {
+    std::mt19937 rng(31);
+    std::uniform_real_distribution<double> weight(0.0, 1.0);
+    for (int trial = 0; trial < 10; ++trial) {
+        const std::size_t cols = 20;
+        auto problem = randomFeasibleProblem(rng, 8, cols);
+        auto solution = ModifiedSimplexSolver().solve(problem);
+        ASSERT_EQ(solution.status, SolutionStatus::Optimal) << "trial " << trial;
+
+        // Each cut  wᵀx <= wᵀx* - 1  removes the current optimum x*.
+        for (int round = 0; round < 5; ++round) {
+            std::vector<double> w(cols);
+            double current = 0.0;
+            for (std::size_t c = 0; c < cols; ++c) {
+                w[c] = weight(rng);
+                current += w[c] * solution.values[c];
+            }
+            problem = addCut(problem, w, current - 1.0);
+            const auto warm = Duality().reoptimize(problem, solution.basisState);
+            const auto cold = ModifiedSimplexSolver().solve(problem);
+            ASSERT_EQ(warm.status, cold.status) << "trial " << trial << " round " << round;
+            if (cold.status != SolutionStatus::Optimal) {
+                break;
+            }
+            EXPECT_NEAR(warm.objective, cold.objective, 1e-7) << "trial " << trial << " round " << round;
+            expectFeasible(problem, warm);
+            for (std::size_t c = 0; c < problem.cols(); ++c) {
+                // Complementary slackness for the box [0, u].
+                if (warm.reducedCosts[c] > 1e-7) {
+                    EXPECT_NEAR(warm.values[c], 0.0, 1e-7);
+                } else if (warm.reducedCosts[c] < -1e-7) {
+                    ASSERT_TRUE(problem.hasUpperBound(c));
+                    EXPECT_NEAR(warm.values[c], *problem.upperBounds[c], 1e-7);
+                }
+            }
+            solution = warm;
+        }
+    }
+}
@@ -0,0 +1,203 @@
+#include "limo/analysis/Sensitivity.hpp"
+#include "limo/simplex/ModifiedSimplexSolver.hpp"
+#include "limo/simplex/SimplexSolver.hpp"
+#include "limo/thread_pool/ThreadPool.hpp"
+
+#include "TestProblems.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using limo::analysis::Range;
+using limo::analysis::Sensitivity;
+using limo::core::SolutionStatus;
+using limo::simplex::ModifiedSimplexSolver;
+using limo::simplex::SimplexSolver;
+using limo::simplex::StandardForm;
+using limo::simplex::testing::randomFeasibleProblem;
+using limo::simplex::testing::RandomProblemShape;
+using limo::simplex::testing::textbookProblem;
+using limo::simplex::testing::transportationProblem;
+using limo::thread_pool::ThreadPool;
+
+namespace {
+
+constexpr double kInfinity = std::numeric_limits<double>::infinity();
+
+// Every column in [0, 4], feasible through x̂_c = 0.5 + c % 3.
+StandardForm<double> randomProblem(std::mt19937& rng, std::size_t rows, std::size_t cols) {
+    RandomProblemShape<double> shape;
+    shape.pointOffset = 0.5;
+    return randomFeasibleProblem(rng, rows, cols, shape);
+}
+
+void expectRange(const Range& range, double lower, double upper) {
+    if (std::isinf(lower)) {
+        EXPECT_EQ(range.lower, lower);
+    } else {
+        EXPECT_NEAR(range.lower, lower, 1e-9);
+    }
+    if (std::isinf(upper)) {
+        EXPECT_EQ(range.upper, upper);
+    } else {
+        EXPECT_NEAR(range.upper, upper, 1e-9);
+    }
+}
+
+} // namespace
+
+TEST(SensitivityTests, RangesTheTextbookProblem) {
+    const auto problem = textbookProblem();
+    const auto solution = ModifiedSimplexSolver().solve(problem);
+    const auto ranging = Sensitivity().analyze(problem, solution);
+
+    const std::vector<double> expectedDuals{0.0, -1.5, -1.0};
+    for (std::size_t i = 0; i < 3; ++i) {
+        EXPECT_NEAR(ranging.shadowPrices()[i], expectedDuals[i], 1e-9);
+    }
+    EXPECT_NEAR(ranging.reducedCosts()[3], 1.5, 1e-9);
+    EXPECT_NEAR(ranging.reducedCosts()[4], 1.0, 1e-9);
+
+    // The classic ranges of max 3x + 5y, negated: profit of x in [0, 7.5],
+    // of y at least 2; plant capacities in [2, inf), [6, 18] and [12, 24].
+    const auto costs = ranging.costRanges();
+    ASSERT_EQ(costs.size(), 5u);
+    expectRange(costs[0], -7.5, 0.0);
+    expectRange(costs[1], -kInfinity, -2.0);
+    expectRange(costs[3], -1.5, kInfinity);
+    expectRange(costs[4], -1.0, kInfinity);
+    const auto rhs = ranging.rhsRanges();
+    ASSERT_EQ(rhs.size(), 3u);
+    expectRange(rhs[0], 2.0, kInfinity);
+    expectRange(rhs[1], 6.0, 18.0);
+    expectRange(rhs[2], 12.0, 24.0);
+}
+
+TEST(SensitivityTests, RangesTheTransportationProblem) {
+    const auto problem = transportationProblem();
+    const auto solution = ModifiedSimplexSolver().solve(problem);
+    const auto ranging = Sensitivity().analyze(problem, solution);
+
+    // Unused routes x11 and x13 stay unused until they are 5 and 3 cheaper;
+    // x12 stays in use as long as it costs at most 9.
+    const auto costs = ranging.costRanges();
+    ASSERT_EQ(costs.size(), 8u);
+    expectRange(costs[0], 3.0, kInfinity);
+    expectRange(costs[1], -kInfinity, 9.0);
+    expectRange(costs[2], 7.0, kInfinity);
+    expectRange(costs[6], -6.0, kInfinity);
+
+    // Plant 1 keeps shipping only to market 2 for capacities in [15, 25];
+    // plant 2 has 5 to spare.
+    const auto rhs = ranging.rhsRanges();
+    ASSERT_EQ(rhs.size(), 5u);
+    expectRange(rhs[0], 15.0, 25.0);
+    expectRange(rhs[1], 30.0, kInfinity);
+    expectRange(rhs[2], 0.0, 15.0);
+    expectRange(rhs[3], 20.0, 30.0);
+    expectRange(rhs[4], 0.0, 20.0);
+}
+
+TEST(SensitivityTests, RangesHoldUnderReSolves) {
+    std::mt19937 rng(41);
+    for (int trial = 0; trial < 10; ++trial) {
+        const auto problem = randomProblem(rng, 5, 12);
+        const auto solution = ModifiedSimplexSolver().solve(problem);
+        ASSERT_EQ(solution.status, SolutionStatus::Optimal) << "trial " << trial;
+        const auto ranging = Sensitivity().analyze(problem, solution);
+        const auto costs = ranging.costRanges();
+        const auto rhs = ranging.rhsRanges();
+
+        // Inside a cost range the old point stays optimal.
+        for (std::size_t j = 0; j < problem.cols(); ++j) {
+            for (const double end : {costs[j].lower, costs[j].upper}) {
+                if (std::isinf(end)) {
+                    continue;
+                }
+                auto moved = problem;
+                moved.costs[j] = 0.99 * end + 0.01 * problem.costs[j];
+                double old = 0.0;
+                for (std::size_t c = 0; c < problem.cols(); ++c) {
+                    old += moved.costs[c] * solution.values[c];
+                }
+                EXPECT_NEAR(ModifiedSimplexSolver().solve(moved).objective, old, 1e-7)
+                    << "trial " << trial << " column " << j;
+            }
+        }
+        // Inside an rhs range the objective moves with the shadow price.
+        for (std::size_t i = 0; i < problem.rows(); ++i) {
+            for (const double end : {rhs[i].lower, rhs[i].upper}) {
+                if (std::isinf(end)) {
+                    continue;
+                }
+                auto moved = problem;
+                moved.rhs[i] = 0.99 * end + 0.01 * problem.rhs[i];
+                const auto resolved = ModifiedSimplexSolver().solve(moved);
+                ASSERT_EQ(resolved.status, SolutionStatus::Optimal) << "trial " << trial << " row " << i;
+                const double expected = solution.objective + ranging.shadowPrices()[i] * (moved.rhs[i] - problem.rhs[i]);
+                EXPECT_NEAR(resolved.objective, expected, 1e-7) << "trial " << trial << " row " << i;
+            }
+        }
+    }
+}
+
+TEST(SensitivityTests, ParallelBatchedAndLazyRangingAgree) {
+    std::mt19937 rng(43);
+    const auto problem = randomProblem(rng, 40, 120);
+    const auto solution = ModifiedSimplexSolver().solve(problem);
+    ASSERT_EQ(solution.status, SolutionStatus::Optimal);
+    const auto sequential = Sensitivity().analyze(problem, solution);
+    const auto costs = sequential.costRanges();
+    const auto rhs = sequential.rhsRanges();
+
+    ThreadPool pool(3);
+    Sensitivity::Options options;
+    options.batchSize = 5;
+    options.parallel = {&pool, 1};
+    const auto parallel = Sensitivity(options).analyze(problem, solution);
+    const auto parallelCosts = parallel.costRanges();
+    const auto parallelRhs = parallel.rhsRanges();
+    for (std::size_t j = 0; j < problem.cols(); ++j) {
+        EXPECT_EQ(parallelCosts[j].lower, costs[j].lower);
+        EXPECT_EQ(parallelCosts[j].upper, costs[j].upper);
+    }
+    for (std::size_t i = 0; i < problem.rows(); ++i) {
+        EXPECT_EQ(parallelRhs[i].lower, rhs[i].lower);
+        EXPECT_EQ(parallelRhs[i].upper, rhs[i].upper);
+    }
+
+    const std::vector<std::size_t> columns{solution.basis[3], 7, solution.basis[0]};
+    const auto lazy = parallel.costRanges(columns);
+    ASSERT_EQ(lazy.size(), 3u);
+    for (std::size_t k = 0; k < columns.size(); ++k) {
+        EXPECT_EQ(lazy[k].lower, costs[columns[k]].lower);
+        EXPECT_EQ(lazy[k].upper, costs[columns[k]].upper);
+    }
+    const std::vector<std::size_t> rows{12};
+    EXPECT_EQ(parallel.rhsRanges(rows)[0].upper, rhs[12].upper);
+}
+
+TEST(SensitivityTests, AcceptsTableauSolutionsAndRejectsBadInput) {
+    const auto problem = textbookProblem();
+    const auto tableau = SimplexSolver<double>().solve(problem);
+    const auto ranging = Sensitivity().analyze(problem, tableau);
+    expectRange(ranging.costRanges()[0], -7.5, 0.0);
+
+    const std::vector<std::size_t> bad{5};
+    EXPECT_THROW(ranging.costRanges(bad), std::out_of_range);
+    const std::vector<std::size_t> badRow{3};
+    EXPECT_THROW(ranging.rhsRanges(badRow), std::out_of_range);
+
+    auto notOptimal = tableau;
+    notOptimal.status = SolutionStatus::IterationLimit;
+    EXPECT_THROW(Sensitivity().analyze(problem, notOptimal), std::invalid_argument);
+    auto shortBasis = tableau;
+    shortBasis.basis.pop_back();
+    EXPECT_THROW(Sensitivity().analyze(problem, shortBasis), std::invalid_argument);
+}
@@ -1,12 +1,77 @@
 #pragma once
 
-#include "limo/core/LinearProgram.hpp"
+#include "limo/numerics/SparseMatrix.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <span>
+#include <vector>
 
 namespace limo::basis {
 
+/**
+ * @brief Starting basis for phase 1 of the problem minimize cᵀx subject to
+ * Ax = b, 0 <= x <= u, as found by ArtificialBasisFinder.
+ */
+struct CrashBasis {
+    /// Marks a row whose artificial stays in the basis.
+    static constexpr std::size_t kArtificial = std::numeric_limits<std::size_t>::max();
+
+    /// Basic column of every row, or kArtificial.
+    std::vector<std::size_t> rows;
+    /// Value of the basic column of every row with all nonbasic columns at
+    /// zero; for an artificial row, the residual its artificial has to cover.
+    std::vector<double> values;
+    std::size_t slacks{0};
+    std::size_t structurals{0};
+    std::size_t artificials{0};
+};
+
+/**
+ * @brief Finds a crash basis so that phase 1 only needs artificials for the
+ * rows the problem's own columns cannot cover.
+ *
+ * First, every row that has a slack-like column singleton whose value
+ * b_i / a_ij fits its bounds takes it. The remaining rows then get a
+ * triangular crash over the other columns: repeatedly, the uncovered row
+ * with the fewest candidate columns takes its preferred one (no upper bound
+ * before boxed, sparser before denser, cheaper before dearer, as in Bixby's
+ * crash) and the row's other candidates drop out. The chosen columns are
+ * thus lower triangular on their rows, so each value follows by forward
+ * substitution the moment it is chosen; a column is only taken if that
+ * value fits its bounds and keeps every slack row's value within bounds
+ * too. Rows left without a column keep their artificial, so every column
+ * in the result is feasible.
+ */
 class ArtificialBasisFinder {
 public:
+    struct Options {
+        /// Cover rows with slack-like column singletons before anything else.
+        bool slacks{true};
+        /// Run the triangular crash over the rows the slacks leave uncovered.
+        bool triangular{true};
+        /// Smallest pivot relative to the largest entry of its column.
+        double relativePivotTolerance{0.01};
+        double feasibilityTolerance{1e-9};
+    };
+
     ArtificialBasisFinder() = default;
+    explicit ArtificialBasisFinder(Options options);
+
+    const Options& getOptions() const;
+
+    /**
+     * @brief `upperBounds` may be empty (no column has one), as in
+     * simplex::StandardForm.
+     * @throws std::invalid_argument if `constraints` is not CSC or the
+     * vectors do not match its dimensions.
+     */
+    CrashBasis find(const numerics::SparseMatrix<double>& constraints, std::span<const double> rhs,
+                    std::span<const double> costs, std::span<const std::optional<double>> upperBounds) const;
+
+private:
+    Options options;
 };
 
 } // namespace limo::basis
@@ -1 +1,196 @@
 #include "limo/basis/ArtificialBasisFinder.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <queue>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+namespace limo::basis {
+
+namespace {
+
+constexpr double kInfinity = std::numeric_limits<double>::infinity();
+
+enum class RowState : unsigned char {
+    Open,
+    Slack,
+    Triangular,
+    Artificial,
+};
+
+} // namespace
+
+ArtificialBasisFinder::ArtificialBasisFinder(Options options) : options(options) {}
+
+const ArtificialBasisFinder::Options& ArtificialBasisFinder::getOptions() const {
+    return options;
+}
+
+CrashBasis ArtificialBasisFinder::find(const numerics::SparseMatrix<double>& constraints, std::span<const double> rhs,
+                                       std::span<const double> costs,
+                                       std::span<const std::optional<double>> upperBounds) const {
+    const std::size_t rows = constraints.rows();
+    const std::size_t cols = constraints.cols();
+    if (constraints.layout() != numerics::SparseLayout::Csc) {
+        throw std::invalid_argument("ArtificialBasisFinder constraints must be stored in CSC layout");
+    }
+    if (rhs.size() != rows || costs.size() != cols || (!upperBounds.empty() && upperBounds.size() != cols)) {
+        throw std::invalid_argument("ArtificialBasisFinder vectors must match the constraint dimensions");
+    }
+    const auto upperOf = [&](std::size_t col) {
+        return upperBounds.empty() || !upperBounds[col] ? kInfinity : *upperBounds[col];
+    };
+    const auto fits = [&](double value, double upper) {
+        return value >= -options.feasibilityTolerance &&
+               value <= upper + options.feasibilityTolerance * std::max(1.0, upper);
+    };
+
+    CrashBasis basis;
+    basis.rows.assign(rows, CrashBasis::kArtificial);
+    std::vector<RowState> states(rows, RowState::Open);
+    // rhs minus the activity of the columns chosen so far; a covered row
+    // holds its column's value instead.
+    std::vector<double> residual(rhs.begin(), rhs.end());
+    // Coefficient of the slack of every slack row.
+    std::vector<double> slackCoefficients(rows, 0.0);
+
+    if (options.slacks) {
+        for (std::size_t col = 0; col < cols; ++col) {
+            const auto indices = constraints.column_indices(col);
+            if (indices.size() != 1) {
+                continue;
+            }
+            const std::size_t row = indices[0];
+            const double coefficient = constraints.column_values(col)[0];
+            if (states[row] != RowState::Open || coefficient == 0.0 || !fits(rhs[row] / coefficient, upperOf(col))) {
+                continue;
+            }
+            states[row] = RowState::Slack;
+            basis.rows[row] = col;
+            slackCoefficients[row] = coefficient;
+            ++basis.slacks;
+        }
+    }
+
+    if (options.triangular) {
+        const numerics::SparseMatrix<double> byRow = constraints.to_csr();
+        // Candidates: columns with an entry in an open row and none in a
+        // triangular row, counted per open row.
+        std::vector<char> active(cols, 0);
+        std::vector<std::size_t> counts(rows, 0);
+        for (std::size_t col = 0; col < cols; ++col) {
+            const auto indices = constraints.column_indices(col);
+            if (indices.empty() || upperOf(col) <= 0.0 || (options.slacks && indices.size() == 1 &&
+                                                           states[indices[0]] == RowState::Slack)) {
+                continue;
+            }
+            active[col] = 1;
+            for (const std::size_t row : indices) {
+                ++counts[row];
+            }
+        }
+        const auto deactivate = [&](std::size_t col, auto& queue) {
+            active[col] = 0;
+            for (const std::size_t row : constraints.column_indices(col)) {
+                --counts[row];
+                if (states[row] == RowState::Open) {
+                    queue.emplace(counts[row], row);
+                }
+            }
+        };
+        const auto preference = [&](std::size_t col) {
+            return std::make_tuple(upperOf(col) < kInfinity, constraints.column_indices(col).size(), costs[col], col);
+        };
+
+        // Open rows by candidate count; entries go stale as counts drop and
+        // are skipped when they surface.
+        using Entry = std::pair<std::size_t, std::size_t>;
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<>> queue;
+        for (std::size_t row = 0; row < rows; ++row) {
+            if (states[row] == RowState::Open) {
+                queue.emplace(counts[row], row);
+            }
+        }
+        while (!queue.empty()) {
+            const auto [count, row] = queue.top();
+            queue.pop();
+            if (states[row] != RowState::Open || count != counts[row]) {
+                continue;
+            }
+
+            // The preferred candidate of the row whose value fits its bounds,
+            // keeps the slack rows feasible and is a large enough pivot.
+            std::size_t chosen = CrashBasis::kArtificial;
+            double chosenValue = 0.0;
+            const auto rowColumns = byRow.row_indices(row);
+            const auto rowValues = byRow.row_values(row);
+            for (std::size_t k = 0; k < rowColumns.size(); ++k) {
+                const std::size_t col = rowColumns[k];
+                if (active[col] == 0 || (chosen != CrashBasis::kArtificial && preference(chosen) < preference(col))) {
+                    continue;
+                }
+                const auto indices = constraints.column_indices(col);
+                const auto values = constraints.column_values(col);
+                double largest = 0.0;
+                for (const double value : values) {
+                    largest = std::max(largest, std::abs(value));
+                }
+                const double pivot = rowValues[k];
+                if (std::abs(pivot) < options.relativePivotTolerance * largest) {
+                    continue;
+                }
+                const double value = residual[row] / pivot;
+                bool feasible = fits(value, upperOf(col));
+                for (std::size_t e = 0; e < indices.size() && feasible; ++e) {
+                    const std::size_t other = indices[e];
+                    if (states[other] == RowState::Slack) {
+                        const double slackValue = (residual[other] - values[e] * value) / slackCoefficients[other];
+                        feasible = fits(slackValue, upperOf(basis.rows[other]));
+                    }
+                }
+                if (feasible) {
+                    chosen = col;
+                    chosenValue = std::clamp(value, 0.0, upperOf(col));
+                }
+            }
+            if (chosen == CrashBasis::kArtificial) {
+                states[row] = RowState::Artificial;
+                continue;
+            }
+
+            states[row] = RowState::Triangular;
+            basis.rows[row] = chosen;
+            ++basis.structurals;
+            const auto indices = constraints.column_indices(chosen);
+            const auto values = constraints.column_values(chosen);
+            for (std::size_t e = 0; e < indices.size(); ++e) {
+                if (indices[e] != row) {
+                    residual[indices[e]] -= values[e] * chosenValue;
+                }
+            }
+            residual[row] = chosenValue;
+            // Later columns must not touch this row, which keeps the chosen
+            // columns triangular.
+            deactivate(chosen, queue);
+            for (const std::size_t col : rowColumns) {
+                if (active[col] != 0) {
+                    deactivate(col, queue);
+                }
+            }
+        }
+    }
+
+    for (std::size_t row = 0; row < rows; ++row) {
+        if (states[row] == RowState::Slack) {
+            residual[row] = std::clamp(residual[row] / slackCoefficients[row], 0.0, upperOf(basis.rows[row]));
+        }
+    }
+    basis.values = std::move(residual);
+    basis.artificials = rows - basis.slacks - basis.structurals;
+    return basis;
+}
+
+} // namespace limo::basis
@@ -0,0 +1,154 @@
+#include "limo/basis/ArtificialBasisFinder.hpp"
+
+#include "limo/numerics/LU.hpp"
+#include "limo/numerics/Matrix.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using limo::basis::ArtificialBasisFinder;
+using limo::basis::CrashBasis;
+using limo::numerics::LU;
+using limo::numerics::Matrix;
+using limo::numerics::SparseMatrix;
+
+namespace {
+
+using Bounds = std::vector<std::optional<double>>;
+
+CrashBasis find(const Matrix<double>& constraints, const std::vector<double>& rhs, const Bounds& upper = {},
+                ArtificialBasisFinder::Options options = {}) {
+    const std::vector<double> costs(constraints.cols(), 0.0);
+    return ArtificialBasisFinder(options).find(SparseMatrix<double>::from_dense(constraints), rhs, costs, upper);
+}
+
+// The basis matrix has the chosen columns and e_i for artificial rows; it
+// must be non-singular and reproduce b with the reported values.
+void expectValidBasis(const Matrix<double>& constraints, const std::vector<double>& rhs, const Bounds& upper,
+                      const CrashBasis& basis) {
+    const std::size_t rows = constraints.rows();
+    ASSERT_EQ(basis.rows.size(), rows);
+    ASSERT_EQ(basis.values.size(), rows);
+    Matrix<double> matrix(rows, rows);
+    std::size_t artificials = 0;
+    for (std::size_t i = 0; i < rows; ++i) {
+        if (basis.rows[i] == CrashBasis::kArtificial) {
+            matrix(i, i) = 1.0;
+            ++artificials;
+            continue;
+        }
+        const std::size_t col = basis.rows[i];
+        for (std::size_t r = 0; r < rows; ++r) {
+            matrix(r, i) = constraints(r, col);
+        }
+        EXPECT_GE(basis.values[i], 0.0);
+        if (!upper.empty() && upper[col]) {
+            EXPECT_LE(basis.values[i], *upper[col]);
+        }
+    }
+    EXPECT_EQ(basis.artificials, artificials);
+    EXPECT_EQ(basis.slacks + basis.structurals + basis.artificials, rows);
+    EXPECT_NO_THROW(LU<double>{matrix});
+
+    for (std::size_t r = 0; r < rows; ++r) {
+        double activity = 0.0;
+        for (std::size_t i = 0; i < rows; ++i) {
+            activity += matrix(r, i) * basis.values[i];
+        }
+        EXPECT_NEAR(activity, rhs[r], 1e-9);
+    }
+}
+
+} // namespace
+
+TEST(ArtificialBasisFinderTests, TakesSlackColumns) {
+    const Matrix<double> constraints{{1, 0, 1, 0, 0}, {0, 2, 0, 1, 0}, {3, 2, 0, 0, 1}};
+    const std::vector<double> rhs{4, 12, 18};
+    const auto basis = find(constraints, rhs);
+
+    EXPECT_EQ(basis.slacks, 3u);
+    EXPECT_EQ(basis.artificials, 0u);
+    EXPECT_EQ(basis.rows, (std::vector<std::size_t>{2, 3, 4}));
+    expectValidBasis(constraints, rhs, {}, basis);
+}
+
+TEST(ArtificialBasisFinderTests, SkipsSurplusColumnsOfPositiveRows) {
+    // x + y - s = 2 and x - y + t = 1: the surplus s would be -2, so x or y
+    // covers the first row while t covers the second.
+    const Matrix<double> constraints{{1, 1, -1, 0}, {1, -1, 0, 1}};
+    const std::vector<double> rhs{2, 1};
+    const auto basis = find(constraints, rhs);
+
+    EXPECT_EQ(basis.slacks, 1u);
+    EXPECT_EQ(basis.structurals, 1u);
+    EXPECT_EQ(basis.artificials, 0u);
+    EXPECT_EQ(basis.rows[1], 3u);
+    expectValidBasis(constraints, rhs, {}, basis);
+}
+
+TEST(ArtificialBasisFinderTests, CoversEqualityRowsTriangularly) {
+    // A chain of flow balances x0 = 3, x1 - x0 = 1, x2 - x1 = 2: triangular, no slacks.
+    const Matrix<double> constraints{{1, 0, 0}, {-1, 1, 0}, {0, -1, 1}};
+    const std::vector<double> rhs{3, 1, 2};
+    const auto basis = find(constraints, rhs);
+    EXPECT_EQ(basis.artificials, 0u);
+    expectValidBasis(constraints, rhs, {}, basis);
+
+    // Without the triangular pass only the singleton x2 is taken.
+    ArtificialBasisFinder::Options noTriangular;
+    noTriangular.triangular = false;
+    EXPECT_EQ(find(constraints, rhs, {}, noTriangular).artificials, 2u);
+}
+
+TEST(ArtificialBasisFinderTests, DropsColumnsOutsideTheirBounds) {
+    // x <= 1 cannot cover x = 5 on its own, y has no such limit.
+    const Matrix<double> constraints{{1, 1}};
+    const std::vector<double> rhs{5};
+    const Bounds upper{1.0, std::nullopt};
+    const auto basis = find(constraints, rhs, upper);
+    EXPECT_EQ(basis.rows[0], 1u);
+    expectValidBasis(constraints, rhs, upper, basis);
+
+    const Bounds tight{1.0, 2.0};
+    const auto none = find(constraints, rhs, tight);
+    EXPECT_EQ(none.artificials, 1u);
+    EXPECT_DOUBLE_EQ(none.values[0], 5.0);
+}
+
+TEST(ArtificialBasisFinderTests, FindsValidBasesForRandomProblems) {
+    std::mt19937 rng(53);
+    std::uniform_int_distribution<int> coefficient(-3, 4);
+    std::uniform_int_distribution<int> sparsity(0, 3);
+    for (int trial = 0; trial < 30; ++trial) {
+        const std::size_t rows = 12;
+        const std::size_t cols = 30;
+        Matrix<double> constraints(rows, cols);
+        std::vector<double> rhs(rows, 0.0);
+        Bounds upper(cols);
+        for (std::size_t c = 0; c < cols; ++c) {
+            if (c % 3 == 0) {
+                upper[c] = 2.0;
+            }
+            for (std::size_t r = 0; r < rows; ++r) {
+                constraints(r, c) = sparsity(rng) == 0 ? coefficient(rng) : 0.0;
+                rhs[r] += constraints(r, c);
+            }
+        }
+        const auto basis = find(constraints, rhs, upper);
+        EXPECT_LT(basis.artificials, rows) << "trial " << trial;
+        expectValidBasis(constraints, rhs, upper, basis);
+    }
+}
+
+TEST(ArtificialBasisFinderTests, RejectsMismatchedInput) {
+    const auto matrix = SparseMatrix<double>::from_dense(Matrix<double>{{1, 1}});
+    const std::vector<double> costs{0, 0};
+    EXPECT_THROW(ArtificialBasisFinder().find(matrix, std::vector<double>{1, 2}, costs, {}), std::invalid_argument);
+    EXPECT_THROW(ArtificialBasisFinder().find(matrix.to_csr(), std::vector<double>{1}, costs, {}),
+                 std::invalid_argument);
+}
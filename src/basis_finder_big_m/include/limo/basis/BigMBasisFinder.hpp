@@ -1,12 +1,67 @@
 #pragma once
 
-#include "limo/core/LinearProgram.hpp"
+#include <cstddef>
+#include <span>
+#include <vector>
 
 namespace limo::basis {
 
+/**
+ * @brief Cost big·M + real for a symbolic, arbitrarily large M.
+ *
+ * Costs compare lexicographically: the big parts decide and the real parts
+ * only break ties, which is what any large enough numeric M would give
+ * without ever forming M·a.
+ */
+template <typename T>
+struct BigMCost {
+    T big{};
+    T real{};
+};
+
+/**
+ * @brief Big-M start for minimize cᵀx subject to Ax = b, 0 <= x <= u: one
+ * artificial per row costing M, so the all-artificial basis is feasible and
+ * a single simplex pass both drives the artificials out and minimizes cᵀx.
+ *
+ * M stays symbolic. Costs are BigMCost pairs, so a tableau carries two
+ * reduced-cost rows, the big and the real parts, and prices them
+ * lexicographically. A numeric M would instead swamp cᵀx in double
+ * precision and blow up the numerators and denominators of Fraction.
+ */
 class BigMBasisFinder {
 public:
     BigMBasisFinder() = default;
+
+    /**
+     * @brief Costs of the columns followed by the artificial of every row:
+     * (0, c_j) for column j and (1, 0) for an artificial.
+     */
+    template <typename T>
+    static std::vector<BigMCost<T>> objective(std::span<const T> costs, std::size_t rows) {
+        std::vector<BigMCost<T>> result(costs.size() + rows);
+        for (std::size_t j = 0; j < costs.size(); ++j) {
+            result[j].real = costs[j];
+        }
+        for (std::size_t i = 0; i < rows; ++i) {
+            result[costs.size() + i].big = T{1};
+        }
+        return result;
+    }
+
+    /**
+     * @brief Lexicographic sign of `cost` (-1, 0 or 1): the sign of its big
+     * part, or of its real part when the big part is zero.
+     * @tparam Tolerance Comparison policy as in simplex/Tolerance.hpp.
+     */
+    template <typename Tolerance, typename T>
+    static int sign(const BigMCost<T>& cost) {
+        const T& decisive = Tolerance::isZero(cost.big) ? cost.real : cost.big;
+        if (Tolerance::isPositive(decisive)) {
+            return 1;
+        }
+        return Tolerance::isNegative(decisive) ? -1 : 0;
+    }
 };
 
 } // namespace limo::basis
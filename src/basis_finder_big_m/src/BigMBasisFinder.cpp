@@ -1 +0,0 @@
-#include "limo/basis/BigMBasisFinder.hpp"
@@ -0,0 +1,41 @@
+#include "limo/basis/BigMBasisFinder.hpp"
+
+#include "limo/numerics/Fraction.hpp"
+#include "limo/simplex/Tolerance.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using limo::basis::BigMBasisFinder;
+using limo::basis::BigMCost;
+using limo::numerics::fraction::Fraction;
+
+using Exact = limo::simplex::ExactTolerance<Fraction>;
+using Epsilon = limo::simplex::EpsilonTolerance<double>;
+
+TEST(BigMBasisFinderTests, PutsTheArtificialsAfterTheColumns) {
+    const std::vector<Fraction> costs{Fraction(-3), Fraction(1, 2)};
+    const auto objective = BigMBasisFinder::objective<Fraction>(costs, 3);
+    ASSERT_EQ(objective.size(), 5u);
+    EXPECT_EQ(objective[0].big, Fraction(0));
+    EXPECT_EQ(objective[0].real, Fraction(-3));
+    EXPECT_EQ(objective[1].real, Fraction(1, 2));
+    for (std::size_t k = 2; k < 5; ++k) {
+        EXPECT_EQ(objective[k].big, Fraction(1));
+        EXPECT_EQ(objective[k].real, Fraction(0));
+    }
+}
+
+TEST(BigMBasisFinderTests, ComparesLexicographically) {
+    // The M part decides however large the real part is.
+    EXPECT_EQ((BigMBasisFinder::sign<Exact>(BigMCost<Fraction>{Fraction(1, 1000), Fraction(-1000000)})), 1);
+    EXPECT_EQ((BigMBasisFinder::sign<Exact>(BigMCost<Fraction>{Fraction(-1), Fraction(5)})), -1);
+    EXPECT_EQ((BigMBasisFinder::sign<Exact>(BigMCost<Fraction>{Fraction(0), Fraction(-2, 3)})), -1);
+    EXPECT_EQ((BigMBasisFinder::sign<Exact>(BigMCost<Fraction>{})), 0);
+
+    // Under a tolerance, an M part within epsilon of zero defers to the real one.
+    EXPECT_EQ(BigMBasisFinder::sign<Epsilon>(BigMCost<double>{1e-12, 2.0}), 1);
+    EXPECT_EQ(BigMBasisFinder::sign<Epsilon>(BigMCost<double>{-1e-6, 2.0}), -1);
+    EXPECT_EQ(BigMBasisFinder::sign<Epsilon>(BigMCost<double>{0.0, 1e-12}), 0);
+}
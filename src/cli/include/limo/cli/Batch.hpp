@@ -0,0 +1,158 @@
+#pragma once
+
+#include "limo/core/LinearProgram.hpp"
+#include "limo/core/Solution.hpp"
+#include "limo/io/ModelReader.hpp"
+#include "limo/presolve/Presolve.hpp"
+
+#include <condition_variable>
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace limo::cli {
+
+enum class SolverKind {
+    Revised,
+    Tableau,
+};
+
+/**
+ * @brief Solves `program` single-threaded through its standard form and maps
+ * the solution back onto its columns and rows.
+ */
+core::Solution<double> solveProgram(const core::LinearProgram& program, SolverKind solver);
+
+/**
+ * @brief Presolves `program`, solves what is left with solveProgram and
+ * postsolves the result; `stats` receives what presolve did.
+ */
+core::Solution<double> solvePresolved(const core::LinearProgram& program, SolverKind solver,
+                                      presolve::PresolveStats& stats);
+
+struct BatchOptions {
+    /// A directory (searched recursively) or a manifest file listing one model per line.
+    std::filesystem::path input;
+    io::ModelFormat format{io::ModelFormat::Auto};
+    SolverKind solver{SolverKind::Revised};
+    bool presolve{true};
+    std::size_t threads{std::thread::hardware_concurrency()};
+    /// Most models read but not yet reported at any time; 0 means the thread count.
+    std::size_t maxInFlight{0};
+    /// Most model file bytes read but not yet reported at any time. A model
+    /// larger than this still runs, alone.
+    std::size_t memoryBudget{std::size_t{1} << 30};
+};
+
+struct BatchSummary {
+    std::size_t models{0};
+    std::size_t optimal{0};
+    std::size_t failed{0};
+    double seconds{0.0};
+};
+
+/**
+ * @brief A model file of a batch and its size, which orders and throttles it.
+ */
+struct BatchModel {
+    std::filesystem::path path;
+    std::size_t bytes{0};
+};
+
+/**
+ * @brief Models named by a directory or manifest, largest file first and
+ * by path among equal sizes.
+ *
+ * A directory contributes every .mps, .lp, .mps.gz and .lp.gz file below it.
+ * A manifest lists one path per line, relative to the manifest's directory;
+ * blank lines and lines starting with '#' are skipped. Listed files that do
+ * not exist have size 0 and are reported when the batch reaches them.
+ *
+ * @throws std::runtime_error if `input` does not exist or cannot be read.
+ */
+std::vector<BatchModel> modelsBySize(const std::filesystem::path& input);
+
+/**
+ * @brief Admission control for a batch: at most `maxModels` models and
+ * `maxBytes` bytes of model files are in flight at once.
+ *
+ * An empty batch always admits, so a model larger than `maxBytes` runs
+ * alone instead of never.
+ */
+class Throttle {
+public:
+    Throttle(std::size_t maxModels, std::size_t maxBytes);
+
+    /**
+     * @brief Blocks until a model of `bytes` fits, then admits it.
+     */
+    void acquire(std::size_t bytes);
+
+    /**
+     * @brief Admits a model of `bytes` if it fits right now.
+     */
+    bool tryAcquire(std::size_t bytes);
+
+    /**
+     * @brief Ends a model admitted with `bytes` and wakes the waiters.
+     */
+    void release(std::size_t bytes);
+
+    /**
+     * @brief Blocks until no model is in flight.
+     */
+    void waitIdle();
+
+    std::size_t inFlight() const;
+
+private:
+    bool fits(std::size_t bytes) const;
+
+    const std::size_t maxModels;
+    const std::size_t maxBytes;
+    mutable std::mutex mutex;
+    std::condition_variable released;
+    std::size_t models{0};
+    std::size_t bytes{0};
+};
+
+/**
+ * @brief Appends `text` to `out` as a JSON string literal, escaping quotes,
+ * backslashes and control characters.
+ */
+void appendJsonString(std::string& out, std::string_view text);
+
+/**
+ * @brief Calls `run` on every model from up to `threads` worker loops on a
+ * thread pool, starting the models strictly in list order.
+ *
+ * A worker takes the next model of the list and waits in `throttle` for it
+ * before another worker may take one, so a small model never overtakes a
+ * larger one that is waiting for budget; the model is released once `run`
+ * returns. Once `run` throws, no worker starts another model; models
+ * already running finish, and the first exception is rethrown.
+ */
+void dispatchModels(const std::vector<BatchModel>& models, std::size_t threads, Throttle& throttle,
+                    const std::function<void(const BatchModel&)>& run);
+
+/**
+ * @brief Reads and solves every model of `options.input` on a thread pool,
+ * writing one JSON object per model to `results` as soon as it is done.
+ *
+ * Models are started largest first through dispatchModels() so the long
+ * solves do not trail at the end. No model starts while maxInFlight models
+ * or memoryBudget bytes are outstanding, so at most that many parsed models
+ * are alive at once however long the list is. Failures to read or solve
+ * a model are reported on its line and do not stop the batch.
+ *
+ * @throws std::runtime_error if `options.input` does not exist or cannot be read.
+ */
+BatchSummary runBatch(const BatchOptions& options, std::ostream& results);
+
+} // namespace limo::cli
@@ -0,0 +1,319 @@
+#include "limo/cli/Batch.hpp"
+
+#include "limo/simplex/Conversion.hpp"
+#include "limo/simplex/ModifiedSimplexSolver.hpp"
+#include "limo/simplex/SimplexSolver.hpp"
+#include "limo/thread_pool/ThreadPool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+namespace limo::cli {
+
+namespace {
+
+bool isModelFile(const std::filesystem::path& path) {
+    std::string name = path.filename().string();
+    std::transform(name.begin(), name.end(), name.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    for (const std::string_view suffix : {".mps", ".lp", ".mps.gz", ".lp.gz"}) {
+        if (name.size() > suffix.size() && name.ends_with(suffix)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::size_t fileSize(const std::filesystem::path& path) {
+    std::error_code error;
+    const std::uintmax_t size = std::filesystem::file_size(path, error);
+    return error ? 0 : static_cast<std::size_t>(size);
+}
+
+// Shortest round-tripping representation; JSON has no infinities or NaN.
+void appendNumber(std::string& out, double value) {
+    if (!std::isfinite(value)) {
+        out += "null";
+        return;
+    }
+    char buffer[32];
+    const auto [end, error] = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    out.append(buffer, error == std::errc() ? end : buffer);
+}
+
+void appendField(std::string& out, std::string_view key) {
+    out += ',';
+    appendJsonString(out, key);
+    out += ':';
+}
+
+double millisecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// The JSON line of one model; also flags whether it was solved to optimality
+// or could not be read or solved at all.
+std::string solveModel(const BatchModel& model, const BatchOptions& options, bool& optimal, bool& failed) {
+    std::string line = "{\"model\":";
+    appendJsonString(line, model.path.string());
+    try {
+        const auto readStart = std::chrono::steady_clock::now();
+        const core::LinearProgram program = io::readModel(model.path, options.format);
+        const double readMs = millisecondsSince(readStart);
+        const auto solveStart = std::chrono::steady_clock::now();
+        presolve::PresolveStats stats;
+        const core::Solution<double> solution = options.presolve ? solvePresolved(program, options.solver, stats)
+                                                                 : solveProgram(program, options.solver);
+        const double solveMs = millisecondsSince(solveStart);
+
+        optimal = solution.isOptimal();
+        appendField(line, "status");
+        appendJsonString(line, core::toString(solution.status));
+        appendField(line, "objective");
+        appendNumber(line, optimal ? solution.objective : std::nan(""));
+        appendField(line, "iterations");
+        line += std::to_string(solution.iterations);
+        appendField(line, "rows");
+        line += std::to_string(program.rows());
+        appendField(line, "cols");
+        line += std::to_string(program.cols());
+        appendField(line, "nonzeros");
+        line += std::to_string(program.nonZeros());
+        if (options.presolve) {
+            appendField(line, "presolved_rows");
+            line += std::to_string(stats.rowsAfter);
+            appendField(line, "presolved_cols");
+            line += std::to_string(stats.colsAfter);
+            appendField(line, "presolved_nonzeros");
+            line += std::to_string(stats.nonZerosAfter);
+        }
+        appendField(line, "read_ms");
+        appendNumber(line, readMs);
+        if (options.presolve) {
+            appendField(line, "presolve_ms");
+            appendNumber(line, stats.seconds * 1e3);
+        }
+        appendField(line, "solve_ms");
+        appendNumber(line, solveMs);
+    } catch (const std::exception& error) {
+        failed = true;
+        appendField(line, "status");
+        appendJsonString(line, "error");
+        appendField(line, "error");
+        appendJsonString(line, error.what());
+    }
+    line += "}\n";
+    return line;
+}
+
+} // namespace
+
+core::Solution<double> solveProgram(const core::LinearProgram& program, SolverKind solver) {
+    const simplex::ConvertedProgram converted = simplex::toStandardForm(program);
+    if (solver == SolverKind::Tableau) {
+        return converted.recover(simplex::SimplexSolver<double>().solve(converted.form()));
+    }
+    return converted.recover(simplex::ModifiedSimplexSolver().solve(converted.form()));
+}
+
+core::Solution<double> solvePresolved(const core::LinearProgram& program, SolverKind solver,
+                                      presolve::PresolveStats& stats) {
+    const presolve::PresolveResult result = presolve::Presolver().presolve(program);
+    stats = result.stats();
+    if (result.status() != core::SolutionStatus::NotSolved) {
+        return result.postsolve({});
+    }
+    if (result.reduced().cols() == 0) {
+        return result.solveEmpty();
+    }
+    return result.postsolve(solveProgram(result.reduced(), solver));
+}
+
+std::vector<BatchModel> modelsBySize(const std::filesystem::path& input) {
+    if (!std::filesystem::exists(input)) {
+        throw std::runtime_error("'" + input.string() + "' does not exist");
+    }
+    std::vector<BatchModel> models;
+    if (std::filesystem::is_directory(input)) {
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(input)) {
+            if (entry.is_regular_file() && isModelFile(entry.path())) {
+                models.push_back({entry.path(), static_cast<std::size_t>(entry.file_size())});
+            }
+        }
+    } else {
+        std::ifstream manifest(input);
+        if (!manifest) {
+            throw std::runtime_error("cannot open '" + input.string() + "'");
+        }
+        const std::filesystem::path base = input.parent_path();
+        std::string line;
+        while (std::getline(manifest, line)) {
+            const auto first = line.find_first_not_of(" \t\r");
+            if (first == std::string::npos || line[first] == '#') {
+                continue;
+            }
+            const auto last = line.find_last_not_of(" \t\r");
+            std::filesystem::path path = line.substr(first, last - first + 1);
+            if (path.is_relative()) {
+                path = base / path;
+            }
+            // Missing files sort last and are reported when their turn comes.
+            models.push_back({path, fileSize(path)});
+        }
+    }
+    std::stable_sort(models.begin(), models.end(), [](const BatchModel& left, const BatchModel& right) {
+        return left.bytes != right.bytes ? left.bytes > right.bytes : left.path < right.path;
+    });
+    return models;
+}
+
+Throttle::Throttle(std::size_t maxModels, std::size_t maxBytes) : maxModels(maxModels), maxBytes(maxBytes) {}
+
+void Throttle::acquire(std::size_t bytes) {
+    std::unique_lock lock(mutex);
+    released.wait(lock, [&] { return fits(bytes); });
+    ++models;
+    this->bytes += bytes;
+}
+
+bool Throttle::tryAcquire(std::size_t bytes) {
+    const std::lock_guard lock(mutex);
+    if (!fits(bytes)) {
+        return false;
+    }
+    ++models;
+    this->bytes += bytes;
+    return true;
+}
+
+void Throttle::release(std::size_t bytes) {
+    {
+        const std::lock_guard lock(mutex);
+        --models;
+        this->bytes -= bytes;
+    }
+    released.notify_all();
+}
+
+void Throttle::waitIdle() {
+    std::unique_lock lock(mutex);
+    released.wait(lock, [&] { return models == 0; });
+}
+
+std::size_t Throttle::inFlight() const {
+    const std::lock_guard lock(mutex);
+    return models;
+}
+
+bool Throttle::fits(std::size_t bytes) const {
+    return models == 0 || (models < maxModels && this->bytes + bytes <= maxBytes);
+}
+
+void appendJsonString(std::string& out, std::string_view text) {
+    out += '"';
+    for (const char c : text) {
+        switch (c) {
+        case '"':
+            out += "\\\"";
+            break;
+        case '\\':
+            out += "\\\\";
+            break;
+        case '\n':
+            out += "\\n";
+            break;
+        case '\t':
+            out += "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                static constexpr char kHex[] = "0123456789abcdef";
+                out += "\\u00";
+                out += kHex[(c >> 4) & 0xf];
+                out += kHex[c & 0xf];
+            } else {
+                out += c;
+            }
+        }
+    }
+    out += '"';
+}
+
+void dispatchModels(const std::vector<BatchModel>& models, std::size_t threads, Throttle& throttle,
+                    const std::function<void(const BatchModel&)>& run) {
+    const std::size_t workers = std::min(std::max<std::size_t>(threads, 1), models.size());
+    if (workers == 0) {
+        return;
+    }
+    // Taking the next index and admitting its model happen under one lock;
+    // the pool's own queues are LIFO per worker and would reorder posts.
+    // A failure is flagged before its model is released, so a worker that
+    // was waiting in the throttle sees it once admitted and backs out.
+    std::mutex admission;
+    std::size_t next = 0;
+    std::atomic<bool> failed{false};
+    thread_pool::ThreadPool pool(workers);
+    pool.submitBatch(workers, [&](std::size_t) {
+        while (true) {
+            const BatchModel* model = nullptr;
+            {
+                const std::lock_guard lock(admission);
+                if (failed || next == models.size()) {
+                    return;
+                }
+                model = &models[next++];
+                throttle.acquire(model->bytes);
+                if (failed) {
+                    throttle.release(model->bytes);
+                    return;
+                }
+            }
+            try {
+                run(*model);
+            } catch (...) {
+                failed = true;
+                throttle.release(model->bytes);
+                throw;
+            }
+            throttle.release(model->bytes);
+        }
+    });
+}
+
+BatchSummary runBatch(const BatchOptions& options, std::ostream& results) {
+    const auto start = std::chrono::steady_clock::now();
+    const std::vector<BatchModel> models = modelsBySize(options.input);
+    const std::size_t threads = std::max<std::size_t>(options.threads, 1);
+
+    BatchSummary summary;
+    summary.models = models.size();
+    std::mutex outputMutex;
+    Throttle throttle(options.maxInFlight != 0 ? options.maxInFlight : threads, options.memoryBudget);
+    dispatchModels(models, threads, throttle, [&](const BatchModel& model) {
+        bool optimal = false;
+        bool failed = false;
+        const std::string line = solveModel(model, options, optimal, failed);
+        const std::lock_guard lock(outputMutex);
+        results << line << std::flush;
+        summary.optimal += optimal ? 1 : 0;
+        summary.failed += failed ? 1 : 0;
+    });
+    summary.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return summary;
+}
+
+} // namespace limo::cli
@@ -1,9 +1,266 @@
+#include "limo/cli/Batch.hpp"
+
+#include "limo/io/ModelReader.hpp"
+#include "limo/numerics/Matrix.hpp"
+#include "limo/thread_pool/Stats.hpp"
+#include "limo/thread_pool/ThreadPool.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <filesystem>
 #include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+
+namespace {
+
+void printUsage(std::ostream& out) {
+    out << "usage: limo <command> [options]\n"
+        << "\n"
+        << "commands:\n"
+        << "  read <model> [--format auto|mps|fixed-mps|lp]\n"
+        << "      Parses an MPS or LP file, optionally gzip-compressed, and reports its\n"
+        << "      size and the parse throughput.\n"
+        << "  solve <model> [--format auto|mps|fixed-mps|lp] [--solver revised|tableau] [--no-presolve]\n"
+        << "      Reads a model, presolves it unless told not to, and solves it.\n"
+        << "  batch <directory|manifest> [--threads N] [--max-in-flight N] [--memory-mb N]\n"
+        << "        [--format auto|mps|fixed-mps|lp] [--solver revised|tableau] [--no-presolve]\n"
+        << "      Solves every model of a directory, or listed in a manifest, concurrently,\n"
+        << "      largest first, printing one JSON line per model as it finishes.\n"
+        << "  pool-stats [--threads N] [--size N]\n"
+        << "      Runs pooled N x N matrix products and dumps the thread pool's stats\n"
+        << "      (meaningful in builds configured with -DLIMO_THREAD_POOL_STATS=ON).\n";
+}
+
+std::size_t parseCount(std::string_view option, const char* value) {
+    if (value == nullptr) {
+        throw std::invalid_argument(std::string(option) + " needs a value");
+    }
+    std::size_t parsed = 0;
+    const unsigned long long number = std::stoull(value, &parsed);
+    if (parsed != std::string_view(value).size() || number == 0) {
+        throw std::invalid_argument(std::string(option) + " expects a positive integer, got '" + value + "'");
+    }
+    return static_cast<std::size_t>(number);
+}
+
+limo::io::ModelFormat parseFormat(const char* value) {
+    using limo::io::ModelFormat;
+    if (value == nullptr) {
+        throw std::invalid_argument("--format needs a value");
+    }
+    for (const ModelFormat format : {ModelFormat::Auto, ModelFormat::FreeMps, ModelFormat::FixedMps, ModelFormat::Lp}) {
+        if (std::string_view(value) == limo::io::toString(format)) {
+            return format;
+        }
+    }
+    throw std::invalid_argument(std::string("unknown format '") + value + "'");
+}
+
+limo::cli::SolverKind parseSolver(const char* value) {
+    if (value == nullptr) {
+        throw std::invalid_argument("--solver needs a value");
+    }
+    const std::string_view name = value;
+    if (name == "revised") {
+        return limo::cli::SolverKind::Revised;
+    }
+    if (name == "tableau") {
+        return limo::cli::SolverKind::Tableau;
+    }
+    throw std::invalid_argument("unknown solver '" + std::string(name) + "'");
+}
+
+double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+struct LoadedModel {
+    limo::core::LinearProgram program;
+    double seconds;
+};
+
+LoadedModel loadModel(const std::filesystem::path& path, limo::io::ModelFormat format) {
+    const auto start = std::chrono::steady_clock::now();
+    limo::core::LinearProgram program = limo::io::readModel(path, format);
+    return {std::move(program), secondsSince(start)};
+}
+
+int runRead(int argc, char** argv) {
+    const char* path = nullptr;
+    limo::io::ModelFormat format = limo::io::ModelFormat::Auto;
+    for (int i = 2; i < argc; ++i) {
+        const std::string_view option = argv[i];
+        if (option == "--format") {
+            format = parseFormat(i + 1 < argc ? argv[++i] : nullptr);
+        } else if (path == nullptr && !option.starts_with("--")) {
+            path = argv[i];
+        } else {
+            throw std::invalid_argument("unknown option '" + std::string(option) + "'");
+        }
+    }
+    if (path == nullptr) {
+        throw std::invalid_argument("expected a model file");
+    }
+
+    const LoadedModel model = loadModel(path, format);
+    const auto bytes = static_cast<double>(std::filesystem::file_size(path));
+    const limo::core::LinearProgram& program = model.program;
+    std::cout << "name:      " << (program.name().empty() ? "-" : program.name()) << '\n'
+              << "sense:     " << limo::core::toString(program.sense()) << '\n'
+              << "rows:      " << program.rows() << '\n'
+              << "columns:   " << program.cols() << '\n'
+              << "non-zeros: " << program.nonZeros() << '\n'
+              << "file:      " << bytes / 1e6 << " MB\n"
+              << "parse:     " << model.seconds * 1e3 << " ms (" << bytes / 1e6 / model.seconds << " MB/s)\n";
+    return 0;
+}
+
+int runSolve(int argc, char** argv) {
+    const char* path = nullptr;
+    limo::io::ModelFormat format = limo::io::ModelFormat::Auto;
+    limo::cli::SolverKind solver = limo::cli::SolverKind::Revised;
+    bool presolve = true;
+    for (int i = 2; i < argc; ++i) {
+        const std::string_view option = argv[i];
+        if (option == "--format") {
+            format = parseFormat(i + 1 < argc ? argv[++i] : nullptr);
+        } else if (option == "--solver") {
+            solver = parseSolver(i + 1 < argc ? argv[++i] : nullptr);
+        } else if (option == "--no-presolve") {
+            presolve = false;
+        } else if (path == nullptr && !option.starts_with("--")) {
+            path = argv[i];
+        } else {
+            throw std::invalid_argument("unknown option '" + std::string(option) + "'");
+        }
+    }
+    if (path == nullptr) {
+        throw std::invalid_argument("expected a model file");
+    }
+
+    const LoadedModel model = loadModel(path, format);
+    const auto start = std::chrono::steady_clock::now();
+    limo::presolve::PresolveStats stats;
+    const limo::core::Solution<double> solution = presolve ? limo::cli::solvePresolved(model.program, solver, stats)
+                                                           : limo::cli::solveProgram(model.program, solver);
+    const double seconds = secondsSince(start);
+
+    if (presolve) {
+        limo::presolve::writeReport(std::cout, stats);
+    }
+    std::cout << "status:     " << limo::core::toString(solution.status) << '\n';
+    if (solution.isOptimal()) {
+        std::cout << "objective:  " << solution.objective << '\n';
+    }
+    std::cout << "iterations: " << solution.iterations << '\n'
+              << "read:       " << model.seconds * 1e3 << " ms\n"
+              << "solve:      " << seconds * 1e3 << " ms\n";
+    return solution.isOptimal() ? 0 : 2;
+}
+
+int runBatch(int argc, char** argv) {
+    limo::cli::BatchOptions options;
+    bool hasInput = false;
+    for (int i = 2; i < argc; ++i) {
+        const std::string_view option = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        if (option == "--threads") {
+            options.threads = parseCount(option, value);
+        } else if (option == "--max-in-flight") {
+            options.maxInFlight = parseCount(option, value);
+        } else if (option == "--memory-mb") {
+            options.memoryBudget = parseCount(option, value) << 20;
+        } else if (option == "--format") {
+            options.format = parseFormat(value);
+        } else if (option == "--solver") {
+            options.solver = parseSolver(value);
+        } else if (option == "--no-presolve") {
+            options.presolve = false;
+            continue;
+        } else if (!hasInput && !option.starts_with("--")) {
+            options.input = argv[i];
+            hasInput = true;
+            continue;
+        } else {
+            throw std::invalid_argument("unknown option '" + std::string(option) + "'");
+        }
+        ++i;
+    }
+    if (!hasInput) {
+        throw std::invalid_argument("expected a directory or manifest");
+    }
+
+    const limo::cli::BatchSummary summary = limo::cli::runBatch(options, std::cout);
+    std::cerr << "limo batch: " << summary.models << " models, " << summary.optimal << " optimal, " << summary.failed
+              << " failed in " << summary.seconds << " s\n";
+    return summary.failed == 0 ? 0 : 2;
+}
+
+int runPoolStats(int argc, char** argv) {
+    std::size_t threads = std::thread::hardware_concurrency();
+    std::size_t size = 384;
+    for (int i = 2; i < argc; ++i) {
+        const std::string_view option = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        if (option == "--threads") {
+            threads = parseCount(option, value);
+        } else if (option == "--size") {
+            size = parseCount(option, value);
+        } else {
+            throw std::invalid_argument("unknown option '" + std::string(option) + "'");
+        }
+        ++i;
+    }
+
+    limo::thread_pool::ThreadPool pool(threads);
+    const limo::numerics::Matrix<double> left(size, size, 1.0);
+    const limo::numerics::Matrix<double> right(size, size, 0.5);
+    for (int round = 0; round < 3; ++round) {
+        static_cast<void>(left.multiply(right, pool));
+    }
+    pool.shutdown();
+    limo::thread_pool::writeStats(std::cout, pool.stats());
+    return 0;
+}
+
+} // namespace
 
 /**
  * @brief Entry point for the LIMO CLI.
  */
-int main() {
-    std::cout << "Hello from cli!" << std::endl;
-    return 0;
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        printUsage(std::cerr);
+        return 1;
+    }
+    const std::string_view command = argv[1];
+    try {
+        if (command == "read") {
+            return runRead(argc, argv);
+        }
+        if (command == "solve") {
+            return runSolve(argc, argv);
+        }
+        if (command == "batch") {
+            return runBatch(argc, argv);
+        }
+        if (command == "pool-stats") {
+            return runPoolStats(argc, argv);
+        }
+        if (command == "help" || command == "--help" || command == "-h") {
+            printUsage(std::cout);
+            return 0;
+        }
+    } catch (const std::exception& error) {
+        std::cerr << "limo " << command << ": " << error.what() << '\n';
+        return 1;
+    }
+    std::cerr << "limo: unknown command '" << command << "'\n";
+    printUsage(std::cerr);
+    return 1;
 }
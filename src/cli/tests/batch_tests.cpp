@@ -0,0 +1,257 @@
+#include "limo/cli/Batch.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using limo::cli::appendJsonString;
+using limo::cli::BatchModel;
+using limo::cli::BatchOptions;
+using limo::cli::dispatchModels;
+using limo::cli::modelsBySize;
+using limo::cli::runBatch;
+using limo::cli::Throttle;
+
+namespace {
+
+// max 3x + 5y  s.t.  x <= 4,  2y <= 12,  3x + 2y <= 18
+const char* kTextbookLp = R"(Maximize
+ profit: 3 x + 5 y
+Subject To
+ plant1: x <= 4
+ plant2: 2 y <= 12
+ plant3: 3 x + 2 y <= 18
+End
+)";
+
+// x >= 2 with x <= 1.
+const char* kInfeasibleLp = R"(Minimize
+ cost: x
+Subject To
+ low: x >= 2
+Bounds
+ x <= 1
+End
+)";
+
+// A fresh, empty directory below the system temporary directory.
+std::filesystem::path temporaryDirectory(const std::string& name) {
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / name;
+    std::filesystem::remove_all(path);
+    std::filesystem::create_directories(path);
+    return path;
+}
+
+void writeFile(const std::filesystem::path& path, const std::string& contents) {
+    std::filesystem::create_directories(path.parent_path());
+    std::ofstream(path, std::ios::binary) << contents;
+}
+
+std::vector<std::string> filenames(const std::vector<BatchModel>& models) {
+    std::vector<std::string> names;
+    for (const BatchModel& model : models) {
+        names.push_back(model.path.filename().string());
+    }
+    return names;
+}
+
+} // namespace
+
+TEST(BatchTests, CollectsModelFilesBelowADirectoryLargestFirst) {
+    const auto directory = temporaryDirectory("limo_cli_batch_directory");
+    writeFile(directory / "small.lp", std::string(10, ' '));
+    writeFile(directory / "nested" / "large.MPS", std::string(300, ' '));
+    writeFile(directory / "nested" / "deeper" / "medium.mps.gz", std::string(200, ' '));
+    writeFile(directory / "tie_b.lp", std::string(50, ' '));
+    writeFile(directory / "tie_a.lp.gz", std::string(50, ' '));
+    writeFile(directory / "notes.txt", std::string(1000, ' '));
+    writeFile(directory / ".mps", std::string(1000, ' '));
+
+    const auto models = modelsBySize(directory);
+    EXPECT_EQ(filenames(models),
+              (std::vector<std::string>{"large.MPS", "medium.mps.gz", "tie_a.lp.gz", "tie_b.lp", "small.lp"}));
+    EXPECT_EQ(models[0].bytes, 300u);
+    EXPECT_EQ(models[4].bytes, 10u);
+    std::filesystem::remove_all(directory);
+}
+
+TEST(BatchTests, ReadsManifestsRelativeToTheirDirectory) {
+    const auto directory = temporaryDirectory("limo_cli_batch_manifest");
+    writeFile(directory / "models" / "a.lp", std::string(20, ' '));
+    writeFile(directory / "models" / "b.mps", std::string(40, ' '));
+    const auto absolute = directory / "elsewhere.lp";
+    writeFile(absolute, std::string(30, ' '));
+    writeFile(directory / "manifest.txt", "# models of the nightly run\n"
+                                          "\n"
+                                          "models/a.lp\n"
+                                          "  models/b.mps \t\r\n"
+                                          "   # indented comment\n"
+                                          "missing.lp\n" +
+                                              absolute.string() + "\n");
+
+    const auto models = modelsBySize(directory / "manifest.txt");
+    ASSERT_EQ(models.size(), 4u);
+    EXPECT_EQ(models[0].path, directory / "models" / "b.mps");
+    EXPECT_EQ(models[1].path, absolute);
+    EXPECT_EQ(models[2].path, directory / "models" / "a.lp");
+    // Missing files sort last and fail when their turn comes.
+    EXPECT_EQ(models[3].path, directory / "missing.lp");
+    EXPECT_EQ(models[3].bytes, 0u);
+
+    EXPECT_THROW(modelsBySize(directory / "no_such_manifest.txt"), std::runtime_error);
+    std::filesystem::remove_all(directory);
+}
+
+TEST(BatchTests, ThrottleLimitsModelsAndBytes) {
+    Throttle throttle(2, 100);
+    EXPECT_TRUE(throttle.tryAcquire(60));
+    EXPECT_FALSE(throttle.tryAcquire(50));
+    EXPECT_TRUE(throttle.tryAcquire(40));
+    EXPECT_FALSE(throttle.tryAcquire(0));
+    EXPECT_EQ(throttle.inFlight(), 2u);
+
+    throttle.release(60);
+    EXPECT_TRUE(throttle.tryAcquire(60));
+    throttle.release(60);
+    throttle.release(40);
+    EXPECT_EQ(throttle.inFlight(), 0u);
+
+    // A model over the byte budget still runs, alone.
+    EXPECT_TRUE(throttle.tryAcquire(500));
+    EXPECT_FALSE(throttle.tryAcquire(1));
+    throttle.release(500);
+}
+
+TEST(BatchTests, ThrottleBlocksUntilAModelIsReleased) {
+    Throttle throttle(1, 100);
+    throttle.acquire(10);
+    std::thread waiter([&] {
+        throttle.acquire(10);
+        throttle.release(10);
+    });
+    throttle.release(10);
+    waiter.join();
+    throttle.waitIdle();
+    EXPECT_EQ(throttle.inFlight(), 0u);
+}
+
+TEST(BatchTests, EscapesJsonStrings) {
+    std::string out;
+    appendJsonString(out, "C:\\models\\\"a\"\n\tb\x01\x1f");
+    EXPECT_EQ(out, R"("C:\\models\\\"a\"\n\tb\u0001\u001f")");
+
+    out = "[";
+    appendJsonString(out, "");
+    appendJsonString(out, "plain ü");
+    EXPECT_EQ(out, "[\"\"\"plain ü\"");
+}
+
+TEST(BatchTests, StartsModelsInListOrder) {
+    std::vector<BatchModel> models;
+    for (std::size_t k = 0; k < 64; ++k) {
+        models.push_back({"model" + std::to_string(k), 1000 - k});
+    }
+    std::vector<std::size_t> expected(models.size());
+    for (std::size_t k = 0; k < expected.size(); ++k) {
+        expected[k] = k;
+    }
+
+    // One worker, no throttling: every model is queued at once and must
+    // still start first in, first out. With one model in flight, three
+    // workers start them in order too.
+    for (const auto& [threads, maxModels] : {std::pair<std::size_t, std::size_t>{1, 1000}, {3, 1}}) {
+        Throttle throttle(maxModels, std::size_t{1} << 20);
+        std::mutex mutex;
+        std::vector<std::size_t> started;
+        dispatchModels(models, threads, throttle, [&](const BatchModel& model) {
+            const std::lock_guard lock(mutex);
+            started.push_back(static_cast<std::size_t>(&model - models.data()));
+        });
+        EXPECT_EQ(started, expected) << threads << " threads";
+        EXPECT_EQ(throttle.inFlight(), 0u);
+    }
+}
+
+TEST(BatchTests, DispatchRunsEveryModelOnceAndStopsOnErrors) {
+    std::vector<BatchModel> models(200, BatchModel{"model", 10});
+    Throttle throttle(6, 35);
+    std::mutex mutex;
+    std::vector<std::size_t> runs(models.size(), 0);
+    dispatchModels(models, 4, throttle, [&](const BatchModel& model) {
+        EXPECT_LE(throttle.inFlight(), 3u);
+        const std::lock_guard lock(mutex);
+        ++runs[static_cast<std::size_t>(&model - models.data())];
+    });
+    EXPECT_EQ(runs, std::vector<std::size_t>(models.size(), 1));
+
+    // With one model in flight, model 5 is the last to start however many
+    // workers are waiting for the next one; it gives them time to queue up.
+    for (std::size_t threads : {1u, 3u}) {
+        Throttle serial(1, 1000);
+        std::atomic<std::size_t> after{0};
+        EXPECT_THROW(dispatchModels(models, threads, serial,
+                                    [&](const BatchModel& model) {
+                                        if (&model == &models[5]) {
+                                            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                                            throw std::runtime_error("model 5");
+                                        }
+                                        after += &model > &models[5] ? 1 : 0;
+                                    }),
+                     std::runtime_error);
+        EXPECT_EQ(after.load(), 0u) << threads << " threads";
+        EXPECT_EQ(serial.inFlight(), 0u);
+    }
+}
+
+TEST(BatchTests, ReportsEveryModelOnItsOwnLine) {
+    const auto directory = temporaryDirectory("limo_cli_batch_run");
+    writeFile(directory / "textbook.lp", kTextbookLp);
+    writeFile(directory / "infeasible.lp", kInfeasibleLp);
+    writeFile(directory / "broken.mps", "NAME broken\nROWS\n Q  row\nENDATA\n");
+
+    for (const bool presolve : {true, false}) {
+        BatchOptions options;
+        options.input = directory;
+        options.threads = 2;
+        options.presolve = presolve;
+        std::ostringstream results;
+        const auto summary = runBatch(options, results);
+        EXPECT_EQ(summary.models, 3u);
+        EXPECT_EQ(summary.optimal, 1u);
+        EXPECT_EQ(summary.failed, 1u);
+
+        std::istringstream lines(results.str());
+        std::string line;
+        std::size_t count = 0;
+        while (std::getline(lines, line)) {
+            ++count;
+            EXPECT_EQ(line.front(), '{');
+            EXPECT_EQ(line.back(), '}');
+            if (line.find("textbook.lp") != std::string::npos) {
+                EXPECT_NE(line.find(R"("status":"optimal","objective":36,)"), std::string::npos) << line;
+            } else if (line.find("infeasible.lp") != std::string::npos) {
+                EXPECT_NE(line.find(R"("status":"infeasible")"), std::string::npos) << line;
+            } else {
+                EXPECT_NE(line.find(R"("status":"error","error":)"), std::string::npos) << line;
+            }
+        }
+        EXPECT_EQ(count, 3u);
+    }
+
+    BatchOptions missing;
+    missing.input = directory / "nowhere";
+    std::ostringstream results;
+    EXPECT_THROW(runBatch(missing, results), std::runtime_error);
+    std::filesystem::remove_all(directory);
+}
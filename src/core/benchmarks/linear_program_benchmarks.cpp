@@ -0,0 +1,71 @@
+#include "limo/core/LinearProgramBuilder.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using limo::core::kInfinity;
+using limo::core::LinearProgram;
+using limo::core::LinearProgramBuilder;
+using limo::core::RowSense;
+
+namespace {
+
+constexpr std::size_t kEntriesPerColumn = 10;
+
+// range(0): non-zeros. Column by column, as an MPS reader feeds the builder.
+void BM_BuildColumnWise(benchmark::State& state) {
+    const auto nonZeros = static_cast<std::size_t>(state.range(0));
+    const std::size_t cols = nonZeros / kEntriesPerColumn;
+    const std::size_t rows = cols / 4;
+    std::vector<std::size_t> indices(kEntriesPerColumn);
+    std::vector<double> values(kEntriesPerColumn, 1.5);
+    for (auto _ : state) {
+        LinearProgramBuilder builder;
+        builder.reserve(rows, cols, nonZeros);
+        for (std::size_t row = 0; row < rows; ++row) {
+            builder.addRow(RowSense::LessEqual, 1.0);
+        }
+        for (std::size_t col = 0; col < cols; ++col) {
+            for (std::size_t k = 0; k < kEntriesPerColumn; ++k) {
+                indices[k] = k * (rows / kEntriesPerColumn) + col % (rows / kEntriesPerColumn);
+            }
+            builder.addColumn(1.0, 0.0, kInfinity, indices, values);
+        }
+        LinearProgram program = builder.build();
+        benchmark::DoNotOptimize(program.rowStarts().data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(nonZeros));
+}
+
+// range(0): non-zeros. Row by row, as an LP-format reader feeds the builder.
+void BM_BuildRowWise(benchmark::State& state) {
+    const auto nonZeros = static_cast<std::size_t>(state.range(0));
+    const std::size_t rows = nonZeros / kEntriesPerColumn;
+    const std::size_t cols = rows * 4;
+    std::vector<std::size_t> indices(kEntriesPerColumn);
+    std::vector<double> values(kEntriesPerColumn, 1.5);
+    for (auto _ : state) {
+        LinearProgramBuilder builder;
+        builder.reserve(rows, cols, nonZeros);
+        for (std::size_t col = 0; col < cols; ++col) {
+            builder.addColumn(1.0);
+        }
+        for (std::size_t row = 0; row < rows; ++row) {
+            for (std::size_t k = 0; k < kEntriesPerColumn; ++k) {
+                indices[k] = (row * 7 + k * (cols / kEntriesPerColumn)) % cols;
+            }
+            builder.addRow(RowSense::GreaterEqual, 1.0, indices, values);
+        }
+        LinearProgram program = builder.build();
+        benchmark::DoNotOptimize(program.columnStarts().data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(nonZeros));
+}
+
+} // namespace
+
+BENCHMARK(BM_BuildColumnWise)->RangeMultiplier(10)->Range(10000, 1000000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_BuildRowWise)->RangeMultiplier(10)->Range(10000, 1000000)->Unit(benchmark::kMillisecond);
@@ -1,8 +1,158 @@
 #pragma once
 
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
 namespace limo::core {
 
-struct LinearProgram {
+/// Value of a missing bound.
+inline constexpr double kInfinity = std::numeric_limits<double>::infinity();
+
+enum class ObjectiveSense {
+    Minimize,
+    Maximize,
+};
+
+/**
+ * @brief Relation between a row's activity aᵢx and its right-hand side bᵢ.
+ *
+ * A ranged row is bᵢ <= aᵢx <= bᵢ + rᵢ with its range rᵢ >= 0.
+ */
+enum class RowSense {
+    LessEqual,
+    GreaterEqual,
+    Equal,
+    Ranged,
+};
+
+const char* toString(ObjectiveSense sense);
+const char* toString(RowSense sense);
+
+/**
+ * @brief Non-zeros of one row or column: parallel index and value arrays.
+ */
+struct SparseVectorView {
+    std::span<const std::size_t> indices;
+    std::span<const double> values;
+
+    std::size_t size() const { return indices.size(); }
+};
+
+/**
+ * @brief Names of rows or columns packed into one character buffer.
+ */
+class NameTable {
+public:
+    std::size_t size() const { return ends.size(); }
+    /// Name of entry i; empty when it was added without one.
+    std::string_view operator[](std::size_t i) const;
+
+    void reserve(std::size_t count, std::size_t characterCount);
+    void push(std::string_view name);
+
+private:
+    std::string characters;
+    std::vector<std::size_t> ends;
+};
+
+/**
+ * @brief A linear program as loaded from a model file or assembled in code:
+ *
+ *     minimize (or maximize)  cᵀx + c₀
+ *     subject to              aᵢx (<=, >=, =) bᵢ  for every row i,
+ *                             l <= x <= u
+ *
+ * Stored as a structure of arrays: one contiguous array per attribute, and
+ * the constraint matrix both column-major (CSC) and row-major (CSR), so
+ * that column() and row() are zero-copy views. Indices within a column and
+ * within a row are strictly increasing; explicit zeros are not stored.
+ *
+ * Instances are immutable and produced by LinearProgramBuilder. Missing
+ * bounds are ±kInfinity.
+ */
+class LinearProgram {
+public:
+    LinearProgram() = default;
+
+    std::size_t rows() const { return rhs_.size(); }
+    std::size_t cols() const { return objective_.size(); }
+    std::size_t nonZeros() const { return values_.size(); }
+
+    const std::string& name() const { return name_; }
+    ObjectiveSense sense() const { return sense_; }
+    double objectiveOffset() const { return objectiveOffset_; }
+
+    std::span<const double> objective() const { return objective_; }
+    std::span<const double> columnLower() const { return columnLower_; }
+    std::span<const double> columnUpper() const { return columnUpper_; }
+
+    std::span<const RowSense> rowSenses() const { return rowSenses_; }
+    std::span<const double> rhs() const { return rhs_; }
+    /// Range of every row; only meaningful for RowSense::Ranged rows, zero elsewhere.
+    std::span<const double> rowRanges() const { return rowRanges_; }
+
+    /**
+     * @brief Raw CSC arrays: column j's entries are at [columnStarts()[j], columnStarts()[j + 1]).
+     */
+    std::span<const std::size_t> columnStarts() const { return columnStarts_; }
+    std::span<const std::size_t> rowIndices() const { return rowIndices_; }
+    std::span<const double> values() const { return values_; }
+
+    /**
+     * @brief Raw CSR arrays: row i's entries are at [rowStarts()[i], rowStarts()[i + 1]).
+     */
+    std::span<const std::size_t> rowStarts() const { return rowStarts_; }
+    std::span<const std::size_t> columnIndices() const { return columnIndices_; }
+    std::span<const double> rowValues() const { return rowValues_; }
+
+    /**
+     * @throws std::out_of_range if the column does not exist.
+     */
+    SparseVectorView column(std::size_t col) const;
+
+    /**
+     * @throws std::out_of_range if the row does not exist.
+     */
+    SparseVectorView row(std::size_t row) const;
+
+    const NameTable& rowNames() const { return rowNames_; }
+    const NameTable& columnNames() const { return columnNames_; }
+
+    /**
+     * @brief Lower and upper limit of row i's activity implied by its sense, rhs and range.
+     */
+    double rowLower(std::size_t row) const;
+    double rowUpper(std::size_t row) const;
+
+private:
+    friend class LinearProgramBuilder;
+
+    std::string name_;
+    ObjectiveSense sense_{ObjectiveSense::Minimize};
+    double objectiveOffset_{0.0};
+
+    std::vector<double> objective_;
+    std::vector<double> columnLower_;
+    std::vector<double> columnUpper_;
+
+    std::vector<RowSense> rowSenses_;
+    std::vector<double> rhs_;
+    std::vector<double> rowRanges_;
+
+    std::vector<std::size_t> columnStarts_{0};
+    std::vector<std::size_t> rowIndices_;
+    std::vector<double> values_;
+
+    std::vector<std::size_t> rowStarts_{0};
+    std::vector<std::size_t> columnIndices_;
+    std::vector<double> rowValues_;
+
+    NameTable rowNames_;
+    NameTable columnNames_;
 };
 
 } // namespace limo::core
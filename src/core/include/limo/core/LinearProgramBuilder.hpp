@@ -0,0 +1,135 @@
+#pragma once
+
+#include "limo/core/LinearProgram.hpp"
+
+#include <cstddef>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace limo::core {
+
+/**
+ * @brief Assembles a LinearProgram row by row, column by column, or entry by entry.
+ *
+ * Non-zeros are appended to flat coordinate arrays and only compressed by
+ * build(): one counting pass into CSC and one transpose into CSR, O(nnz +
+ * rows + cols). With reserve() sized to the model nothing allocates per
+ * entry, and a model built column by column with increasing row indices
+ * (the order of an MPS file) skips the sort entirely.
+ *
+ * Zero coefficients are dropped when added. Adding the same (row, col)
+ * twice is an error reported by build().
+ */
+class LinearProgramBuilder {
+public:
+    LinearProgramBuilder() = default;
+
+    /**
+     * @brief Capacity hints; exceeding them is allowed, it only costs reallocations.
+     */
+    void reserve(std::size_t rows, std::size_t cols, std::size_t nonZeros);
+
+    void setName(std::string name);
+    void setSense(ObjectiveSense sense);
+    void setObjectiveOffset(double offset);
+
+    std::size_t rows() const { return rowSenses.size(); }
+    std::size_t cols() const { return objective.size(); }
+    std::size_t nonZeros() const { return entryValues.size(); }
+
+    /**
+     * @brief Adds an empty row and returns its index.
+     */
+    std::size_t addRow(RowSense sense, double rhs, std::string_view name = {});
+
+    /**
+     * @brief Adds a row with coefficients on existing columns and returns its index.
+     *
+     * All entries are checked first; if any is rejected, nothing is added.
+     * @throws std::invalid_argument if the spans differ in length, a value is not
+     *         finite, or a column is listed twice with nonzero values.
+     * @throws std::out_of_range if a column does not exist.
+     */
+    std::size_t addRow(RowSense sense, double rhs, std::span<const std::size_t> cols,
+                       std::span<const double> values, std::string_view name = {});
+
+    /**
+     * @brief Adds a column without coefficients and returns its index.
+     * @throws std::invalid_argument if lower > upper or a bound is NaN.
+     */
+    std::size_t addColumn(double cost, double lower = 0.0, double upper = kInfinity, std::string_view name = {});
+
+    /**
+     * @brief Adds a column with coefficients in existing rows and returns its index.
+     *
+     * All entries are checked first; if any is rejected, nothing is added.
+     * @throws std::invalid_argument if the spans differ in length, lower > upper, a
+     *         value is not finite, or a row is listed twice with nonzero values.
+     * @throws std::out_of_range if a row does not exist.
+     */
+    std::size_t addColumn(double cost, double lower, double upper, std::span<const std::size_t> rows,
+                          std::span<const double> values, std::string_view name = {});
+
+    /**
+     * @throws std::out_of_range if the row or column does not exist.
+     */
+    void addEntry(std::size_t row, std::size_t col, double value);
+
+    /**
+     * @throws std::out_of_range if the column does not exist.
+     */
+    void setCost(std::size_t col, double cost);
+
+    /**
+     * @throws std::out_of_range if the column does not exist.
+     * @throws std::invalid_argument if lower > upper or a bound is NaN.
+     */
+    void setBounds(std::size_t col, double lower, double upper);
+
+    /**
+     * @throws std::out_of_range if the row does not exist.
+     */
+    void setRhs(std::size_t row, double rhs);
+
+    /**
+     * @brief Makes row i ranged: rhs <= aᵢx <= rhs + range.
+     * @throws std::out_of_range if the row does not exist.
+     * @throws std::invalid_argument if the range is negative or NaN.
+     */
+    void setRowRange(std::size_t row, double range);
+
+    /**
+     * @brief Compresses the entries and hands everything over; the builder is
+     * empty afterwards, also when this throws.
+     * @throws std::invalid_argument if a (row, col) position was given more than once.
+     */
+    LinearProgram build();
+
+private:
+    LinearProgram compress();
+    void checkRow(std::size_t row) const;
+    void checkColumn(std::size_t col) const;
+
+    std::string name;
+    ObjectiveSense sense{ObjectiveSense::Minimize};
+    double objectiveOffset{0.0};
+
+    std::vector<double> objective;
+    std::vector<double> columnLower;
+    std::vector<double> columnUpper;
+    NameTable columnNames;
+
+    std::vector<RowSense> rowSenses;
+    std::vector<double> rhs;
+    std::vector<double> rowRanges;
+    NameTable rowNames;
+
+    // Coordinate form of the non-zeros, in insertion order.
+    std::vector<std::size_t> entryRows;
+    std::vector<std::size_t> entryCols;
+    std::vector<double> entryValues;
+};
+
+} // namespace limo::core
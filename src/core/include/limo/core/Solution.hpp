@@ -1,8 +1,77 @@
 #pragma once
 
+#include <cstddef>
+#include <vector>
+
 namespace limo::core {
 
+/**
+ * @brief Outcome of a solve.
+ */
+enum class SolutionStatus {
+    NotSolved,
+    Optimal,
+    Infeasible,
+    Unbounded,
+    IterationLimit,
+};
+
+const char* toString(SolutionStatus status);
+
+/**
+ * @brief Position of a column, or of a row's logical variable, relative to a basis.
+ *
+ * For a row, AtLower and AtUpper mean its activity sits at its lower or
+ * upper limit (equality rows report AtLower) and Basic means the row is
+ * not tight, i.e. its logical is basic.
+ */
+enum class BasisStatus {
+    Basic,
+    AtLower,
+    AtUpper,
+};
+
+const char* toString(BasisStatus status);
+
+/**
+ * @brief Basis status of every column and row: what a solve ends with, and
+ * what a warm start begins from.
+ */
+struct BasisState {
+    std::vector<BasisStatus> columns;
+    std::vector<BasisStatus> rows;
+
+    bool empty() const { return columns.empty() && rows.empty(); }
+};
+
+/**
+ * @brief Result of a simplex solve.
+ *
+ * Columns are indexed as in the solved problem. Basis entries below the
+ * column count name structural columns; an entry cols + i names the
+ * logical (slack or artificial) variable of row i, which stays basic only
+ * for redundant rows.
+ *
+ * @tparam T Scalar type of the solver that produced the solution.
+ */
+template <typename T = double>
 struct Solution {
+    SolutionStatus status{SolutionStatus::NotSolved};
+    T objective{};
+    /// Primal value of every column.
+    std::vector<T> values;
+    /// Simplex multiplier (shadow price) of every row.
+    std::vector<T> duals;
+    /// Reduced cost of every column.
+    std::vector<T> reducedCosts;
+    /// Basic variable of every row.
+    std::vector<std::size_t> basis;
+    /// Final basis status of every column and row; pass it to a solver to
+    /// warm-start a re-solve of the same or a slightly changed problem.
+    BasisState basisState;
+    std::size_t iterations{0};
+
+    bool isOptimal() const { return status == SolutionStatus::Optimal; }
 };
 
 } // namespace limo::core
@@ -1 +1,91 @@
 #include "limo/core/LinearProgram.hpp"
+
+#include <stdexcept>
+
+namespace limo::core {
+
+const char* toString(ObjectiveSense sense) {
+    switch (sense) {
+    case ObjectiveSense::Minimize:
+        return "minimize";
+    case ObjectiveSense::Maximize:
+        return "maximize";
+    }
+    return "unknown";
+}
+
+const char* toString(RowSense sense) {
+    switch (sense) {
+    case RowSense::LessEqual:
+        return "<=";
+    case RowSense::GreaterEqual:
+        return ">=";
+    case RowSense::Equal:
+        return "=";
+    case RowSense::Ranged:
+        return "ranged";
+    }
+    return "unknown";
+}
+
+std::string_view NameTable::operator[](std::size_t i) const {
+    const std::size_t begin = i == 0 ? 0 : ends[i - 1];
+    return std::string_view(characters).substr(begin, ends[i] - begin);
+}
+
+void NameTable::reserve(std::size_t count, std::size_t characterCount) {
+    ends.reserve(count);
+    characters.reserve(characterCount);
+}
+
+void NameTable::push(std::string_view name) {
+    characters.append(name);
+    ends.push_back(characters.size());
+}
+
+SparseVectorView LinearProgram::column(std::size_t col) const {
+    if (col >= cols()) {
+        throw std::out_of_range("LinearProgram column index out of range");
+    }
+    const std::size_t begin = columnStarts_[col];
+    const std::size_t count = columnStarts_[col + 1] - begin;
+    return {std::span<const std::size_t>(rowIndices_).subspan(begin, count),
+            std::span<const double>(values_).subspan(begin, count)};
+}
+
+SparseVectorView LinearProgram::row(std::size_t row) const {
+    if (row >= rows()) {
+        throw std::out_of_range("LinearProgram row index out of range");
+    }
+    const std::size_t begin = rowStarts_[row];
+    const std::size_t count = rowStarts_[row + 1] - begin;
+    return {std::span<const std::size_t>(columnIndices_).subspan(begin, count),
+            std::span<const double>(rowValues_).subspan(begin, count)};
+}
+
+double LinearProgram::rowLower(std::size_t row) const {
+    switch (rowSenses_[row]) {
+    case RowSense::LessEqual:
+        return -kInfinity;
+    case RowSense::GreaterEqual:
+    case RowSense::Equal:
+    case RowSense::Ranged:
+        return rhs_[row];
+    }
+    return -kInfinity;
+}
+
+double LinearProgram::rowUpper(std::size_t row) const {
+    switch (rowSenses_[row]) {
+    case RowSense::GreaterEqual:
+        return kInfinity;
+    case RowSense::LessEqual:
+    case RowSense::Equal:
+        return rhs_[row];
+    case RowSense::Ranged:
+        return rhs_[row] + rowRanges_[row];
+    }
+    return kInfinity;
+}
+
+} // namespace limo::core
@@ -0,0 +1,277 @@
+#include "limo/core/LinearProgramBuilder.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace limo::core {
+
+namespace {
+
+void checkBounds(double lower, double upper) {
+    if (std::isnan(lower) || std::isnan(upper)) {
+        throw std::invalid_argument("LinearProgramBuilder bounds must not be NaN");
+    }
+    if (lower > upper) {
+        throw std::invalid_argument("LinearProgramBuilder lower bound exceeds upper bound");
+    }
+}
+
+void checkCoefficient(double value) {
+    if (!std::isfinite(value)) {
+        throw std::invalid_argument("LinearProgramBuilder coefficients must be finite");
+    }
+}
+
+// Rejects an index listed twice with nonzero values, which build() would
+// refuse anyway; checked before anything is added so a failed call leaves
+// the builder unchanged.
+void checkDistinct(std::span<const std::size_t> indices, std::span<const double> values, const char* what) {
+    std::vector<std::size_t> stored;
+    stored.reserve(indices.size());
+    for (std::size_t k = 0; k < indices.size(); ++k) {
+        if (values[k] != 0.0) {
+            stored.push_back(indices[k]);
+        }
+    }
+    std::sort(stored.begin(), stored.end());
+    if (std::adjacent_find(stored.begin(), stored.end()) != stored.end()) {
+        throw std::invalid_argument(std::string("LinearProgramBuilder ") + what + " lists an index twice");
+    }
+}
+
+// Sorts the entries [begin, end) of one compressed column by row index.
+void sortSegment(std::vector<std::size_t>& indices, std::vector<double>& values, std::size_t begin, std::size_t end,
+                 std::vector<std::pair<std::size_t, double>>& scratch) {
+    scratch.clear();
+    for (std::size_t k = begin; k < end; ++k) {
+        scratch.emplace_back(indices[k], values[k]);
+    }
+    std::sort(scratch.begin(), scratch.end(),
+              [](const auto& left, const auto& right) { return left.first < right.first; });
+    for (std::size_t k = begin; k < end; ++k) {
+        indices[k] = scratch[k - begin].first;
+        values[k] = scratch[k - begin].second;
+    }
+}
+
+} // namespace
+
+void LinearProgramBuilder::reserve(std::size_t rowCount, std::size_t colCount, std::size_t nonZeroCount) {
+    objective.reserve(colCount);
+    columnLower.reserve(colCount);
+    columnUpper.reserve(colCount);
+    rowSenses.reserve(rowCount);
+    rhs.reserve(rowCount);
+    rowRanges.reserve(rowCount);
+    columnNames.reserve(colCount, 0);
+    rowNames.reserve(rowCount, 0);
+    entryRows.reserve(nonZeroCount);
+    entryCols.reserve(nonZeroCount);
+    entryValues.reserve(nonZeroCount);
+}
+
+void LinearProgramBuilder::setName(std::string modelName) {
+    name = std::move(modelName);
+}
+
+void LinearProgramBuilder::setSense(ObjectiveSense objectiveSense) {
+    sense = objectiveSense;
+}
+
+void LinearProgramBuilder::setObjectiveOffset(double offset) {
+    objectiveOffset = offset;
+}
+
+std::size_t LinearProgramBuilder::addRow(RowSense rowSense, double rowRhs, std::string_view rowName) {
+    rowSenses.push_back(rowSense);
+    rhs.push_back(rowRhs);
+    rowRanges.push_back(0.0);
+    rowNames.push(rowName);
+    return rowSenses.size() - 1;
+}
+
+std::size_t LinearProgramBuilder::addRow(RowSense rowSense, double rowRhs, std::span<const std::size_t> cols,
+                                         std::span<const double> values, std::string_view rowName) {
+    if (cols.size() != values.size()) {
+        throw std::invalid_argument("LinearProgramBuilder row indices and values differ in length");
+    }
+    for (std::size_t k = 0; k < cols.size(); ++k) {
+        checkColumn(cols[k]);
+        checkCoefficient(values[k]);
+    }
+    checkDistinct(cols, values, "row");
+    const std::size_t row = addRow(rowSense, rowRhs, rowName);
+    for (std::size_t k = 0; k < cols.size(); ++k) {
+        addEntry(row, cols[k], values[k]);
+    }
+    return row;
+}
+
+std::size_t LinearProgramBuilder::addColumn(double cost, double lower, double upper, std::string_view colName) {
+    checkBounds(lower, upper);
+    objective.push_back(cost);
+    columnLower.push_back(lower);
+    columnUpper.push_back(upper);
+    columnNames.push(colName);
+    return objective.size() - 1;
+}
+
+std::size_t LinearProgramBuilder::addColumn(double cost, double lower, double upper, std::span<const std::size_t> rows,
+                                            std::span<const double> values, std::string_view colName) {
+    if (rows.size() != values.size()) {
+        throw std::invalid_argument("LinearProgramBuilder column indices and values differ in length");
+    }
+    checkBounds(lower, upper);
+    for (std::size_t k = 0; k < rows.size(); ++k) {
+        checkRow(rows[k]);
+        checkCoefficient(values[k]);
+    }
+    checkDistinct(rows, values, "column");
+    const std::size_t col = addColumn(cost, lower, upper, colName);
+    for (std::size_t k = 0; k < rows.size(); ++k) {
+        addEntry(rows[k], col, values[k]);
+    }
+    return col;
+}
+
+void LinearProgramBuilder::addEntry(std::size_t row, std::size_t col, double value) {
+    checkRow(row);
+    checkColumn(col);
+    checkCoefficient(value);
+    if (value == 0.0) {
+        return;
+    }
+    entryRows.push_back(row);
+    entryCols.push_back(col);
+    entryValues.push_back(value);
+}
+
+void LinearProgramBuilder::setCost(std::size_t col, double cost) {
+    checkColumn(col);
+    objective[col] = cost;
+}
+
+void LinearProgramBuilder::setBounds(std::size_t col, double lower, double upper) {
+    checkColumn(col);
+    checkBounds(lower, upper);
+    columnLower[col] = lower;
+    columnUpper[col] = upper;
+}
+
+void LinearProgramBuilder::setRhs(std::size_t row, double rowRhs) {
+    checkRow(row);
+    rhs[row] = rowRhs;
+}
+
+void LinearProgramBuilder::setRowRange(std::size_t row, double range) {
+    checkRow(row);
+    if (!(range >= 0.0)) {
+        throw std::invalid_argument("LinearProgramBuilder row ranges must be non-negative");
+    }
+    rowSenses[row] = RowSense::Ranged;
+    rowRanges[row] = range;
+}
+
+LinearProgram LinearProgramBuilder::build() {
+    // Whatever happens below, the builder starts over afterwards.
+    LinearProgramBuilder source = std::move(*this);
+    *this = LinearProgramBuilder();
+    return source.compress();
+}
+
+LinearProgram LinearProgramBuilder::compress() {
+    const std::size_t rowCount = rows();
+    const std::size_t colCount = cols();
+    const std::size_t nonZeroCount = nonZeros();
+
+    LinearProgram program;
+    program.name_ = std::move(name);
+    program.sense_ = sense;
+    program.objectiveOffset_ = objectiveOffset;
+    program.objective_ = std::move(objective);
+    program.columnLower_ = std::move(columnLower);
+    program.columnUpper_ = std::move(columnUpper);
+    program.rowSenses_ = std::move(rowSenses);
+    program.rhs_ = std::move(rhs);
+    program.rowRanges_ = std::move(rowRanges);
+    program.rowNames_ = std::move(rowNames);
+    program.columnNames_ = std::move(columnNames);
+
+    // CSC: count per column, then either adopt the coordinate arrays as they
+    // are (entries already grouped by column) or scatter them stably.
+    std::vector<std::size_t>& columnStarts = program.columnStarts_;
+    columnStarts.assign(colCount + 1, 0);
+    for (std::size_t col : entryCols) {
+        ++columnStarts[col + 1];
+    }
+    for (std::size_t col = 0; col < colCount; ++col) {
+        columnStarts[col + 1] += columnStarts[col];
+    }
+    if (std::is_sorted(entryCols.begin(), entryCols.end())) {
+        program.rowIndices_ = std::move(entryRows);
+        program.values_ = std::move(entryValues);
+    } else {
+        program.rowIndices_.resize(nonZeroCount);
+        program.values_.resize(nonZeroCount);
+        std::vector<std::size_t> next(columnStarts.begin(), columnStarts.end() - 1);
+        for (std::size_t k = 0; k < nonZeroCount; ++k) {
+            const std::size_t position = next[entryCols[k]]++;
+            program.rowIndices_[position] = entryRows[k];
+            program.values_[position] = entryValues[k];
+        }
+    }
+
+    std::vector<std::pair<std::size_t, double>> scratch;
+    for (std::size_t col = 0; col < colCount; ++col) {
+        const std::size_t begin = columnStarts[col];
+        const std::size_t end = columnStarts[col + 1];
+        const auto first = program.rowIndices_.begin() + static_cast<std::ptrdiff_t>(begin);
+        const auto last = program.rowIndices_.begin() + static_cast<std::ptrdiff_t>(end);
+        if (!std::is_sorted(first, last)) {
+            sortSegment(program.rowIndices_, program.values_, begin, end, scratch);
+        }
+        if (std::adjacent_find(first, last) != last) {
+            throw std::invalid_argument("LinearProgramBuilder entry given twice in column " + std::to_string(col));
+        }
+    }
+
+    // CSR by transposing the CSC arrays; walking columns in order leaves
+    // the column indices of every row sorted.
+    std::vector<std::size_t>& rowStarts = program.rowStarts_;
+    rowStarts.assign(rowCount + 1, 0);
+    for (std::size_t row : program.rowIndices_) {
+        ++rowStarts[row + 1];
+    }
+    for (std::size_t row = 0; row < rowCount; ++row) {
+        rowStarts[row + 1] += rowStarts[row];
+    }
+    program.columnIndices_.resize(nonZeroCount);
+    program.rowValues_.resize(nonZeroCount);
+    std::vector<std::size_t> next(rowStarts.begin(), rowStarts.end() - 1);
+    for (std::size_t col = 0; col < colCount; ++col) {
+        for (std::size_t k = columnStarts[col]; k < columnStarts[col + 1]; ++k) {
+            const std::size_t position = next[program.rowIndices_[k]]++;
+            program.columnIndices_[position] = col;
+            program.rowValues_[position] = program.values_[k];
+        }
+    }
+
+    return program;
+}
+
+void LinearProgramBuilder::checkRow(std::size_t row) const {
+    if (row >= rows()) {
+        throw std::out_of_range("LinearProgramBuilder row index out of range");
+    }
+}
+
+void LinearProgramBuilder::checkColumn(std::size_t col) const {
+    if (col >= cols()) {
+        throw std::out_of_range("LinearProgramBuilder column index out of range");
+    }
+}
+
+} // namespace limo::core
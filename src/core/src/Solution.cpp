@@ -1 +1,33 @@
 #include "limo/core/Solution.hpp"
+
+namespace limo::core {
+
+const char* toString(SolutionStatus status) {
+    switch (status) {
+    case SolutionStatus::NotSolved:
+        return "not solved";
+    case SolutionStatus::Optimal:
+        return "optimal";
+    case SolutionStatus::Infeasible:
+        return "infeasible";
+    case SolutionStatus::Unbounded:
+        return "unbounded";
+    case SolutionStatus::IterationLimit:
+        return "iteration limit";
+    }
+    return "unknown";
+}
+
+const char* toString(BasisStatus status) {
+    switch (status) {
+    case BasisStatus::Basic:
+        return "basic";
+    case BasisStatus::AtLower:
+        return "at lower";
+    case BasisStatus::AtUpper:
+        return "at upper";
+    }
+    return "unknown";
+}
+
+} // namespace limo::core
@@ -0,0 +1,221 @@
+#include "limo/core/LinearProgram.hpp"
+#include "limo/core/LinearProgramBuilder.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+using limo::core::kInfinity;
+using limo::core::LinearProgram;
+using limo::core::LinearProgramBuilder;
+using limo::core::ObjectiveSense;
+using limo::core::RowSense;
+
+namespace {
+
+template <typename T>
+std::vector<T> toVector(std::span<const T> values) {
+    return {values.begin(), values.end()};
+}
+
+// max 3x + 5y  s.t.  x <= 4,  2y <= 12,  3x + 2y = 18,  0 <= y <= 7
+LinearProgram textbookByRows() {
+    LinearProgramBuilder builder;
+    builder.setName("textbook");
+    builder.setSense(ObjectiveSense::Maximize);
+    const std::size_t x = builder.addColumn(3.0, 0.0, kInfinity, "x");
+    const std::size_t y = builder.addColumn(5.0, 0.0, 7.0, "y");
+    const std::vector<std::size_t> first{x};
+    const std::vector<std::size_t> second{y};
+    const std::vector<std::size_t> third{y, x};
+    builder.addRow(RowSense::LessEqual, 4.0, first, std::vector<double>{1.0}, "plant1");
+    builder.addRow(RowSense::LessEqual, 12.0, second, std::vector<double>{2.0}, "plant2");
+    builder.addRow(RowSense::Equal, 18.0, third, std::vector<double>{2.0, 3.0}, "plant3");
+    return builder.build();
+}
+
+} // namespace
+
+TEST(LinearProgramTests, DefaultProgramIsEmpty) {
+    const LinearProgram program;
+    EXPECT_EQ(program.rows(), 0u);
+    EXPECT_EQ(program.cols(), 0u);
+    EXPECT_EQ(program.nonZeros(), 0u);
+    EXPECT_EQ(program.columnStarts().size(), 1u);
+    EXPECT_EQ(program.rowStarts().size(), 1u);
+}
+
+TEST(LinearProgramTests, BuildsRowWiseIntoBothLayouts) {
+    const LinearProgram program = textbookByRows();
+    EXPECT_EQ(program.name(), "textbook");
+    EXPECT_EQ(program.sense(), ObjectiveSense::Maximize);
+    EXPECT_EQ(program.rows(), 3u);
+    EXPECT_EQ(program.cols(), 2u);
+    EXPECT_EQ(program.nonZeros(), 4u);
+    EXPECT_EQ(toVector(program.objective()), (std::vector<double>{3.0, 5.0}));
+    EXPECT_EQ(toVector(program.columnUpper()), (std::vector<double>{kInfinity, 7.0}));
+
+    EXPECT_EQ(toVector(program.columnStarts()), (std::vector<std::size_t>{0, 2, 4}));
+    EXPECT_EQ(toVector(program.rowIndices()), (std::vector<std::size_t>{0, 2, 1, 2}));
+    EXPECT_EQ(toVector(program.values()), (std::vector<double>{1.0, 3.0, 2.0, 2.0}));
+
+    // Row entries come out sorted by column even though row 2 was given as (y, x).
+    const auto row = program.row(2);
+    EXPECT_EQ(toVector(row.indices), (std::vector<std::size_t>{0, 1}));
+    EXPECT_EQ(toVector(row.values), (std::vector<double>{3.0, 2.0}));
+
+    const auto column = program.column(1);
+    EXPECT_EQ(toVector(column.indices), (std::vector<std::size_t>{1, 2}));
+    EXPECT_EQ(column.size(), 2u);
+
+    EXPECT_EQ(program.rowNames()[2], "plant3");
+    EXPECT_EQ(program.columnNames()[0], "x");
+    EXPECT_THROW(program.row(3), std::out_of_range);
+    EXPECT_THROW(program.column(2), std::out_of_range);
+}
+
+TEST(LinearProgramTests, ColumnWiseAndEntryWiseBuildsAgree) {
+    LinearProgramBuilder byColumns;
+    byColumns.reserve(3, 2, 4);
+    byColumns.setSense(ObjectiveSense::Maximize);
+    byColumns.addRow(RowSense::LessEqual, 4.0);
+    byColumns.addRow(RowSense::LessEqual, 12.0);
+    byColumns.addRow(RowSense::Equal, 18.0);
+    byColumns.addColumn(3.0, 0.0, kInfinity, std::vector<std::size_t>{0, 2}, std::vector<double>{1.0, 3.0});
+    // Rows out of order within a column are sorted by build().
+    byColumns.addColumn(5.0, 0.0, 7.0, std::vector<std::size_t>{2, 1}, std::vector<double>{2.0, 2.0});
+    const LinearProgram fromColumns = byColumns.build();
+
+    LinearProgramBuilder byEntries;
+    byEntries.setSense(ObjectiveSense::Maximize);
+    byEntries.addColumn(3.0);
+    byEntries.addColumn(5.0, 0.0, 7.0);
+    byEntries.addRow(RowSense::LessEqual, 4.0);
+    byEntries.addRow(RowSense::LessEqual, 12.0);
+    byEntries.addRow(RowSense::Equal, 18.0);
+    byEntries.addEntry(2, 1, 2.0);
+    byEntries.addEntry(1, 1, 2.0);
+    byEntries.addEntry(2, 0, 3.0);
+    byEntries.addEntry(0, 0, 1.0);
+    byEntries.addEntry(0, 1, 0.0);
+    const LinearProgram fromEntries = byEntries.build();
+
+    const LinearProgram fromRows = textbookByRows();
+    for (const LinearProgram* program : {&fromColumns, &fromEntries}) {
+        EXPECT_EQ(toVector(program->columnStarts()), toVector(fromRows.columnStarts()));
+        EXPECT_EQ(toVector(program->rowIndices()), toVector(fromRows.rowIndices()));
+        EXPECT_EQ(toVector(program->values()), toVector(fromRows.values()));
+        EXPECT_EQ(toVector(program->rowStarts()), toVector(fromRows.rowStarts()));
+        EXPECT_EQ(toVector(program->columnIndices()), toVector(fromRows.columnIndices()));
+        EXPECT_EQ(toVector(program->rowValues()), toVector(fromRows.rowValues()));
+        EXPECT_EQ(toVector(program->rhs()), toVector(fromRows.rhs()));
+    }
+    EXPECT_EQ(fromColumns.rowNames()[0], "");
+}
+
+TEST(LinearProgramTests, RowLimitsFollowTheSense) {
+    LinearProgramBuilder builder;
+    builder.addRow(RowSense::LessEqual, 1.0);
+    builder.addRow(RowSense::GreaterEqual, 2.0);
+    builder.addRow(RowSense::Equal, 3.0);
+    const std::size_t ranged = builder.addRow(RowSense::GreaterEqual, 4.0);
+    builder.setRowRange(ranged, 2.5);
+    const LinearProgram program = builder.build();
+
+    EXPECT_EQ(program.rowLower(0), -kInfinity);
+    EXPECT_EQ(program.rowUpper(0), 1.0);
+    EXPECT_EQ(program.rowLower(1), 2.0);
+    EXPECT_EQ(program.rowUpper(1), kInfinity);
+    EXPECT_EQ(program.rowLower(2), 3.0);
+    EXPECT_EQ(program.rowUpper(2), 3.0);
+    EXPECT_EQ(program.rowSenses()[3], RowSense::Ranged);
+    EXPECT_EQ(program.rowLower(3), 4.0);
+    EXPECT_EQ(program.rowUpper(3), 6.5);
+}
+
+TEST(LinearProgramTests, BuilderRejectsInvalidInput) {
+    LinearProgramBuilder builder;
+    const std::size_t col = builder.addColumn(1.0);
+    const std::size_t row = builder.addRow(RowSense::Equal, 1.0);
+    EXPECT_THROW(builder.addColumn(0.0, 2.0, 1.0), std::invalid_argument);
+    EXPECT_THROW(builder.setBounds(col, 0.0, -1.0), std::invalid_argument);
+    EXPECT_THROW(builder.addEntry(row + 1, col, 1.0), std::out_of_range);
+    EXPECT_THROW(builder.addEntry(row, col + 1, 1.0), std::out_of_range);
+    EXPECT_THROW(builder.addEntry(row, col, kInfinity), std::invalid_argument);
+    EXPECT_THROW(builder.setRowRange(row, -1.0), std::invalid_argument);
+    EXPECT_THROW(builder.addRow(RowSense::Equal, 0.0, std::vector<std::size_t>{0, 1}, std::vector<double>{1.0}),
+                 std::invalid_argument);
+
+    builder.addEntry(row, col, 1.0);
+    builder.addEntry(row, col, 2.0);
+    EXPECT_THROW(builder.build(), std::invalid_argument);
+    // The builder starts over after build(), even a failed one.
+    EXPECT_EQ(builder.rows(), 0u);
+    EXPECT_EQ(builder.build().nonZeros(), 0u);
+}
+
+TEST(LinearProgramTests, RejectedSpanAddsNothing) {
+    LinearProgramBuilder builder;
+    builder.addColumn(1.0);
+    builder.addColumn(2.0);
+    builder.addRow(RowSense::LessEqual, 1.0);
+    const std::vector<std::size_t> badColumn{0, 2};
+    const std::vector<std::size_t> repeated{1, 0, 1};
+    const std::vector<double> pair{1.0, 2.0};
+    const std::vector<double> triple{1.0, 2.0, 3.0};
+    EXPECT_THROW(builder.addRow(RowSense::Equal, 0.0, badColumn, pair), std::out_of_range);
+    EXPECT_THROW(builder.addRow(RowSense::Equal, 0.0, repeated, triple), std::invalid_argument);
+    EXPECT_THROW(builder.addRow(RowSense::Equal, 0.0, std::vector<std::size_t>{0, 1},
+                                std::vector<double>{1.0, kInfinity}),
+                 std::invalid_argument);
+    EXPECT_THROW(builder.addColumn(0.0, 0.0, 1.0, std::vector<std::size_t>{0, 0}, pair), std::invalid_argument);
+    EXPECT_THROW(builder.addColumn(0.0, 0.0, 1.0, std::vector<std::size_t>{0, 1}, pair), std::out_of_range);
+    EXPECT_EQ(builder.rows(), 1u);
+    EXPECT_EQ(builder.cols(), 2u);
+    EXPECT_EQ(builder.nonZeros(), 0u);
+
+    // A repeated index with a zero value stores nothing, so it is accepted.
+    builder.addRow(RowSense::Equal, 0.0, repeated, std::vector<double>{1.0, 2.0, 0.0});
+    EXPECT_EQ(builder.build().nonZeros(), 2u);
+}
+
+TEST(LinearProgramTests, LargeColumnWiseBuildKeepsItsLayout) {
+    constexpr std::size_t kRows = 500;
+    constexpr std::size_t kCols = 2000;
+    LinearProgramBuilder builder;
+    builder.reserve(kRows, kCols, kCols * 5);
+    for (std::size_t row = 0; row < kRows; ++row) {
+        builder.addRow(RowSense::LessEqual, 1.0);
+    }
+    std::vector<std::size_t> rows(5);
+    std::vector<double> values(5);
+    for (std::size_t col = 0; col < kCols; ++col) {
+        for (std::size_t k = 0; k < 5; ++k) {
+            rows[k] = (col + k * 97) % kRows;
+            values[k] = static_cast<double>(k + 1);
+        }
+        builder.addColumn(1.0, 0.0, kInfinity, rows, values);
+    }
+    const LinearProgram program = builder.build();
+    ASSERT_EQ(program.nonZeros(), kCols * 5);
+
+    std::size_t seen = 0;
+    for (std::size_t row = 0; row < kRows; ++row) {
+        const auto entries = program.row(row);
+        for (std::size_t k = 0; k < entries.size(); ++k) {
+            if (k > 0) {
+                EXPECT_LT(entries.indices[k - 1], entries.indices[k]);
+            }
+            const auto column = program.column(entries.indices[k]);
+            bool found = false;
+            for (std::size_t e = 0; e < column.size(); ++e) {
+                found = found || (column.indices[e] == row && column.values[e] == entries.values[k]);
+            }
+            EXPECT_TRUE(found);
+            ++seen;
+        }
+    }
+    EXPECT_EQ(seen, program.nonZeros());
+}
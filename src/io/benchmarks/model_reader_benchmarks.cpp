@@ -0,0 +1,148 @@
+#include "limo/io/ModelReader.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#if LIMO_HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+using limo::core::LinearProgram;
+using limo::io::ModelFormat;
+
+namespace {
+
+constexpr std::size_t kEntriesPerColumn = 8;
+
+// range(0): columns; rows = columns / 4, 8 non-zeros per column.
+std::string generateMps(std::size_t cols) {
+    const std::size_t rows = cols / 4;
+    std::string text = "NAME generated\nROWS\n N obj\n";
+    for (std::size_t i = 0; i < rows; ++i) {
+        text += " L r" + std::to_string(i) + "\n";
+    }
+    text += "COLUMNS\n";
+    for (std::size_t j = 0; j < cols; ++j) {
+        const std::string name = "    x" + std::to_string(j);
+        text += name + "  obj  " + std::to_string(1 + j % 7) + "\n";
+        for (std::size_t k = 0; k < kEntriesPerColumn; ++k) {
+            const std::size_t row = (j * 31 + k * (rows / kEntriesPerColumn)) % rows;
+            text += name + "  r" + std::to_string(row) + "  " + std::to_string(0.25 * static_cast<double>(k + 1)) + "\n";
+        }
+    }
+    text += "RHS\n";
+    for (std::size_t i = 0; i < rows; ++i) {
+        text += "    rhs  r" + std::to_string(i) + "  100\n";
+    }
+    text += "BOUNDS\n";
+    for (std::size_t j = 0; j < cols; j += 3) {
+        text += " UP bnd  x" + std::to_string(j) + "  50\n";
+    }
+    return text + "ENDATA\n";
+}
+
+// The same shape as generateMps(), row by row.
+std::string generateLp(std::size_t cols) {
+    const std::size_t rows = cols / 4;
+    std::string text = "minimize\n obj:";
+    for (std::size_t j = 0; j < cols; ++j) {
+        text += " + " + std::to_string(1 + j % 7) + " x" + std::to_string(j);
+        if (j % 8 == 7) {
+            text += "\n";
+        }
+    }
+    text += "\nsubject to\n";
+    const std::size_t perRow = cols * kEntriesPerColumn / rows;
+    for (std::size_t i = 0; i < rows; ++i) {
+        text += " r" + std::to_string(i) + ":";
+        for (std::size_t k = 0; k < perRow; ++k) {
+            text += " + 0.5 x" + std::to_string((i * 7 + k * 4) % cols);
+            if (k % 8 == 7) {
+                text += "\n";
+            }
+        }
+        text += " <= 100\n";
+    }
+    text += "bounds\n";
+    for (std::size_t j = 0; j < cols; j += 3) {
+        text += " x" + std::to_string(j) + " <= 50\n";
+    }
+    return text + "end\n";
+}
+
+void parse(benchmark::State& state, const std::string& text, ModelFormat format) {
+    for (auto _ : state) {
+        LinearProgram program = limo::io::parseModel(text, format);
+        benchmark::DoNotOptimize(program.rowStarts().data());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(text.size()));
+}
+
+void BM_ParseFreeMps(benchmark::State& state) {
+    parse(state, generateMps(static_cast<std::size_t>(state.range(0))), ModelFormat::FreeMps);
+}
+
+void BM_ParseLp(benchmark::State& state) {
+    parse(state, generateLp(static_cast<std::size_t>(state.range(0))), ModelFormat::Lp);
+}
+
+// Through readModel(): mmap plus parse. Bytes are those of the file on disk.
+void read(benchmark::State& state, const std::string& contents, const std::string& name) {
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / name;
+    std::ofstream(path, std::ios::binary) << contents;
+    for (auto _ : state) {
+        LinearProgram program = limo::io::readModel(path);
+        benchmark::DoNotOptimize(program.rowStarts().data());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(contents.size()));
+    std::filesystem::remove(path);
+}
+
+void BM_ReadMpsFile(benchmark::State& state) {
+    read(state, generateMps(static_cast<std::size_t>(state.range(0))), "limo_io_benchmark.mps");
+}
+
+#if LIMO_HAVE_ZLIB
+
+std::string gzip(const std::string& text) {
+    uLongf size = compressBound(static_cast<uLong>(text.size())) + 32;
+    std::string compressed(size, '\0');
+    z_stream stream{};
+    deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 16 + MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(text.data()));
+    stream.avail_in = static_cast<uInt>(text.size());
+    stream.next_out = reinterpret_cast<Bytef*>(compressed.data());
+    stream.avail_out = static_cast<uInt>(compressed.size());
+    deflate(&stream, Z_FINISH);
+    compressed.resize(stream.total_out);
+    deflateEnd(&stream);
+    return compressed;
+}
+
+// Bytes processed count the uncompressed text, so MB/s compare with BM_ReadMpsFile.
+void BM_ReadGzipMpsFile(benchmark::State& state) {
+    const std::string text = generateMps(static_cast<std::size_t>(state.range(0)));
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "limo_io_benchmark.mps.gz";
+    std::ofstream(path, std::ios::binary) << gzip(text);
+    for (auto _ : state) {
+        LinearProgram program = limo::io::readModel(path);
+        benchmark::DoNotOptimize(program.rowStarts().data());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(text.size()));
+    std::filesystem::remove(path);
+}
+
+BENCHMARK(BM_ReadGzipMpsFile)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+#endif
+
+} // namespace
+
+BENCHMARK(BM_ParseFreeMps)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ParseLp)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ReadMpsFile)->Arg(100000)->Unit(benchmark::kMillisecond);
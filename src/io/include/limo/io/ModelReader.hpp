@@ -0,0 +1,75 @@
+#pragma once
+
+#include "limo/core/LinearProgram.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace limo::io {
+
+/**
+ * @brief Text formats readModel() understands.
+ */
+enum class ModelFormat {
+    /// Chosen from the file extension (.mps, .lp, optionally followed by .gz); free MPS otherwise.
+    Auto,
+    /// MPS with whitespace-separated fields; names must not contain spaces.
+    FreeMps,
+    /// MPS with fields at the fixed columns 2-3, 5-12, 15-22, 25-36, 40-47 and 50-61.
+    FixedMps,
+    /// CPLEX LP format.
+    Lp,
+};
+
+const char* toString(ModelFormat format);
+
+/**
+ * @brief Thrown for malformed model text; what() reads "source:line: message".
+ */
+class ParseError : public std::runtime_error {
+public:
+    ParseError(const std::string& source, std::size_t line, const std::string& message);
+
+    /// 1-based line of the error, 0 if it concerns the model as a whole.
+    std::size_t line() const { return line_; }
+
+private:
+    std::size_t line_;
+};
+
+/**
+ * @brief Format implied by a path's extension.
+ */
+ModelFormat detectFormat(const std::filesystem::path& path);
+
+/**
+ * @brief Reads a model file into a LinearProgram.
+ *
+ * The file is memory-mapped and parsed in a single pass, line by line,
+ * straight into a LinearProgramBuilder: no copy of the text is made and
+ * only names and non-zeros are stored. Gzip-compressed files (recognized by
+ * their magic bytes, whatever the extension) are inflated chunk by chunk
+ * through a fixed-size window, so memory stays bounded by the model itself.
+ *
+ * Integrality markers are accepted and ignored; LinearProgram has no
+ * integer columns.
+ *
+ * @throws ParseError for malformed text.
+ * @throws std::runtime_error if the file cannot be opened, or is compressed
+ * and limo was built without zlib.
+ */
+core::LinearProgram readModel(const std::filesystem::path& path, ModelFormat format = ModelFormat::Auto);
+
+/**
+ * @brief Parses model text held in memory; `source` names it in error messages.
+ *
+ * ModelFormat::Auto means free MPS here.
+ *
+ * @throws ParseError for malformed text.
+ */
+core::LinearProgram parseModel(std::string_view text, ModelFormat format, const std::string& source = "<memory>");
+
+} // namespace limo::io
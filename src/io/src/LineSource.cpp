@@ -0,0 +1,146 @@
+#include "LineSource.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+#if LIMO_HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+namespace limo::io {
+
+namespace {
+
+constexpr std::size_t kWindowSize = std::size_t{1} << 20;
+
+} // namespace
+
+bool TextLineSource::next(std::string_view& line) {
+    if (position >= text.size()) {
+        return false;
+    }
+    const char* start = text.data() + position;
+    const auto* newline = static_cast<const char*>(std::memchr(start, '\n', text.size() - position));
+    const std::size_t length = newline != nullptr ? static_cast<std::size_t>(newline - start) : text.size() - position;
+    line = trimCarriageReturn(std::string_view(start, length));
+    position += length + 1;
+    ++lineNumber_;
+    return true;
+}
+
+#if LIMO_HAVE_ZLIB
+
+struct GzipLineSource::Stream {
+    z_stream z{};
+    // Compressed bytes past next_in + avail_in; avail_in is a 32-bit uInt, so
+    // larger inputs are handed to inflate in chunks.
+    std::size_t unread = 0;
+
+    void feed() {
+        if (z.avail_in == 0 && unread > 0) {
+            const std::size_t chunk = std::min<std::size_t>(unread, std::numeric_limits<uInt>::max());
+            z.avail_in = static_cast<uInt>(chunk);
+            unread -= chunk;
+        }
+    }
+
+    bool exhausted() const { return z.avail_in == 0 && unread == 0; }
+};
+
+GzipLineSource::GzipLineSource(std::string_view compressed) : stream(std::make_unique<Stream>()), window(kWindowSize) {
+    // 16 + MAX_WBITS: expect a gzip header rather than a raw zlib stream.
+    if (inflateInit2(&stream->z, 16 + MAX_WBITS) != Z_OK) {
+        throw std::runtime_error("cannot initialize gzip decompression");
+    }
+    stream->z.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(compressed.data()));
+    stream->unread = compressed.size();
+}
+
+GzipLineSource::~GzipLineSource() {
+    inflateEnd(&stream->z);
+}
+
+bool GzipLineSource::fill() {
+    if (finished) {
+        return false;
+    }
+    // Keep the unread tail, then make room for at least one more chunk.
+    if (begin > 0) {
+        std::memmove(window.data(), window.data() + begin, end - begin);
+        end -= begin;
+        begin = 0;
+    }
+    if (end == window.size()) {
+        window.resize(window.size() * 2);
+    }
+    z_stream& z = stream->z;
+    z.next_out = reinterpret_cast<Bytef*>(window.data() + end);
+    z.avail_out = static_cast<uInt>(std::min<std::size_t>(window.size() - end, std::numeric_limits<uInt>::max()));
+    while (z.avail_out > 0) {
+        stream->feed();
+        const int status = inflate(&z, Z_NO_FLUSH);
+        if (status == Z_STREAM_END) {
+            // Concatenated gzip members form one stream.
+            if (stream->exhausted() || inflateReset(&z) != Z_OK) {
+                finished = true;
+                break;
+            }
+            continue;
+        }
+        if (status == Z_BUF_ERROR && stream->exhausted()) {
+            throw std::runtime_error("truncated gzip stream");
+        }
+        if (status != Z_OK) {
+            throw std::runtime_error(std::string("corrupt gzip stream: ") + (z.msg != nullptr ? z.msg : "inflate failed"));
+        }
+    }
+    end = static_cast<std::size_t>(reinterpret_cast<char*>(z.next_out) - window.data());
+    return true;
+}
+
+#else
+
+struct GzipLineSource::Stream {};
+
+GzipLineSource::GzipLineSource(std::string_view) {
+    throw std::runtime_error("limo was built without zlib; cannot read gzip-compressed models");
+}
+
+GzipLineSource::~GzipLineSource() = default;
+
+bool GzipLineSource::fill() {
+    return false;
+}
+
+#endif
+
+bool GzipLineSource::next(std::string_view& line) {
+    std::size_t searched = begin;
+    while (true) {
+        const char* start = window.data() + searched;
+        const auto* newline = static_cast<const char*>(std::memchr(start, '\n', end - searched));
+        if (newline != nullptr) {
+            const std::size_t length = static_cast<std::size_t>(newline - window.data()) - begin;
+            line = trimCarriageReturn(std::string_view(window.data() + begin, length));
+            begin += length + 1;
+            ++lineNumber_;
+            return true;
+        }
+        const std::size_t unread = end - begin;
+        if (!fill()) {
+            if (unread == 0) {
+                return false;
+            }
+            // Last line without a terminator.
+            line = trimCarriageReturn(std::string_view(window.data() + begin, unread));
+            begin = end;
+            ++lineNumber_;
+            return true;
+        }
+        searched = begin + unread;
+    }
+}
+
+} // namespace limo::io
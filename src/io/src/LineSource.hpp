@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace limo::io {
+
+/**
+ * @brief Hands out the lines of a model text one at a time.
+ */
+class LineSource {
+public:
+    virtual ~LineSource() = default;
+
+    /**
+     * @brief Next line without its terminator ("\n" or "\r\n").
+     *
+     * The view stays valid until the next call only.
+     */
+    virtual bool next(std::string_view& line) = 0;
+
+    /// 1-based number of the line last returned.
+    std::size_t lineNumber() const { return lineNumber_; }
+
+protected:
+    static std::string_view trimCarriageReturn(std::string_view line) {
+        if (!line.empty() && line.back() == '\r') {
+            line.remove_suffix(1);
+        }
+        return line;
+    }
+
+    std::size_t lineNumber_{0};
+};
+
+/**
+ * @brief Lines of text that is entirely in memory, e.g. a mapped file.
+ */
+class TextLineSource final : public LineSource {
+public:
+    explicit TextLineSource(std::string_view text) : text(text) {}
+
+    bool next(std::string_view& line) override;
+
+private:
+    std::string_view text;
+    std::size_t position{0};
+};
+
+/**
+ * @brief Lines of gzip-compressed bytes, inflated through a window that only
+ * grows when a single line does not fit.
+ */
+class GzipLineSource final : public LineSource {
+public:
+    explicit GzipLineSource(std::string_view compressed);
+    ~GzipLineSource() override;
+
+    GzipLineSource(const GzipLineSource&) = delete;
+    GzipLineSource& operator=(const GzipLineSource&) = delete;
+
+    bool next(std::string_view& line) override;
+
+private:
+    // Inflates into the free space after `end`; false once the input is exhausted.
+    bool fill();
+
+    struct Stream;
+    std::unique_ptr<Stream> stream;
+    std::vector<char> window;
+    std::size_t begin{0};
+    std::size_t end{0};
+    bool finished{false};
+};
+
+/**
+ * @brief True if `bytes` starts with the gzip magic number.
+ */
+inline bool isGzip(std::string_view bytes) {
+    return bytes.size() >= 2 && static_cast<unsigned char>(bytes[0]) == 0x1f &&
+           static_cast<unsigned char>(bytes[1]) == 0x8b;
+}
+
+} // namespace limo::io
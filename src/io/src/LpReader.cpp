@@ -0,0 +1,576 @@
+#include "ParseSupport.hpp"
+
+#include "limo/core/LinearProgramBuilder.hpp"
+#include "limo/io/ModelReader.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace limo::io {
+
+namespace {
+
+using core::kInfinity;
+using core::RowSense;
+
+enum class Section {
+    None,
+    Objective,
+    Constraints,
+    Bounds,
+    Generals,
+    Binaries,
+    End,
+};
+
+enum class TokenKind {
+    Number,
+    Name,
+    Plus,
+    Minus,
+    Colon,
+    LessEqual,
+    GreaterEqual,
+    Equal,
+    Section,
+    EndOfFile,
+};
+
+struct Token {
+    TokenKind kind{TokenKind::EndOfFile};
+    // Owned, so a token survives the line it came from (gzip windows are reused).
+    std::string text;
+    double number{0.0};
+    Section section{Section::None};
+    std::size_t line{0};
+};
+
+bool isOperator(TokenKind kind) {
+    return kind == TokenKind::LessEqual || kind == TokenKind::GreaterEqual || kind == TokenKind::Equal;
+}
+
+bool isInfinity(std::string_view word) {
+    return equalsIgnoreCase(word, "inf") || equalsIgnoreCase(word, "infinity");
+}
+
+bool isNameEnd(char c) {
+    switch (c) {
+    case ' ':
+    case '\t':
+    case '+':
+    case '-':
+    case ':':
+    case '<':
+    case '>':
+    case '=':
+    case '[':
+    case ']':
+    case '^':
+    case '\\':
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool isDigit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+/**
+ * Splits LP text into tokens with one token of lookahead. Section keywords
+ * are only recognized as the first word of a line, as in CPLEX.
+ */
+class Tokenizer {
+public:
+    Tokenizer(LineSource& lines, const std::string& source) : lines(lines), source(source) {}
+
+    const Token& peek() {
+        if (!hasLookahead) {
+            read(lookahead);
+            hasLookahead = true;
+        }
+        return lookahead;
+    }
+
+    const Token& take() {
+        peek();
+        std::swap(current, lookahead);
+        hasLookahead = false;
+        return current;
+    }
+
+    [[noreturn]] void fail(std::size_t line, const std::string& message) const {
+        throw ParseError(source, line, message);
+    }
+
+private:
+    void read(Token& token) {
+        while (true) {
+            while (position < line.size() && (line[position] == ' ' || line[position] == '\t')) {
+                ++position;
+            }
+            if (position < line.size() && line[position] != '\\') {
+                break;
+            }
+            if (!lines.next(line)) {
+                token.kind = TokenKind::EndOfFile;
+                token.line = lines.lineNumber();
+                return;
+            }
+            position = 0;
+            if (sectionKeyword(token)) {
+                return;
+            }
+        }
+        token.line = lines.lineNumber();
+        const char c = line[position];
+        switch (c) {
+        case '+':
+            ++position;
+            token.kind = TokenKind::Plus;
+            return;
+        case '-':
+            ++position;
+            token.kind = TokenKind::Minus;
+            return;
+        case ':':
+            ++position;
+            token.kind = TokenKind::Colon;
+            return;
+        case '<':
+        case '>':
+        case '=': {
+            ++position;
+            // <=, =<, <, >=, =>, > and =.
+            char other = c;
+            if (position < line.size() && (line[position] == '<' || line[position] == '>' || line[position] == '=')) {
+                other = line[position++];
+            }
+            const bool less = c == '<' || other == '<';
+            const bool greater = c == '>' || other == '>';
+            if (less && greater) {
+                fail(token.line, "malformed relational operator");
+            }
+            token.kind = less ? TokenKind::LessEqual : greater ? TokenKind::GreaterEqual : TokenKind::Equal;
+            return;
+        }
+        case '[':
+            fail(token.line, "quadratic terms are not supported");
+        default:
+            break;
+        }
+        const std::size_t start = position;
+        if (isDigit(c) || (c == '.' && position + 1 < line.size() && isDigit(line[position + 1]))) {
+            while (position < line.size() && (isDigit(line[position]) || line[position] == '.')) {
+                ++position;
+            }
+            // An exponent only if digits follow, so "2e" in "2 ex" or "2ex" stays a name.
+            if (position < line.size() && (line[position] == 'e' || line[position] == 'E')) {
+                std::size_t exponent = position + 1;
+                if (exponent < line.size() && (line[exponent] == '+' || line[exponent] == '-')) {
+                    ++exponent;
+                }
+                if (exponent < line.size() && isDigit(line[exponent])) {
+                    position = exponent;
+                    while (position < line.size() && isDigit(line[position])) {
+                        ++position;
+                    }
+                }
+            }
+            const std::string_view text = line.substr(start, position - start);
+            if (!parseNumber(text, token.number)) {
+                fail(token.line, "malformed number '" + std::string(text) + "'");
+            }
+            token.kind = TokenKind::Number;
+            return;
+        }
+        while (position < line.size() && !isNameEnd(line[position])) {
+            ++position;
+        }
+        token.kind = TokenKind::Name;
+        token.text.assign(line.substr(start, position - start));
+    }
+
+    // Consumes a section keyword at the start of the fresh line, if there is one.
+    bool sectionKeyword(Token& token) {
+        std::string_view words[2];
+        splitFields(line, words);
+        const std::string_view first = words[0];
+        Section section = Section::None;
+        std::size_t wordCount = 1;
+        if (equalsIgnoreCase(first, "max") || equalsIgnoreCase(first, "maximize") ||
+            equalsIgnoreCase(first, "maximise") || equalsIgnoreCase(first, "maximum") ||
+            equalsIgnoreCase(first, "min") || equalsIgnoreCase(first, "minimize") ||
+            equalsIgnoreCase(first, "minimise") || equalsIgnoreCase(first, "minimum")) {
+            section = Section::Objective;
+        } else if (equalsIgnoreCase(first, "st") || equalsIgnoreCase(first, "st.") ||
+                   equalsIgnoreCase(first, "s.t.")) {
+            section = Section::Constraints;
+        } else if ((equalsIgnoreCase(first, "subject") && equalsIgnoreCase(words[1], "to")) ||
+                   (equalsIgnoreCase(first, "such") && equalsIgnoreCase(words[1], "that"))) {
+            section = Section::Constraints;
+            wordCount = 2;
+        } else if (equalsIgnoreCase(first, "bounds") || equalsIgnoreCase(first, "bound")) {
+            section = Section::Bounds;
+        } else if (equalsIgnoreCase(first, "general") || equalsIgnoreCase(first, "generals") ||
+                   equalsIgnoreCase(first, "gen") || equalsIgnoreCase(first, "integer") ||
+                   equalsIgnoreCase(first, "integers")) {
+            section = Section::Generals;
+        } else if (equalsIgnoreCase(first, "binary") || equalsIgnoreCase(first, "binaries") ||
+                   equalsIgnoreCase(first, "bin")) {
+            section = Section::Binaries;
+        } else if (equalsIgnoreCase(first, "end")) {
+            section = Section::End;
+        } else if (equalsIgnoreCase(first, "semi-continuous") || equalsIgnoreCase(first, "semis") ||
+                   equalsIgnoreCase(first, "semi") || equalsIgnoreCase(first, "sos") ||
+                   equalsIgnoreCase(first, "lazy") || equalsIgnoreCase(first, "user")) {
+            fail(lines.lineNumber(), "unsupported LP section '" + std::string(first) + "'");
+        }
+        if (section == Section::None) {
+            return false;
+        }
+        const std::string_view last = words[wordCount - 1];
+        position = static_cast<std::size_t>(last.data() + last.size() - line.data());
+        token.kind = TokenKind::Section;
+        token.section = section;
+        token.text.assign(first);
+        token.line = lines.lineNumber();
+        return true;
+    }
+
+    LineSource& lines;
+    const std::string& source;
+    std::string_view line;
+    std::size_t position{0};
+    Token current;
+    Token lookahead;
+    bool hasLookahead{false};
+};
+
+class LpParser {
+public:
+    LpParser(LineSource& lines, const std::string& source, std::size_t sizeHint)
+        : source(source), tokens(lines, source) {
+        // Roughly one non-zero per 12 bytes of LP text.
+        builder.reserve(0, 0, sizeHint / 12);
+    }
+
+    core::LinearProgram parse() {
+        while (section != Section::End) {
+            const Token& token = tokens.peek();
+            if (token.kind == TokenKind::EndOfFile) {
+                break;
+            }
+            if (token.kind == TokenKind::Section) {
+                enter(tokens.take());
+                continue;
+            }
+            switch (section) {
+            case Section::None:
+                tokens.fail(token.line, "expected an objective section (minimize or maximize)");
+            case Section::Objective:
+                objective();
+                break;
+            case Section::Constraints:
+                constraint();
+                break;
+            case Section::Bounds:
+                bound();
+                break;
+            case Section::Generals:
+                column(name());
+                break;
+            case Section::Binaries: {
+                const std::size_t col = column(name());
+                lower[col] = 0.0;
+                upper[col] = 1.0;
+                break;
+            }
+            case Section::End:
+                break;
+            }
+        }
+        return finish();
+    }
+
+private:
+    void enter(const Token& token) {
+        if (token.section == Section::Objective) {
+            if (seenObjective) {
+                tokens.fail(token.line, "more than one objective section");
+            }
+            seenObjective = true;
+            const bool maximize = token.text.size() >= 3 && equalsIgnoreCase(std::string_view(token.text).substr(0, 3), "max");
+            builder.setSense(maximize ? core::ObjectiveSense::Maximize : core::ObjectiveSense::Minimize);
+        }
+        section = token.section;
+    }
+
+    std::size_t column(std::string_view name) {
+        std::size_t index = columnIndex.find(name);
+        if (index == NameIndex::kMissing) {
+            index = builder.addColumn(0.0, 0.0, kInfinity, name);
+            columnIndex.insert(name, index);
+            costs.push_back(0.0);
+            lower.push_back(0.0);
+            upper.push_back(kInfinity);
+            rowSlot.push_back(0);
+        }
+        return index;
+    }
+
+    std::string_view name() {
+        const Token& token = tokens.take();
+        if (token.kind != TokenKind::Name) {
+            tokens.fail(token.line, "expected a variable name");
+        }
+        return token.text;
+    }
+
+    // [sign...] (number | inf | infinity)
+    double value() {
+        double sign = 1.0;
+        while (tokens.peek().kind == TokenKind::Plus || tokens.peek().kind == TokenKind::Minus) {
+            if (tokens.take().kind == TokenKind::Minus) {
+                sign = -sign;
+            }
+        }
+        const Token& token = tokens.take();
+        if (token.kind == TokenKind::Number) {
+            return sign * token.number;
+        }
+        if (token.kind == TokenKind::Name && isInfinity(token.text)) {
+            return sign * kInfinity;
+        }
+        tokens.fail(token.line, "expected a number");
+    }
+
+    // Optional "label:" in front of a statement; returns the label, or an empty
+    // string with `pending` holding the variable that turned out to start the
+    // expression instead.
+    std::string label(std::string& pending) {
+        pending.clear();
+        if (tokens.peek().kind != TokenKind::Name) {
+            return {};
+        }
+        std::string text = tokens.take().text;
+        if (tokens.peek().kind == TokenKind::Colon) {
+            tokens.take();
+            return text;
+        }
+        pending = std::move(text);
+        return {};
+    }
+
+    /**
+     * Reads "[+|-] [coefficient] [variable]" terms up to the next operator,
+     * section or end of input, merging repeated variables into rowCols and
+     * rowValues; constants are summed into the return value.
+     */
+    double expression(std::string_view pending) {
+        rowCols.clear();
+        rowValues.clear();
+        double constant = 0.0;
+        if (!pending.empty()) {
+            addTerm(column(pending), 1.0);
+        }
+        while (true) {
+            double sign = 1.0;
+            bool hasSign = false;
+            while (tokens.peek().kind == TokenKind::Plus || tokens.peek().kind == TokenKind::Minus) {
+                hasSign = true;
+                if (tokens.take().kind == TokenKind::Minus) {
+                    sign = -sign;
+                }
+            }
+            const Token& token = tokens.peek();
+            if (token.kind == TokenKind::Number) {
+                const double coefficient = sign * tokens.take().number;
+                if (tokens.peek().kind == TokenKind::Name && !isInfinity(tokens.peek().text)) {
+                    addTerm(column(tokens.take().text), coefficient);
+                } else {
+                    constant += coefficient;
+                }
+            } else if (token.kind == TokenKind::Name && !(hasSign && isInfinity(token.text))) {
+                addTerm(column(tokens.take().text), sign);
+            } else if (hasSign) {
+                tokens.fail(token.line, "expected a term after the sign");
+            } else {
+                // Leave rowSlot all zero for the next expression.
+                for (const std::size_t col : rowCols) {
+                    rowSlot[col] = 0;
+                }
+                return constant;
+            }
+        }
+    }
+
+    // rowSlot holds 1 + the position of a column within the current expression, 0 if absent.
+    void addTerm(std::size_t col, double coefficient) {
+        if (rowSlot[col] != 0) {
+            rowValues[rowSlot[col] - 1] += coefficient;
+            return;
+        }
+        rowCols.push_back(col);
+        rowValues.push_back(coefficient);
+        rowSlot[col] = rowCols.size();
+    }
+
+    void objective() {
+        std::string pending;
+        label(pending);
+        const double constant = expression(pending);
+        for (std::size_t k = 0; k < rowCols.size(); ++k) {
+            costs[rowCols[k]] += rowValues[k];
+        }
+        objectiveOffset += constant;
+        const Token& next = tokens.peek();
+        if (next.kind != TokenKind::Section && next.kind != TokenKind::EndOfFile) {
+            tokens.fail(next.line, "unexpected token in the objective");
+        }
+    }
+
+    static RowSense senseOf(TokenKind kind) {
+        return kind == TokenKind::LessEqual      ? RowSense::LessEqual
+               : kind == TokenKind::GreaterEqual ? RowSense::GreaterEqual
+                                                 : RowSense::Equal;
+    }
+
+    void constraint() {
+        std::string pending;
+        const std::string rowName = label(pending);
+        const std::size_t line = tokens.peek().line;
+        double constant = expression(pending);
+        const Token& op = tokens.take();
+        if (!isOperator(op.kind)) {
+            tokens.fail(op.line, "expected <=, >= or = in a constraint");
+        }
+        const TokenKind first = op.kind;
+        if (!rowCols.empty()) {
+            const double rhs = value() - constant;
+            if (!std::isfinite(rhs)) {
+                tokens.fail(line, "constraint with an infinite right-hand side");
+            }
+            builder.addRow(senseOf(first), rhs, rowCols, rowValues, rowName);
+            return;
+        }
+        // "lo <= expression <= hi": the leading constant was the left limit.
+        const double left = constant;
+        constant = expression({});
+        const Token& second = tokens.take();
+        if (second.kind != first || first == TokenKind::Equal || rowCols.empty()) {
+            tokens.fail(second.line, "expected a constraint of the form 'lo <= expression <= hi'");
+        }
+        const double right = value();
+        double low = (first == TokenKind::LessEqual ? left : right) - constant;
+        double high = (first == TokenKind::LessEqual ? right : left) - constant;
+        if (std::isinf(low) && std::isinf(high)) {
+            tokens.fail(line, "constraint without finite bounds");
+        }
+        if (low > high) {
+            tokens.fail(line, "constraint with lower limit above its upper limit");
+        }
+        if (std::isinf(low)) {
+            builder.addRow(RowSense::LessEqual, high, rowCols, rowValues, rowName);
+        } else if (std::isinf(high)) {
+            builder.addRow(RowSense::GreaterEqual, low, rowCols, rowValues, rowName);
+        } else {
+            const std::size_t row = builder.addRow(RowSense::Ranged, low, rowCols, rowValues, rowName);
+            builder.setRowRange(row, high - low);
+        }
+    }
+
+    void applyBound(std::size_t col, std::string_view variable, TokenKind op, double bound, bool variableFirst,
+                    std::size_t line) {
+        // "x <= b" and "b >= x" are upper bounds.
+        const bool upperBound = variableFirst ? op == TokenKind::LessEqual : op == TokenKind::GreaterEqual;
+        if (op == TokenKind::Equal) {
+            lower[col] = bound;
+            upper[col] = bound;
+        } else if (upperBound) {
+            upper[col] = bound;
+        } else {
+            lower[col] = bound;
+        }
+        if (lower[col] > upper[col] || lower[col] == kInfinity || upper[col] == -kInfinity) {
+            tokens.fail(line, "inconsistent bounds on '" + std::string(variable) + "'");
+        }
+    }
+
+    // "x free", "x op b", "b op x" or "b op x op b".
+    void bound() {
+        const Token& token = tokens.peek();
+        const std::size_t line = token.line;
+        if (token.kind == TokenKind::Name && !isInfinity(token.text)) {
+            const std::string variable = tokens.take().text;
+            const std::size_t col = column(variable);
+            if (tokens.peek().kind == TokenKind::Name && equalsIgnoreCase(tokens.peek().text, "free")) {
+                tokens.take();
+                lower[col] = -kInfinity;
+                upper[col] = kInfinity;
+                return;
+            }
+            const TokenKind op = tokens.take().kind;
+            if (!isOperator(op)) {
+                tokens.fail(line, "expected a relational operator or 'free' after '" + variable + "'");
+            }
+            applyBound(col, variable, op, value(), true, line);
+            return;
+        }
+        const double left = value();
+        const TokenKind op = tokens.take().kind;
+        if (!isOperator(op)) {
+            tokens.fail(line, "expected a relational operator in a bound");
+        }
+        const std::string variable(name());
+        const std::size_t col = column(variable);
+        applyBound(col, variable, op, left, false, line);
+        if (isOperator(tokens.peek().kind)) {
+            const TokenKind second = tokens.take().kind;
+            applyBound(col, variable, second, value(), true, line);
+        }
+    }
+
+    core::LinearProgram finish() {
+        if (!seenObjective) {
+            throw ParseError(source, 0, "no objective section");
+        }
+        builder.setObjectiveOffset(objectiveOffset);
+        for (std::size_t col = 0; col < costs.size(); ++col) {
+            builder.setCost(col, costs[col]);
+            builder.setBounds(col, lower[col], upper[col]);
+        }
+        try {
+            return builder.build();
+        } catch (const std::invalid_argument& error) {
+            throw ParseError(source, 0, error.what());
+        }
+    }
+
+    const std::string& source;
+    Tokenizer tokens;
+    core::LinearProgramBuilder builder;
+    Section section{Section::None};
+    bool seenObjective{false};
+    double objectiveOffset{0.0};
+    NameIndex columnIndex;
+    std::vector<double> costs;
+    std::vector<double> lower;
+    std::vector<double> upper;
+    std::vector<std::size_t> rowCols;
+    std::vector<double> rowValues;
+    std::vector<std::size_t> rowSlot;
+};
+
+} // namespace
+
+core::LinearProgram readLp(LineSource& lines, const std::string& source, std::size_t sizeHint) {
+    return LpParser(lines, source, sizeHint).parse();
+}
+
+} // namespace limo::io
@@ -0,0 +1,63 @@
+#include "MappedFile.hpp"
+
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define LIMO_HAVE_MMAP 1
+#else
+#define LIMO_HAVE_MMAP 0
+#endif
+
+namespace limo::io {
+
+MappedFile::MappedFile(const std::filesystem::path& path) {
+#if LIMO_HAVE_MMAP
+    const int descriptor = ::open(path.c_str(), O_RDONLY);
+    if (descriptor < 0) {
+        throw std::runtime_error("cannot open '" + path.string() + "'");
+    }
+    struct stat status {};
+    if (::fstat(descriptor, &status) != 0) {
+        ::close(descriptor);
+        throw std::runtime_error("cannot stat '" + path.string() + "'");
+    }
+    size = static_cast<std::size_t>(status.st_size);
+    if (size > 0) {
+        void* address = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        if (address != MAP_FAILED) {
+            // Parsing is one front-to-back pass: let the kernel read ahead aggressively.
+            ::madvise(address, size, MADV_SEQUENTIAL);
+            data = static_cast<const char*>(address);
+            mapped = true;
+        }
+    }
+    ::close(descriptor);
+    if (mapped || size == 0) {
+        return;
+    }
+#endif
+    // No mmap on this platform, or it failed (e.g. a pipe): read the file instead.
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        throw std::runtime_error("cannot open '" + path.string() + "'");
+    }
+    fallback.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    data = fallback.data();
+    size = fallback.size();
+}
+
+MappedFile::~MappedFile() {
+#if LIMO_HAVE_MMAP
+    if (mapped) {
+        ::munmap(const_cast<char*>(data), size);
+    }
+#endif
+}
+
+} // namespace limo::io
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+namespace limo::io {
+
+/**
+ * @brief Read-only view of a whole file, memory-mapped where the platform
+ * allows it and read into a buffer otherwise.
+ */
+class MappedFile {
+public:
+    /**
+     * @throws std::runtime_error if the file cannot be opened or read.
+     */
+    explicit MappedFile(const std::filesystem::path& path);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    std::string_view bytes() const { return {data, size}; }
+
+private:
+    const char* data{nullptr};
+    std::size_t size{0};
+    bool mapped{false};
+    std::string fallback;
+};
+
+} // namespace limo::io
@@ -0,0 +1,81 @@
+#include "limo/io/ModelReader.hpp"
+
+#include "LineSource.hpp"
+#include "MappedFile.hpp"
+#include "ParseSupport.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <memory>
+
+namespace limo::io {
+
+namespace {
+
+core::LinearProgram parseLines(LineSource& lines, ModelFormat format, const std::string& source, std::size_t sizeHint) {
+    switch (format) {
+    case ModelFormat::Lp:
+        return readLp(lines, source, sizeHint);
+    case ModelFormat::FixedMps:
+        return readMps(lines, true, source, sizeHint);
+    case ModelFormat::Auto:
+    case ModelFormat::FreeMps:
+        break;
+    }
+    return readMps(lines, false, source, sizeHint);
+}
+
+std::string lowercase(std::string text) {
+    std::transform(text.begin(), text.end(), text.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return text;
+}
+
+} // namespace
+
+const char* toString(ModelFormat format) {
+    switch (format) {
+    case ModelFormat::Auto:
+        return "auto";
+    case ModelFormat::FreeMps:
+        return "mps";
+    case ModelFormat::FixedMps:
+        return "fixed-mps";
+    case ModelFormat::Lp:
+        return "lp";
+    }
+    return "unknown";
+}
+
+ParseError::ParseError(const std::string& source, std::size_t line, const std::string& message)
+    : std::runtime_error(source + ":" + std::to_string(line) + ": " + message), line_(line) {}
+
+ModelFormat detectFormat(const std::filesystem::path& path) {
+    std::filesystem::path name = path.filename();
+    if (lowercase(name.extension().string()) == ".gz") {
+        name = name.stem();
+    }
+    return lowercase(name.extension().string()) == ".lp" ? ModelFormat::Lp : ModelFormat::FreeMps;
+}
+
+core::LinearProgram readModel(const std::filesystem::path& path, ModelFormat format) {
+    if (format == ModelFormat::Auto) {
+        format = detectFormat(path);
+    }
+    const MappedFile file(path);
+    const std::string_view bytes = file.bytes();
+    std::unique_ptr<LineSource> lines;
+    if (isGzip(bytes)) {
+        lines = std::make_unique<GzipLineSource>(bytes);
+    } else {
+        lines = std::make_unique<TextLineSource>(bytes);
+    }
+    return parseLines(*lines, format, path.string(), bytes.size());
+}
+
+core::LinearProgram parseModel(std::string_view text, ModelFormat format, const std::string& source) {
+    TextLineSource lines(text);
+    return parseLines(lines, format, source, text.size());
+}
+
+} // namespace limo::io
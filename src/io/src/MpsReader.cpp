@@ -0,0 +1,403 @@
+#include "ParseSupport.hpp"
+
+#include "limo/core/LinearProgramBuilder.hpp"
+#include "limo/io/ModelReader.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace limo::io {
+
+namespace {
+
+using core::kInfinity;
+using core::RowSense;
+
+// Magnitudes from here on are read as infinite bounds, as MPS writers
+// commonly emit 1e30 for "no bound".
+constexpr double kInfiniteBound = 1e30;
+
+enum class Section {
+    None,
+    ObjSense,
+    Rows,
+    Columns,
+    Rhs,
+    Ranges,
+    Bounds,
+    End,
+};
+
+// Row index stand-ins for the objective and for further free (N) rows,
+// whose coefficients are dropped.
+constexpr std::size_t kObjectiveRow = NameIndex::kMissing - 1;
+constexpr std::size_t kFreeRow = NameIndex::kMissing - 2;
+
+std::string_view trim(std::string_view text) {
+    while (!text.empty() && (text.front() == ' ' || text.front() == '\t')) {
+        text.remove_prefix(1);
+    }
+    while (!text.empty() && (text.back() == ' ' || text.back() == '\t')) {
+        text.remove_suffix(1);
+    }
+    return text;
+}
+
+// Non-blank fields of a fixed-format data line, cut at their column
+// positions (0-based starts) and packed like splitFields() packs free ones;
+// blank fields, e.g. an unnamed RHS set, are skipped as in free MPS.
+std::size_t fixedFields(std::string_view line, std::string_view (&fields)[6]) {
+    static constexpr std::size_t kStart[6] = {1, 4, 14, 24, 39, 49};
+    static constexpr std::size_t kLength[6] = {2, 8, 8, 12, 8, 12};
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < 6; ++i) {
+        const std::string_view field = kStart[i] < line.size() ? trim(line.substr(kStart[i], kLength[i])) : "";
+        if (!field.empty()) {
+            fields[count++] = field;
+        }
+    }
+    if (kStart[5] + kLength[5] < line.size() && !trim(line.substr(kStart[5] + kLength[5])).empty()) {
+        return 7;
+    }
+    return count;
+}
+
+class MpsParser {
+public:
+    MpsParser(LineSource& lines, bool fixed, const std::string& source, std::size_t sizeHint)
+        : lines(lines), fixed(fixed), source(source) {
+        // Roughly one non-zero per 30 bytes of COLUMNS text; reserving only
+        // commits address space, not memory, until it is used.
+        builder.reserve(0, 0, sizeHint / 30);
+    }
+
+    core::LinearProgram parse() {
+        std::string_view line;
+        while (section != Section::End && lines.next(line)) {
+            // Blank (possibly indented) lines and comments carry nothing.
+            if (trim(line).empty() || line.front() == '*') {
+                continue;
+            }
+            if (line.front() != ' ' && line.front() != '\t') {
+                header(line);
+            } else {
+                data(line);
+            }
+        }
+        return finish();
+    }
+
+private:
+    [[noreturn]] void fail(const std::string& message) const { throw ParseError(source, lines.lineNumber(), message); }
+
+    double number(std::string_view token) const {
+        double value = 0.0;
+        if (!parseNumber(token, value)) {
+            fail("expected a number, got '" + std::string(token) + "'");
+        }
+        return value;
+    }
+
+    std::size_t row(std::string_view name) const {
+        const std::size_t index = rowIndex.find(name);
+        if (index == NameIndex::kMissing) {
+            fail("unknown row '" + std::string(name) + "'");
+        }
+        return index;
+    }
+
+    std::size_t column(std::string_view name) const {
+        const std::size_t index = columnIndex.find(name);
+        if (index == NameIndex::kMissing) {
+            fail("unknown column '" + std::string(name) + "'");
+        }
+        return index;
+    }
+
+    void header(std::string_view line) {
+        std::string_view fields[3];
+        const std::size_t count = splitFields(line, fields);
+        const std::string_view keyword = fields[0];
+        if (equalsIgnoreCase(keyword, "NAME")) {
+            builder.setName(std::string(trim(line.substr(4))));
+            section = Section::None;
+        } else if (equalsIgnoreCase(keyword, "OBJSENSE")) {
+            section = Section::ObjSense;
+            if (count >= 2) {
+                objectiveSense(fields[1]);
+            }
+        } else if (equalsIgnoreCase(keyword, "ROWS")) {
+            section = Section::Rows;
+        } else if (equalsIgnoreCase(keyword, "COLUMNS")) {
+            section = Section::Columns;
+        } else if (equalsIgnoreCase(keyword, "RHS")) {
+            section = Section::Rhs;
+        } else if (equalsIgnoreCase(keyword, "RANGES")) {
+            section = Section::Ranges;
+        } else if (equalsIgnoreCase(keyword, "BOUNDS")) {
+            section = Section::Bounds;
+        } else if (equalsIgnoreCase(keyword, "ENDATA")) {
+            section = Section::End;
+        } else {
+            fail("unsupported MPS section '" + std::string(keyword) + "'");
+        }
+    }
+
+    void objectiveSense(std::string_view word) {
+        if (equalsIgnoreCase(word, "MAX") || equalsIgnoreCase(word, "MAXIMIZE")) {
+            builder.setSense(core::ObjectiveSense::Maximize);
+        } else if (equalsIgnoreCase(word, "MIN") || equalsIgnoreCase(word, "MINIMIZE")) {
+            builder.setSense(core::ObjectiveSense::Minimize);
+        } else {
+            fail("unknown objective sense '" + std::string(word) + "'");
+        }
+    }
+
+    void data(std::string_view line) {
+        std::string_view fields[6];
+        const std::size_t count =
+            fixed && section != Section::ObjSense ? fixedFields(line, fields) : splitFields(line, fields);
+        if (count > 6) {
+            fail("too many fields");
+        }
+        switch (section) {
+        case Section::ObjSense:
+            objectiveSense(fields[0]);
+            break;
+        case Section::Rows:
+            rowLine(fields, count);
+            break;
+        case Section::Columns:
+            columnLine(fields, count);
+            break;
+        case Section::Rhs:
+            valueLine(fields, count, [this](std::size_t row, double value) {
+                if (row == kObjectiveRow) {
+                    builder.setObjectiveOffset(-value);
+                } else if (row != kFreeRow) {
+                    rhsValues.resize(senses.size(), 0.0);
+                    rhsValues[row] = value;
+                }
+            });
+            break;
+        case Section::Ranges:
+            valueLine(fields, count, [this](std::size_t row, double value) {
+                if (row == kObjectiveRow || row == kFreeRow) {
+                    fail("RANGES entry for a free row");
+                }
+                ranges.resize(senses.size(), std::nan(""));
+                ranges[row] = value;
+            });
+            break;
+        case Section::Bounds:
+            boundLine(fields, count);
+            break;
+        case Section::None:
+        case Section::End:
+            fail("data line outside of a section");
+        }
+    }
+
+    void rowLine(const std::string_view (&fields)[6], std::size_t count) {
+        if (count != 2) {
+            fail("ROWS lines need a type and a name");
+        }
+        const std::string_view type = fields[0];
+        const std::string_view name = fields[1];
+        if (equalsIgnoreCase(type, "N")) {
+            if (!rowIndex.insert(name, objectiveName.empty() ? kObjectiveRow : kFreeRow)) {
+                fail("duplicate row '" + std::string(name) + "'");
+            }
+            if (objectiveName.empty()) {
+                objectiveName = name;
+            }
+            return;
+        }
+        RowSense sense = RowSense::Equal;
+        if (equalsIgnoreCase(type, "L")) {
+            sense = RowSense::LessEqual;
+        } else if (equalsIgnoreCase(type, "G")) {
+            sense = RowSense::GreaterEqual;
+        } else if (!equalsIgnoreCase(type, "E")) {
+            fail("unknown row type '" + std::string(type) + "'");
+        }
+        if (!rowIndex.insert(name, builder.rows())) {
+            fail("duplicate row '" + std::string(name) + "'");
+        }
+        builder.addRow(sense, 0.0, name);
+        senses.push_back(sense);
+    }
+
+    void columnLine(const std::string_view (&fields)[6], std::size_t count) {
+        if (count >= 3 && equalsIgnoreCase(fields[1], "'MARKER'")) {
+            // Integrality markers: LinearProgram is continuous.
+            return;
+        }
+        if (count != 3 && count != 5) {
+            fail("COLUMNS lines need a column and one or two (row, value) pairs");
+        }
+        if (currentColumn == NameIndex::kMissing || fields[0] != currentName) {
+            currentColumn = builder.addColumn(0.0, 0.0, kInfinity, fields[0]);
+            if (!columnIndex.insert(fields[0], currentColumn)) {
+                fail("entries of column '" + std::string(fields[0]) + "' are not contiguous");
+            }
+            currentName.assign(fields[0]);
+            lower.push_back(0.0);
+            upper.push_back(kInfinity);
+        }
+        for (std::size_t pair = 1; pair + 1 < count; pair += 2) {
+            const std::size_t target = row(fields[pair]);
+            const double value = number(fields[pair + 1]);
+            if (target == kObjectiveRow) {
+                builder.setCost(currentColumn, value);
+            } else if (target != kFreeRow) {
+                builder.addEntry(target, currentColumn, value);
+            }
+        }
+    }
+
+    // RHS and RANGES: [set] row value [row value]. Only the first set counts.
+    template <typename Apply>
+    void valueLine(const std::string_view (&fields)[6], std::size_t count, Apply apply) {
+        if (count < 2 || count > 5) {
+            fail("expected one or two (row, value) pairs");
+        }
+        std::size_t first = 0;
+        if (count % 2 == 1) {
+            std::string& set = section == Section::Rhs ? rhsSet : rangeSet;
+            if (set.empty()) {
+                set.assign(fields[0]);
+            } else if (fields[0] != set) {
+                return;
+            }
+            first = 1;
+        }
+        for (std::size_t pair = first; pair + 1 < count; pair += 2) {
+            apply(row(fields[pair]), number(fields[pair + 1]));
+        }
+    }
+
+    // BOUNDS: type [set] column [value]. Only the first set counts.
+    void boundLine(const std::string_view (&fields)[6], std::size_t count) {
+        if (count < 2) {
+            fail("BOUNDS lines need a type and a column");
+        }
+        const std::string_view type = fields[0];
+        const bool valueless = equalsIgnoreCase(type, "FR") || equalsIgnoreCase(type, "MI") ||
+                               equalsIgnoreCase(type, "PL");
+        const bool binary = equalsIgnoreCase(type, "BV");
+        bool hasSet = false;
+        if (valueless) {
+            hasSet = count == 3;
+        } else if (binary) {
+            hasSet = count == 4 || (count == 3 && columnIndex.find(fields[1]) == NameIndex::kMissing);
+        } else {
+            hasSet = count == 4;
+            if (count != 3 && count != 4) {
+                fail("bound '" + std::string(type) + "' needs a value");
+            }
+        }
+        if (hasSet) {
+            if (boundSet.empty()) {
+                boundSet.assign(fields[1]);
+            } else if (fields[1] != boundSet) {
+                return;
+            }
+        }
+        const std::size_t col = column(fields[hasSet ? 2 : 1]);
+        const std::size_t valueField = hasSet ? 3 : 2;
+        const double value = valueField < count ? number(fields[valueField]) : 0.0;
+
+        if (equalsIgnoreCase(type, "UP") || equalsIgnoreCase(type, "UI")) {
+            upper[col] = value >= kInfiniteBound ? kInfinity : value;
+            // Classic MPS: a negative upper bound on a column whose lower bound
+            // was never set makes the column unbounded below.
+            if (value < 0.0 && lower[col] == 0.0) {
+                lower[col] = -kInfinity;
+            }
+        } else if (equalsIgnoreCase(type, "LO") || equalsIgnoreCase(type, "LI")) {
+            lower[col] = value <= -kInfiniteBound ? -kInfinity : value;
+        } else if (equalsIgnoreCase(type, "FX")) {
+            lower[col] = value;
+            upper[col] = value;
+        } else if (equalsIgnoreCase(type, "FR")) {
+            lower[col] = -kInfinity;
+            upper[col] = kInfinity;
+        } else if (equalsIgnoreCase(type, "MI")) {
+            lower[col] = -kInfinity;
+        } else if (equalsIgnoreCase(type, "PL")) {
+            upper[col] = kInfinity;
+        } else if (binary) {
+            lower[col] = 0.0;
+            upper[col] = 1.0;
+        } else {
+            fail("unsupported bound type '" + std::string(type) + "'");
+        }
+        if (lower[col] > upper[col]) {
+            fail("lower bound of column '" + std::string(fields[hasSet ? 2 : 1]) + "' exceeds its upper bound");
+        }
+    }
+
+    core::LinearProgram finish() {
+        if (objectiveName.empty() && builder.rows() == 0 && builder.cols() == 0) {
+            fail("no ROWS or COLUMNS section");
+        }
+        for (std::size_t col = 0; col < lower.size(); ++col) {
+            builder.setBounds(col, lower[col], upper[col]);
+        }
+        rhsValues.resize(senses.size(), 0.0);
+        ranges.resize(senses.size(), std::nan(""));
+        for (std::size_t row = 0; row < senses.size(); ++row) {
+            const double rhs = rhsValues[row];
+            builder.setRhs(row, rhs);
+            // RANGES turn a row into lo <= aᵢx <= hi depending on its type and the range's sign.
+            const double range = ranges[row];
+            if (std::isnan(range)) {
+                continue;
+            }
+            const double width = std::abs(range);
+            double low = rhs;
+            if (senses[row] == RowSense::LessEqual || (senses[row] == RowSense::Equal && range < 0.0)) {
+                low = rhs - width;
+            }
+            builder.setRhs(row, low);
+            builder.setRowRange(row, width);
+        }
+        try {
+            return builder.build();
+        } catch (const std::invalid_argument& error) {
+            throw ParseError(source, 0, error.what());
+        }
+    }
+
+    LineSource& lines;
+    const bool fixed;
+    const std::string& source;
+
+    core::LinearProgramBuilder builder;
+    Section section{Section::None};
+    NameIndex rowIndex;
+    NameIndex columnIndex;
+    std::string objectiveName;
+    std::vector<RowSense> senses;
+    std::vector<double> rhsValues;
+    std::vector<double> ranges;
+    std::vector<double> lower;
+    std::vector<double> upper;
+    std::size_t currentColumn{NameIndex::kMissing};
+    std::string currentName;
+    std::string rhsSet;
+    std::string rangeSet;
+    std::string boundSet;
+};
+
+} // namespace
+
+core::LinearProgram readMps(LineSource& lines, bool fixed, const std::string& source, std::size_t sizeHint) {
+    return MpsParser(lines, fixed, source, sizeHint).parse();
+}
+
+} // namespace limo::io
@@ -0,0 +1,74 @@
+#include "ParseSupport.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstring>
+
+namespace limo::io {
+
+namespace {
+
+constexpr std::size_t kArenaBlock = 64 * 1024;
+
+} // namespace
+
+std::size_t NameIndex::find(std::string_view name) const {
+    const auto found = map.find(name);
+    return found == map.end() ? kMissing : found->second;
+}
+
+bool NameIndex::insert(std::string_view name, std::size_t value) {
+    if (map.find(name) != map.end()) {
+        return false;
+    }
+    map.emplace(store(name), value);
+    return true;
+}
+
+std::string_view NameIndex::store(std::string_view name) {
+    if (name.empty()) {
+        return {};
+    }
+    if (blocks.empty() || blockUsed + name.size() > blockSize) {
+        blockSize = std::max(kArenaBlock, name.size());
+        blocks.push_back(std::make_unique<char[]>(blockSize));
+        blockUsed = 0;
+    }
+    char* target = blocks.back().get() + blockUsed;
+    std::memcpy(target, name.data(), name.size());
+    blockUsed += name.size();
+    return {target, name.size()};
+}
+
+bool equalsIgnoreCase(std::string_view left, std::string_view right) {
+    return left.size() == right.size() &&
+           std::equal(left.begin(), left.end(), right.begin(), [](char a, char b) {
+               return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(b));
+           });
+}
+
+bool parseNumber(std::string_view token, double& value) {
+    bool negative = false;
+    if (!token.empty() && (token.front() == '+' || token.front() == '-')) {
+        negative = token.front() == '-';
+        token.remove_prefix(1);
+    }
+    if (token.empty()) {
+        return false;
+    }
+    if (equalsIgnoreCase(token, "inf") || equalsIgnoreCase(token, "infinity")) {
+        value = negative ? -core::kInfinity : core::kInfinity;
+        return true;
+    }
+    const auto [end, error] = std::from_chars(token.data(), token.data() + token.size(), value);
+    if (error != std::errc() || end != token.data() + token.size()) {
+        return false;
+    }
+    if (negative) {
+        value = -value;
+    }
+    return true;
+}
+
+} // namespace limo::io
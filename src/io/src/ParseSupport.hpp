@@ -0,0 +1,76 @@
+#pragma once
+
+#include "LineSource.hpp"
+
+#include "limo/core/LinearProgram.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace limo::io {
+
+/**
+ * @brief Name-to-index map whose keys live in a bump-allocated arena, so
+ * they outlive the line buffer they were read from and cost no allocation
+ * of their own.
+ */
+class NameIndex {
+public:
+    static constexpr std::size_t kMissing = std::numeric_limits<std::size_t>::max();
+
+    std::size_t find(std::string_view name) const;
+    /// False, leaving the index unchanged, if `name` is already present.
+    bool insert(std::string_view name, std::size_t value);
+    void reserve(std::size_t count) { map.reserve(count); }
+
+private:
+    std::string_view store(std::string_view name);
+
+    std::vector<std::unique_ptr<char[]>> blocks;
+    std::size_t blockUsed{0};
+    std::size_t blockSize{0};
+    std::unordered_map<std::string_view, std::size_t> map;
+};
+
+bool equalsIgnoreCase(std::string_view left, std::string_view right);
+
+/**
+ * @brief Parses a decimal number, accepting a leading '+' and "inf"/"infinity" in any case.
+ */
+bool parseNumber(std::string_view token, double& value);
+
+/**
+ * @brief Splits `line` at blanks into at most `fields.size()` tokens; returns how many were found.
+ * Returns fields.size() + 1 if there were more.
+ */
+template <std::size_t N>
+std::size_t splitFields(std::string_view line, std::string_view (&fields)[N]) {
+    std::size_t count = 0;
+    std::size_t position = 0;
+    while (true) {
+        while (position < line.size() && (line[position] == ' ' || line[position] == '\t')) {
+            ++position;
+        }
+        if (position == line.size()) {
+            return count;
+        }
+        const std::size_t start = position;
+        while (position < line.size() && line[position] != ' ' && line[position] != '\t') {
+            ++position;
+        }
+        if (count == N) {
+            return N + 1;
+        }
+        fields[count++] = line.substr(start, position - start);
+    }
+}
+
+core::LinearProgram readMps(LineSource& lines, bool fixed, const std::string& source, std::size_t sizeHint);
+core::LinearProgram readLp(LineSource& lines, const std::string& source, std::size_t sizeHint);
+
+} // namespace limo::io
@@ -0,0 +1,348 @@
+#include "limo/io/ModelReader.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#if LIMO_HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+using limo::core::kInfinity;
+using limo::core::LinearProgram;
+using limo::core::ObjectiveSense;
+using limo::core::RowSense;
+using limo::io::detectFormat;
+using limo::io::ModelFormat;
+using limo::io::parseModel;
+using limo::io::ParseError;
+using limo::io::readModel;
+
+namespace {
+
+double coefficient(const LinearProgram& program, std::size_t row, std::size_t col) {
+    const auto entries = program.row(row);
+    for (std::size_t k = 0; k < entries.size(); ++k) {
+        if (entries.indices[k] == col) {
+            return entries.values[k];
+        }
+    }
+    return 0.0;
+}
+
+// max 3x + 5y  s.t.  x <= 4,  2y <= 12,  3x + 2y = 18,  y <= 7
+const char* kFreeMps = R"(* the textbook example
+NAME          textbook
+OBJSENSE
+    MAX
+ROWS
+ N  profit
+ L  plant1
+ L  plant2
+ E  plant3
+COLUMNS
+    x  profit  3  plant1  1
+    x  plant3  3
+    y  profit  5  plant2  2
+    y  plant3  2
+RHS
+    rhs  plant1  4  plant2  12
+    rhs  plant3  18
+BOUNDS
+ UP bnd  y  7
+ENDATA
+)";
+
+const char* kLp = R"(\ the textbook example
+Maximize
+ profit: 3 x + 5y
+Subject To
+ plant1: x <= 4
+ plant2: 2 y <= 12
+ plant3: 3 x
+   + 2 y = 18
+Bounds
+ y <= 7
+End
+)";
+
+void expectTextbook(const LinearProgram& program) {
+    EXPECT_EQ(program.sense(), ObjectiveSense::Maximize);
+    ASSERT_EQ(program.rows(), 3u);
+    ASSERT_EQ(program.cols(), 2u);
+    EXPECT_EQ(program.nonZeros(), 4u);
+    EXPECT_EQ(program.columnNames()[0], "x");
+    EXPECT_EQ(program.rowNames()[2], "plant3");
+    EXPECT_DOUBLE_EQ(program.objective()[0], 3.0);
+    EXPECT_DOUBLE_EQ(program.objective()[1], 5.0);
+    EXPECT_EQ(program.rowSenses()[0], RowSense::LessEqual);
+    EXPECT_EQ(program.rowSenses()[2], RowSense::Equal);
+    EXPECT_DOUBLE_EQ(program.rhs()[1], 12.0);
+    EXPECT_DOUBLE_EQ(program.rhs()[2], 18.0);
+    EXPECT_DOUBLE_EQ(coefficient(program, 2, 0), 3.0);
+    EXPECT_DOUBLE_EQ(coefficient(program, 2, 1), 2.0);
+    EXPECT_DOUBLE_EQ(program.columnUpper()[0], kInfinity);
+    EXPECT_DOUBLE_EQ(program.columnUpper()[1], 7.0);
+}
+
+std::filesystem::path temporaryFile(const std::string& name, const std::string& contents) {
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / name;
+    std::ofstream(path, std::ios::binary) << contents;
+    return path;
+}
+
+} // namespace
+
+TEST(ModelReaderTests, ReadsFreeMps) {
+    const LinearProgram program = parseModel(kFreeMps, ModelFormat::FreeMps);
+    EXPECT_EQ(program.name(), "textbook");
+    expectTextbook(program);
+}
+
+TEST(ModelReaderTests, SkipsWhitespaceOnlyMpsLines) {
+    const std::string text = "NAME          textbook\n"
+                             "OBJSENSE\n"
+                             "    MAX\n"
+                             "ROWS\n"
+                             " N  profit\n"
+                             "    \n"
+                             " L  plant1\n"
+                             " L  plant2\n"
+                             "\t\n"
+                             " E  plant3\n"
+                             "COLUMNS\n"
+                             "    x  profit  3  plant1  1\n"
+                             "  \t  \n"
+                             "    x  plant3  3\n"
+                             "    y  profit  5  plant2  2\n"
+                             "    y  plant3  2\n"
+                             "RHS\n"
+                             "    rhs  plant1  4  plant2  12\n"
+                             "    rhs  plant3  18\n"
+                             "BOUNDS\n"
+                             " UP bnd  y  7\n"
+                             "ENDATA\n";
+    expectTextbook(parseModel(text, ModelFormat::FreeMps));
+}
+
+TEST(ModelReaderTests, ReadsFixedMpsWithBlanksInNames) {
+    const std::string text = "NAME          fixed\n"
+                             "ROWS\n"
+                             " N  cost\n"
+                             " G  row one\n"
+                             "COLUMNS\n"
+                             "    col a     cost      1.0            row one   2.0\n"
+                             "RHS\n"
+                             "              row one   4.0\n"
+                             "ENDATA\n";
+    const LinearProgram program = parseModel(text, ModelFormat::FixedMps);
+    ASSERT_EQ(program.rows(), 1u);
+    ASSERT_EQ(program.cols(), 1u);
+    EXPECT_EQ(program.rowNames()[0], "row one");
+    EXPECT_EQ(program.columnNames()[0], "col a");
+    EXPECT_EQ(program.rowSenses()[0], RowSense::GreaterEqual);
+    EXPECT_DOUBLE_EQ(program.rhs()[0], 4.0);
+    EXPECT_DOUBLE_EQ(coefficient(program, 0, 0), 2.0);
+}
+
+TEST(ModelReaderTests, AppliesMpsRangesBoundsAndObjectiveConstant) {
+    const std::string text = "NAME ranges\n"
+                             "ROWS\n"
+                             " N obj\n"
+                             " L le\n"
+                             " G ge\n"
+                             " E eqpos\n"
+                             " E eqneg\n"
+                             " N spare\n"
+                             "COLUMNS\n"
+                             " a obj 1 le 1\n"
+                             " a ge 1 eqpos 1\n"
+                             " a eqneg 1 spare 9\n"
+                             " b obj 1 le 1\n"
+                             " c obj 1 le 1\n"
+                             " d obj 1 le 1\n"
+                             " e obj 1 le 1\n"
+                             "RHS\n"
+                             " rhs obj -2.5\n"
+                             " rhs le 10 ge 1\n"
+                             " rhs eqpos 5 eqneg 5\n"
+                             " other le 99\n"
+                             "RANGES\n"
+                             " rng le 4 ge -3\n"
+                             " rng eqpos 2 eqneg -2\n"
+                             "BOUNDS\n"
+                             " UP bnd a -1\n"
+                             " FR bnd b\n"
+                             " MI bnd c\n"
+                             " FX bnd d 3\n"
+                             " BV bnd e\n"
+                             " UP other a 100\n"
+                             "ENDATA\n";
+    const LinearProgram program = parseModel(text, ModelFormat::FreeMps);
+    ASSERT_EQ(program.rows(), 4u);
+    EXPECT_DOUBLE_EQ(program.objectiveOffset(), 2.5);
+
+    EXPECT_DOUBLE_EQ(program.rowLower(0), 6.0);
+    EXPECT_DOUBLE_EQ(program.rowUpper(0), 10.0);
+    EXPECT_DOUBLE_EQ(program.rowLower(1), 1.0);
+    EXPECT_DOUBLE_EQ(program.rowUpper(1), 4.0);
+    EXPECT_DOUBLE_EQ(program.rowLower(2), 5.0);
+    EXPECT_DOUBLE_EQ(program.rowUpper(2), 7.0);
+    EXPECT_DOUBLE_EQ(program.rowLower(3), 3.0);
+    EXPECT_DOUBLE_EQ(program.rowUpper(3), 5.0);
+
+    EXPECT_DOUBLE_EQ(program.columnLower()[0], -kInfinity);
+    EXPECT_DOUBLE_EQ(program.columnUpper()[0], -1.0);
+    EXPECT_DOUBLE_EQ(program.columnLower()[1], -kInfinity);
+    EXPECT_DOUBLE_EQ(program.columnUpper()[1], kInfinity);
+    EXPECT_DOUBLE_EQ(program.columnLower()[2], -kInfinity);
+    EXPECT_DOUBLE_EQ(program.columnUpper()[2], kInfinity);
+    EXPECT_DOUBLE_EQ(program.columnLower()[3], 3.0);
+    EXPECT_DOUBLE_EQ(program.columnUpper()[3], 3.0);
+    EXPECT_DOUBLE_EQ(program.columnUpper()[4], 1.0);
+}
+
+TEST(ModelReaderTests, ReadsLp) {
+    expectTextbook(parseModel(kLp, ModelFormat::Lp));
+}
+
+TEST(ModelReaderTests, ReadsLpConstantsRangesAndBounds) {
+    const std::string text = "minimize\n"
+                             "  obj: 2 x - y + x + 7\n"
+                             "subject to\n"
+                             "  c1: x + y + 3 >= 5\n"
+                             "  c2: -4 <= x - y <= 4\n"
+                             "  10 >= x + 2 y >= -inf\n"
+                             "  x + y + x = 6\n"
+                             "bounds\n"
+                             "  -inf <= x <= 8\n"
+                             "  y free\n"
+                             "  z >= 1e-1\n"
+                             "  z <= 2.5E+1\n"
+                             "binary\n"
+                             "  w\n"
+                             "end\n";
+    const LinearProgram program = parseModel(text, ModelFormat::Lp);
+    ASSERT_EQ(program.rows(), 4u);
+    ASSERT_EQ(program.cols(), 4u);
+    EXPECT_EQ(program.sense(), ObjectiveSense::Minimize);
+    EXPECT_DOUBLE_EQ(program.objective()[0], 3.0);
+    EXPECT_DOUBLE_EQ(program.objective()[1], -1.0);
+    EXPECT_DOUBLE_EQ(program.objectiveOffset(), 7.0);
+
+    EXPECT_EQ(program.rowSenses()[0], RowSense::GreaterEqual);
+    EXPECT_DOUBLE_EQ(program.rhs()[0], 2.0);
+    EXPECT_EQ(program.rowSenses()[1], RowSense::Ranged);
+    EXPECT_DOUBLE_EQ(program.rowLower(1), -4.0);
+    EXPECT_DOUBLE_EQ(program.rowUpper(1), 4.0);
+    EXPECT_EQ(program.rowSenses()[2], RowSense::LessEqual);
+    EXPECT_DOUBLE_EQ(program.rhs()[2], 10.0);
+    EXPECT_EQ(program.rowSenses()[3], RowSense::Equal);
+    EXPECT_DOUBLE_EQ(coefficient(program, 3, 0), 2.0);
+
+    EXPECT_DOUBLE_EQ(program.columnLower()[0], -kInfinity);
+    EXPECT_DOUBLE_EQ(program.columnUpper()[0], 8.0);
+    EXPECT_DOUBLE_EQ(program.columnLower()[1], -kInfinity);
+    EXPECT_DOUBLE_EQ(program.columnLower()[2], 0.1);
+    EXPECT_DOUBLE_EQ(program.columnUpper()[2], 25.0);
+    EXPECT_EQ(program.columnNames()[3], "w");
+    EXPECT_DOUBLE_EQ(program.columnUpper()[3], 1.0);
+}
+
+TEST(ModelReaderTests, ReportsTheLineOfAnError) {
+    const std::string mps = "NAME bad\nROWS\n N obj\n L c1\nCOLUMNS\n x obj 1 c2 1\nENDATA\n";
+    try {
+        parseModel(mps, ModelFormat::FreeMps, "bad.mps");
+        FAIL() << "expected a ParseError";
+    } catch (const ParseError& error) {
+        EXPECT_EQ(error.line(), 6u);
+        EXPECT_EQ(std::string(error.what()), "bad.mps:6: unknown row 'c2'");
+    }
+
+    const std::string lp = "min\n x + y\nst\n x + y >= \n";
+    try {
+        parseModel(lp, ModelFormat::Lp, "bad.lp");
+        FAIL() << "expected a ParseError";
+    } catch (const ParseError& error) {
+        EXPECT_EQ(error.line(), 4u);
+    }
+
+    EXPECT_THROW(parseModel("NAME x\nBOUNDS\n UP bnd x 1\nENDATA\n", ModelFormat::FreeMps), ParseError);
+    EXPECT_THROW(parseModel("min\n x + [ x ^ 2 ]\nend\n", ModelFormat::Lp), ParseError);
+    EXPECT_THROW(parseModel("min\n x\nbounds\n x >= 3\n x <= 2\nend\n", ModelFormat::Lp), ParseError);
+}
+
+TEST(ModelReaderTests, DetectsTheFormatFromTheExtension) {
+    EXPECT_EQ(detectFormat("model.lp"), ModelFormat::Lp);
+    EXPECT_EQ(detectFormat("dir/model.LP.gz"), ModelFormat::Lp);
+    EXPECT_EQ(detectFormat("model.mps.gz"), ModelFormat::FreeMps);
+    EXPECT_EQ(detectFormat("model"), ModelFormat::FreeMps);
+}
+
+TEST(ModelReaderTests, ReadsFilesFromDisk) {
+    const std::filesystem::path mps = temporaryFile("limo_io_textbook.mps", kFreeMps);
+    const std::filesystem::path lp = temporaryFile("limo_io_textbook.lp", kLp);
+    expectTextbook(readModel(mps));
+    expectTextbook(readModel(lp));
+    std::filesystem::remove(mps);
+    std::filesystem::remove(lp);
+    EXPECT_THROW(readModel(std::filesystem::temp_directory_path() / "limo_io_missing.mps"), std::runtime_error);
+}
+
+#if LIMO_HAVE_ZLIB
+
+namespace {
+
+std::string gzip(const std::string& text) {
+    z_stream stream{};
+    EXPECT_EQ(deflateInit2(&stream, Z_BEST_SPEED, Z_DEFLATED, 16 + MAX_WBITS, 8, Z_DEFAULT_STRATEGY), Z_OK);
+    std::string compressed(deflateBound(&stream, static_cast<uLong>(text.size())), '\0');
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(text.data()));
+    stream.avail_in = static_cast<uInt>(text.size());
+    stream.next_out = reinterpret_cast<Bytef*>(compressed.data());
+    stream.avail_out = static_cast<uInt>(compressed.size());
+    EXPECT_EQ(deflate(&stream, Z_FINISH), Z_STREAM_END);
+    compressed.resize(stream.total_out);
+    deflateEnd(&stream);
+    return compressed;
+}
+
+} // namespace
+
+TEST(ModelReaderTests, ReadsGzipCompressedFiles) {
+    const std::filesystem::path mps = temporaryFile("limo_io_textbook.mps.gz", gzip(kFreeMps));
+    const std::filesystem::path lp = temporaryFile("limo_io_textbook.lp.gz", gzip(kLp));
+    expectTextbook(readModel(mps));
+    expectTextbook(readModel(lp));
+    std::filesystem::remove(mps);
+    std::filesystem::remove(lp);
+}
+
+TEST(ModelReaderTests, ReadsGzipLinesLongerThanTheInflateWindow) {
+    // One objective line of ~3 MiB forces the window to grow.
+    std::string text = "min\n obj:";
+    const std::size_t columns = 200000;
+    for (std::size_t j = 0; j < columns; ++j) {
+        text += " + x" + std::to_string(j);
+    }
+    text += "\nst\n c: x0 >= 1\nend\n";
+    const std::filesystem::path path = temporaryFile("limo_io_long.lp.gz", gzip(text));
+    const LinearProgram program = readModel(path);
+    std::filesystem::remove(path);
+    EXPECT_EQ(program.cols(), columns);
+    EXPECT_EQ(program.rows(), 1u);
+}
+
+TEST(ModelReaderTests, RejectsTruncatedGzip) {
+    const std::string compressed = gzip(kFreeMps);
+    const std::filesystem::path path =
+        temporaryFile("limo_io_truncated.mps.gz", compressed.substr(0, compressed.size() / 2));
+    EXPECT_THROW(readModel(path), std::runtime_error);
+    std::filesystem::remove(path);
+}
+
+#endif
@@ -0,0 +1,170 @@
+#include "limo/numerics/Fraction.hpp"
+#include "limo/numerics/Matrix.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using limo::numerics::Matrix;
+using limo::numerics::fraction::Fraction;
+
+namespace {
+
+/**
+ * Operands with numerators/denominators of roughly `bits` bits, so the
+ * per-operation cost can be read for tableau-like small values, values close
+ * to the 64-bit limit and values that already live in the BigInt fallback.
+ */
+std::vector<Fraction> makeOperands(int bits, std::size_t count) {
+    std::mt19937_64 rng(42);
+    std::vector<Fraction> values;
+    values.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        if (bits <= 62) {
+            const std::int64_t mask = (std::int64_t{1} << bits) - 1;
+            // Keep numerators non-zero so the same operands can be used as divisors.
+            const std::int64_t num = static_cast<std::int64_t>(rng() & static_cast<std::uint64_t>(mask)) | 1;
+            const std::int64_t denom = static_cast<std::int64_t>(rng() & static_cast<std::uint64_t>(mask)) + 1;
+            values.emplace_back(num, denom);
+        } else {
+            limo::numerics::BigInt num(static_cast<std::int64_t>(rng() >> 1) | 1);
+            limo::numerics::BigInt denom(static_cast<std::int64_t>(rng() >> 1) + 1);
+            for (int b = 63; b < bits; b += 63) {
+                num = num * limo::numerics::BigInt(static_cast<std::int64_t>(rng() >> 1) | 1);
+                denom = denom * limo::numerics::BigInt(static_cast<std::int64_t>(rng() >> 1) + 1);
+            }
+            values.emplace_back(num, denom);
+        }
+    }
+    return values;
+}
+
+constexpr std::size_t kOperandCount = 1024;
+
+template <typename Op>
+void runBinary(benchmark::State& state, Op op) {
+    const std::vector<Fraction> left = makeOperands(static_cast<int>(state.range(0)), kOperandCount);
+    const std::vector<Fraction> right = makeOperands(static_cast<int>(state.range(0)) - 1, kOperandCount);
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(op(left[i], right[i]));
+        i = (i + 1) % kOperandCount;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_FractionAdd(benchmark::State& state) {
+    runBinary(state, [](const Fraction& a, const Fraction& b) { return a + b; });
+}
+
+void BM_FractionMultiply(benchmark::State& state) {
+    runBinary(state, [](const Fraction& a, const Fraction& b) { return a * b; });
+}
+
+void BM_FractionDivide(benchmark::State& state) {
+    runBinary(state, [](const Fraction& a, const Fraction& b) { return a / b; });
+}
+
+void BM_FractionCompare(benchmark::State& state) {
+    runBinary(state, [](const Fraction& a, const Fraction& b) { return a < b; });
+}
+
+void BM_FractionMultiplyAdd(benchmark::State& state) {
+    // The add_scaled_row kernel: target + source * factor.
+    runBinary(state, [](const Fraction& a, const Fraction& b) { return a + b * a; });
+}
+
+BENCHMARK(BM_FractionAdd)->Arg(8)->Arg(31)->Arg(62)->Arg(256);
+BENCHMARK(BM_FractionMultiply)->Arg(8)->Arg(31)->Arg(62)->Arg(256);
+BENCHMARK(BM_FractionDivide)->Arg(8)->Arg(31)->Arg(62)->Arg(256);
+BENCHMARK(BM_FractionCompare)->Arg(8)->Arg(31)->Arg(62)->Arg(256);
+BENCHMARK(BM_FractionMultiplyAdd)->Arg(8)->Arg(31)->Arg(62)->Arg(256);
+
+/**
+ * Random small-integer square block with an identity appended on the right,
+ * i.e. the [A | I] layout of a tableau with slack columns.
+ */
+Matrix<Fraction> makeIntegerMatrix(std::size_t size) {
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> entry(-9, 9);
+    Matrix<Fraction> matrix(size, 2 * size);
+    for (std::size_t r = 0; r < size; ++r) {
+        for (std::size_t c = 0; c < size; ++c) {
+            matrix(r, c) = Fraction(entry(rng));
+        }
+        matrix(r, r) = matrix(r, r) + Fraction(40);
+        matrix(r, size + r) = Fraction(1);
+    }
+    return matrix;
+}
+
+void reportMagnitudes(benchmark::State& state, const Matrix<Fraction>& matrix) {
+    std::size_t maxBits = 0;
+    std::size_t inlineCount = 0;
+    for (const Fraction& value : matrix) {
+        maxBits = std::max({maxBits, value.getBigNumerator().bitLength(), value.getBigDenominator().bitLength()});
+        inlineCount += value.isInline() ? 1 : 0;
+    }
+    state.counters["max_bits"] = static_cast<double>(maxBits);
+    state.counters["inline_ratio"] = static_cast<double>(inlineCount) / static_cast<double>(matrix.size());
+}
+
+/**
+ * Gauss-Jordan pivots on [A | I] built from scale_row/add_scaled_row, the
+ * same pattern a dense tableau performs. Reports the largest numerator/denominator bit length and
+ * the share of entries still held inline after `range(0)` pivots.
+ */
+void BM_FractionPivotChain(benchmark::State& state) {
+    const std::size_t size = 24;
+    const std::size_t pivots = static_cast<std::size_t>(state.range(0));
+    Matrix<Fraction> last;
+    for (auto _ : state) {
+        Matrix<Fraction> matrix = makeIntegerMatrix(size);
+        for (std::size_t p = 0; p < pivots; ++p) {
+            const std::size_t pivot = p % size;
+            matrix.scale_row(pivot, Fraction(1) / matrix(pivot, pivot));
+            for (std::size_t r = 0; r < size; ++r) {
+                if (r != pivot) {
+                    matrix.add_scaled_row(r, pivot, -matrix(r, pivot));
+                }
+            }
+        }
+        benchmark::DoNotOptimize(matrix.data());
+        last = std::move(matrix);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(pivots * size * 2 * size));
+    reportMagnitudes(state, last);
+}
+
+/**
+ * Long chains of add_scaled_row with random small rational factors; without
+ * canonicalization the magnitudes would grow with every step.
+ */
+void BM_FractionAddScaledRowChain(benchmark::State& state) {
+    const std::size_t size = 16;
+    const std::size_t steps = static_cast<std::size_t>(state.range(0));
+    Matrix<Fraction> last;
+    for (auto _ : state) {
+        std::mt19937 rng(11);
+        std::uniform_int_distribution<int> factor(-6, 6);
+        std::uniform_int_distribution<std::size_t> row(0, size - 1);
+        Matrix<Fraction> matrix = makeIntegerMatrix(size);
+        for (std::size_t s = 0; s < steps; ++s) {
+            const std::size_t target = row(rng);
+            const std::size_t source = (target + 1 + row(rng) % (size - 1)) % size;
+            matrix.add_scaled_row(target, source, Fraction(factor(rng), 7));
+        }
+        benchmark::DoNotOptimize(matrix.data());
+        last = std::move(matrix);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(steps * 2 * size));
+    reportMagnitudes(state, last);
+}
+
+BENCHMARK(BM_FractionPivotChain)->Arg(4)->Arg(12)->Arg(24);
+BENCHMARK(BM_FractionAddScaledRowChain)->Arg(16)->Arg(64)->Arg(256);
+
+} // namespace
@@ -0,0 +1,209 @@
+#include "limo/numerics/LU.hpp"
+#include "limo/numerics/Matrix.hpp"
+#include "limo/numerics/RowKernels.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <vector>
+
+using limo::numerics::LU;
+using limo::numerics::Matrix;
+namespace kernels = limo::numerics::kernels;
+
+namespace {
+
+Matrix<double> makeDense(std::size_t rows, std::size_t cols) {
+    std::mt19937_64 rng(3);
+    std::uniform_real_distribution<double> entry(-1.0, 1.0);
+    Matrix<double> matrix(rows, cols);
+    for (double& value : matrix) {
+        value = entry(rng);
+    }
+    for (std::size_t i = 0; i < std::min(rows, cols); ++i) {
+        matrix(i, i) += 4.0;
+    }
+    return matrix;
+}
+
+/**
+ * Selects the ISA given as range(1) (0 = scalar, 1 = AVX2, 2 = AVX-512) and
+ * skips the run when the CPU lacks it.
+ */
+bool selectFromState(benchmark::State& state) {
+    const auto isa = static_cast<kernels::Isa>(state.range(1));
+    if (!kernels::selectIsa(isa)) {
+        state.SkipWithError("ISA not supported on this CPU");
+        return false;
+    }
+    state.SetLabel(kernels::isaName(isa));
+    return true;
+}
+
+void BM_MatrixAddScaledRow(benchmark::State& state) {
+    if (!selectFromState(state)) {
+        return;
+    }
+    const std::size_t cols = static_cast<std::size_t>(state.range(0));
+    Matrix<double> matrix = makeDense(2, cols);
+    for (auto _ : state) {
+        matrix.add_scaled_row(0, 1, 1e-9);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(3 * cols * sizeof(double)));
+}
+
+/**
+ * One full tableau pivot: eliminate_column versus the equivalent sequence of
+ * scale_row/add_scaled_row calls.
+ */
+void BM_MatrixEliminateColumn(benchmark::State& state) {
+    if (!selectFromState(state)) {
+        return;
+    }
+    const std::size_t size = static_cast<std::size_t>(state.range(0));
+    const Matrix<double> original = makeDense(size, 2 * size);
+    Matrix<double> matrix = original;
+    std::size_t pivot = 0;
+    for (auto _ : state) {
+        matrix.eliminate_column(pivot, pivot);
+        pivot = (pivot + 1) % size;
+        if (pivot == 0) {
+            state.PauseTiming();
+            matrix = original;
+            state.ResumeTiming();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(size * 2 * size));
+}
+
+void BM_MatrixRowByRowPivot(benchmark::State& state) {
+    if (!selectFromState(state)) {
+        return;
+    }
+    const std::size_t size = static_cast<std::size_t>(state.range(0));
+    const Matrix<double> original = makeDense(size, 2 * size);
+    Matrix<double> matrix = original;
+    std::size_t pivot = 0;
+    for (auto _ : state) {
+        matrix.scale_row(pivot, 1.0 / matrix(pivot, pivot));
+        for (std::size_t r = 0; r < size; ++r) {
+            if (r != pivot) {
+                matrix.add_scaled_row(r, pivot, -matrix(r, pivot));
+            }
+        }
+        pivot = (pivot + 1) % size;
+        if (pivot == 0) {
+            state.PauseTiming();
+            matrix = original;
+            state.ResumeTiming();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(size * 2 * size));
+}
+
+/**
+ * The previous operator* (plain i-k-j loop) as a baseline for the blocked product.
+ */
+Matrix<double> naiveProduct(const Matrix<double>& left, const Matrix<double>& right) {
+    Matrix<double> result(left.rows(), right.cols(), 0.0);
+    for (std::size_t r = 0; r < left.rows(); ++r) {
+        for (std::size_t k = 0; k < left.cols(); ++k) {
+            const double a = left(r, k);
+            for (std::size_t c = 0; c < right.cols(); ++c) {
+                result(r, c) += a * right(k, c);
+            }
+        }
+    }
+    return result;
+}
+
+void BM_MatrixMultiplyNaive(benchmark::State& state) {
+    const std::size_t size = static_cast<std::size_t>(state.range(0));
+    const Matrix<double> left = makeDense(size, size);
+    const Matrix<double> right = makeDense(size, size);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(naiveProduct(left, right).data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(size * size * size));
+}
+
+void BM_MatrixMultiplyBlocked(benchmark::State& state) {
+    const std::size_t size = static_cast<std::size_t>(state.range(0));
+    const Matrix<double> left = makeDense(size, size);
+    const Matrix<double> right = makeDense(size, size);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize((left * right).data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(size * size * size));
+}
+
+void BM_MatrixMultiplyParallel(benchmark::State& state) {
+    const std::size_t size = static_cast<std::size_t>(state.range(0));
+    const Matrix<double> left = makeDense(size, size);
+    const Matrix<double> right = makeDense(size, size);
+    limo::thread_pool::ThreadPool pool(std::thread::hardware_concurrency());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(left.multiply(right, pool).data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(size * size * size));
+    state.counters["threads"] = static_cast<double>(pool.size());
+}
+
+void BM_MatrixTranspose(benchmark::State& state) {
+    const std::size_t size = static_cast<std::size_t>(state.range(0));
+    const Matrix<double> matrix = makeDense(size, size + 3);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(matrix.transpose().data());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(2 * matrix.size() * sizeof(double)));
+}
+
+/**
+ * A basis is factored once and then used for range(1) solves, the way a
+ * simplex iteration runs FTRAN/BTRAN. Compared with forming the explicit
+ * inverse and multiplying it with each right-hand side.
+ */
+void BM_LUFactorAndSolve(benchmark::State& state) {
+    const std::size_t size = static_cast<std::size_t>(state.range(0));
+    const std::size_t solves = static_cast<std::size_t>(state.range(1));
+    const Matrix<double> basis = makeDense(size, size);
+    const std::vector<double> rhs(size, 1.0);
+    for (auto _ : state) {
+        const LU<double> lu(basis);
+        for (std::size_t s = 0; s < solves; ++s) {
+            benchmark::DoNotOptimize(lu.solve(rhs).data());
+        }
+    }
+}
+
+void BM_InverseAndMultiply(benchmark::State& state) {
+    const std::size_t size = static_cast<std::size_t>(state.range(0));
+    const std::size_t solves = static_cast<std::size_t>(state.range(1));
+    const Matrix<double> basis = makeDense(size, size);
+    Matrix<double> rhs(size, 1, 1.0);
+    for (auto _ : state) {
+        const Matrix<double> inverse = basis.inverse();
+        for (std::size_t s = 0; s < solves; ++s) {
+            benchmark::DoNotOptimize((inverse * rhs).data());
+        }
+    }
+}
+
+BENCHMARK(BM_LUFactorAndSolve)->ArgsProduct({{64, 256}, {1, 16}});
+BENCHMARK(BM_InverseAndMultiply)->ArgsProduct({{64, 256}, {1, 16}});
+
+BENCHMARK(BM_MatrixMultiplyNaive)->Arg(128)->Arg(512)->Arg(1024)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_MatrixMultiplyBlocked)->Arg(128)->Arg(512)->Arg(1024)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_MatrixMultiplyParallel)->Arg(512)->Arg(1024)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_MatrixTranspose)->Arg(256)->Arg(2048);
+
+BENCHMARK(BM_MatrixAddScaledRow)->ArgsProduct({{64, 1024, 16384}, {0, 1, 2}});
+BENCHMARK(BM_MatrixEliminateColumn)->ArgsProduct({{128, 512}, {0, 1, 2}});
+BENCHMARK(BM_MatrixRowByRowPivot)->ArgsProduct({{128, 512}, {0, 1, 2}});
+
+} // namespace
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace limo::numerics {
+
+/**
+ * @brief Arbitrary precision signed integer.
+ *
+ * Stores the magnitude as little-endian 32-bit limbs next to a sign flag.
+ * Used as the overflow representation of Fraction, so it favours a small,
+ * dependency-free implementation (schoolbook multiplication, Knuth division)
+ * over asymptotically fast algorithms.
+ */
+class BigInt {
+public:
+    using Limb = std::uint32_t;
+
+    BigInt() = default;
+    BigInt(std::int64_t value);
+
+    bool isZero() const { return limbs.empty(); }
+    bool isNegative() const { return negative; }
+    int sign() const { return isZero() ? 0 : (negative ? -1 : 1); }
+
+    /**
+     * @brief Number of significant bits of the magnitude (0 for zero).
+     */
+    std::size_t bitLength() const;
+
+    bool fitsInt64() const;
+    /**
+     * @brief Converts to a 64-bit integer.
+     * @throws std::overflow_error if the value does not fit.
+     */
+    std::int64_t toInt64() const;
+    double toDouble() const;
+    std::string toString() const;
+
+    BigInt abs() const;
+
+    BigInt operator-() const;
+    BigInt operator+(const BigInt& other) const;
+    BigInt operator-(const BigInt& other) const;
+    BigInt operator*(const BigInt& other) const;
+    /**
+     * @brief Truncating division, matching the semantics of built-in integers.
+     * @throws std::invalid_argument on division by zero.
+     */
+    BigInt operator/(const BigInt& other) const;
+    BigInt operator%(const BigInt& other) const;
+    BigInt operator<<(std::size_t bits) const;
+    BigInt operator>>(std::size_t bits) const;
+
+    BigInt& operator+=(const BigInt& other) { return *this = *this + other; }
+    BigInt& operator-=(const BigInt& other) { return *this = *this - other; }
+    BigInt& operator*=(const BigInt& other) { return *this = *this * other; }
+    BigInt& operator/=(const BigInt& other) { return *this = *this / other; }
+
+    bool operator==(const BigInt& other) const = default;
+    std::strong_ordering operator<=>(const BigInt& other) const;
+
+    /**
+     * @brief Computes quotient and remainder of a truncating division in one pass.
+     * @throws std::invalid_argument on division by zero.
+     */
+    static void divMod(const BigInt& dividend, const BigInt& divisor, BigInt& quotient, BigInt& remainder);
+
+    /**
+     * @brief Greatest common divisor of the magnitudes (always non-negative).
+     *
+     * Uses one division step to balance operand sizes, then an in-place
+     * binary GCD that finishes in machine words.
+     */
+    static BigInt gcd(BigInt left, BigInt right);
+
+private:
+    using Limbs = std::vector<Limb>;
+
+    bool negative{false};
+    Limbs limbs;
+
+    void trim();
+
+    static int compareMagnitude(const Limbs& left, const Limbs& right);
+    static Limbs addMagnitude(const Limbs& left, const Limbs& right);
+    static Limbs subtractMagnitude(const Limbs& larger, const Limbs& smaller);
+    static Limbs multiplyMagnitude(const Limbs& left, const Limbs& right);
+    static void divModMagnitude(const Limbs& dividend, const Limbs& divisor, Limbs& quotient, Limbs& remainder);
+    static std::size_t trailingZeroBits(const Limbs& value);
+    static void shiftRightInPlace(Limbs& value, std::size_t bits);
+    static void subtractInPlace(Limbs& larger, const Limbs& smaller);
+    static std::uint64_t toWord(const Limbs& value);
+};
+
+std::ostream& operator<<(std::ostream& stream, const BigInt& value);
+
+} // namespace limo::numerics
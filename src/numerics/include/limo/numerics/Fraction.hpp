@@ -1,5 +1,12 @@
 #pragma once
 
+#include "limo/numerics/BigInt.hpp"
+
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <string>
+
 namespace limo::numerics::fraction {
 
 /**
@@ -9,22 +16,66 @@ namespace limo::numerics::fraction {
  * losing exact fractional precision. Aims to keep fractions in reduced form and
  * reduce fault accumulation during simplex operations.
  *
+ * Values are stored inline as two 64-bit integers while they fit. Every
+ * arithmetic step uses checked multiplication/addition; when an intermediate
+ * result overflows, the value is promoted to a heap-allocated BigInt pair and
+ * demoted back as soon as it fits into 64 bits again. The denominator is kept
+ * positive, so the common small case never allocates.
+ *
+ * Every constructor and operator returns the canonical (fully reduced) form:
+ * products cross-cancel gcd(a, d) and gcd(c, b) before multiplying, sums use
+ * the lcm-based formula, and the 64-bit path uses a binary GCD. normalize()
+ * is therefore only needed for values built before this invariant existed and
+ * is kept for compatibility.
+ *
  * @author Volodymyr Shpyrka
  */
 class Fraction {
 public:
-    Fraction(int numerator = 0, int denominator = 1) : num(numerator), denom(denominator) {}
+    /**
+     * @throws std::invalid_argument if the denominator is zero.
+     */
+    Fraction(std::int64_t numerator = 0, std::int64_t denominator = 1);
+    Fraction(const BigInt& numerator, const BigInt& denominator = BigInt(1));
+
+    Fraction(const Fraction& other);
+    Fraction(Fraction&& other) noexcept = default;
+    Fraction& operator=(const Fraction& other);
+    Fraction& operator=(Fraction&& other) noexcept = default;
+    ~Fraction() = default;
 
     void normalize();
     double toDouble() const;
+    std::string toString() const;
+
+    /**
+     * @brief True while the value is held in the allocation-free 64-bit representation.
+     */
+    bool isInline() const { return !big; }
 
-    int getNumerator() const { return num; }
-    int getDenominator() const { return denom; }
+    /**
+     * @throws std::overflow_error if the value is not representable with 64-bit parts.
+     */
+    std::int64_t getNumerator() const;
+    std::int64_t getDenominator() const;
+
+    BigInt getBigNumerator() const;
+    BigInt getBigDenominator() const;
 
     Fraction operator+(const Fraction& other) const;
     Fraction operator-(const Fraction& other) const;
     Fraction operator*(const Fraction& other) const;
+    /**
+     * @throws std::invalid_argument on division by zero.
+     */
     Fraction operator/(const Fraction& other) const;
+    Fraction operator-() const;
+
+    Fraction& operator+=(const Fraction& other) { return *this = *this + other; }
+    Fraction& operator-=(const Fraction& other) { return *this = *this - other; }
+    Fraction& operator*=(const Fraction& other) { return *this = *this * other; }
+    Fraction& operator/=(const Fraction& other) { return *this = *this / other; }
+
     bool operator==(const Fraction& other) const;
     bool operator!=(const Fraction& other) const;
     bool operator<(const Fraction& other) const;
@@ -33,8 +84,20 @@ public:
     bool operator>=(const Fraction& other) const;
 
 private:
-    int num;
-    int denom;
+    struct BigParts {
+        BigInt num;
+        BigInt denom;
+    };
+
+    std::int64_t num;
+    std::int64_t denom;
+    std::unique_ptr<BigParts> big;
+
+    static Fraction fromBig(BigInt numerator, BigInt denominator);
+    static Fraction fromReduced(std::int64_t numerator, std::int64_t denominator);
+    int compare(const Fraction& other) const;
 };
 
+std::ostream& operator<<(std::ostream& stream, const Fraction& value);
+
 } // namespace limo::numerics::fraction
@@ -0,0 +1,330 @@
+#pragma once
+
+#include "limo/numerics/Matrix.hpp"
+#include "limo/numerics/RowKernels.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace limo::numerics {
+
+/**
+ * @brief LU factorization PA = LU of a square matrix with partial pivoting.
+ *
+ * The matrix is factored once and can then be used for any number of
+ * solves with A (FTRAN) and with Aᵀ (BTRAN), each costing O(n²) instead of
+ * the O(n³) of forming an explicit inverse. L (unit lower triangular) and U
+ * are stored packed in a single row-major matrix next to the row permutation.
+ *
+ * Floating-point types pick the largest magnitude in the pivot column; a
+ * pivot below n·ε·max|aᵢⱼ| is treated as zero. Exact types such as Fraction
+ * take the first non-zero entry, since every choice is equally accurate and
+ * comparing magnitudes is not free.
+ */
+template <typename T>
+class LU {
+public:
+	using size_type = std::size_t;
+
+	/**
+	 * @throws std::invalid_argument if the matrix is not square or is singular.
+	 */
+	explicit LU(const Matrix<T>& matrix) : factors_(matrix), permutation_(matrix.rows()) {
+		if (matrix.rows() != matrix.cols()) {
+			throw std::invalid_argument("LU factorization requires a square matrix");
+		}
+		std::iota(permutation_.begin(), permutation_.end(), size_type{0});
+		factorize();
+	}
+
+	size_type size() const { return factors_.rows(); }
+
+	/**
+	 * @brief Row permutation: row i of PA is row permutation()[i] of A.
+	 */
+	const std::vector<size_type>& permutation() const { return permutation_; }
+
+	/**
+	 * @brief Packed factors: U on and above the diagonal, L (without its unit diagonal) below it.
+	 */
+	const Matrix<T>& factors() const { return factors_; }
+
+	/**
+	 * @brief Solves A x = b.
+	 * @throws std::invalid_argument if b has the wrong length.
+	 */
+	std::vector<T> solve(const std::vector<T>& rhs) const {
+		ensure_length(rhs.size());
+		std::vector<T> x(size());
+		for (size_type i = 0; i < size(); ++i) {
+			x[i] = rhs[permutation_[i]];
+		}
+		forward_unit_lower(x);
+		backward_upper(x);
+		return x;
+	}
+
+	/**
+	 * @brief Solves Aᵀ y = b.
+	 * @throws std::invalid_argument if b has the wrong length.
+	 */
+	std::vector<T> solve_transpose(const std::vector<T>& rhs) const {
+		ensure_length(rhs.size());
+		std::vector<T> work(rhs);
+		forward_upper_transpose(work);
+		backward_unit_lower_transpose(work);
+		std::vector<T> y(size());
+		for (size_type i = 0; i < size(); ++i) {
+			y[permutation_[i]] = work[i];
+		}
+		return y;
+	}
+
+	/**
+	 * @brief Solves A X = B for every column of B at once.
+	 *
+	 * The substitutions run over whole rows of B, so all right-hand sides
+	 * share one pass over the factors.
+	 * @throws std::invalid_argument if B does not have size() rows.
+	 */
+	Matrix<T> solve(const Matrix<T>& rhs) const {
+		ensure_length(rhs.rows());
+		const size_type n = size();
+		const size_type width = rhs.cols();
+		Matrix<T> x(n, width);
+		for (size_type i = 0; i < n; ++i) {
+			std::copy_n(rhs.data() + permutation_[i] * width, width, x.data() + i * width);
+		}
+		for (size_type i = 0; i < n; ++i) {
+			T* target = x.data() + i * width;
+			for (size_type k = 0; k < i; ++k) {
+				const T& factor = factors_(i, k);
+				if (factor != T{}) {
+					axpy(target, x.data() + k * width, T{} - factor, width);
+				}
+			}
+		}
+		for (size_type i = n; i-- > 0;) {
+			T* target = x.data() + i * width;
+			for (size_type k = i + 1; k < n; ++k) {
+				const T& factor = factors_(i, k);
+				if (factor != T{}) {
+					axpy(target, x.data() + k * width, T{} - factor, width);
+				}
+			}
+			scale(target, T{1} / factors_(i, i), width);
+		}
+		return x;
+	}
+
+	/**
+	 * @brief Solves Aᵀ Y = B for every column of B at once.
+	 * @throws std::invalid_argument if B does not have size() rows.
+	 */
+	Matrix<T> solve_transpose(const Matrix<T>& rhs) const {
+		ensure_length(rhs.rows());
+		const size_type n = size();
+		const size_type width = rhs.cols();
+		Matrix<T> work(rhs);
+		// Uᵀ is lower triangular: eliminate row k from the rows below it.
+		for (size_type k = 0; k < n; ++k) {
+			T* source = work.data() + k * width;
+			scale(source, T{1} / factors_(k, k), width);
+			for (size_type i = k + 1; i < n; ++i) {
+				const T& factor = factors_(k, i);
+				if (factor != T{}) {
+					axpy(work.data() + i * width, source, T{} - factor, width);
+				}
+			}
+		}
+		// Lᵀ is unit upper triangular.
+		for (size_type k = n; k-- > 0;) {
+			const T* source = work.data() + k * width;
+			for (size_type i = 0; i < k; ++i) {
+				const T& factor = factors_(k, i);
+				if (factor != T{}) {
+					axpy(work.data() + i * width, source, T{} - factor, width);
+				}
+			}
+		}
+		Matrix<T> y(n, width);
+		for (size_type i = 0; i < n; ++i) {
+			std::copy_n(work.data() + i * width, width, y.data() + permutation_[i] * width);
+		}
+		return y;
+	}
+
+	/**
+	 * @brief Explicit inverse, for callers that really need A⁻¹ rather than solves.
+	 */
+	Matrix<T> inverse() const {
+		Matrix<T> identity(size(), size());
+		for (size_type i = 0; i < size(); ++i) {
+			identity(i, i) = T{1};
+		}
+		return solve(identity);
+	}
+
+	T determinant() const {
+		T result{1};
+		for (size_type i = 0; i < size(); ++i) {
+			result = result * factors_(i, i);
+		}
+		return swaps_ % 2 == 0 ? result : T{} - result;
+	}
+
+private:
+	Matrix<T> factors_;
+	std::vector<size_type> permutation_;
+	size_type swaps_ = 0;
+
+	// Right-looking elimination: after choosing the pivot of column k, every
+	// row below it stores its multiplier in column k and is updated with one
+	// contiguous axpy over columns k+1..n.
+	void factorize() {
+		const size_type n = size();
+		const T tolerance = singular_tolerance();
+		for (size_type k = 0; k < n; ++k) {
+			const size_type pivotRow = choose_pivot(k);
+			if (pivotRow == n || !is_nonzero(factors_(pivotRow, k), tolerance)) {
+				throw std::invalid_argument("Matrix is singular and cannot be factorized");
+			}
+			if (pivotRow != k) {
+				factors_.swap_rows(pivotRow, k);
+				std::swap(permutation_[pivotRow], permutation_[k]);
+				++swaps_;
+			}
+
+			const T* pivotData = factors_.data() + k * n;
+			const T inversePivot = T{1} / pivotData[k];
+			for (size_type i = k + 1; i < n; ++i) {
+				T* target = factors_.data() + i * n;
+				if (target[k] == T{}) {
+					continue;
+				}
+				const T multiplier = target[k] * inversePivot;
+				target[k] = multiplier;
+				axpy(target + k + 1, pivotData + k + 1, T{} - multiplier, n - k - 1);
+			}
+		}
+	}
+
+	size_type choose_pivot(size_type k) const {
+		const size_type n = size();
+		if constexpr (std::is_floating_point_v<T>) {
+			size_type best = k;
+			for (size_type i = k + 1; i < n; ++i) {
+				if (std::abs(factors_(i, k)) > std::abs(factors_(best, k))) {
+					best = i;
+				}
+			}
+			return best;
+		} else {
+			for (size_type i = k; i < n; ++i) {
+				if (factors_(i, k) != T{}) {
+					return i;
+				}
+			}
+			return n;
+		}
+	}
+
+	T singular_tolerance() const {
+		if constexpr (std::is_floating_point_v<T>) {
+			T largest{};
+			for (const T& value : factors_) {
+				largest = std::max(largest, std::abs(value));
+			}
+			return static_cast<T>(size()) * std::numeric_limits<T>::epsilon() * largest;
+		} else {
+			return T{};
+		}
+	}
+
+	static bool is_nonzero(const T& value, const T& tolerance) {
+		if constexpr (std::is_floating_point_v<T>) {
+			return std::abs(value) > tolerance;
+		} else {
+			return value != T{};
+		}
+	}
+
+	void forward_unit_lower(std::vector<T>& x) const {
+		for (size_type i = 0; i < size(); ++i) {
+			const T* row = factors_.data() + i * size();
+			T sum = x[i];
+			for (size_type k = 0; k < i; ++k) {
+				sum = sum - row[k] * x[k];
+			}
+			x[i] = sum;
+		}
+	}
+
+	void backward_upper(std::vector<T>& x) const {
+		for (size_type i = size(); i-- > 0;) {
+			const T* row = factors_.data() + i * size();
+			T sum = x[i];
+			for (size_type k = i + 1; k < size(); ++k) {
+				sum = sum - row[k] * x[k];
+			}
+			x[i] = sum / row[i];
+		}
+	}
+
+	// The transposed solves walk the factors row by row as well and scatter
+	// each solved entry into the remaining right-hand side.
+	void forward_upper_transpose(std::vector<T>& x) const {
+		const size_type n = size();
+		for (size_type k = 0; k < n; ++k) {
+			const T* row = factors_.data() + k * n;
+			x[k] = x[k] / row[k];
+			if (x[k] != T{}) {
+				axpy(x.data() + k + 1, row + k + 1, T{} - x[k], n - k - 1);
+			}
+		}
+	}
+
+	void backward_unit_lower_transpose(std::vector<T>& x) const {
+		const size_type n = size();
+		for (size_type k = n; k-- > 0;) {
+			if (x[k] != T{}) {
+				axpy(x.data(), factors_.data() + k * n, T{} - x[k], k);
+			}
+		}
+	}
+
+	void ensure_length(size_type length) const {
+		if (length != size()) {
+			throw std::invalid_argument("LU right-hand side size must match the matrix size");
+		}
+	}
+
+	static void axpy(T* target, const T* source, const T& factor, size_type count) {
+		if constexpr (std::is_same_v<T, double> || std::is_same_v<T, float>) {
+			kernels::axpy(target, source, factor, count);
+		} else {
+			for (size_type i = 0; i < count; ++i) {
+				target[i] = target[i] + source[i] * factor;
+			}
+		}
+	}
+
+	static void scale(T* values, const T& factor, size_type count) {
+		if constexpr (std::is_same_v<T, double> || std::is_same_v<T, float>) {
+			kernels::scale(values, factor, count);
+		} else {
+			for (size_type i = 0; i < count; ++i) {
+				values[i] = values[i] * factor;
+			}
+		}
+	}
+};
+
+} // namespace limo::numerics
@@ -1,15 +1,23 @@
 #pragma once
 
+#include "limo/numerics/RowKernels.hpp"
+#include "limo/thread_pool/ThreadPool.hpp"
+
 #include <algorithm>
+#include <array>
 #include <cstddef>
 #include <initializer_list>
 #include <span>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 namespace limo::numerics {
 
+template <typename T>
+class LU;
+
 /**
  * @brief Cache-friendly dense matrix with row-major storage
  * 
@@ -23,6 +31,19 @@ public:
 	using iterator = typename std::vector<T>::iterator;
 	using const_iterator = typename std::vector<T>::const_iterator;
 
+	/**
+	 * @brief Products with fewer multiply-adds than this use the simple i-k-j loop.
+	 */
+	static constexpr size_type kBlockedMultiplyThreshold = 64 * 64 * 64;
+	/**
+	 * @brief Products with fewer multiply-adds than this are not split across a thread pool.
+	 */
+	static constexpr size_type kParallelMultiplyThreshold = 256 * 256 * 256;
+	/**
+	 * @brief Matrices with fewer elements than this are transposed without tiling.
+	 */
+	static constexpr size_type kBlockedTransposeThreshold = 64 * 64;
+
 	Matrix() = default;
 
 	Matrix(size_type rows, size_type cols, const T& value = T{}) { resize(rows, cols, value); }
@@ -89,11 +110,34 @@ public:
 		return {data_.data() + rowIndex * cols_, cols_};
 	}
 
+	/**
+	 * @brief Returns the transposed matrix.
+	 *
+	 * Large matrices are copied in square tiles so both the source rows and
+	 * the destination columns of a tile stay in cache.
+	 */
 	Matrix transpose() const {
 		Matrix result(cols_, rows_);
-		for (size_type rowIndex = 0; rowIndex < rows_; ++rowIndex) {
-			for (size_type colIndex = 0; colIndex < cols_; ++colIndex) {
-				result(colIndex, rowIndex) = (*this)(rowIndex, colIndex);
+		if (size() < kBlockedTransposeThreshold) {
+			for (size_type rowIndex = 0; rowIndex < rows_; ++rowIndex) {
+				for (size_type colIndex = 0; colIndex < cols_; ++colIndex) {
+					result(colIndex, rowIndex) = (*this)(rowIndex, colIndex);
+				}
+			}
+			return result;
+		}
+
+		constexpr size_type tile = 32;
+		for (size_type rowBlock = 0; rowBlock < rows_; rowBlock += tile) {
+			const size_type rowEnd = std::min(rowBlock + tile, rows_);
+			for (size_type colBlock = 0; colBlock < cols_; colBlock += tile) {
+				const size_type colEnd = std::min(colBlock + tile, cols_);
+				for (size_type rowIndex = rowBlock; rowIndex < rowEnd; ++rowIndex) {
+					const T* source = data_.data() + rowIndex * cols_;
+					for (size_type colIndex = colBlock; colIndex < colEnd; ++colIndex) {
+						result.data_[colIndex * rows_ + rowIndex] = source[colIndex];
+					}
+				}
 			}
 		}
 		return result;
@@ -106,18 +150,14 @@ public:
 		if (left == right) {
 			return;
 		}
-		for (size_type col = 0; col < cols_; ++col) {
-			std::swap((*this)(left, col), (*this)(right, col));
-		}
+		std::swap_ranges(row_data(left), row_data(left) + cols_, row_data(right));
 	}
 
 	void scale_row(size_type rowIndex, const T& factor) {
 		if (rowIndex >= rows_) {
 			throw std::out_of_range("Matrix row index out of range");
 		}
-		for (size_type col = 0; col < cols_; ++col) {
-			(*this)(rowIndex, col) = (*this)(rowIndex, col) * factor;
-		}
+		scale_span(row_data(rowIndex), factor);
 	}
 
 	void add_scaled_row(size_type targetRow, size_type sourceRow, const T& factor) {
@@ -127,8 +167,42 @@ public:
 		if (factor == T{}) {
 			return;
 		}
-		for (size_type col = 0; col < cols_; ++col) {
-			(*this)(targetRow, col) = (*this)(targetRow, col) + (*this)(sourceRow, col) * factor;
+		axpy_span(row_data(targetRow), row_data(sourceRow), factor);
+	}
+
+	/**
+	 * @brief Performs a full Gauss-Jordan pivot on (pivotRow, pivotCol) in one pass.
+	 *
+	 * Scales the pivot row so the pivot becomes one, then subtracts it from
+	 * every other row with a non-zero entry in the pivot column. Each row is
+	 * visited exactly once, and the pivot column is set to the exact unit
+	 * vector afterwards so no rounding residue is left behind.
+	 *
+	 * @throws std::out_of_range if the pivot position is outside the matrix.
+	 * @throws std::invalid_argument if the pivot element is zero.
+	 */
+	void eliminate_column(size_type pivotRow, size_type pivotCol) {
+		ensure_in_range(pivotRow, pivotCol);
+		const T pivot = (*this)(pivotRow, pivotCol);
+		if (pivot == T{}) {
+			throw std::invalid_argument("Matrix pivot element must be non-zero");
+		}
+
+		T* pivotData = row_data(pivotRow);
+		scale_span(pivotData, T{1} / pivot);
+		pivotData[pivotCol] = T{1};
+
+		for (size_type rowIndex = 0; rowIndex < rows_; ++rowIndex) {
+			if (rowIndex == pivotRow) {
+				continue;
+			}
+			T* target = row_data(rowIndex);
+			const T factor = target[pivotCol];
+			if (factor == T{}) {
+				continue;
+			}
+			axpy_span(target, pivotData, T{} - factor);
+			target[pivotCol] = T{};
 		}
 	}
 
@@ -150,70 +224,55 @@ public:
 		return result;
 	}
 
+	/**
+	 * @brief Matrix product.
+	 *
+	 * Small products use the simple i-k-j loop; larger ones are cache blocked
+	 * (see multiply_rows_blocked).
+	 */
 	Matrix operator*(const Matrix& other) const {
-		if (cols_ != other.rows_) {
-			throw std::invalid_argument("Matrix multiplication requires left cols = right rows");
-		}
+		ensure_multipliable(other);
+		Matrix result(rows_, other.cols_, T{});
+		multiply_rows(other, result, 0, rows_);
+		return result;
+	}
 
+	/**
+	 * @brief Matrix product with row blocks of the result computed on a thread pool.
+	 *
+	 * Falls back to the serial product below kParallelMultiplyThreshold. The
+	 * calling thread and the pool's workers claim ranges of micro-kernel row
+	 * blocks through ThreadPool::parallelFor; each range owns disjoint result
+	 * rows, so no synchronization beyond the final wait is needed.
+	 */
+	Matrix multiply(const Matrix& other, thread_pool::ThreadPool& pool) const {
+		ensure_multipliable(other);
 		Matrix result(rows_, other.cols_, T{});
-		for (size_type rowIndex = 0; rowIndex < rows_; ++rowIndex) {
-			for (size_type k = 0; k < cols_; ++k) {
-				const T left = (*this)(rowIndex, k);
-				for (size_type colIndex = 0; colIndex < other.cols_; ++colIndex) {
-					result(rowIndex, colIndex) += left * other(k, colIndex);
-				}
-			}
+		if (multiply_adds(other) < kParallelMultiplyThreshold) {
+			multiply_rows(other, result, 0, rows_);
+			return result;
 		}
+
+		// Ranges are counted in micro-kernel blocks so that every range
+		// starts on a block boundary.
+		const size_type blocks = (rows_ + kMicroRows - 1) / kMicroRows;
+		pool.parallelFor(0, blocks, 1, [this, &other, &result](size_type first, size_type last) {
+			multiply_rows(other, result, first * kMicroRows, std::min(last * kMicroRows, rows_));
+		});
 		return result;
 	}
 
+	/**
+	 * @brief Returns the explicit inverse, computed through an LU factorization.
+	 *
+	 * Callers that only need A⁻¹b should factor once with LU and use its
+	 * solves instead.
+	 */
 	Matrix inverse() const {
 		if (rows_ != cols_) {
 			throw std::invalid_argument("Matrix inverse requires a square matrix");
 		}
-
-		const size_type n = rows_;
-		Matrix work(*this);
-		Matrix inv = identity(n);
-
-		for (size_type i = 0; i < n; ++i) {
-			size_type pivotRow = i;
-			while (pivotRow < n && work(pivotRow, i) == T{}) {
-				++pivotRow;
-			}
-			if (pivotRow == n) {
-				throw std::invalid_argument("Matrix is singular and cannot be inverted");
-			}
-			if (pivotRow != i) {
-				work.swap_rows(pivotRow, i);
-				inv.swap_rows(pivotRow, i);
-			}
-
-			const T pivot = work(i, i);
-			if (pivot == T{}) {
-				throw std::invalid_argument("Matrix is singular and cannot be inverted");
-			}
-			for (size_type col = 0; col < n; ++col) {
-				work(i, col) = work(i, col) / pivot;
-				inv(i, col) = inv(i, col) / pivot;
-			}
-
-			for (size_type row = 0; row < n; ++row) {
-				if (row == i) {
-					continue;
-				}
-				const T factor = work(row, i);
-				if (factor == T{}) {
-					continue;
-				}
-				for (size_type col = 0; col < n; ++col) {
-					work(row, col) = work(row, col) - factor * work(i, col);
-					inv(row, col) = inv(row, col) - factor * inv(i, col);
-				}
-			}
-		}
-
-		return inv;
+		return LU<T>(*this).inverse();
 	}
 
 	bool operator==(const Matrix& other) const {
@@ -236,12 +295,172 @@ private:
 
 	size_type index(size_type row, size_type col) const { return row * cols_ + col; }
 
-	static Matrix identity(size_type size) {
-		Matrix result(size, size, T{});
-		for (size_type i = 0; i < size; ++i) {
-			result(i, i) = T{1};
+	T* row_data(size_type rowIndex) { return data_.data() + rowIndex * cols_; }
+
+	// Blocking parameters for the product: kMicroRows x kMicroCols is the
+	// register tile, kBlockDepth x kBlockCols the packed panel of the right
+	// operand that is reused by every row of the left operand.
+	static constexpr size_type kMicroRows = kernels::kTileRows;
+	static constexpr size_type kMicroCols = kernels::kTileCols;
+	static constexpr size_type kBlockDepth = 256;
+	static constexpr size_type kBlockCols = 512;
+
+	void ensure_multipliable(const Matrix& other) const {
+		if (cols_ != other.rows_) {
+			throw std::invalid_argument("Matrix multiplication requires left cols = right rows");
+		}
+	}
+
+	size_type multiply_adds(const Matrix& other) const { return rows_ * cols_ * other.cols_; }
+
+	void multiply_rows(const Matrix& other, Matrix& result, size_type rowBegin, size_type rowEnd) const {
+		if (multiply_adds(other) < kBlockedMultiplyThreshold) {
+			multiply_rows_simple(other, result, rowBegin, rowEnd);
+		} else {
+			multiply_rows_blocked(other, result, rowBegin, rowEnd);
+		}
+	}
+
+	void multiply_rows_simple(const Matrix& other, Matrix& result, size_type rowBegin, size_type rowEnd) const {
+		for (size_type rowIndex = rowBegin; rowIndex < rowEnd; ++rowIndex) {
+			for (size_type k = 0; k < cols_; ++k) {
+				const T left = (*this)(rowIndex, k);
+				for (size_type colIndex = 0; colIndex < other.cols_; ++colIndex) {
+					result(rowIndex, colIndex) += left * other(k, colIndex);
+				}
+			}
+		}
+	}
+
+	/**
+	 * Blocked product for rows [rowBegin, rowEnd). Arithmetic types pack a
+	 * kBlockDepth x kBlockCols panel of the right operand into contiguous
+	 * kMicroCols-wide strips and accumulate kMicroRows x kMicroCols tiles in
+	 * registers; float/double tiles use the SIMD micro-kernels from
+	 * RowKernels, other arithmetic types a generic one. Other types (e.g.
+	 * Fraction) use the same blocking without packing, since copying them
+	 * is not free.
+	 */
+	void multiply_rows_blocked(const Matrix& other, Matrix& result, size_type rowBegin, size_type rowEnd) const {
+		const size_type depth = cols_;
+		const size_type width = other.cols_;
+
+		if constexpr (std::is_arithmetic_v<T>) {
+			std::vector<T> packed(kBlockDepth * (kBlockCols + kMicroCols));
+			for (size_type kBlock = 0; kBlock < depth; kBlock += kBlockDepth) {
+				const size_type kCount = std::min(kBlockDepth, depth - kBlock);
+				for (size_type colBlock = 0; colBlock < width; colBlock += kBlockCols) {
+					const size_type colCount = std::min(kBlockCols, width - colBlock);
+					pack_panel(other, packed.data(), kBlock, kCount, colBlock, colCount);
+
+					if constexpr (std::is_same_v<T, double> || std::is_same_v<T, float>) {
+						for (size_type rowIndex = rowBegin; rowIndex < rowEnd; rowIndex += kMicroRows) {
+							const size_type rowCount = std::min(kMicroRows, rowEnd - rowIndex);
+							for (size_type strip = 0; strip < colCount; strip += kMicroCols) {
+								kernels::multiplyTile(data_.data() + rowIndex * depth + kBlock, depth,
+									packed.data() + strip * kCount, kCount,
+									result.data_.data() + rowIndex * width + colBlock + strip, width, rowCount,
+									std::min(kMicroCols, colCount - strip));
+							}
+						}
+					} else {
+						size_type rowIndex = rowBegin;
+						for (; rowIndex + kMicroRows <= rowEnd; rowIndex += kMicroRows) {
+							multiply_strips<kMicroRows>(packed.data(), result, rowIndex, kBlock, kCount, colBlock,
+								colCount);
+						}
+						for (; rowIndex < rowEnd; ++rowIndex) {
+							multiply_strips<1>(packed.data(), result, rowIndex, kBlock, kCount, colBlock, colCount);
+						}
+					}
+				}
+			}
+		} else {
+			for (size_type kBlock = 0; kBlock < depth; kBlock += kBlockDepth) {
+				const size_type kEnd = std::min(kBlock + kBlockDepth, depth);
+				for (size_type colBlock = 0; colBlock < width; colBlock += kBlockCols) {
+					const size_type colEnd = std::min(colBlock + kBlockCols, width);
+					for (size_type rowIndex = rowBegin; rowIndex < rowEnd; ++rowIndex) {
+						T* target = result.data_.data() + rowIndex * width;
+						for (size_type k = kBlock; k < kEnd; ++k) {
+							const T& left = data_[rowIndex * depth + k];
+							if (left == T{}) {
+								continue;
+							}
+							const T* source = other.data_.data() + k * width;
+							for (size_type colIndex = colBlock; colIndex < colEnd; ++colIndex) {
+								target[colIndex] += left * source[colIndex];
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+
+	// Copies other[kBlock.., colBlock..] into strips of kMicroCols columns,
+	// each stored k-major and zero padded, so the micro-kernel streams it linearly.
+	static void pack_panel(const Matrix& other, T* packed, size_type kBlock, size_type kCount, size_type colBlock,
+		size_type colCount) {
+		for (size_type strip = 0; strip < colCount; strip += kMicroCols) {
+			const size_type stripCols = std::min(kMicroCols, colCount - strip);
+			T* out = packed + strip * kCount;
+			for (size_type k = 0; k < kCount; ++k) {
+				const T* source = other.data_.data() + (kBlock + k) * other.cols_ + colBlock + strip;
+				for (size_type c = 0; c < kMicroCols; ++c) {
+					out[k * kMicroCols + c] = c < stripCols ? source[c] : T{};
+				}
+			}
+		}
+	}
+
+	template <size_type Rows>
+	void multiply_strips(const T* packed, Matrix& result, size_type rowIndex, size_type kBlock, size_type kCount,
+		size_type colBlock, size_type colCount) const {
+		const size_type depth = cols_;
+		const size_type width = result.cols_;
+		for (size_type strip = 0; strip < colCount; strip += kMicroCols) {
+			const T* panel = packed + strip * kCount;
+			std::array<std::array<T, kMicroCols>, Rows> accumulator{};
+			for (size_type k = 0; k < kCount; ++k) {
+				const T* b = panel + k * kMicroCols;
+				for (size_type r = 0; r < Rows; ++r) {
+					const T a = data_[(rowIndex + r) * depth + kBlock + k];
+					for (size_type c = 0; c < kMicroCols; ++c) {
+						accumulator[r][c] += a * b[c];
+					}
+				}
+			}
+			const size_type stripCols = std::min(kMicroCols, colCount - strip);
+			for (size_type r = 0; r < Rows; ++r) {
+				T* target = result.data_.data() + (rowIndex + r) * width + colBlock + strip;
+				for (size_type c = 0; c < stripCols; ++c) {
+					target[c] += accumulator[r][c];
+				}
+			}
+		}
+	}
+
+	// Row kernels: float/double go through the SIMD dispatch in RowKernels,
+	// every other scalar type uses a plain pointer loop.
+	void scale_span(T* values, const T& factor) {
+		if constexpr (std::is_same_v<T, double> || std::is_same_v<T, float>) {
+			kernels::scale(values, factor, cols_);
+		} else {
+			for (size_type col = 0; col < cols_; ++col) {
+				values[col] = values[col] * factor;
+			}
+		}
+	}
+
+	void axpy_span(T* target, const T* source, const T& factor) {
+		if constexpr (std::is_same_v<T, double> || std::is_same_v<T, float>) {
+			kernels::axpy(target, source, factor, cols_);
+		} else {
+			for (size_type col = 0; col < cols_; ++col) {
+				target[col] = target[col] + source[col] * factor;
+			}
 		}
-		return result;
 	}
 
 	void ensure_same_size(const Matrix& other, const char* message) const {
@@ -258,3 +477,6 @@ private:
 };
 
 } // namespace limo::numerics
+
+// LU uses Matrix as its storage, and Matrix::inverse is implemented on top of LU.
+#include "limo/numerics/LU.hpp"
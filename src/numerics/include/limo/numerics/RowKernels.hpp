@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+
+namespace limo::numerics::kernels {
+
+/**
+ * @brief Instruction set used by the floating-point row kernels.
+ */
+enum class Isa {
+    Scalar,
+    Avx2,
+    Avx512,
+};
+
+const char* isaName(Isa isa);
+
+/**
+ * @brief Whether the running CPU (and build) can execute kernels for the given ISA.
+ */
+bool isSupported(Isa isa);
+
+/**
+ * @brief ISA currently used by the dispatching entry points.
+ *
+ * Resolved once on first use to the widest supported instruction set.
+ */
+Isa activeIsa();
+
+/**
+ * @brief Overrides the dispatch target, e.g. to compare kernels in tests or benchmarks.
+ * @return false (and leaves the selection unchanged) if the ISA is not supported.
+ */
+bool selectIsa(Isa isa);
+
+/**
+ * @brief target[i] += factor * source[i] for i in [0, count).
+ *
+ * target and source may be the same pointer, but must not otherwise overlap.
+ */
+void axpy(double* target, const double* source, double factor, std::size_t count);
+void axpy(float* target, const float* source, float factor, std::size_t count);
+
+/**
+ * @brief values[i] *= factor for i in [0, count).
+ */
+void scale(double* values, double factor, std::size_t count);
+void scale(float* values, float factor, std::size_t count);
+
+/**
+ * @brief Height of the register tile computed by multiplyTile.
+ */
+inline constexpr std::size_t kTileRows = 4;
+/**
+ * @brief Width of the register tile and of the packed right-operand strips.
+ */
+inline constexpr std::size_t kTileCols = 8;
+
+/**
+ * @brief Register-blocked matrix product micro-kernel.
+ *
+ * c[r * ldc + j] += sum over k < depth of a[r * lda + k] * packed[k * kTileCols + j]
+ * for r < rows and j < cols. The right operand strip is packed k-major and
+ * zero padded to kTileCols columns; rows <= kTileRows and cols <= kTileCols.
+ */
+void multiplyTile(const double* a, std::size_t lda, const double* packed, std::size_t depth, double* c,
+                  std::size_t ldc, std::size_t rows, std::size_t cols);
+void multiplyTile(const float* a, std::size_t lda, const float* packed, std::size_t depth, float* c,
+                  std::size_t ldc, std::size_t rows, std::size_t cols);
+
+} // namespace limo::numerics::kernels
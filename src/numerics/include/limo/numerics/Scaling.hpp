@@ -0,0 +1,235 @@
+#pragma once
+
+#include "limo/numerics/Matrix.hpp"
+#include "limo/numerics/SparseMatrix.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace limo::numerics {
+
+/**
+ * @brief Controls compute_scale_factors.
+ */
+struct ScalingOptions {
+	/// Upper limit on geometric-mean passes; 0 skips them.
+	std::size_t geometric_passes = 8;
+	/// Geometric passes stop once a pass shrinks the ratio between the largest
+	/// and smallest scaled magnitude by less than this factor.
+	double geometric_improvement = 0.9;
+	/// Finish with one max-norm equilibration of rows, then columns.
+	bool equilibrate = true;
+	/// Round every factor to the nearest power of two, so scaling and
+	/// unscaling only change exponents and introduce no rounding error.
+	bool power_of_two = true;
+};
+
+/**
+ * @brief Diagonal scaling R A C of a matrix A: rows[i] = Rᵢᵢ, cols[j] = Cⱼⱼ.
+ *
+ * For a linear program min cᵀx, Ax = b scaled to min (Cc)ᵀx̂, (RAC)x̂ = Rb,
+ * a solution of the scaled program maps back as x = C x̂ (unscale_columns),
+ * y = R ŷ for the duals (unscale_rows) and d = C⁻¹ d̂ for reduced costs.
+ */
+template <typename T>
+struct ScaleFactors {
+	std::vector<T> rows;
+	std::vector<T> cols;
+};
+
+namespace detail {
+
+template <typename T, typename Visit>
+void for_each_entry(const Matrix<T>& matrix, Visit visit) {
+	for (std::size_t row = 0; row < matrix.rows(); ++row) {
+		for (std::size_t col = 0; col < matrix.cols(); ++col) {
+			if (matrix(row, col) != T{}) {
+				visit(row, col, matrix(row, col));
+			}
+		}
+	}
+}
+
+template <typename T, typename Visit>
+void for_each_entry(const SparseMatrix<T>& matrix, Visit visit) {
+	const bool csc = matrix.layout() == SparseLayout::Csc;
+	const std::size_t majors = csc ? matrix.cols() : matrix.rows();
+	for (std::size_t major = 0; major < majors; ++major) {
+		for (std::size_t k = matrix.starts()[major]; k < matrix.starts()[major + 1]; ++k) {
+			const std::size_t minor = matrix.indices()[k];
+			visit(csc ? minor : major, csc ? major : minor, matrix.values()[k]);
+		}
+	}
+}
+
+// Nearest power of two in the logarithmic sense; exact for any finite positive value.
+template <typename T>
+T round_to_power_of_two(T value) {
+	int exponent = 0;
+	const T mantissa = std::frexp(value, &exponent);
+	return std::ldexp(T{1}, mantissa < std::sqrt(T{0.5}) ? exponent - 1 : exponent);
+}
+
+template <typename T>
+struct Extremes {
+	std::vector<T> smallest;
+	std::vector<T> largest;
+
+	explicit Extremes(std::size_t count)
+		: smallest(count, std::numeric_limits<T>::infinity()), largest(count, T{}) {}
+
+	void add(std::size_t index, T magnitude) {
+		smallest[index] = std::min(smallest[index], magnitude);
+		largest[index] = std::max(largest[index], magnitude);
+	}
+
+	bool empty(std::size_t index) const { return largest[index] == T{}; }
+};
+
+/**
+ * Alternates row and column passes over the entries of any matrix type
+ * for_each_entry accepts. Each pass recomputes one side's factors from the
+ * other side's current ones, so only two vectors of extremes are alive.
+ */
+template <typename T, typename Entries>
+ScaleFactors<T> compute_scale_factors(const Entries& matrix, std::size_t rows, std::size_t cols,
+									  const ScalingOptions& options) {
+	static_assert(std::is_floating_point_v<T>, "scaling requires a floating-point scalar type");
+	ScaleFactors<T> factors{std::vector<T>(rows, T{1}), std::vector<T>(cols, T{1})};
+	const auto finish = [&](T factor) { return options.power_of_two ? round_to_power_of_two(factor) : factor; };
+
+	// Recomputes the row factors from the column factors (or the other way
+	// round) by `rule`; returns the largest over the smallest scaled magnitude.
+	const auto pass = [&](bool by_row, auto rule) {
+		std::vector<T>& target = by_row ? factors.rows : factors.cols;
+		const std::vector<T>& other = by_row ? factors.cols : factors.rows;
+		Extremes<T> extremes(target.size());
+		for_each_entry(matrix, [&](std::size_t row, std::size_t col, const T& value) {
+			extremes.add(by_row ? row : col, std::abs(value) * other[by_row ? col : row]);
+		});
+		T smallest = std::numeric_limits<T>::infinity();
+		T largest = T{};
+		for (std::size_t index = 0; index < target.size(); ++index) {
+			if (extremes.empty(index)) {
+				continue;
+			}
+			target[index] = finish(rule(extremes.smallest[index], extremes.largest[index]));
+			smallest = std::min(smallest, extremes.smallest[index] * target[index]);
+			largest = std::max(largest, extremes.largest[index] * target[index]);
+		}
+		return largest == T{} ? T{1} : largest / smallest;
+	};
+	// Square roots before the product, which over- or underflows for extreme entries.
+	const auto geometric = [](T smallest, T largest) { return T{1} / (std::sqrt(smallest) * std::sqrt(largest)); };
+	const auto max_norm = [](T, T largest) { return T{1} / largest; };
+
+	T spread = std::numeric_limits<T>::infinity();
+	for (std::size_t round = 0; round < options.geometric_passes; ++round) {
+		pass(true, geometric);
+		const T next = pass(false, geometric);
+		if (next > options.geometric_improvement * spread) {
+			break;
+		}
+		spread = next;
+	}
+	if (options.equilibrate) {
+		pass(true, max_norm);
+		pass(false, max_norm);
+	}
+	return factors;
+}
+
+} // namespace detail
+
+/**
+ * @brief Row and column factors that bring the non-zeros of `matrix` close
+ * to magnitude one: iterated geometric-mean scaling (each row and column
+ * divided by the geometric mean of its smallest and largest entry), then
+ * max-norm equilibration. The matrix itself is left unchanged.
+ */
+template <typename T>
+ScaleFactors<T> compute_scale_factors(const Matrix<T>& matrix, const ScalingOptions& options = {}) {
+	return detail::compute_scale_factors<T>(matrix, matrix.rows(), matrix.cols(), options);
+}
+
+template <typename T>
+ScaleFactors<T> compute_scale_factors(const SparseMatrix<T>& matrix, const ScalingOptions& options = {}) {
+	return detail::compute_scale_factors<T>(matrix, matrix.rows(), matrix.cols(), options);
+}
+
+/**
+ * @brief Replaces `matrix` with R A C.
+ * @throws std::invalid_argument if the factor counts do not match the dimensions.
+ */
+template <typename T>
+void apply_scaling(Matrix<T>& matrix, const ScaleFactors<T>& factors) {
+	if (factors.rows.size() != matrix.rows() || factors.cols.size() != matrix.cols()) {
+		throw std::invalid_argument("Matrix scaling requires one factor per row and per column");
+	}
+	for (std::size_t row = 0; row < matrix.rows(); ++row) {
+		const std::span<T> values = matrix.row(row);
+		for (std::size_t col = 0; col < values.size(); ++col) {
+			values[col] = values[col] * factors.rows[row] * factors.cols[col];
+		}
+	}
+}
+
+template <typename T>
+void apply_scaling(SparseMatrix<T>& matrix, const ScaleFactors<T>& factors) {
+	matrix.scale(factors.rows, factors.cols);
+}
+
+/**
+ * @brief Computes scale factors for `matrix`, applies them and returns them.
+ */
+template <typename T>
+ScaleFactors<T> scale(Matrix<T>& matrix, const ScalingOptions& options = {}) {
+	ScaleFactors<T> factors = compute_scale_factors(matrix, options);
+	apply_scaling(matrix, factors);
+	return factors;
+}
+
+template <typename T>
+ScaleFactors<T> scale(SparseMatrix<T>& matrix, const ScalingOptions& options = {}) {
+	ScaleFactors<T> factors = compute_scale_factors(matrix, options);
+	apply_scaling(matrix, factors);
+	return factors;
+}
+
+/**
+ * @brief Multiplies values[j] by cols[j]: maps primal values of the scaled
+ * program back, or scales costs into it.
+ * @throws std::invalid_argument if the sizes do not match.
+ */
+template <typename T>
+void unscale_columns(std::vector<T>& values, const ScaleFactors<T>& factors) {
+	if (values.size() != factors.cols.size()) {
+		throw std::invalid_argument("unscale_columns requires one value per column");
+	}
+	for (std::size_t col = 0; col < values.size(); ++col) {
+		values[col] *= factors.cols[col];
+	}
+}
+
+/**
+ * @brief Multiplies values[i] by rows[i]: maps duals of the scaled program
+ * back, or scales right-hand sides into it.
+ * @throws std::invalid_argument if the sizes do not match.
+ */
+template <typename T>
+void unscale_rows(std::vector<T>& values, const ScaleFactors<T>& factors) {
+	if (values.size() != factors.rows.size()) {
+		throw std::invalid_argument("unscale_rows requires one value per row");
+	}
+	for (std::size_t row = 0; row < values.size(); ++row) {
+		values[row] *= factors.rows[row];
+	}
+}
+
+} // namespace limo::numerics
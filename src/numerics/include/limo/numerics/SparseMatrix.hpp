@@ -0,0 +1,401 @@
+#pragma once
+
+#include "limo/numerics/Matrix.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace limo::numerics {
+
+/**
+ * @brief Storage order of a SparseMatrix: compressed columns or compressed rows.
+ */
+enum class SparseLayout {
+	Csc,
+	Csr,
+};
+
+/**
+ * @brief A single (row, col, value) entry as accepted by SparseMatrix::Builder.
+ */
+template <typename T>
+struct Triplet {
+	std::size_t row;
+	std::size_t col;
+	T value;
+};
+
+/**
+ * @brief Compressed sparse matrix in either column (CSC) or row (CSR) layout.
+ *
+ * Entries of one column (CSC) or row (CSR) are stored contiguously with
+ * strictly increasing minor indices, and explicit zeros are never stored.
+ * Converting between the layouts is a single counting pass, O(nnz + rows +
+ * cols), so a solver can keep CSC for pricing and a CSR copy for row-wise
+ * updates.
+ */
+template <typename T>
+class SparseMatrix {
+public:
+	using value_type = T;
+	using size_type = std::size_t;
+
+	class Builder;
+
+	SparseMatrix() = default;
+
+	/**
+	 * @brief Creates an all-zero matrix.
+	 */
+	SparseMatrix(size_type rows, size_type cols, SparseLayout layout = SparseLayout::Csc)
+		: rows_(rows), cols_(cols), layout_(layout), starts_(major_count() + 1, 0) {}
+
+	static SparseMatrix from_dense(const Matrix<T>& dense, SparseLayout layout = SparseLayout::Csc) {
+		Builder builder(dense.rows(), dense.cols());
+		for (size_type row = 0; row < dense.rows(); ++row) {
+			for (size_type col = 0; col < dense.cols(); ++col) {
+				if (dense(row, col) != T{}) {
+					builder.add(row, col, dense(row, col));
+				}
+			}
+		}
+		return builder.build(layout);
+	}
+
+	size_type rows() const { return rows_; }
+	size_type cols() const { return cols_; }
+	size_type non_zeros() const { return values_.size(); }
+	SparseLayout layout() const { return layout_; }
+
+	/**
+	 * @brief Raw compressed arrays: entries of column (CSC) or row (CSR) j
+	 * are at positions [starts()[j], starts()[j + 1]) of indices() and values().
+	 */
+	const std::vector<size_type>& starts() const { return starts_; }
+	const std::vector<size_type>& indices() const { return indices_; }
+	const std::vector<T>& values() const { return values_; }
+
+	/**
+	 * @brief Row indices and values of a column.
+	 * @throws std::logic_error if the matrix is not stored as CSC.
+	 * @throws std::out_of_range if the column does not exist.
+	 */
+	std::span<const size_type> column_indices(size_type col) const {
+		ensure_major(SparseLayout::Csc, col, "SparseMatrix column access requires CSC layout");
+		return major_indices(col);
+	}
+
+	std::span<const T> column_values(size_type col) const {
+		ensure_major(SparseLayout::Csc, col, "SparseMatrix column access requires CSC layout");
+		return major_values(col);
+	}
+
+	/**
+	 * @brief Column indices and values of a row.
+	 * @throws std::logic_error if the matrix is not stored as CSR.
+	 * @throws std::out_of_range if the row does not exist.
+	 */
+	std::span<const size_type> row_indices(size_type row) const {
+		ensure_major(SparseLayout::Csr, row, "SparseMatrix row access requires CSR layout");
+		return major_indices(row);
+	}
+
+	std::span<const T> row_values(size_type row) const {
+		ensure_major(SparseLayout::Csr, row, "SparseMatrix row access requires CSR layout");
+		return major_values(row);
+	}
+
+	/**
+	 * @brief Value at (row, col), zero if the entry is not stored.
+	 *
+	 * Binary search within the column (CSC) or row (CSR).
+	 * @throws std::out_of_range if the position is outside the matrix.
+	 */
+	T at(size_type row, size_type col) const {
+		if (row >= rows_ || col >= cols_) {
+			throw std::out_of_range("SparseMatrix index out of range");
+		}
+		const size_type major = layout_ == SparseLayout::Csc ? col : row;
+		const size_type minor = layout_ == SparseLayout::Csc ? row : col;
+		const auto first = indices_.begin() + static_cast<std::ptrdiff_t>(starts_[major]);
+		const auto last = indices_.begin() + static_cast<std::ptrdiff_t>(starts_[major + 1]);
+		const auto found = std::lower_bound(first, last, minor);
+		if (found == last || *found != minor) {
+			return T{};
+		}
+		return values_[static_cast<size_type>(found - indices_.begin())];
+	}
+
+	/**
+	 * @brief Returns the same matrix in the requested layout.
+	 */
+	SparseMatrix with_layout(SparseLayout layout) const {
+		if (layout == layout_) {
+			return *this;
+		}
+		SparseMatrix result(rows_, cols_, layout);
+		transpose_storage(*this, result);
+		return result;
+	}
+
+	SparseMatrix to_csc() const { return with_layout(SparseLayout::Csc); }
+	SparseMatrix to_csr() const { return with_layout(SparseLayout::Csr); }
+
+	/**
+	 * @brief Returns Aᵀ by reinterpreting the arrays: CSC of A is CSR of Aᵀ.
+	 */
+	SparseMatrix transpose() const {
+		SparseMatrix result(*this);
+		std::swap(result.rows_, result.cols_);
+		result.layout_ = layout_ == SparseLayout::Csc ? SparseLayout::Csr : SparseLayout::Csc;
+		return result;
+	}
+
+	Matrix<T> to_dense() const {
+		Matrix<T> dense(rows_, cols_);
+		for (size_type major = 0; major < major_count(); ++major) {
+			for (size_type k = starts_[major]; k < starts_[major + 1]; ++k) {
+				if (layout_ == SparseLayout::Csc) {
+					dense(indices_[k], major) = values_[k];
+				} else {
+					dense(major, indices_[k]) = values_[k];
+				}
+			}
+		}
+		return dense;
+	}
+
+	/**
+	 * @brief Computes A x.
+	 * @throws std::invalid_argument if x does not have cols() entries.
+	 */
+	std::vector<T> multiply(const std::vector<T>& x) const {
+		if (x.size() != cols_) {
+			throw std::invalid_argument("SparseMatrix multiply requires a vector of length cols");
+		}
+		std::vector<T> result(rows_, T{});
+		if (layout_ == SparseLayout::Csc) {
+			scatter_major(x, result);
+		} else {
+			gather_major(x, result);
+		}
+		return result;
+	}
+
+	/**
+	 * @brief Computes Aᵀ y without forming the transpose.
+	 * @throws std::invalid_argument if y does not have rows() entries.
+	 */
+	std::vector<T> multiply_transpose(const std::vector<T>& y) const {
+		if (y.size() != rows_) {
+			throw std::invalid_argument("SparseMatrix transpose multiply requires a vector of length rows");
+		}
+		std::vector<T> result(cols_, T{});
+		if (layout_ == SparseLayout::Csc) {
+			gather_major(y, result);
+		} else {
+			scatter_major(y, result);
+		}
+		return result;
+	}
+
+	/**
+	 * @brief Multiplies entry (i, j) by row_factors[i] * col_factors[j], i.e.
+	 * replaces A with R A C for the diagonal matrices R and C.
+	 * @throws std::invalid_argument if the factor counts do not match the dimensions.
+	 */
+	void scale(std::span<const T> row_factors, std::span<const T> col_factors) {
+		if (row_factors.size() != rows_ || col_factors.size() != cols_) {
+			throw std::invalid_argument("SparseMatrix scale requires one factor per row and per column");
+		}
+		const std::span<const T> major_factors = layout_ == SparseLayout::Csc ? col_factors : row_factors;
+		const std::span<const T> minor_factors = layout_ == SparseLayout::Csc ? row_factors : col_factors;
+		for (size_type major = 0; major < major_count(); ++major) {
+			for (size_type k = starts_[major]; k < starts_[major + 1]; ++k) {
+				values_[k] = values_[k] * major_factors[major] * minor_factors[indices_[k]];
+			}
+		}
+	}
+
+	bool operator==(const SparseMatrix& other) const = default;
+
+private:
+	size_type rows_ = 0;
+	size_type cols_ = 0;
+	SparseLayout layout_ = SparseLayout::Csc;
+	std::vector<size_type> starts_{0};
+	std::vector<size_type> indices_;
+	std::vector<T> values_;
+
+	size_type major_count() const { return layout_ == SparseLayout::Csc ? cols_ : rows_; }
+
+	std::span<const size_type> major_indices(size_type major) const {
+		return {indices_.data() + starts_[major], starts_[major + 1] - starts_[major]};
+	}
+
+	std::span<const T> major_values(size_type major) const {
+		return {values_.data() + starts_[major], starts_[major + 1] - starts_[major]};
+	}
+
+	void ensure_major(SparseLayout layout, size_type major, const char* message) const {
+		if (layout_ != layout) {
+			throw std::logic_error(message);
+		}
+		if (major >= major_count()) {
+			throw std::out_of_range("SparseMatrix index out of range");
+		}
+	}
+
+	// result[minor] += value * x[major] over all entries (column-wise A x for CSC).
+	void scatter_major(const std::vector<T>& x, std::vector<T>& result) const {
+		for (size_type major = 0; major < major_count(); ++major) {
+			const T& factor = x[major];
+			if (factor == T{}) {
+				continue;
+			}
+			for (size_type k = starts_[major]; k < starts_[major + 1]; ++k) {
+				result[indices_[k]] += values_[k] * factor;
+			}
+		}
+	}
+
+	// result[major] = sum of value * x[minor] (row-wise dot products for CSR).
+	void gather_major(const std::vector<T>& x, std::vector<T>& result) const {
+		for (size_type major = 0; major < major_count(); ++major) {
+			T sum{};
+			for (size_type k = starts_[major]; k < starts_[major + 1]; ++k) {
+				sum += values_[k] * x[indices_[k]];
+			}
+			result[major] = sum;
+		}
+	}
+
+	// Sums adjacent entries with equal minor index and drops zeros, compacting in place.
+	void merge_duplicates() {
+		size_type write = 0;
+		size_type begin = 0;
+		for (size_type major = 0; major < major_count(); ++major) {
+			const size_type end = starts_[major + 1];
+			for (size_type k = begin; k < end;) {
+				const size_type minor = indices_[k];
+				T sum = values_[k];
+				for (++k; k < end && indices_[k] == minor; ++k) {
+					sum += values_[k];
+				}
+				if (sum != T{}) {
+					indices_[write] = minor;
+					values_[write] = std::move(sum);
+					++write;
+				}
+			}
+			begin = end;
+			starts_[major + 1] = write;
+		}
+		indices_.resize(write);
+		values_.resize(write);
+	}
+
+	// Counting transpose of the compressed arrays: source majors become
+	// target minors. Walking the source majors in order appends to every
+	// target bucket with increasing minor index, so the output is sorted
+	// without a comparison sort.
+	static void transpose_storage(const SparseMatrix& source, SparseMatrix& target) {
+		const size_type targetMajors = target.major_count();
+		std::vector<size_type> starts(targetMajors + 1, 0);
+		for (size_type index : source.indices_) {
+			++starts[index + 1];
+		}
+		for (size_type major = 0; major < targetMajors; ++major) {
+			starts[major + 1] += starts[major];
+		}
+
+		std::vector<size_type> next(starts.begin(), starts.end() - 1);
+		std::vector<size_type> indices(source.indices_.size());
+		std::vector<T> values(source.values_.size());
+		for (size_type major = 0; major < source.major_count(); ++major) {
+			for (size_type k = source.starts_[major]; k < source.starts_[major + 1]; ++k) {
+				const size_type position = next[source.indices_[k]]++;
+				indices[position] = major;
+				values[position] = source.values_[k];
+			}
+		}
+		target.starts_ = std::move(starts);
+		target.indices_ = std::move(indices);
+		target.values_ = std::move(values);
+	}
+};
+
+/**
+ * @brief Collects triplets in any order and compresses them into a SparseMatrix.
+ *
+ * Duplicate positions are summed and entries that end up zero are dropped.
+ * build() bucket-sorts the triplets in two counting passes, O(nnz + rows + cols).
+ */
+template <typename T>
+class SparseMatrix<T>::Builder {
+public:
+	Builder(size_type rows, size_type cols) : rows_(rows), cols_(cols) {}
+
+	Builder& reserve(size_type count) {
+		triplets_.reserve(count);
+		return *this;
+	}
+
+	/**
+	 * @throws std::out_of_range if the position is outside the matrix.
+	 */
+	Builder& add(size_type row, size_type col, const T& value) {
+		if (row >= rows_ || col >= cols_) {
+			throw std::out_of_range("SparseMatrix builder index out of range");
+		}
+		triplets_.push_back({row, col, value});
+		return *this;
+	}
+
+	Builder& add(const Triplet<T>& triplet) { return add(triplet.row, triplet.col, triplet.value); }
+
+	size_type size() const { return triplets_.size(); }
+
+	SparseMatrix build(SparseLayout layout = SparseLayout::Csc) const {
+		// Bucket by the target minor index into the opposite layout first;
+		// converting that to the target layout then yields sorted buckets.
+		const SparseLayout opposite = layout == SparseLayout::Csc ? SparseLayout::Csr : SparseLayout::Csc;
+		SparseMatrix staged(rows_, cols_, opposite);
+		std::vector<size_type> starts(staged.major_count() + 1, 0);
+		for (const Triplet<T>& triplet : triplets_) {
+			++starts[major_of(triplet, opposite) + 1];
+		}
+		for (size_type major = 0; major + 1 < starts.size(); ++major) {
+			starts[major + 1] += starts[major];
+		}
+		std::vector<size_type> next(starts.begin(), starts.end() - 1);
+		staged.indices_.resize(triplets_.size());
+		staged.values_.resize(triplets_.size());
+		for (const Triplet<T>& triplet : triplets_) {
+			const size_type position = next[major_of(triplet, opposite)]++;
+			staged.indices_[position] = major_of(triplet, layout);
+			staged.values_[position] = triplet.value;
+		}
+		staged.starts_ = std::move(starts);
+
+		SparseMatrix result(rows_, cols_, layout);
+		transpose_storage(staged, result);
+		result.merge_duplicates();
+		return result;
+	}
+
+private:
+	size_type rows_;
+	size_type cols_;
+	std::vector<Triplet<T>> triplets_;
+
+	static size_type major_of(const Triplet<T>& triplet, SparseLayout layout) {
+		return layout == SparseLayout::Csc ? triplet.col : triplet.row;
+	}
+};
+
+} // namespace limo::numerics
@@ -0,0 +1,487 @@
+#include "limo/numerics/BigInt.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <utility>
+
+namespace limo::numerics {
+
+namespace {
+
+constexpr unsigned kLimbBits = 32;
+constexpr std::uint64_t kLimbBase = std::uint64_t{1} << kLimbBits;
+
+} // namespace
+
+BigInt::BigInt(std::int64_t value) {
+    negative = value < 0;
+    // Negate in unsigned arithmetic so INT64_MIN is handled without overflow.
+    std::uint64_t magnitude = negative ? ~static_cast<std::uint64_t>(value) + 1 : static_cast<std::uint64_t>(value);
+    while (magnitude != 0) {
+        limbs.push_back(static_cast<Limb>(magnitude));
+        magnitude >>= kLimbBits;
+    }
+}
+
+std::size_t BigInt::bitLength() const {
+    if (limbs.empty()) {
+        return 0;
+    }
+    return (limbs.size() - 1) * kLimbBits + static_cast<std::size_t>(std::bit_width(limbs.back()));
+}
+
+bool BigInt::fitsInt64() const {
+    if (limbs.size() > 2) {
+        return false;
+    }
+    const std::uint64_t magnitude = toWord(limbs);
+    const std::uint64_t limit = static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max());
+    return negative ? magnitude <= limit + 1 : magnitude <= limit;
+}
+
+std::int64_t BigInt::toInt64() const {
+    if (!fitsInt64()) {
+        throw std::overflow_error("BigInt value does not fit into 64 bits");
+    }
+    const std::uint64_t magnitude = toWord(limbs);
+    return static_cast<std::int64_t>(negative ? ~magnitude + 1 : magnitude);
+}
+
+double BigInt::toDouble() const {
+    double result = 0.0;
+    for (std::size_t i = limbs.size(); i-- > 0;) {
+        result = result * static_cast<double>(kLimbBase) + static_cast<double>(limbs[i]);
+    }
+    return negative ? -result : result;
+}
+
+std::string BigInt::toString() const {
+    if (limbs.empty()) {
+        return "0";
+    }
+
+    // Peel off base 10^9 chunks with a short division per step.
+    constexpr Limb chunkBase = 1000000000u;
+    Limbs work = limbs;
+    std::vector<Limb> chunks;
+    while (!work.empty()) {
+        std::uint64_t remainder = 0;
+        for (std::size_t i = work.size(); i-- > 0;) {
+            const std::uint64_t current = (remainder << kLimbBits) | work[i];
+            work[i] = static_cast<Limb>(current / chunkBase);
+            remainder = current % chunkBase;
+        }
+        while (!work.empty() && work.back() == 0) {
+            work.pop_back();
+        }
+        chunks.push_back(static_cast<Limb>(remainder));
+    }
+
+    std::string result = negative ? "-" : "";
+    result += std::to_string(chunks.back());
+    for (std::size_t i = chunks.size() - 1; i-- > 0;) {
+        const std::string digits = std::to_string(chunks[i]);
+        result.append(9 - digits.size(), '0');
+        result += digits;
+    }
+    return result;
+}
+
+BigInt BigInt::abs() const {
+    BigInt result(*this);
+    result.negative = false;
+    return result;
+}
+
+BigInt BigInt::operator-() const {
+    BigInt result(*this);
+    if (!result.isZero()) {
+        result.negative = !result.negative;
+    }
+    return result;
+}
+
+BigInt BigInt::operator+(const BigInt& other) const {
+    BigInt result;
+    if (negative == other.negative) {
+        result.limbs = addMagnitude(limbs, other.limbs);
+        result.negative = negative;
+    } else if (compareMagnitude(limbs, other.limbs) >= 0) {
+        result.limbs = subtractMagnitude(limbs, other.limbs);
+        result.negative = negative;
+    } else {
+        result.limbs = subtractMagnitude(other.limbs, limbs);
+        result.negative = other.negative;
+    }
+    result.trim();
+    return result;
+}
+
+BigInt BigInt::operator-(const BigInt& other) const {
+    return *this + (-other);
+}
+
+BigInt BigInt::operator*(const BigInt& other) const {
+    BigInt result;
+    result.limbs = multiplyMagnitude(limbs, other.limbs);
+    result.negative = negative != other.negative;
+    result.trim();
+    return result;
+}
+
+BigInt BigInt::operator/(const BigInt& other) const {
+    BigInt quotient;
+    BigInt remainder;
+    divMod(*this, other, quotient, remainder);
+    return quotient;
+}
+
+BigInt BigInt::operator%(const BigInt& other) const {
+    BigInt quotient;
+    BigInt remainder;
+    divMod(*this, other, quotient, remainder);
+    return remainder;
+}
+
+BigInt BigInt::operator<<(std::size_t bits) const {
+    if (isZero() || bits == 0) {
+        return *this;
+    }
+    const std::size_t limbShift = bits / kLimbBits;
+    const unsigned bitShift = static_cast<unsigned>(bits % kLimbBits);
+
+    BigInt result;
+    result.negative = negative;
+    result.limbs.assign(limbs.size() + limbShift + 1, 0);
+    for (std::size_t i = 0; i < limbs.size(); ++i) {
+        const std::uint64_t shifted = static_cast<std::uint64_t>(limbs[i]) << bitShift;
+        result.limbs[i + limbShift] |= static_cast<Limb>(shifted);
+        result.limbs[i + limbShift + 1] |= static_cast<Limb>(shifted >> kLimbBits);
+    }
+    result.trim();
+    return result;
+}
+
+BigInt BigInt::operator>>(std::size_t bits) const {
+    const std::size_t limbShift = bits / kLimbBits;
+    if (limbShift >= limbs.size()) {
+        return BigInt();
+    }
+    const unsigned bitShift = static_cast<unsigned>(bits % kLimbBits);
+
+    BigInt result;
+    result.negative = negative;
+    result.limbs.assign(limbs.size() - limbShift, 0);
+    for (std::size_t i = 0; i < result.limbs.size(); ++i) {
+        std::uint64_t window = limbs[i + limbShift];
+        if (i + limbShift + 1 < limbs.size()) {
+            window |= static_cast<std::uint64_t>(limbs[i + limbShift + 1]) << kLimbBits;
+        }
+        result.limbs[i] = static_cast<Limb>(window >> bitShift);
+    }
+    result.trim();
+    return result;
+}
+
+std::strong_ordering BigInt::operator<=>(const BigInt& other) const {
+    if (negative != other.negative) {
+        return negative ? std::strong_ordering::less : std::strong_ordering::greater;
+    }
+    const int magnitude = compareMagnitude(limbs, other.limbs);
+    const int ordered = negative ? -magnitude : magnitude;
+    if (ordered < 0) {
+        return std::strong_ordering::less;
+    }
+    return ordered > 0 ? std::strong_ordering::greater : std::strong_ordering::equal;
+}
+
+void BigInt::divMod(const BigInt& dividend, const BigInt& divisor, BigInt& quotient, BigInt& remainder) {
+    if (divisor.isZero()) {
+        throw std::invalid_argument("BigInt division by zero");
+    }
+    Limbs q;
+    Limbs r;
+    divModMagnitude(dividend.limbs, divisor.limbs, q, r);
+
+    quotient.limbs = std::move(q);
+    quotient.negative = dividend.negative != divisor.negative;
+    quotient.trim();
+
+    remainder.limbs = std::move(r);
+    remainder.negative = dividend.negative;
+    remainder.trim();
+}
+
+BigInt BigInt::gcd(BigInt left, BigInt right) {
+    left.negative = false;
+    right.negative = false;
+    if (compareMagnitude(left.limbs, right.limbs) < 0) {
+        std::swap(left, right);
+    }
+    // Binary steps only shave a few bits each, so close a large size gap with
+    // one division first.
+    if (!right.isZero() && left.limbs.size() > right.limbs.size() + 1) {
+        left = left % right;
+        std::swap(left, right);
+    }
+    if (left.isZero()) {
+        return right;
+    }
+    if (right.isZero()) {
+        return left;
+    }
+
+    // Binary GCD on the limb vectors in place: shifts and subtractions only,
+    // no per-step allocation.
+    Limbs& a = left.limbs;
+    Limbs& b = right.limbs;
+    const std::size_t shift = std::min(trailingZeroBits(a), trailingZeroBits(b));
+    shiftRightInPlace(a, trailingZeroBits(a));
+    while (!b.empty()) {
+        shiftRightInPlace(b, trailingZeroBits(b));
+        if (compareMagnitude(a, b) > 0) {
+            std::swap(a, b);
+        }
+        if (b.size() <= 2) {
+            // Both operands fit into machine words now.
+            std::uint64_t x = toWord(a);
+            std::uint64_t y = toWord(b);
+            while (y != 0) {
+                y >>= std::countr_zero(y);
+                if (x > y) {
+                    std::swap(x, y);
+                }
+                y -= x;
+            }
+            a.clear();
+            while (x != 0) {
+                a.push_back(static_cast<Limb>(x));
+                x >>= kLimbBits;
+            }
+            break;
+        }
+        subtractInPlace(b, a);
+    }
+    return left << shift;
+}
+
+std::size_t BigInt::trailingZeroBits(const Limbs& value) {
+    for (std::size_t i = 0; i < value.size(); ++i) {
+        if (value[i] != 0) {
+            return i * kLimbBits + static_cast<std::size_t>(std::countr_zero(value[i]));
+        }
+    }
+    return 0;
+}
+
+void BigInt::shiftRightInPlace(Limbs& value, std::size_t bits) {
+    const std::size_t limbShift = bits / kLimbBits;
+    const unsigned bitShift = static_cast<unsigned>(bits % kLimbBits);
+    if (limbShift > 0) {
+        value.erase(value.begin(), value.begin() + static_cast<std::ptrdiff_t>(std::min(limbShift, value.size())));
+    }
+    if (bitShift != 0) {
+        for (std::size_t i = 0; i < value.size(); ++i) {
+            const std::uint64_t high = i + 1 < value.size() ? static_cast<std::uint64_t>(value[i + 1]) << kLimbBits : 0;
+            value[i] = static_cast<Limb>((high | value[i]) >> bitShift);
+        }
+    }
+    while (!value.empty() && value.back() == 0) {
+        value.pop_back();
+    }
+}
+
+void BigInt::subtractInPlace(Limbs& larger, const Limbs& smaller) {
+    std::int64_t borrow = 0;
+    for (std::size_t i = 0; i < larger.size() && (borrow != 0 || i < smaller.size()); ++i) {
+        std::int64_t difference = static_cast<std::int64_t>(larger[i]) - borrow -
+                                  (i < smaller.size() ? static_cast<std::int64_t>(smaller[i]) : 0);
+        borrow = difference < 0 ? 1 : 0;
+        if (difference < 0) {
+            difference += static_cast<std::int64_t>(kLimbBase);
+        }
+        larger[i] = static_cast<Limb>(difference);
+    }
+    while (!larger.empty() && larger.back() == 0) {
+        larger.pop_back();
+    }
+}
+
+std::uint64_t BigInt::toWord(const Limbs& value) {
+    std::uint64_t word = 0;
+    for (std::size_t i = value.size(); i-- > 0;) {
+        word = (word << kLimbBits) | value[i];
+    }
+    return word;
+}
+
+void BigInt::trim() {
+    while (!limbs.empty() && limbs.back() == 0) {
+        limbs.pop_back();
+    }
+    if (limbs.empty()) {
+        negative = false;
+    }
+}
+
+int BigInt::compareMagnitude(const Limbs& left, const Limbs& right) {
+    if (left.size() != right.size()) {
+        return left.size() < right.size() ? -1 : 1;
+    }
+    for (std::size_t i = left.size(); i-- > 0;) {
+        if (left[i] != right[i]) {
+            return left[i] < right[i] ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+BigInt::Limbs BigInt::addMagnitude(const Limbs& left, const Limbs& right) {
+    const Limbs& longer = left.size() >= right.size() ? left : right;
+    const Limbs& shorter = left.size() >= right.size() ? right : left;
+
+    Limbs result(longer.size() + 1, 0);
+    std::uint64_t carry = 0;
+    for (std::size_t i = 0; i < longer.size(); ++i) {
+        const std::uint64_t sum = carry + longer[i] + (i < shorter.size() ? shorter[i] : 0);
+        result[i] = static_cast<Limb>(sum);
+        carry = sum >> kLimbBits;
+    }
+    result[longer.size()] = static_cast<Limb>(carry);
+    return result;
+}
+
+BigInt::Limbs BigInt::subtractMagnitude(const Limbs& larger, const Limbs& smaller) {
+    Limbs result(larger.size(), 0);
+    std::int64_t borrow = 0;
+    for (std::size_t i = 0; i < larger.size(); ++i) {
+        std::int64_t difference = static_cast<std::int64_t>(larger[i]) - borrow -
+                                  (i < smaller.size() ? static_cast<std::int64_t>(smaller[i]) : 0);
+        borrow = difference < 0 ? 1 : 0;
+        if (difference < 0) {
+            difference += static_cast<std::int64_t>(kLimbBase);
+        }
+        result[i] = static_cast<Limb>(difference);
+    }
+    return result;
+}
+
+BigInt::Limbs BigInt::multiplyMagnitude(const Limbs& left, const Limbs& right) {
+    if (left.empty() || right.empty()) {
+        return {};
+    }
+    Limbs result(left.size() + right.size(), 0);
+    for (std::size_t i = 0; i < left.size(); ++i) {
+        std::uint64_t carry = 0;
+        const std::uint64_t factor = left[i];
+        for (std::size_t j = 0; j < right.size(); ++j) {
+            const std::uint64_t product = factor * right[j] + result[i + j] + carry;
+            result[i + j] = static_cast<Limb>(product);
+            carry = product >> kLimbBits;
+        }
+        result[i + right.size()] = static_cast<Limb>(carry);
+    }
+    return result;
+}
+
+void BigInt::divModMagnitude(const Limbs& dividend, const Limbs& divisor, Limbs& quotient, Limbs& remainder) {
+    if (compareMagnitude(dividend, divisor) < 0) {
+        quotient.clear();
+        remainder = dividend;
+        return;
+    }
+
+    if (divisor.size() == 1) {
+        const std::uint64_t d = divisor[0];
+        quotient.assign(dividend.size(), 0);
+        std::uint64_t rest = 0;
+        for (std::size_t i = dividend.size(); i-- > 0;) {
+            const std::uint64_t current = (rest << kLimbBits) | dividend[i];
+            quotient[i] = static_cast<Limb>(current / d);
+            rest = current % d;
+        }
+        remainder.assign(1, static_cast<Limb>(rest));
+        return;
+    }
+
+    // Knuth, TAOCP vol. 2, algorithm D: normalise so the top divisor limb has
+    // its high bit set, then estimate each quotient limb from the top two limbs.
+    const std::size_t n = divisor.size();
+    const std::size_t m = dividend.size() - n;
+    const unsigned shift = static_cast<unsigned>(std::countl_zero(divisor.back()));
+
+    Limbs vn(n, 0);
+    for (std::size_t i = n - 1; i > 0; --i) {
+        vn[i] = static_cast<Limb>((static_cast<std::uint64_t>(divisor[i]) << shift) |
+                                  (shift == 0 ? 0 : static_cast<std::uint64_t>(divisor[i - 1]) >> (kLimbBits - shift)));
+    }
+    vn[0] = static_cast<Limb>(static_cast<std::uint64_t>(divisor[0]) << shift);
+
+    Limbs un(dividend.size() + 1, 0);
+    un[dividend.size()] = shift == 0 ? 0 : static_cast<Limb>(static_cast<std::uint64_t>(dividend.back()) >> (kLimbBits - shift));
+    for (std::size_t i = dividend.size() - 1; i > 0; --i) {
+        un[i] = static_cast<Limb>((static_cast<std::uint64_t>(dividend[i]) << shift) |
+                                  (shift == 0 ? 0 : static_cast<std::uint64_t>(dividend[i - 1]) >> (kLimbBits - shift)));
+    }
+    un[0] = static_cast<Limb>(static_cast<std::uint64_t>(dividend[0]) << shift);
+
+    quotient.assign(m + 1, 0);
+    for (std::size_t j = m + 1; j-- > 0;) {
+        const std::uint64_t top = (static_cast<std::uint64_t>(un[j + n]) << kLimbBits) | un[j + n - 1];
+        std::uint64_t qhat = top / vn[n - 1];
+        std::uint64_t rhat = top % vn[n - 1];
+        while (qhat >= kLimbBase || qhat * vn[n - 2] > ((rhat << kLimbBits) | un[j + n - 2])) {
+            --qhat;
+            rhat += vn[n - 1];
+            if (rhat >= kLimbBase) {
+                break;
+            }
+        }
+
+        std::int64_t borrow = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            const std::uint64_t product = qhat * vn[i];
+            const std::int64_t difference = static_cast<std::int64_t>(un[i + j]) - borrow -
+                                            static_cast<std::int64_t>(product & 0xFFFFFFFFu);
+            un[i + j] = static_cast<Limb>(difference);
+            borrow = static_cast<std::int64_t>(product >> kLimbBits) - (difference >> kLimbBits);
+        }
+        const std::int64_t topDifference = static_cast<std::int64_t>(un[j + n]) - borrow;
+        un[j + n] = static_cast<Limb>(topDifference);
+
+        if (topDifference < 0) {
+            // The estimate was one too large; add the divisor back.
+            --qhat;
+            std::uint64_t carry = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                const std::uint64_t sum = static_cast<std::uint64_t>(un[i + j]) + vn[i] + carry;
+                un[i + j] = static_cast<Limb>(sum);
+                carry = sum >> kLimbBits;
+            }
+            un[j + n] = static_cast<Limb>(un[j + n] + carry);
+        }
+        quotient[j] = static_cast<Limb>(qhat);
+    }
+
+    remainder.assign(n, 0);
+    for (std::size_t i = 0; i < n; ++i) {
+        remainder[i] = static_cast<Limb>((static_cast<std::uint64_t>(un[i]) >> shift) |
+                                         (shift == 0 ? 0 : static_cast<std::uint64_t>(un[i + 1]) << (kLimbBits - shift)));
+    }
+    while (!remainder.empty() && remainder.back() == 0) {
+        remainder.pop_back();
+    }
+    while (!quotient.empty() && quotient.back() == 0) {
+        quotient.pop_back();
+    }
+}
+
+std::ostream& operator<<(std::ostream& stream, const BigInt& value) {
+    return stream << value.toString();
+}
+
+} // namespace limo::numerics
@@ -1,49 +1,344 @@
 #include "limo/numerics/Fraction.hpp"
 
+#include <algorithm>
+#include <bit>
+#include <cmath>
 #include <cstdlib>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <utility>
 
 namespace limo::numerics::fraction {
 
+namespace {
+
+constexpr std::int64_t kInt64Min = std::numeric_limits<std::int64_t>::min();
+constexpr std::int64_t kInt64Max = std::numeric_limits<std::int64_t>::max();
+
+// Inline parts never hold INT64_MIN, so negation and abs are always safe.
+bool checkedMultiply(std::int64_t left, std::int64_t right, std::int64_t& result) {
+#if defined(__GNUC__) || defined(__clang__)
+    return !__builtin_mul_overflow(left, right, &result) && result != kInt64Min;
+#else
+    if (left == 0 || right == 0) {
+        result = 0;
+        return true;
+    }
+    if (std::llabs(left) > kInt64Max / std::llabs(right)) {
+        return false;
+    }
+    result = left * right;
+    return true;
+#endif
+}
+
+bool checkedAdd(std::int64_t left, std::int64_t right, std::int64_t& result) {
+#if defined(__GNUC__) || defined(__clang__)
+    return !__builtin_add_overflow(left, right, &result) && result != kInt64Min;
+#else
+    if ((right > 0 && left > kInt64Max - right) || (right < 0 && left < -kInt64Max - right)) {
+        return false;
+    }
+    result = left + right;
+    return true;
+#endif
+}
+
+/**
+ * Binary (Stein) GCD: only shifts and subtractions, no hardware division,
+ * which is what dominates the cost of a modulo-based Euclid loop.
+ */
+std::int64_t binaryGcd(std::int64_t left, std::int64_t right) {
+    std::uint64_t a = static_cast<std::uint64_t>(std::llabs(left));
+    std::uint64_t b = static_cast<std::uint64_t>(std::llabs(right));
+    if (a == 0 || b == 0) {
+        return static_cast<std::int64_t>(a | b);
+    }
+    const int shift = std::countr_zero(a | b);
+    a >>= std::countr_zero(a);
+    do {
+        // min/max instead of a conditional swap keeps the loop branch-free.
+        b >>= std::countr_zero(b);
+        const std::uint64_t smaller = std::min(a, b);
+        b = std::max(a, b) - smaller;
+        a = smaller;
+    } while (b != 0);
+    return static_cast<std::int64_t>(a << shift);
+}
+
+// BigInt counterparts of the reduced-form formulas below; used once any
+// operand or intermediate no longer fits into 64 bits.
+void addBig(const BigInt& a, const BigInt& b, const BigInt& c, const BigInt& d, BigInt& num, BigInt& denom) {
+    const BigInt g = BigInt::gcd(b, d);
+    if (g == BigInt(1)) {
+        num = a * d + c * b;
+        denom = b * d;
+        return;
+    }
+    const BigInt bg = b / g;
+    const BigInt t = a * (d / g) + c * bg;
+    const BigInt g2 = BigInt::gcd(t, g);
+    num = t / g2;
+    denom = bg * (d / g2);
+}
+
+void multiplyBig(const BigInt& a, const BigInt& b, const BigInt& c, const BigInt& d, BigInt& num, BigInt& denom) {
+    const BigInt g1 = BigInt::gcd(a, d);
+    const BigInt g2 = BigInt::gcd(c, b);
+    num = (a / g1) * (c / g2);
+    denom = (b / g2) * (d / g1);
+}
+
+} // namespace
+
+Fraction::Fraction(std::int64_t numerator, std::int64_t denominator) : num(numerator), denom(denominator) {
+    if (denominator == 0) {
+        throw std::invalid_argument("Fraction denominator must be non-zero");
+    }
+    if (numerator == kInt64Min || denominator == kInt64Min) {
+        *this = Fraction(BigInt(numerator), BigInt(denominator));
+        return;
+    }
+    if (denominator != 1) {
+        normalize();
+    }
+}
+
+Fraction::Fraction(const BigInt& numerator, const BigInt& denominator) : num(0), denom(1) {
+    if (denominator.isZero()) {
+        throw std::invalid_argument("Fraction denominator must be non-zero");
+    }
+    const BigInt divisor = BigInt::gcd(numerator, denominator);
+    *this = fromBig(numerator / divisor, denominator / divisor);
+}
+
+Fraction::Fraction(const Fraction& other)
+    : num(other.num), denom(other.denom), big(other.big ? std::make_unique<BigParts>(*other.big) : nullptr) {}
+
+Fraction& Fraction::operator=(const Fraction& other) {
+    if (this != &other) {
+        num = other.num;
+        denom = other.denom;
+        big = other.big ? std::make_unique<BigParts>(*other.big) : nullptr;
+    }
+    return *this;
+}
+
+Fraction Fraction::fromBig(BigInt numerator, BigInt denominator) {
+    if (denominator.isNegative()) {
+        numerator = -numerator;
+        denominator = -denominator;
+    }
+    Fraction result;
+    if (numerator.fitsInt64() && denominator.fitsInt64()) {
+        const std::int64_t smallNum = numerator.toInt64();
+        const std::int64_t smallDenom = denominator.toInt64();
+        if (smallNum != kInt64Min && smallDenom != kInt64Min) {
+            result.num = smallNum;
+            result.denom = smallDenom;
+            return result;
+        }
+    }
+    result.big = std::make_unique<BigParts>(BigParts{std::move(numerator), std::move(denominator)});
+    return result;
+}
+
+Fraction Fraction::fromReduced(std::int64_t numerator, std::int64_t denominator) {
+    Fraction result;
+    result.num = numerator;
+    result.denom = numerator == 0 ? 1 : denominator;
+    return result;
+}
+
 void Fraction::normalize() {
+    if (big) {
+        const BigInt divisor = BigInt::gcd(big->num, big->denom);
+        *this = fromBig(big->num / divisor, big->denom / divisor);
+        return;
+    }
     if (denom < 0) {
         num = -num;
         denom = -denom;
     }
-    int a = std::abs(num);
-    int b = std::abs(denom);
-    int temp;
-    while (b != 0) {
-        temp = b;
-        b = a % b;
-        a = temp;
+    if (num == 0) {
+        denom = 1;
+        return;
     }
-    num /= a;
-    denom /= a;
+    const std::int64_t divisor = binaryGcd(num, denom);
+    num /= divisor;
+    denom /= divisor;
 }
 
-
 double Fraction::toDouble() const {
-    return static_cast<double>(num) / static_cast<double>(denom);
+    if (!big) {
+        return static_cast<double>(num) / static_cast<double>(denom);
+    }
+    // Scale both parts down to ~64 significant bits first so huge values do
+    // not overflow to inf/inf.
+    const std::size_t numBits = big->num.bitLength();
+    const std::size_t denomBits = big->denom.bitLength();
+    const std::size_t numShift = numBits > 64 ? numBits - 64 : 0;
+    const std::size_t denomShift = denomBits > 64 ? denomBits - 64 : 0;
+    const double ratio = (big->num >> numShift).toDouble() / (big->denom >> denomShift).toDouble();
+    return std::ldexp(ratio, static_cast<int>(numShift) - static_cast<int>(denomShift));
+}
+
+std::string Fraction::toString() const {
+    const BigInt numerator = getBigNumerator();
+    const BigInt denominator = getBigDenominator();
+    if (denominator == BigInt(1)) {
+        return numerator.toString();
+    }
+    return numerator.toString() + "/" + denominator.toString();
+}
+
+std::int64_t Fraction::getNumerator() const {
+    if (big) {
+        throw std::overflow_error("Fraction numerator does not fit into 64 bits");
+    }
+    return num;
+}
+
+std::int64_t Fraction::getDenominator() const {
+    if (big) {
+        throw std::overflow_error("Fraction denominator does not fit into 64 bits");
+    }
+    return denom;
+}
+
+BigInt Fraction::getBigNumerator() const {
+    return big ? big->num : BigInt(num);
+}
+
+BigInt Fraction::getBigDenominator() const {
+    return big ? big->denom : BigInt(denom);
 }
 
 Fraction Fraction::operator+(const Fraction& other) const {
-    return Fraction(num * other.denom + other.num * denom, denom * other.denom);
+    if (!big && !other.big) {
+        // Henrici: work modulo g = gcd(b, d) so the result is already reduced
+        // and intermediates stay at lcm size instead of b * d.
+        if (other.num == 0) {
+            return *this;
+        }
+        if (num == 0) {
+            return other;
+        }
+        const std::int64_t g = binaryGcd(denom, other.denom);
+        std::int64_t left;
+        std::int64_t right;
+        std::int64_t sum;
+        std::int64_t denominator;
+        if (g == 1) {
+            if (checkedMultiply(num, other.denom, left) && checkedMultiply(other.num, denom, right) &&
+                checkedAdd(left, right, sum) && checkedMultiply(denom, other.denom, denominator)) {
+                return fromReduced(sum, denominator);
+            }
+        } else {
+            const std::int64_t thisScaled = denom / g;
+            if (checkedMultiply(num, other.denom / g, left) && checkedMultiply(other.num, thisScaled, right) &&
+                checkedAdd(left, right, sum)) {
+                if (sum == 0) {
+                    return Fraction();
+                }
+                const std::int64_t g2 = binaryGcd(sum, g);
+                if (checkedMultiply(thisScaled, other.denom / g2, denominator)) {
+                    return fromReduced(sum / g2, denominator);
+                }
+            }
+        }
+    }
+    BigInt numerator;
+    BigInt denominator;
+    addBig(getBigNumerator(), getBigDenominator(), other.getBigNumerator(), other.getBigDenominator(), numerator,
+           denominator);
+    if (numerator.isZero()) {
+        return Fraction();
+    }
+    return fromBig(std::move(numerator), std::move(denominator));
 }
 
 Fraction Fraction::operator-(const Fraction& other) const {
-    return Fraction(num * other.denom - other.num * denom, denom * other.denom);
+    return *this + (-other);
 }
 
 Fraction Fraction::operator*(const Fraction& other) const {
-    return Fraction(num * other.num, denom * other.denom);
+    if (!big && !other.big) {
+        if (num == 0 || other.num == 0) {
+            return Fraction();
+        }
+        // Cross-cancel before multiplying: with reduced inputs the product of
+        // the cancelled parts is reduced as well, and far less likely to overflow.
+        const std::int64_t g1 = binaryGcd(num, other.denom);
+        const std::int64_t g2 = binaryGcd(other.num, denom);
+        std::int64_t numerator;
+        std::int64_t denominator;
+        if (checkedMultiply(num / g1, other.num / g2, numerator) &&
+            checkedMultiply(denom / g2, other.denom / g1, denominator)) {
+            return fromReduced(numerator, denominator);
+        }
+    }
+    BigInt numerator;
+    BigInt denominator;
+    multiplyBig(getBigNumerator(), getBigDenominator(), other.getBigNumerator(), other.getBigDenominator(), numerator,
+                denominator);
+    if (numerator.isZero()) {
+        return Fraction();
+    }
+    return fromBig(std::move(numerator), std::move(denominator));
 }
 
 Fraction Fraction::operator/(const Fraction& other) const {
-    return Fraction(num * other.denom, denom * other.num);
+    if (other.big ? other.big->num.isZero() : other.num == 0) {
+        throw std::invalid_argument("Fraction division by zero");
+    }
+    // Multiply by the reciprocal; its sign moves to the numerator so the
+    // reciprocal is itself in canonical form.
+    Fraction reciprocal;
+    if (other.big) {
+        const bool negative = other.big->num.isNegative();
+        reciprocal = fromBig(negative ? -other.big->denom : other.big->denom, other.big->num.abs());
+    } else {
+        reciprocal.num = other.num < 0 ? -other.denom : other.denom;
+        reciprocal.denom = std::llabs(other.num);
+    }
+    return *this * reciprocal;
+}
+
+Fraction Fraction::operator-() const {
+    if (!big) {
+        return fromReduced(-num, denom);
+    }
+    return fromBig(-big->num, big->denom);
+}
+
+int Fraction::compare(const Fraction& other) const {
+    // Denominators are always positive, so cross-multiplication keeps the order.
+    if (!big && !other.big) {
+        if (denom == other.denom) {
+            return (num > other.num) - (num < other.num);
+        }
+        std::int64_t left;
+        std::int64_t right;
+        if (checkedMultiply(num, other.denom, left) && checkedMultiply(other.num, denom, right)) {
+            return (left > right) - (left < right);
+        }
+    }
+    const BigInt left = getBigNumerator() * other.getBigDenominator();
+    const BigInt right = other.getBigNumerator() * getBigDenominator();
+    return (left > right) - (left < right);
 }
 
 bool Fraction::operator==(const Fraction& other) const {
-    return num * other.denom == other.num * denom;
+    // Canonical form is unique, so equality is a plain part-wise comparison.
+    if (!big && !other.big) {
+        return num == other.num && denom == other.denom;
+    }
+    if (big && other.big) {
+        return big->num == other.big->num && big->denom == other.big->denom;
+    }
+    return false;
 }
 
 bool Fraction::operator!=(const Fraction& other) const {
@@ -51,19 +346,23 @@ bool Fraction::operator!=(const Fraction& other) const {
 }
 
 bool Fraction::operator<(const Fraction& other) const {
-    return num * other.denom < other.num * denom;
+    return compare(other) < 0;
 }
 
 bool Fraction::operator<=(const Fraction& other) const {
-    return *this < other || *this == other;
+    return compare(other) <= 0;
 }
 
 bool Fraction::operator>(const Fraction& other) const {
-    return !(*this <= other);
+    return compare(other) > 0;
 }
 
 bool Fraction::operator>=(const Fraction& other) const {
-    return !(*this < other);
+    return compare(other) >= 0;
+}
+
+std::ostream& operator<<(std::ostream& stream, const Fraction& value) {
+    return stream << value.toString();
 }
 
 } // namespace limo::numerics::fraction
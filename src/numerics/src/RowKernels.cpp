@@ -0,0 +1,448 @@
+#include "limo/numerics/RowKernels.hpp"
+
+#include <atomic>
+#include <cmath>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define LIMO_KERNELS_X86 1
+#include <immintrin.h>
+#endif
+
+namespace limo::numerics::kernels {
+
+namespace {
+
+struct KernelTable {
+    void (*axpyDouble)(double*, const double*, double, std::size_t);
+    void (*axpyFloat)(float*, const float*, float, std::size_t);
+    void (*scaleDouble)(double*, double, std::size_t);
+    void (*scaleFloat)(float*, float, std::size_t);
+    void (*tileDouble)(const double*, std::size_t, const double*, std::size_t, double*, std::size_t, std::size_t,
+                       std::size_t);
+    void (*tileFloat)(const float*, std::size_t, const float*, std::size_t, float*, std::size_t, std::size_t,
+                      std::size_t);
+};
+
+template <typename T>
+void axpyScalar(T* target, const T* source, T factor, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        target[i] += factor * source[i];
+    }
+}
+
+template <typename T>
+void scaleScalar(T* values, T factor, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        values[i] *= factor;
+    }
+}
+
+template <typename T>
+void multiplyTileScalar(const T* a, std::size_t lda, const T* packed, std::size_t depth, T* c, std::size_t ldc,
+                        std::size_t rows, std::size_t cols) {
+    T accumulator[kTileRows][kTileCols] = {};
+    for (std::size_t k = 0; k < depth; ++k) {
+        const T* b = packed + k * kTileCols;
+        for (std::size_t r = 0; r < rows; ++r) {
+            const T left = a[r * lda + k];
+            for (std::size_t j = 0; j < kTileCols; ++j) {
+                accumulator[r][j] += left * b[j];
+            }
+        }
+    }
+    for (std::size_t r = 0; r < rows; ++r) {
+        for (std::size_t j = 0; j < cols; ++j) {
+            c[r * ldc + j] += accumulator[r][j];
+        }
+    }
+}
+
+template <typename T>
+void addTile(const T (&tile)[kTileRows][kTileCols], T* c, std::size_t ldc, std::size_t rows, std::size_t cols) {
+    for (std::size_t r = 0; r < rows; ++r) {
+        for (std::size_t j = 0; j < cols; ++j) {
+            c[r * ldc + j] += tile[r][j];
+        }
+    }
+}
+
+constexpr KernelTable kScalarTable{
+    &axpyScalar<double>,
+    &axpyScalar<float>,
+    &scaleScalar<double>,
+    &scaleScalar<float>,
+    &multiplyTileScalar<double>,
+    &multiplyTileScalar<float>,
+};
+
+#ifdef LIMO_KERNELS_X86
+
+// Two vectors per iteration hide FMA latency; the remainder falls back to
+// one vector and then scalar code, which also fuses so every element rounds
+// the same way.
+__attribute__((target("avx2,fma"))) void axpyDoubleAvx2(double* target, const double* source, double factor,
+                                                         std::size_t count) {
+    const __m256d f = _mm256_set1_pd(factor);
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m256d t0 = _mm256_fmadd_pd(_mm256_loadu_pd(source + i), f, _mm256_loadu_pd(target + i));
+        const __m256d t1 = _mm256_fmadd_pd(_mm256_loadu_pd(source + i + 4), f, _mm256_loadu_pd(target + i + 4));
+        _mm256_storeu_pd(target + i, t0);
+        _mm256_storeu_pd(target + i + 4, t1);
+    }
+    for (; i + 4 <= count; i += 4) {
+        _mm256_storeu_pd(target + i, _mm256_fmadd_pd(_mm256_loadu_pd(source + i), f, _mm256_loadu_pd(target + i)));
+    }
+    for (; i < count; ++i) {
+        target[i] = std::fma(factor, source[i], target[i]);
+    }
+}
+
+__attribute__((target("avx2,fma"))) void axpyFloatAvx2(float* target, const float* source, float factor,
+                                                        std::size_t count) {
+    const __m256 f = _mm256_set1_ps(factor);
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        const __m256 t0 = _mm256_fmadd_ps(_mm256_loadu_ps(source + i), f, _mm256_loadu_ps(target + i));
+        const __m256 t1 = _mm256_fmadd_ps(_mm256_loadu_ps(source + i + 8), f, _mm256_loadu_ps(target + i + 8));
+        _mm256_storeu_ps(target + i, t0);
+        _mm256_storeu_ps(target + i + 8, t1);
+    }
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_ps(target + i, _mm256_fmadd_ps(_mm256_loadu_ps(source + i), f, _mm256_loadu_ps(target + i)));
+    }
+    for (; i < count; ++i) {
+        target[i] = std::fma(factor, source[i], target[i]);
+    }
+}
+
+__attribute__((target("avx2"))) void scaleDoubleAvx2(double* values, double factor, std::size_t count) {
+    const __m256d f = _mm256_set1_pd(factor);
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        _mm256_storeu_pd(values + i, _mm256_mul_pd(_mm256_loadu_pd(values + i), f));
+    }
+    for (; i < count; ++i) {
+        values[i] *= factor;
+    }
+}
+
+__attribute__((target("avx2"))) void scaleFloatAvx2(float* values, float factor, std::size_t count) {
+    const __m256 f = _mm256_set1_ps(factor);
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_ps(values + i, _mm256_mul_ps(_mm256_loadu_ps(values + i), f));
+    }
+    for (; i < count; ++i) {
+        values[i] *= factor;
+    }
+}
+
+// AVX-512 handles the tail with a masked load/store instead of scalar code.
+__attribute__((target("avx512f"))) void axpyDoubleAvx512(double* target, const double* source, double factor,
+                                                          std::size_t count) {
+    const __m512d f = _mm512_set1_pd(factor);
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        const __m512d t0 = _mm512_fmadd_pd(_mm512_loadu_pd(source + i), f, _mm512_loadu_pd(target + i));
+        const __m512d t1 = _mm512_fmadd_pd(_mm512_loadu_pd(source + i + 8), f, _mm512_loadu_pd(target + i + 8));
+        _mm512_storeu_pd(target + i, t0);
+        _mm512_storeu_pd(target + i + 8, t1);
+    }
+    for (; i + 8 <= count; i += 8) {
+        _mm512_storeu_pd(target + i, _mm512_fmadd_pd(_mm512_loadu_pd(source + i), f, _mm512_loadu_pd(target + i)));
+    }
+    if (i < count) {
+        const __mmask8 mask = static_cast<__mmask8>((1u << (count - i)) - 1);
+        const __m512d t = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask, source + i), f,
+                                          _mm512_maskz_loadu_pd(mask, target + i));
+        _mm512_mask_storeu_pd(target + i, mask, t);
+    }
+}
+
+__attribute__((target("avx512f"))) void axpyFloatAvx512(float* target, const float* source, float factor,
+                                                         std::size_t count) {
+    const __m512 f = _mm512_set1_ps(factor);
+    std::size_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        const __m512 t0 = _mm512_fmadd_ps(_mm512_loadu_ps(source + i), f, _mm512_loadu_ps(target + i));
+        const __m512 t1 = _mm512_fmadd_ps(_mm512_loadu_ps(source + i + 16), f, _mm512_loadu_ps(target + i + 16));
+        _mm512_storeu_ps(target + i, t0);
+        _mm512_storeu_ps(target + i + 16, t1);
+    }
+    for (; i + 16 <= count; i += 16) {
+        _mm512_storeu_ps(target + i, _mm512_fmadd_ps(_mm512_loadu_ps(source + i), f, _mm512_loadu_ps(target + i)));
+    }
+    if (i < count) {
+        const __mmask16 mask = static_cast<__mmask16>((1u << (count - i)) - 1);
+        const __m512 t = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, source + i), f,
+                                         _mm512_maskz_loadu_ps(mask, target + i));
+        _mm512_mask_storeu_ps(target + i, mask, t);
+    }
+}
+
+__attribute__((target("avx512f"))) void scaleDoubleAvx512(double* values, double factor, std::size_t count) {
+    const __m512d f = _mm512_set1_pd(factor);
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm512_storeu_pd(values + i, _mm512_mul_pd(_mm512_loadu_pd(values + i), f));
+    }
+    if (i < count) {
+        const __mmask8 mask = static_cast<__mmask8>((1u << (count - i)) - 1);
+        _mm512_mask_storeu_pd(values + i, mask, _mm512_mul_pd(_mm512_maskz_loadu_pd(mask, values + i), f));
+    }
+}
+
+__attribute__((target("avx512f"))) void scaleFloatAvx512(float* values, float factor, std::size_t count) {
+    const __m512 f = _mm512_set1_ps(factor);
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        _mm512_storeu_ps(values + i, _mm512_mul_ps(_mm512_loadu_ps(values + i), f));
+    }
+    if (i < count) {
+        const __mmask16 mask = static_cast<__mmask16>((1u << (count - i)) - 1);
+        _mm512_mask_storeu_ps(values + i, mask, _mm512_mul_ps(_mm512_maskz_loadu_ps(mask, values + i), f));
+    }
+}
+
+// The tile kernels keep all kTileRows x kTileCols accumulators in registers
+// and broadcast one left-operand element per row and k. Rows beyond `rows`
+// alias row 0, so partial tiles run the same code and drop the extra results.
+__attribute__((target("avx2,fma"))) void multiplyTileDoubleAvx2(const double* a, std::size_t lda,
+                                                                 const double* packed, std::size_t depth, double* c,
+                                                                 std::size_t ldc, std::size_t rows,
+                                                                 std::size_t cols) {
+    const double* a0 = a;
+    const double* a1 = rows > 1 ? a + lda : a;
+    const double* a2 = rows > 2 ? a + 2 * lda : a;
+    const double* a3 = rows > 3 ? a + 3 * lda : a;
+    __m256d c00 = _mm256_setzero_pd();
+    __m256d c01 = c00, c10 = c00, c11 = c00, c20 = c00, c21 = c00, c30 = c00, c31 = c00;
+    for (std::size_t k = 0; k < depth; ++k) {
+        const __m256d b0 = _mm256_loadu_pd(packed + k * kTileCols);
+        const __m256d b1 = _mm256_loadu_pd(packed + k * kTileCols + 4);
+        __m256d left = _mm256_broadcast_sd(a0 + k);
+        c00 = _mm256_fmadd_pd(left, b0, c00);
+        c01 = _mm256_fmadd_pd(left, b1, c01);
+        left = _mm256_broadcast_sd(a1 + k);
+        c10 = _mm256_fmadd_pd(left, b0, c10);
+        c11 = _mm256_fmadd_pd(left, b1, c11);
+        left = _mm256_broadcast_sd(a2 + k);
+        c20 = _mm256_fmadd_pd(left, b0, c20);
+        c21 = _mm256_fmadd_pd(left, b1, c21);
+        left = _mm256_broadcast_sd(a3 + k);
+        c30 = _mm256_fmadd_pd(left, b0, c30);
+        c31 = _mm256_fmadd_pd(left, b1, c31);
+    }
+    double tile[kTileRows][kTileCols];
+    _mm256_storeu_pd(tile[0], c00);
+    _mm256_storeu_pd(tile[0] + 4, c01);
+    _mm256_storeu_pd(tile[1], c10);
+    _mm256_storeu_pd(tile[1] + 4, c11);
+    _mm256_storeu_pd(tile[2], c20);
+    _mm256_storeu_pd(tile[2] + 4, c21);
+    _mm256_storeu_pd(tile[3], c30);
+    _mm256_storeu_pd(tile[3] + 4, c31);
+    addTile(tile, c, ldc, rows, cols);
+}
+
+// One ymm per row; k is unrolled by two into separate accumulators so
+// eight independent FMA chains are in flight.
+__attribute__((target("avx2,fma"))) void multiplyTileFloatAvx2(const float* a, std::size_t lda, const float* packed,
+                                                                std::size_t depth, float* c, std::size_t ldc,
+                                                                std::size_t rows, std::size_t cols) {
+    const float* rowsA[kTileRows] = {a, rows > 1 ? a + lda : a, rows > 2 ? a + 2 * lda : a,
+                                     rows > 3 ? a + 3 * lda : a};
+    __m256 even[kTileRows] = {_mm256_setzero_ps(), _mm256_setzero_ps(), _mm256_setzero_ps(), _mm256_setzero_ps()};
+    __m256 odd[kTileRows] = {_mm256_setzero_ps(), _mm256_setzero_ps(), _mm256_setzero_ps(), _mm256_setzero_ps()};
+    std::size_t k = 0;
+    for (; k + 2 <= depth; k += 2) {
+        const __m256 b0 = _mm256_loadu_ps(packed + k * kTileCols);
+        const __m256 b1 = _mm256_loadu_ps(packed + (k + 1) * kTileCols);
+        for (std::size_t r = 0; r < kTileRows; ++r) {
+            even[r] = _mm256_fmadd_ps(_mm256_broadcast_ss(rowsA[r] + k), b0, even[r]);
+            odd[r] = _mm256_fmadd_ps(_mm256_broadcast_ss(rowsA[r] + k + 1), b1, odd[r]);
+        }
+    }
+    if (k < depth) {
+        const __m256 b0 = _mm256_loadu_ps(packed + k * kTileCols);
+        for (std::size_t r = 0; r < kTileRows; ++r) {
+            even[r] = _mm256_fmadd_ps(_mm256_broadcast_ss(rowsA[r] + k), b0, even[r]);
+        }
+    }
+    float tile[kTileRows][kTileCols];
+    for (std::size_t r = 0; r < kTileRows; ++r) {
+        _mm256_storeu_ps(tile[r], _mm256_add_ps(even[r], odd[r]));
+    }
+    addTile(tile, c, ldc, rows, cols);
+}
+
+// One zmm per row; same k unrolling as the float AVX2 kernel.
+__attribute__((target("avx512f"))) void multiplyTileDoubleAvx512(const double* a, std::size_t lda,
+                                                                  const double* packed, std::size_t depth, double* c,
+                                                                  std::size_t ldc, std::size_t rows,
+                                                                  std::size_t cols) {
+    const double* rowsA[kTileRows] = {a, rows > 1 ? a + lda : a, rows > 2 ? a + 2 * lda : a,
+                                      rows > 3 ? a + 3 * lda : a};
+    __m512d even[kTileRows] = {_mm512_setzero_pd(), _mm512_setzero_pd(), _mm512_setzero_pd(), _mm512_setzero_pd()};
+    __m512d odd[kTileRows] = {_mm512_setzero_pd(), _mm512_setzero_pd(), _mm512_setzero_pd(), _mm512_setzero_pd()};
+    std::size_t k = 0;
+    for (; k + 2 <= depth; k += 2) {
+        const __m512d b0 = _mm512_loadu_pd(packed + k * kTileCols);
+        const __m512d b1 = _mm512_loadu_pd(packed + (k + 1) * kTileCols);
+        for (std::size_t r = 0; r < kTileRows; ++r) {
+            even[r] = _mm512_fmadd_pd(_mm512_set1_pd(rowsA[r][k]), b0, even[r]);
+            odd[r] = _mm512_fmadd_pd(_mm512_set1_pd(rowsA[r][k + 1]), b1, odd[r]);
+        }
+    }
+    if (k < depth) {
+        const __m512d b0 = _mm512_loadu_pd(packed + k * kTileCols);
+        for (std::size_t r = 0; r < kTileRows; ++r) {
+            even[r] = _mm512_fmadd_pd(_mm512_set1_pd(rowsA[r][k]), b0, even[r]);
+        }
+    }
+    double tile[kTileRows][kTileCols];
+    for (std::size_t r = 0; r < kTileRows; ++r) {
+        _mm512_storeu_pd(tile[r], _mm512_add_pd(even[r], odd[r]));
+    }
+    addTile(tile, c, ldc, rows, cols);
+}
+
+constexpr KernelTable kAvx2Table{
+    &axpyDoubleAvx2,
+    &axpyFloatAvx2,
+    &scaleDoubleAvx2,
+    &scaleFloatAvx2,
+    &multiplyTileDoubleAvx2,
+    &multiplyTileFloatAvx2,
+};
+
+// A 4x8 float tile only fills half a zmm register, so floats keep using the
+// AVX2 tile kernel; isSupported(Isa::Avx512) therefore also requires AVX2
+// and FMA.
+constexpr KernelTable kAvx512Table{
+    &axpyDoubleAvx512,
+    &axpyFloatAvx512,
+    &scaleDoubleAvx512,
+    &scaleFloatAvx512,
+    &multiplyTileDoubleAvx512,
+    &multiplyTileFloatAvx2,
+};
+
+#endif
+
+const KernelTable& tableFor(Isa isa) {
+#ifdef LIMO_KERNELS_X86
+    switch (isa) {
+    case Isa::Avx512:
+        return kAvx512Table;
+    case Isa::Avx2:
+        return kAvx2Table;
+    case Isa::Scalar:
+        break;
+    }
+#else
+    (void)isa;
+#endif
+    return kScalarTable;
+}
+
+Isa detectIsa() {
+    if (isSupported(Isa::Avx512)) {
+        return Isa::Avx512;
+    }
+    if (isSupported(Isa::Avx2)) {
+        return Isa::Avx2;
+    }
+    return Isa::Scalar;
+}
+
+struct Dispatch {
+    std::atomic<Isa> isa;
+    std::atomic<const KernelTable*> table;
+
+    Dispatch() : isa(detectIsa()), table(&tableFor(isa.load())) {}
+};
+
+Dispatch& dispatch() {
+    static Dispatch instance;
+    return instance;
+}
+
+const KernelTable& activeTable() {
+    return *dispatch().table.load(std::memory_order_relaxed);
+}
+
+} // namespace
+
+const char* isaName(Isa isa) {
+    switch (isa) {
+    case Isa::Avx512:
+        return "avx512";
+    case Isa::Avx2:
+        return "avx2";
+    case Isa::Scalar:
+        break;
+    }
+    return "scalar";
+}
+
+bool isSupported(Isa isa) {
+    switch (isa) {
+    case Isa::Scalar:
+        return true;
+#ifdef LIMO_KERNELS_X86
+    case Isa::Avx2:
+        return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    case Isa::Avx512:
+        return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx2") &&
+               __builtin_cpu_supports("fma");
+#else
+    case Isa::Avx2:
+    case Isa::Avx512:
+        return false;
+#endif
+    }
+    return false;
+}
+
+Isa activeIsa() {
+    return dispatch().isa.load(std::memory_order_relaxed);
+}
+
+bool selectIsa(Isa isa) {
+    if (!isSupported(isa)) {
+        return false;
+    }
+    dispatch().isa.store(isa, std::memory_order_relaxed);
+    dispatch().table.store(&tableFor(isa), std::memory_order_relaxed);
+    return true;
+}
+
+void axpy(double* target, const double* source, double factor, std::size_t count) {
+    activeTable().axpyDouble(target, source, factor, count);
+}
+
+void axpy(float* target, const float* source, float factor, std::size_t count) {
+    activeTable().axpyFloat(target, source, factor, count);
+}
+
+void scale(double* values, double factor, std::size_t count) {
+    activeTable().scaleDouble(values, factor, count);
+}
+
+void scale(float* values, float factor, std::size_t count) {
+    activeTable().scaleFloat(values, factor, count);
+}
+
+void multiplyTile(const double* a, std::size_t lda, const double* packed, std::size_t depth, double* c,
+                  std::size_t ldc, std::size_t rows, std::size_t cols) {
+    activeTable().tileDouble(a, lda, packed, depth, c, ldc, rows, cols);
+}
+
+void multiplyTile(const float* a, std::size_t lda, const float* packed, std::size_t depth, float* c,
+                  std::size_t ldc, std::size_t rows, std::size_t cols) {
+    activeTable().tileFloat(a, lda, packed, depth, c, ldc, rows, cols);
+}
+
+} // namespace limo::numerics::kernels
@@ -0,0 +1,95 @@
+#include "limo/numerics/BigInt.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+
+using limo::numerics::BigInt;
+
+namespace {
+
+BigInt power(BigInt base, int exponent) {
+    BigInt result(1);
+    for (int i = 0; i < exponent; ++i) {
+        result *= base;
+    }
+    return result;
+}
+
+} // namespace
+
+TEST(BigIntConversionTests, RoundTripsInt64Limits) {
+    const std::int64_t minValue = std::numeric_limits<std::int64_t>::min();
+    const std::int64_t maxValue = std::numeric_limits<std::int64_t>::max();
+
+    EXPECT_EQ(BigInt(minValue).toInt64(), minValue);
+    EXPECT_EQ(BigInt(maxValue).toInt64(), maxValue);
+    EXPECT_EQ(BigInt(0).toInt64(), 0);
+    EXPECT_TRUE(BigInt(0).isZero());
+    EXPECT_EQ(BigInt(-5).sign(), -1);
+
+    const BigInt tooLarge = BigInt(maxValue) + BigInt(1);
+    EXPECT_FALSE(tooLarge.fitsInt64());
+    EXPECT_THROW(tooLarge.toInt64(), std::overflow_error);
+    EXPECT_TRUE((-tooLarge).fitsInt64());
+}
+
+TEST(BigIntConversionTests, FormatsDecimalStrings) {
+    EXPECT_EQ(BigInt(0).toString(), "0");
+    EXPECT_EQ(BigInt(-1234567890123).toString(), "-1234567890123");
+    EXPECT_EQ(power(BigInt(10), 30).toString(), "1000000000000000000000000000000");
+    EXPECT_DOUBLE_EQ(power(BigInt(2), 70).toDouble(), 1180591620717411303424.0);
+}
+
+TEST(BigIntArithmeticTests, AddsAndSubtractsWithSigns) {
+    const BigInt large = power(BigInt(2), 64);
+    EXPECT_EQ((large - BigInt(1)).toString(), "18446744073709551615");
+    EXPECT_EQ((BigInt(5) - large).toString(), "-18446744073709551611");
+    EXPECT_EQ(large + (-large), BigInt(0));
+    EXPECT_EQ(BigInt(-3) + BigInt(10), BigInt(7));
+}
+
+TEST(BigIntArithmeticTests, MultipliesAndDividesMultiLimbValues) {
+    const BigInt a = power(BigInt(3), 50);
+    const BigInt b = power(BigInt(7), 30);
+    const BigInt product = a * b;
+
+    EXPECT_EQ(product / a, b);
+    EXPECT_EQ(product / b, a);
+    EXPECT_EQ(product % a, BigInt(0));
+
+    const BigInt dividend = product + BigInt(12345);
+    BigInt quotient;
+    BigInt remainder;
+    BigInt::divMod(dividend, b, quotient, remainder);
+    EXPECT_EQ(quotient * b + remainder, dividend);
+    EXPECT_LT(remainder, b);
+
+    BigInt::divMod(-dividend, b, quotient, remainder);
+    EXPECT_TRUE(quotient.isNegative());
+    EXPECT_TRUE(remainder.isNegative());
+    EXPECT_EQ(quotient * b + remainder, -dividend);
+
+    EXPECT_THROW(a / BigInt(0), std::invalid_argument);
+}
+
+TEST(BigIntArithmeticTests, ShiftsAndComputesGcd) {
+    const BigInt one(1);
+    EXPECT_EQ((one << 100) >> 100, one);
+    EXPECT_EQ((one << 100).bitLength(), 101u);
+    EXPECT_EQ(BigInt(12) >> 200, BigInt(0));
+
+    const BigInt common = power(BigInt(11), 25);
+    EXPECT_EQ(BigInt::gcd(common * BigInt(6), -common * BigInt(4)), common * BigInt(2));
+    EXPECT_EQ(BigInt::gcd(BigInt(0), BigInt(-9)), BigInt(9));
+}
+
+TEST(BigIntComparisonTests, OrdersBySignAndMagnitude) {
+    const BigInt large = power(BigInt(2), 80);
+    EXPECT_LT(-large, BigInt(-1));
+    EXPECT_LT(BigInt(-1), BigInt(0));
+    EXPECT_LT(BigInt(0), large);
+    EXPECT_GT(large, large - BigInt(1));
+    EXPECT_EQ(large, power(BigInt(4), 40));
+}
@@ -2,6 +2,9 @@
 
 #include <gtest/gtest.h>
 
+#include <cstdint>
+#include <limits>
+
 using limo::numerics::fraction::Fraction;
 
 TEST(FractionNormalizeTests, ReducesAndKeepsPositiveDenominator) {
@@ -16,6 +19,28 @@ TEST(FractionNormalizeTests, ReducesAndKeepsPositiveDenominator) {
     EXPECT_EQ(negativeDenom.getDenominator(), 3);
 }
 
+TEST(FractionNormalizeTests, OperatorsKeepCanonicalForm) {
+    Fraction constructed(6, -8);
+    EXPECT_EQ(constructed.getNumerator(), -3);
+    EXPECT_EQ(constructed.getDenominator(), 4);
+
+    Fraction sum = Fraction(1, 6) + Fraction(1, 3);
+    EXPECT_EQ(sum.getNumerator(), 1);
+    EXPECT_EQ(sum.getDenominator(), 2);
+
+    Fraction product = Fraction(4, 9) * Fraction(3, 8);
+    EXPECT_EQ(product.getNumerator(), 1);
+    EXPECT_EQ(product.getDenominator(), 6);
+
+    Fraction quotient = Fraction(2, 3) / Fraction(-4, 9);
+    EXPECT_EQ(quotient.getNumerator(), -3);
+    EXPECT_EQ(quotient.getDenominator(), 2);
+
+    Fraction zero = Fraction(1, 6) - Fraction(2, 12);
+    EXPECT_EQ(zero.getNumerator(), 0);
+    EXPECT_EQ(zero.getDenominator(), 1);
+}
+
 TEST(FractionArithmeticTests, SupportsAddSubtractMultiplyDivide) {
     Fraction left(1, 2);
     Fraction right(1, 3);
@@ -58,3 +83,54 @@ TEST(FractionValueTests, ConvertsToDouble) {
     Fraction value(1, 4);
     EXPECT_DOUBLE_EQ(value.toDouble(), 0.25);
 }
+
+TEST(FractionOverflowTests, PromotesToBigRepresentationOnOverflow) {
+    // 2^62 + 3 shares no factor with 3 or 5, so nothing cancels.
+    const std::int64_t large = (std::int64_t{1} << 62) + 3;
+    Fraction value(large, 3);
+    EXPECT_TRUE(value.isInline());
+
+    Fraction product = value * Fraction(large, 5);
+    EXPECT_FALSE(product.isInline());
+    EXPECT_THROW(product.getNumerator(), std::overflow_error);
+    EXPECT_EQ(product.getBigNumerator(), limo::numerics::BigInt(large) * limo::numerics::BigInt(large));
+    EXPECT_EQ(product.getBigDenominator(), limo::numerics::BigInt(15));
+
+    Fraction back = product / Fraction(large, 5);
+    EXPECT_TRUE(back.isInline());
+    EXPECT_EQ(back, value);
+}
+
+TEST(FractionOverflowTests, ComparesAndSumsBeyondInt64) {
+    const std::int64_t large = std::numeric_limits<std::int64_t>::max();
+    Fraction almostOne(large - 1, large);
+    Fraction one(1);
+
+    EXPECT_TRUE(almostOne < one);
+    EXPECT_TRUE(one > almostOne);
+    EXPECT_FALSE(almostOne == one);
+
+    Fraction sum = almostOne + Fraction(1, large);
+    EXPECT_EQ(sum, one);
+    Fraction difference = one - almostOne;
+    EXPECT_EQ(difference, Fraction(1, large));
+    EXPECT_NEAR(almostOne.toDouble(), 1.0, 1e-15);
+}
+
+TEST(FractionOverflowTests, HandlesInt64MinAndZeroDenominator) {
+    const std::int64_t minValue = std::numeric_limits<std::int64_t>::min();
+    Fraction value(minValue, -2);
+    value.normalize();
+    EXPECT_TRUE(value.isInline());
+    EXPECT_EQ(value.getNumerator(), std::int64_t{1} << 62);
+    EXPECT_EQ(value.getDenominator(), 1);
+
+    EXPECT_THROW(Fraction(1, 0), std::invalid_argument);
+    EXPECT_THROW(Fraction(1) / Fraction(0), std::invalid_argument);
+}
+
+TEST(FractionValueTests, FormatsAsString) {
+    EXPECT_EQ(Fraction(-3, 4).toString(), "-3/4");
+    EXPECT_EQ(Fraction(6, 1).toString(), "6");
+    EXPECT_EQ((-Fraction(1, -2)).toString(), "1/2");
+}
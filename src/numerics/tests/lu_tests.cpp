@@ -0,0 +1,112 @@
+#include "limo/numerics/LU.hpp"
+#include "limo/numerics/Fraction.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using limo::numerics::LU;
+using limo::numerics::Matrix;
+using limo::numerics::fraction::Fraction;
+
+namespace {
+
+template <typename T>
+std::vector<T> multiply(const Matrix<T>& matrix, const std::vector<T>& x) {
+    std::vector<T> result(matrix.rows(), T{});
+    for (std::size_t r = 0; r < matrix.rows(); ++r) {
+        for (std::size_t c = 0; c < matrix.cols(); ++c) {
+            result[r] += matrix(r, c) * x[c];
+        }
+    }
+    return result;
+}
+
+// Diagonally weak, so partial pivoting has to reorder rows.
+Matrix<double> pivotingMatrix(std::size_t size) {
+    Matrix<double> matrix(size, size);
+    for (std::size_t r = 0; r < size; ++r) {
+        for (std::size_t c = 0; c < size; ++c) {
+            matrix(r, c) = static_cast<double>((r * 5 + c * 3) % 7) - 3.0 + (r == c ? 0.5 : 0.0);
+        }
+    }
+    return matrix;
+}
+
+} // namespace
+
+TEST(LUTests, SolvesAndSolvesTransposeWithPivoting) {
+    const Matrix<double> matrix = {{0.0, 2.0, 1.0}, {1.0, 1.0, 0.0}, {3.0, 0.0, 4.0}};
+    const LU<double> lu(matrix);
+
+    const std::vector<double> b = {5.0, 3.0, 10.0};
+    const std::vector<double> x = lu.solve(b);
+    const std::vector<double> ax = multiply(matrix, x);
+    const std::vector<double> y = lu.solve_transpose(b);
+    const std::vector<double> aty = multiply(matrix.transpose(), y);
+    for (std::size_t i = 0; i < b.size(); ++i) {
+        EXPECT_NEAR(ax[i], b[i], 1e-12);
+        EXPECT_NEAR(aty[i], b[i], 1e-12);
+    }
+    EXPECT_EQ(lu.permutation()[0], 2u);
+    EXPECT_NEAR(lu.determinant(), -11.0, 1e-12);
+}
+
+TEST(LUTests, MultipleRightHandSidesMatchSingleSolves) {
+    const Matrix<double> matrix = pivotingMatrix(9);
+    const LU<double> lu(matrix);
+
+    Matrix<double> rhs(9, 4);
+    for (std::size_t r = 0; r < rhs.rows(); ++r) {
+        for (std::size_t c = 0; c < rhs.cols(); ++c) {
+            rhs(r, c) = static_cast<double>(r) - 2.0 * static_cast<double>(c);
+        }
+    }
+    const Matrix<double> x = lu.solve(rhs);
+    const Matrix<double> y = lu.solve_transpose(rhs);
+    for (std::size_t c = 0; c < rhs.cols(); ++c) {
+        std::vector<double> column(rhs.rows());
+        for (std::size_t r = 0; r < rhs.rows(); ++r) {
+            column[r] = rhs(r, c);
+        }
+        const std::vector<double> single = lu.solve(column);
+        const std::vector<double> singleTranspose = lu.solve_transpose(column);
+        for (std::size_t r = 0; r < rhs.rows(); ++r) {
+            EXPECT_NEAR(x(r, c), single[r], 1e-10);
+            EXPECT_NEAR(y(r, c), singleTranspose[r], 1e-10);
+        }
+    }
+
+    const Matrix<double> product = matrix * lu.inverse();
+    for (std::size_t r = 0; r < product.rows(); ++r) {
+        for (std::size_t c = 0; c < product.cols(); ++c) {
+            EXPECT_NEAR(product(r, c), r == c ? 1.0 : 0.0, 1e-10);
+        }
+    }
+}
+
+TEST(LUTests, FactorsFractionsExactly) {
+    const Matrix<Fraction> matrix = {
+        {Fraction(0), Fraction(1, 2), Fraction(2)},
+        {Fraction(3), Fraction(1), Fraction(0)},
+        {Fraction(1, 3), Fraction(0), Fraction(5)},
+    };
+    const LU<Fraction> lu(matrix);
+
+    const std::vector<Fraction> b = {Fraction(1), Fraction(2, 3), Fraction(-4)};
+    EXPECT_EQ(multiply(matrix, lu.solve(b)), b);
+    EXPECT_EQ(multiply(matrix.transpose(), lu.solve_transpose(b)), b);
+    EXPECT_EQ(lu.determinant(), Fraction(-49, 6));
+}
+
+TEST(LUTests, RejectsSingularNonSquareAndMismatchedInputs) {
+    EXPECT_THROW(LU<double>(Matrix<double>(2, 3)), std::invalid_argument);
+    EXPECT_THROW(LU<double>(Matrix<double>{{1.0, 2.0}, {2.0, 4.0}}), std::invalid_argument);
+    EXPECT_THROW(LU<double>(Matrix<double>{{1.0, 1.0}, {1.0, 1.0 + 1e-17}}), std::invalid_argument);
+    EXPECT_THROW(LU<Fraction>(Matrix<Fraction>{{Fraction(1), Fraction(2)}, {Fraction(1, 2), Fraction(1)}}),
+                 std::invalid_argument);
+
+    const LU<double> lu(Matrix<double>{{2.0, 0.0}, {0.0, 4.0}});
+    EXPECT_THROW(lu.solve(std::vector<double>{1.0}), std::invalid_argument);
+    EXPECT_THROW(lu.solve_transpose(Matrix<double>(3, 1)), std::invalid_argument);
+}
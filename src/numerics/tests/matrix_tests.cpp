@@ -1,8 +1,41 @@
 #include "limo/numerics/Matrix.hpp"
+#include "limo/numerics/Fraction.hpp"
 
 #include <gtest/gtest.h>
 
 using limo::numerics::Matrix;
+using limo::numerics::fraction::Fraction;
+using limo::thread_pool::ThreadPool;
+
+namespace {
+
+template <typename T>
+Matrix<T> patterned(std::size_t rows, std::size_t cols, int seed) {
+    Matrix<T> matrix(rows, cols);
+    for (std::size_t r = 0; r < rows; ++r) {
+        for (std::size_t c = 0; c < cols; ++c) {
+            matrix(r, c) = T(static_cast<int>((r * 7 + c * 13 + static_cast<std::size_t>(seed)) % 11) - 5);
+        }
+    }
+    return matrix;
+}
+
+template <typename T>
+Matrix<T> referenceProduct(const Matrix<T>& left, const Matrix<T>& right) {
+    Matrix<T> result(left.rows(), right.cols(), T{});
+    for (std::size_t r = 0; r < left.rows(); ++r) {
+        for (std::size_t c = 0; c < right.cols(); ++c) {
+            T sum{};
+            for (std::size_t k = 0; k < left.cols(); ++k) {
+                sum += left(r, k) * right(k, c);
+            }
+            result(r, c) = sum;
+        }
+    }
+    return result;
+}
+
+} // namespace
 
 TEST(MatrixConstructionTests, CreatesWithDimensionsAndInitializerList) {
     Matrix<int> matrix(2, 3, 7);
@@ -107,6 +140,34 @@ TEST(MatrixArithmeticTests, MultipliesMatrices) {
     EXPECT_THROW(left * mismatch, std::invalid_argument);
 }
 
+TEST(MatrixArithmeticTests, BlockedMultiplyMatchesReference) {
+    // Odd sizes exercise partial register tiles and partial panels.
+    const Matrix<long long> left = patterned<long long>(67, 301, 1);
+    const Matrix<long long> right = patterned<long long>(301, 530, 2);
+    ASSERT_GE(left.rows() * left.cols() * right.cols(), Matrix<long long>::kBlockedMultiplyThreshold);
+    EXPECT_EQ(left * right, referenceProduct(left, right));
+
+    const Matrix<double> leftDouble = patterned<double>(41, 97, 3);
+    const Matrix<double> rightDouble = patterned<double>(97, 83, 4);
+    EXPECT_EQ(leftDouble * rightDouble, referenceProduct(leftDouble, rightDouble));
+
+    const Matrix<Fraction> leftExact = patterned<Fraction>(70, 65, 5);
+    const Matrix<Fraction> rightExact = patterned<Fraction>(65, 60, 6);
+    EXPECT_EQ(leftExact * rightExact, referenceProduct(leftExact, rightExact));
+}
+
+TEST(MatrixArithmeticTests, ParallelMultiplyMatchesSerial) {
+    ThreadPool pool(3);
+    const Matrix<double> left = patterned<double>(259, 257, 7);
+    const Matrix<double> right = patterned<double>(257, 263, 8);
+    ASSERT_GE(left.rows() * left.cols() * right.cols(), Matrix<double>::kParallelMultiplyThreshold);
+    EXPECT_EQ(left.multiply(right, pool), left * right);
+
+    const Matrix<int> small{{1, 2}, {3, 4}};
+    EXPECT_EQ(small.multiply(small, pool), small * small);
+    EXPECT_THROW(small.multiply(Matrix<int>(3, 1), pool), std::invalid_argument);
+}
+
 TEST(MatrixArithmeticTests, InverseHandlesValidAndInvalidMatrices) {
     Matrix<double> matrix{{4.0, 7.0}, {2.0, 6.0}};
     Matrix<double> inverse = matrix.inverse();
@@ -139,6 +200,21 @@ TEST(MatrixArithmeticTests, InverseHandlesValidAndInvalidMatrices) {
     EXPECT_THROW(zeroColumn.inverse(), std::invalid_argument);
 }
 
+TEST(MatrixArithmeticTests, WorksWithExactFractions) {
+    Matrix<Fraction> matrix{{Fraction(4), Fraction(7)}, {Fraction(2), Fraction(6)}};
+    Matrix<Fraction> inverse = matrix.inverse();
+    EXPECT_EQ(inverse(0, 0), Fraction(3, 5));
+    EXPECT_EQ(inverse(0, 1), Fraction(-7, 10));
+    EXPECT_EQ(inverse(1, 0), Fraction(-1, 5));
+    EXPECT_EQ(inverse(1, 1), Fraction(2, 5));
+
+    Matrix<Fraction> product = matrix * inverse;
+    EXPECT_EQ(product(0, 0), Fraction(1));
+    EXPECT_EQ(product(0, 1), Fraction(0));
+    EXPECT_EQ(product(1, 0), Fraction(0));
+    EXPECT_EQ(product(1, 1), Fraction(1));
+}
+
 TEST(MatrixArithmeticTests, EqualityOperatorsCompareSizesAndData) {
     Matrix<int> left{{1, 2}, {3, 4}};
     Matrix<int> same{{1, 2}, {3, 4}};
@@ -169,6 +245,42 @@ TEST(MatrixRowOperationTests, SwapsScalesAndAddsRows) {
     EXPECT_THROW(matrix.add_scaled_row(0, 4, 1), std::out_of_range);
 }
 
+TEST(MatrixRowOperationTests, EliminatesPivotColumnInOnePass) {
+    Matrix<double> matrix{{2.0, 4.0, 6.0, 8.0, 1.0}, {1.0, 3.0, 5.0, 7.0, 2.0}, {0.0, 1.0, 0.0, 1.0, 3.0}};
+    matrix.eliminate_column(0, 0);
+
+    EXPECT_DOUBLE_EQ(matrix(0, 0), 1.0);
+    EXPECT_DOUBLE_EQ(matrix(0, 1), 2.0);
+    EXPECT_DOUBLE_EQ(matrix(0, 4), 0.5);
+    EXPECT_DOUBLE_EQ(matrix(1, 0), 0.0);
+    EXPECT_DOUBLE_EQ(matrix(1, 1), 1.0);
+    EXPECT_DOUBLE_EQ(matrix(1, 3), 3.0);
+    EXPECT_DOUBLE_EQ(matrix(1, 4), 1.5);
+    EXPECT_DOUBLE_EQ(matrix(2, 1), 1.0);
+    EXPECT_DOUBLE_EQ(matrix(2, 4), 3.0);
+
+    Matrix<Fraction> exact{{Fraction(3), Fraction(1)}, {Fraction(1), Fraction(2)}};
+    exact.eliminate_column(1, 1);
+    EXPECT_EQ(exact(0, 0), Fraction(5, 2));
+    EXPECT_EQ(exact(0, 1), Fraction(0));
+    EXPECT_EQ(exact(1, 0), Fraction(1, 2));
+    EXPECT_EQ(exact(1, 1), Fraction(1));
+
+    EXPECT_THROW(matrix.eliminate_column(3, 0), std::out_of_range);
+    EXPECT_THROW(matrix.eliminate_column(0, 5), std::out_of_range);
+    EXPECT_THROW(matrix.eliminate_column(2, 0), std::invalid_argument);
+}
+
+TEST(MatrixRowOperationTests, FloatingRowKernelsHandleWideRows) {
+    Matrix<float> matrix(2, 37, 1.0f);
+    matrix.scale_row(1, 2.0f);
+    matrix.add_scaled_row(0, 1, 0.5f);
+    for (std::size_t c = 0; c < matrix.cols(); ++c) {
+        EXPECT_FLOAT_EQ(matrix(0, c), 2.0f);
+        EXPECT_FLOAT_EQ(matrix(1, c), 2.0f);
+    }
+}
+
 TEST(MatrixTransformTests, TransposesMatrix) {
     Matrix<int> matrix{{1, 2, 3}, {4, 5, 6}};
     Matrix<int> transposed = matrix.transpose();
@@ -182,3 +294,18 @@ TEST(MatrixTransformTests, TransposesMatrix) {
     EXPECT_EQ(transposed(1, 1), 5);
     EXPECT_EQ(transposed(2, 1), 6);
 }
+
+TEST(MatrixTransformTests, TransposesLargeMatrixInTiles) {
+    const Matrix<int> matrix = patterned<int>(75, 130, 9);
+    ASSERT_GE(matrix.size(), Matrix<int>::kBlockedTransposeThreshold);
+    const Matrix<int> transposed = matrix.transpose();
+
+    ASSERT_EQ(transposed.rows(), 130u);
+    ASSERT_EQ(transposed.cols(), 75u);
+    for (std::size_t r = 0; r < matrix.rows(); ++r) {
+        for (std::size_t c = 0; c < matrix.cols(); ++c) {
+            EXPECT_EQ(transposed(c, r), matrix(r, c));
+        }
+    }
+    EXPECT_EQ(transposed.transpose(), matrix);
+}
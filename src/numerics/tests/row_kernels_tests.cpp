@@ -0,0 +1,155 @@
+#include "limo/numerics/RowKernels.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace kernels = limo::numerics::kernels;
+
+namespace {
+
+constexpr kernels::Isa kAllIsas[] = {kernels::Isa::Scalar, kernels::Isa::Avx2, kernels::Isa::Avx512};
+
+template <typename T>
+std::vector<T> sequence(std::size_t count, T start, T step) {
+    std::vector<T> values(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        values[i] = start + step * static_cast<T>(i);
+    }
+    return values;
+}
+
+class RowKernelsTests : public ::testing::Test {
+protected:
+    void TearDown() override { kernels::selectIsa(initial); }
+
+    kernels::Isa initial = kernels::activeIsa();
+};
+
+} // namespace
+
+TEST_F(RowKernelsTests, ScalarIsAlwaysSupportedAndSelectable) {
+    EXPECT_TRUE(kernels::isSupported(kernels::Isa::Scalar));
+    EXPECT_TRUE(kernels::selectIsa(kernels::Isa::Scalar));
+    EXPECT_EQ(kernels::activeIsa(), kernels::Isa::Scalar);
+    EXPECT_STREQ(kernels::isaName(kernels::Isa::Scalar), "scalar");
+}
+
+TEST_F(RowKernelsTests, AxpyMatchesReferenceForEveryIsaAndTailLength) {
+    for (kernels::Isa isa : kAllIsas) {
+        if (!kernels::selectIsa(isa)) {
+            continue;
+        }
+        for (std::size_t count : {0u, 1u, 3u, 7u, 8u, 15u, 16u, 33u, 67u}) {
+            std::vector<double> target = sequence<double>(count, 1.0, 0.5);
+            const std::vector<double> source = sequence<double>(count, -2.0, 0.25);
+            kernels::axpy(target.data(), source.data(), 3.0, count);
+
+            std::vector<float> targetFloat = sequence<float>(count, 1.0f, 0.5f);
+            const std::vector<float> sourceFloat = sequence<float>(count, -2.0f, 0.25f);
+            kernels::axpy(targetFloat.data(), sourceFloat.data(), 3.0f, count);
+
+            for (std::size_t i = 0; i < count; ++i) {
+                EXPECT_DOUBLE_EQ(target[i], 1.0 + 0.5 * i + 3.0 * (-2.0 + 0.25 * i)) << kernels::isaName(isa);
+                EXPECT_FLOAT_EQ(targetFloat[i], 1.0f + 0.5f * i + 3.0f * (-2.0f + 0.25f * i)) << kernels::isaName(isa);
+            }
+        }
+    }
+}
+
+TEST_F(RowKernelsTests, AxpyRoundsTheTailLikeTheVectorBody) {
+    // factor * source needs more than one word, so a fused and an unfused
+    // update differ; every element must round the same way whichever loop
+    // handles it.
+    const double factor = 1.0 + 0x1p-30;
+    const float factorFloat = 1.0f + 0x1p-13f;
+    for (kernels::Isa isa : kAllIsas) {
+        if (!kernels::selectIsa(isa)) {
+            continue;
+        }
+        std::vector<double> target(11, -1.0);
+        const std::vector<double> source(target.size(), factor);
+        kernels::axpy(target.data(), source.data(), factor, target.size());
+
+        std::vector<float> targetFloat(19, -1.0f);
+        const std::vector<float> sourceFloat(targetFloat.size(), factorFloat);
+        kernels::axpy(targetFloat.data(), sourceFloat.data(), factorFloat, targetFloat.size());
+
+        for (double value : target) {
+            EXPECT_EQ(value, target.front()) << kernels::isaName(isa);
+        }
+        for (float value : targetFloat) {
+            EXPECT_EQ(value, targetFloat.front()) << kernels::isaName(isa);
+        }
+    }
+}
+
+TEST_F(RowKernelsTests, ScaleMatchesReferenceForEveryIsaAndTailLength) {
+    for (kernels::Isa isa : kAllIsas) {
+        if (!kernels::selectIsa(isa)) {
+            continue;
+        }
+        for (std::size_t count : {0u, 1u, 5u, 8u, 17u, 31u}) {
+            std::vector<double> values = sequence<double>(count, 2.0, 1.0);
+            kernels::scale(values.data(), -0.5, count);
+            std::vector<float> valuesFloat = sequence<float>(count, 2.0f, 1.0f);
+            kernels::scale(valuesFloat.data(), -0.5f, count);
+
+            for (std::size_t i = 0; i < count; ++i) {
+                EXPECT_DOUBLE_EQ(values[i], -0.5 * (2.0 + i)) << kernels::isaName(isa);
+                EXPECT_FLOAT_EQ(valuesFloat[i], -0.5f * (2.0f + i)) << kernels::isaName(isa);
+            }
+        }
+    }
+}
+
+TEST_F(RowKernelsTests, AxpySupportsIdenticalTargetAndSource) {
+    for (kernels::Isa isa : kAllIsas) {
+        if (!kernels::selectIsa(isa)) {
+            continue;
+        }
+        std::vector<double> values = sequence<double>(13, 1.0, 1.0);
+        kernels::axpy(values.data(), values.data(), 1.0, values.size());
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            EXPECT_DOUBLE_EQ(values[i], 2.0 * (1.0 + i)) << kernels::isaName(isa);
+        }
+    }
+}
+
+TEST_F(RowKernelsTests, MultiplyTileMatchesReferenceForEveryIsaAndPartialTile) {
+    constexpr std::size_t depth = 5;
+    constexpr std::size_t lda = 7;
+    constexpr std::size_t ldc = 11;
+    // Small integers keep every product exact, so all ISAs must agree bit for bit.
+    const std::vector<double> a = sequence<double>(kernels::kTileRows * lda, -3.0, 1.0);
+    const std::vector<double> packed = sequence<double>(depth * kernels::kTileCols, 2.0, -1.0);
+    const std::vector<float> aFloat = sequence<float>(kernels::kTileRows * lda, -3.0f, 1.0f);
+    const std::vector<float> packedFloat = sequence<float>(depth * kernels::kTileCols, 2.0f, -1.0f);
+    for (kernels::Isa isa : kAllIsas) {
+        if (!kernels::selectIsa(isa)) {
+            continue;
+        }
+        for (std::size_t rows = 1; rows <= kernels::kTileRows; ++rows) {
+            for (std::size_t cols : {std::size_t{1}, std::size_t{5}, kernels::kTileCols}) {
+                std::vector<double> c(kernels::kTileRows * ldc, 1.0);
+                kernels::multiplyTile(a.data(), lda, packed.data(), depth, c.data(), ldc, rows, cols);
+                std::vector<float> cFloat(kernels::kTileRows * ldc, 1.0f);
+                kernels::multiplyTile(aFloat.data(), lda, packedFloat.data(), depth, cFloat.data(), ldc, rows, cols);
+
+                for (std::size_t r = 0; r < kernels::kTileRows; ++r) {
+                    for (std::size_t j = 0; j < ldc; ++j) {
+                        double expected = 1.0;
+                        if (r < rows && j < cols) {
+                            for (std::size_t k = 0; k < depth; ++k) {
+                                expected += a[r * lda + k] * packed[k * kernels::kTileCols + j];
+                            }
+                        }
+                        EXPECT_EQ(c[r * ldc + j], expected) << kernels::isaName(isa);
+                        EXPECT_EQ(cFloat[r * ldc + j], static_cast<float>(expected)) << kernels::isaName(isa);
+                    }
+                }
+            }
+        }
+    }
+}
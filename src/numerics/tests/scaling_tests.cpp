@@ -0,0 +1,157 @@
+#include "limo/numerics/Scaling.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using limo::numerics::Matrix;
+using limo::numerics::ScaleFactors;
+using limo::numerics::ScalingOptions;
+using limo::numerics::SparseLayout;
+using limo::numerics::SparseMatrix;
+
+namespace {
+
+// Rows and columns multiplied by random powers of ten between 1e-4 and 1e4.
+Matrix<double> badlyScaled(std::size_t rows, std::size_t cols) {
+	std::mt19937 rng(19);
+	std::uniform_int_distribution<int> exponent(-4, 4);
+	std::uniform_real_distribution<double> value(1.0, 3.0);
+	std::uniform_int_distribution<int> sparsity(0, 2);
+	std::vector<double> rowFactor(rows);
+	std::vector<double> colFactor(cols);
+	for (double& factor : rowFactor) {
+		factor = std::pow(10.0, exponent(rng));
+	}
+	for (double& factor : colFactor) {
+		factor = std::pow(10.0, exponent(rng));
+	}
+	Matrix<double> matrix(rows, cols);
+	for (std::size_t row = 0; row < rows; ++row) {
+		for (std::size_t col = 0; col < cols; ++col) {
+			if (sparsity(rng) != 0 || col == row) {
+				matrix(row, col) = value(rng) * rowFactor[row] * colFactor[col];
+			}
+		}
+	}
+	return matrix;
+}
+
+double spread(const Matrix<double>& matrix) {
+	double smallest = INFINITY;
+	double largest = 0.0;
+	for (std::size_t row = 0; row < matrix.rows(); ++row) {
+		for (const double value : matrix.row(row)) {
+			if (value != 0.0) {
+				smallest = std::min(smallest, std::abs(value));
+				largest = std::max(largest, std::abs(value));
+			}
+		}
+	}
+	return largest / smallest;
+}
+
+bool isPowerOfTwo(double value) {
+	int exponent = 0;
+	return std::frexp(value, &exponent) == 0.5;
+}
+
+} // namespace
+
+TEST(ScalingTests, BringsEntriesCloseToOne) {
+	Matrix<double> matrix = badlyScaled(12, 16);
+	ASSERT_GT(spread(matrix), 1e6);
+	const ScaleFactors<double> factors = limo::numerics::scale(matrix);
+	EXPECT_LT(spread(matrix), 64.0);
+	for (std::size_t row = 0; row < matrix.rows(); ++row) {
+		double largest = 0.0;
+		for (const double value : matrix.row(row)) {
+			largest = std::max(largest, std::abs(value));
+		}
+		// Equilibrated up to the power-of-two rounding of the column pass.
+		EXPECT_LE(largest, 2.0 + 1e-12);
+		EXPECT_GE(largest, 0.25);
+	}
+	for (const double factor : factors.rows) {
+		EXPECT_TRUE(isPowerOfTwo(factor)) << factor;
+	}
+	for (const double factor : factors.cols) {
+		EXPECT_TRUE(isPowerOfTwo(factor)) << factor;
+	}
+}
+
+TEST(ScalingTests, PowerOfTwoScalingIsExact) {
+	const Matrix<double> original = badlyScaled(8, 8);
+	Matrix<double> matrix = original;
+	const ScaleFactors<double> factors = limo::numerics::scale(matrix);
+	for (std::size_t row = 0; row < matrix.rows(); ++row) {
+		for (std::size_t col = 0; col < matrix.cols(); ++col) {
+			EXPECT_EQ(matrix(row, col) / factors.rows[row] / factors.cols[col], original(row, col));
+		}
+	}
+
+	std::vector<double> x(8, 3.0);
+	limo::numerics::unscale_columns(x, factors);
+	for (std::size_t col = 0; col < x.size(); ++col) {
+		EXPECT_EQ(x[col], 3.0 * factors.cols[col]);
+	}
+	std::vector<double> y(7, 1.0);
+	EXPECT_THROW(limo::numerics::unscale_rows(y, factors), std::invalid_argument);
+}
+
+TEST(ScalingTests, DenseAndSparseAgree) {
+	const Matrix<double> dense = badlyScaled(10, 7);
+	ScalingOptions options;
+	options.power_of_two = false;
+	const ScaleFactors<double> expected = limo::numerics::compute_scale_factors(dense, options);
+	for (const SparseLayout layout : {SparseLayout::Csc, SparseLayout::Csr}) {
+		SparseMatrix<double> sparse = SparseMatrix<double>::from_dense(dense, layout);
+		const ScaleFactors<double> factors = limo::numerics::scale(sparse, options);
+		ASSERT_EQ(factors.rows.size(), expected.rows.size());
+		for (std::size_t row = 0; row < factors.rows.size(); ++row) {
+			EXPECT_DOUBLE_EQ(factors.rows[row], expected.rows[row]);
+		}
+		for (std::size_t col = 0; col < factors.cols.size(); ++col) {
+			EXPECT_DOUBLE_EQ(factors.cols[col], expected.cols[col]);
+		}
+		Matrix<double> scaled = dense;
+		limo::numerics::apply_scaling(scaled, factors);
+		const Matrix<double> fromSparse = sparse.to_dense();
+		for (std::size_t row = 0; row < scaled.rows(); ++row) {
+			for (std::size_t col = 0; col < scaled.cols(); ++col) {
+				EXPECT_DOUBLE_EQ(fromSparse(row, col), scaled(row, col));
+			}
+		}
+	}
+}
+
+TEST(ScalingTests, LeavesEmptyRowsAndColumnsAtOne) {
+	Matrix<double> matrix{{0.0, 0.0, 0.0}, {0.0, 1e3, 1e-3}};
+	const ScaleFactors<double> factors = limo::numerics::scale(matrix);
+	EXPECT_EQ(factors.rows[0], 1.0);
+	EXPECT_EQ(factors.cols[0], 1.0);
+	EXPECT_LT(spread(matrix), 4.0);
+
+	SparseMatrix<double> sparse(2, 2);
+	EXPECT_THROW(sparse.scale(std::vector<double>{1.0}, std::vector<double>{1.0, 1.0}), std::invalid_argument);
+}
+
+TEST(ScalingTests, HandlesExtremeMagnitudes) {
+	// 1e-300 * 1e-30 underflows to zero, so the geometric mean must not form
+	// that product; without power-of-two rounding nothing hides the result.
+	ScalingOptions options;
+	options.power_of_two = false;
+	options.equilibrate = false;
+	options.geometric_passes = 1;
+	const Matrix<double> matrix{{1e-300, 1e-30}};
+	const ScaleFactors<double> factors = limo::numerics::compute_scale_factors(matrix, options);
+	ASSERT_TRUE(std::isfinite(factors.rows[0]));
+	EXPECT_NEAR(factors.rows[0] * 1e-165, 1.0, 1e-12);
+	for (const double factor : factors.cols) {
+		EXPECT_TRUE(std::isfinite(factor));
+		EXPECT_GT(factor, 0.0);
+	}
+}
@@ -0,0 +1,91 @@
+#include "limo/numerics/SparseMatrix.hpp"
+#include "limo/numerics/Fraction.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using limo::numerics::Matrix;
+using limo::numerics::SparseLayout;
+using limo::numerics::SparseMatrix;
+using limo::numerics::fraction::Fraction;
+
+namespace {
+
+// 3x4:
+//  [ 1 0 0 2 ]
+//  [ 0 0 3 0 ]
+//  [ 4 5 0 0 ]
+SparseMatrix<double> example(SparseLayout layout) {
+    SparseMatrix<double>::Builder builder(3, 4);
+    builder.add(2, 1, 5.0).add(0, 3, 2.0).add(1, 2, 3.0).add(2, 0, 4.0).add(0, 0, 1.0);
+    return builder.build(layout);
+}
+
+} // namespace
+
+TEST(SparseMatrixTests, BuildsSortedColumnsFromUnorderedTriplets) {
+    const SparseMatrix<double> csc = example(SparseLayout::Csc);
+    EXPECT_EQ(csc.rows(), 3u);
+    EXPECT_EQ(csc.cols(), 4u);
+    EXPECT_EQ(csc.non_zeros(), 5u);
+    EXPECT_EQ(csc.starts(), (std::vector<std::size_t>{0, 2, 3, 4, 5}));
+    EXPECT_EQ(csc.indices(), (std::vector<std::size_t>{0, 2, 2, 1, 0}));
+    EXPECT_EQ(csc.values(), (std::vector<double>{1.0, 4.0, 5.0, 3.0, 2.0}));
+
+    const auto rows = csc.column_indices(0);
+    const auto values = csc.column_values(0);
+    ASSERT_EQ(rows.size(), 2u);
+    EXPECT_EQ(rows[1], 2u);
+    EXPECT_EQ(values[1], 4.0);
+    EXPECT_EQ(csc.at(1, 2), 3.0);
+    EXPECT_EQ(csc.at(1, 1), 0.0);
+    EXPECT_THROW(csc.row_indices(0), std::logic_error);
+    EXPECT_THROW(csc.column_indices(4), std::out_of_range);
+    EXPECT_THROW(csc.at(3, 0), std::out_of_range);
+}
+
+TEST(SparseMatrixTests, ConvertsBetweenLayoutsAndDense) {
+    const SparseMatrix<double> csc = example(SparseLayout::Csc);
+    const SparseMatrix<double> csr = example(SparseLayout::Csr);
+
+    EXPECT_EQ(csc.to_csr(), csr);
+    EXPECT_EQ(csr.to_csc(), csc);
+    EXPECT_EQ(csr.row_indices(2)[0], 0u);
+    EXPECT_EQ(csr.row_values(2)[1], 5.0);
+    EXPECT_EQ(csc.to_dense(), csr.to_dense());
+    EXPECT_EQ(SparseMatrix<double>::from_dense(csc.to_dense(), SparseLayout::Csr), csr);
+
+    const SparseMatrix<double> transposed = csc.transpose();
+    EXPECT_EQ(transposed.layout(), SparseLayout::Csr);
+    EXPECT_EQ(transposed.to_dense(), csc.to_dense().transpose());
+}
+
+TEST(SparseMatrixTests, MultipliesInBothLayouts) {
+    const std::vector<double> x = {1.0, -1.0, 2.0, 0.5};
+    const std::vector<double> y = {2.0, 1.0, -1.0};
+    for (SparseLayout layout : {SparseLayout::Csc, SparseLayout::Csr}) {
+        const SparseMatrix<double> matrix = example(layout);
+        EXPECT_EQ(matrix.multiply(x), (std::vector<double>{2.0, 6.0, -1.0}));
+        EXPECT_EQ(matrix.multiply_transpose(y), (std::vector<double>{-2.0, -5.0, 3.0, 4.0}));
+        EXPECT_THROW(matrix.multiply(y), std::invalid_argument);
+        EXPECT_THROW(matrix.multiply_transpose(x), std::invalid_argument);
+    }
+}
+
+TEST(SparseMatrixTests, BuilderSumsDuplicatesAndDropsZeros) {
+    SparseMatrix<Fraction>::Builder builder(2, 2);
+    builder.add(1, 1, Fraction(1, 3)).add(0, 1, Fraction(2)).add(1, 1, Fraction(1, 6)).add(0, 1, Fraction(-2));
+    builder.add({0, 0, Fraction(0)});
+    EXPECT_THROW(builder.add(2, 0, Fraction(1)), std::out_of_range);
+
+    const SparseMatrix<Fraction> matrix = builder.build();
+    EXPECT_EQ(matrix.non_zeros(), 1u);
+    EXPECT_EQ(matrix.at(1, 1), Fraction(1, 2));
+    EXPECT_EQ(matrix.at(0, 1), Fraction(0));
+    EXPECT_TRUE(matrix.column_indices(0).empty());
+
+    const SparseMatrix<double> empty(4, 3, SparseLayout::Csr);
+    EXPECT_EQ(empty.non_zeros(), 0u);
+    EXPECT_EQ(empty.multiply(std::vector<double>(3, 1.0)), std::vector<double>(4, 0.0));
+}
@@ -0,0 +1,177 @@
+#pragma once
+
+#include "limo/core/LinearProgram.hpp"
+#include "limo/core/Solution.hpp"
+
+#include <cstddef>
+#include <ostream>
+#include <vector>
+
+namespace limo::presolve {
+
+namespace detail {
+class PresolveState;
+} // namespace detail
+
+/**
+ * @brief How much presolve removed, and how long it took.
+ */
+struct PresolveStats {
+    std::size_t rowsBefore{0};
+    std::size_t colsBefore{0};
+    std::size_t nonZerosBefore{0};
+    std::size_t rowsAfter{0};
+    std::size_t colsAfter{0};
+    std::size_t nonZerosAfter{0};
+
+    std::size_t emptyRows{0};
+    std::size_t emptyColumns{0};
+    std::size_t singletonRows{0};
+    std::size_t fixedColumns{0};
+    std::size_t duplicateRows{0};
+    std::size_t dominatedColumns{0};
+    std::size_t tightenedBounds{0};
+    /// Rows that can never be violated within the (tightened) column bounds.
+    std::size_t redundantRows{0};
+
+    std::size_t passes{0};
+    double seconds{0.0};
+};
+
+/**
+ * @brief Writes a human-readable summary of `stats`.
+ */
+void writeReport(std::ostream& out, const PresolveStats& stats);
+
+/**
+ * @brief A presolved program together with the record needed to undo the
+ * reductions on a solution of it.
+ */
+class PresolveResult {
+public:
+    /**
+     * @brief NotSolved if reduced() is to be solved; Infeasible or Unbounded
+     * if presolve already decided the program. Unbounded means the objective
+     * can improve without limit along a column nothing restricts, so the
+     * program is unbounded unless it is infeasible.
+     */
+    core::SolutionStatus status() const { return status_; }
+
+    const core::LinearProgram& reduced() const { return reduced_; }
+    const PresolveStats& stats() const { return stats_; }
+
+    /**
+     * @brief Maps a solution of reduced() back onto the original program.
+     *
+     * Values, duals and reduced costs are rebuilt for every original column
+     * and row, and the objective is recomputed from the values. Removed rows
+     * contribute their logical to the basis; dual information moved onto
+     * them by postsolve can leave that basis in need of repair. Basis
+     * statuses are carried over for kept columns and rows; removed columns
+     * report the original bound they rest on, and rows report the limit
+     * their dual says is active. The result is a warm-start hint, not
+     * necessarily a basis with exactly one basic per row.
+     * A solution without values only has its status carried over.
+     */
+    core::Solution<double> postsolve(const core::Solution<double>& reduced) const;
+
+    /**
+     * @brief The solution of a program presolve removed entirely, i.e. the
+     * postsolved optimal solution of an empty reduced().
+     */
+    core::Solution<double> solveEmpty() const;
+
+private:
+    friend class Presolver;
+    friend class detail::PresolveState;
+
+    enum class Operation {
+        /// Row removed with a zero dual (empty, free, redundant or merged into another).
+        RemoveRow,
+        /// Column removed at `value`.
+        FixColumn,
+        /// Column bound tightened to `value` as implied by `row`.
+        TightenLower,
+        TightenUpper,
+        /// Row `row` is `coefficient` times row `other`, whose limits absorbed its
+        /// lower (flag 1) and/or upper (flag 2) limit.
+        DuplicateRow,
+    };
+
+    struct Step {
+        Operation operation;
+        std::size_t row;
+        std::size_t col;
+        std::size_t other;
+        double value;
+        double coefficient;
+        unsigned flags;
+    };
+
+    core::SolutionStatus status_{core::SolutionStatus::NotSolved};
+    core::LinearProgram reduced_;
+    PresolveStats stats_;
+
+    // Original program in minimization form, for postsolve.
+    double senseSign_{1.0};
+    double objectiveOffset_{0.0};
+    std::vector<double> costs_;
+    std::vector<std::size_t> columnStarts_;
+    std::vector<std::size_t> rowIndices_;
+    std::vector<double> values_;
+    std::size_t rows_{0};
+    std::vector<double> columnLower_;
+    std::vector<double> columnUpper_;
+    std::vector<char> equalityRows_;
+
+    /// Original index of every column and row of reduced().
+    std::vector<std::size_t> keptColumns_;
+    std::vector<std::size_t> keptRows_;
+    std::vector<Step> steps_;
+};
+
+/**
+ * @brief Applies standard LP reductions until none of them finds more to do.
+ *
+ * Reductions, each of which can be switched off:
+ * - empty rows (dropped) and empty columns (set to their best bound);
+ * - singleton rows, turned into column bounds;
+ * - fixed columns, substituted into the row limits;
+ * - duplicate rows (scalar multiples of another row), merged into one;
+ * - dominated columns, whose cost pushes them towards a bound no row
+ *   prevents them from reaching, fixed at that bound;
+ * - bound tightening from row activities, which also drops rows that
+ *   their columns' bounds already satisfy.
+ *
+ * Coefficients are never changed, so a reduced program is exactly a
+ * subset of the original's rows and columns with tighter bounds and
+ * limits.
+ */
+class Presolver {
+public:
+    struct Options {
+        bool emptyRows{true};
+        bool emptyColumns{true};
+        bool singletonRows{true};
+        bool fixedColumns{true};
+        bool duplicateRows{true};
+        bool dominatedColumns{true};
+        bool boundTightening{true};
+        /// Limit on rounds over all reductions.
+        std::size_t maxPasses{20};
+        /// Feasibility tolerance for limits and bounds.
+        double tolerance{1e-9};
+    };
+
+    Presolver() = default;
+    explicit Presolver(Options options);
+
+    const Options& getOptions() const;
+
+    PresolveResult presolve(const core::LinearProgram& program) const;
+
+private:
+    Options options;
+};
+
+} // namespace limo::presolve
@@ -0,0 +1,689 @@
+#include "limo/presolve/Presolve.hpp"
+
+#include "limo/core/LinearProgramBuilder.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <utility>
+
+namespace limo::presolve {
+
+namespace {
+
+using core::kInfinity;
+
+// Bound changes smaller than this (relative) are not worth a postsolve step
+// and could otherwise creep forever.
+constexpr double kSignificantChange = 1e-7;
+// Implied bounds beyond this magnitude come from cancelling huge activities
+// and are not trusted.
+constexpr double kLargestImpliedBound = 1e10;
+// A postsolved value this close (relative) to a tightened bound sits on it.
+constexpr double kOnBoundTolerance = 1e-7;
+
+bool isSignificant(double current, double candidate) {
+    return std::isinf(current) || std::abs(candidate - current) > kSignificantChange * std::max(1.0, std::abs(current));
+}
+
+std::uint64_t mix(std::uint64_t hash, std::uint64_t value) {
+    hash ^= value + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+    return hash;
+}
+
+std::uint64_t bitsOf(double value) {
+    std::uint64_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+} // namespace
+
+namespace detail {
+
+/**
+ * Working copy of a program being presolved. Rows and columns are switched
+ * off rather than erased, and coefficients are read straight from the
+ * original program's CSC and CSR arrays, filtered by the active flags.
+ */
+class PresolveState {
+public:
+    PresolveState(const core::LinearProgram& program, const Presolver::Options& options, PresolveResult& result)
+        : program(program), options(options), result(result), stats(result.stats_), rows(program.rows()),
+          cols(program.cols()), rowActive(rows, 1), colActive(cols, 1), rowCount(rows), colCount(cols),
+          lower(program.columnLower().begin(), program.columnLower().end()),
+          upper(program.columnUpper().begin(), program.columnUpper().end()), rowLower(rows), rowUpper(rows),
+          costs(cols) {
+        const double sign = program.sense() == core::ObjectiveSense::Maximize ? -1.0 : 1.0;
+        for (std::size_t col = 0; col < cols; ++col) {
+            costs[col] = sign * program.objective()[col];
+            colCount[col] = program.columnStarts()[col + 1] - program.columnStarts()[col];
+        }
+        for (std::size_t row = 0; row < rows; ++row) {
+            rowLower[row] = program.rowLower(row);
+            rowUpper[row] = program.rowUpper(row);
+            rowCount[row] = program.rowStarts()[row + 1] - program.rowStarts()[row];
+        }
+        result.senseSign_ = sign;
+        result.objectiveOffset_ = program.objectiveOffset();
+        result.costs_ = costs;
+        result.columnStarts_.assign(program.columnStarts().begin(), program.columnStarts().end());
+        result.rowIndices_.assign(program.rowIndices().begin(), program.rowIndices().end());
+        result.values_.assign(program.values().begin(), program.values().end());
+        result.rows_ = rows;
+        result.columnLower_ = lower;
+        result.columnUpper_ = upper;
+        result.equalityRows_.resize(rows);
+        for (std::size_t row = 0; row < rows; ++row) {
+            result.equalityRows_[row] = rowLower[row] == rowUpper[row] ? 1 : 0;
+        }
+    }
+
+    void run() {
+        for (std::size_t pass = 0; pass < options.maxPasses && decided() == false; ++pass) {
+            ++stats.passes;
+            const std::size_t stepsBefore = result.steps_.size();
+            rowPass();
+            columnPass();
+            if (options.duplicateRows && !decided()) {
+                duplicateRowPass();
+            }
+            if (!decided()) {
+                activityPass();
+            }
+            if (result.steps_.size() == stepsBefore) {
+                break;
+            }
+        }
+        if (!decided()) {
+            buildReduced();
+        }
+    }
+
+private:
+    using Operation = PresolveResult::Operation;
+
+    bool decided() const { return result.status_ != core::SolutionStatus::NotSolved; }
+
+    void conclude(core::SolutionStatus status) {
+        if (!decided()) {
+            result.status_ = status;
+        }
+    }
+
+    double tolerance(double value) const { return options.tolerance * std::max(1.0, std::abs(value)); }
+
+    // Visits the entries of row i whose column is still active.
+    template <typename Visit>
+    void forRow(std::size_t row, Visit visit) const {
+        for (std::size_t k = program.rowStarts()[row]; k < program.rowStarts()[row + 1]; ++k) {
+            const std::size_t col = program.columnIndices()[k];
+            if (colActive[col]) {
+                visit(col, program.rowValues()[k]);
+            }
+        }
+    }
+
+    // Visits the entries of column j whose row is still active.
+    template <typename Visit>
+    void forColumn(std::size_t col, Visit visit) const {
+        for (std::size_t k = program.columnStarts()[col]; k < program.columnStarts()[col + 1]; ++k) {
+            const std::size_t row = program.rowIndices()[k];
+            if (rowActive[row]) {
+                visit(row, program.values()[k]);
+            }
+        }
+    }
+
+    void push(Operation operation, std::size_t row, std::size_t col, std::size_t other, double value,
+              double coefficient, unsigned flags = 0) {
+        result.steps_.push_back({operation, row, col, other, value, coefficient, flags});
+    }
+
+    void removeRow(std::size_t row, std::size_t& counter) {
+        rowActive[row] = 0;
+        forRow(row, [&](std::size_t col, double) { --colCount[col]; });
+        push(Operation::RemoveRow, row, 0, 0, 0.0, 0.0);
+        ++counter;
+    }
+
+    void removeColumn(std::size_t col, double value, std::size_t& counter) {
+        forColumn(col, [&](std::size_t row, double coefficient) {
+            rowLower[row] -= coefficient * value;
+            rowUpper[row] -= coefficient * value;
+            --rowCount[row];
+        });
+        offset += costs[col] * value;
+        colActive[col] = 0;
+        push(Operation::FixColumn, 0, col, 0, value, 0.0);
+        ++counter;
+    }
+
+    // Tightens a column bound to what row `row` implies; crossing bounds beyond tolerance are infeasible.
+    void tighten(std::size_t col, bool isUpper, double bound, std::size_t row, double coefficient) {
+        if (isUpper) {
+            upper[col] = bound;
+            push(Operation::TightenUpper, row, col, 0, bound, coefficient);
+        } else {
+            lower[col] = bound;
+            push(Operation::TightenLower, row, col, 0, bound, coefficient);
+        }
+        if (lower[col] > upper[col]) {
+            if (lower[col] - upper[col] > tolerance(lower[col])) {
+                conclude(core::SolutionStatus::Infeasible);
+            } else if (isUpper) {
+                upper[col] = lower[col];
+            } else {
+                lower[col] = upper[col];
+            }
+        }
+    }
+
+    void rowPass() {
+        for (std::size_t row = 0; row < rows && !decided(); ++row) {
+            if (!rowActive[row]) {
+                continue;
+            }
+            if (std::isinf(rowLower[row]) && std::isinf(rowUpper[row]) && rowLower[row] < 0 && rowUpper[row] > 0) {
+                removeRow(row, stats.redundantRows);
+            } else if (rowCount[row] == 0 && options.emptyRows) {
+                if (rowLower[row] > tolerance(rowLower[row]) || rowUpper[row] < -tolerance(rowUpper[row])) {
+                    conclude(core::SolutionStatus::Infeasible);
+                    return;
+                }
+                removeRow(row, stats.emptyRows);
+            } else if (rowCount[row] == 1 && options.singletonRows) {
+                singletonRow(row);
+            }
+        }
+    }
+
+    // l <= a x_j <= u becomes bounds on x_j.
+    void singletonRow(std::size_t row) {
+        std::size_t col = 0;
+        double coefficient = 0.0;
+        forRow(row, [&](std::size_t j, double a) {
+            col = j;
+            coefficient = a;
+        });
+        double impliedLower = (coefficient > 0 ? rowLower[row] : rowUpper[row]) / coefficient;
+        double impliedUpper = (coefficient > 0 ? rowUpper[row] : rowLower[row]) / coefficient;
+        if (impliedLower > lower[col]) {
+            tighten(col, false, impliedLower, row, coefficient);
+        }
+        if (impliedUpper < upper[col] && !decided()) {
+            tighten(col, true, impliedUpper, row, coefficient);
+        }
+        if (!decided()) {
+            removeRow(row, stats.singletonRows);
+        }
+    }
+
+    void columnPass() {
+        for (std::size_t col = 0; col < cols && !decided(); ++col) {
+            if (!colActive[col]) {
+                continue;
+            }
+            if (options.fixedColumns && !std::isinf(lower[col]) && upper[col] - lower[col] <= tolerance(lower[col])) {
+                removeColumn(col, lower[col], stats.fixedColumns);
+            } else if (colCount[col] == 0 && options.emptyColumns) {
+                dominatedColumn(col, stats.emptyColumns);
+            } else if (options.dominatedColumns) {
+                dominatedColumn(col, stats.dominatedColumns);
+            }
+        }
+    }
+
+    /**
+     * A column no row stops from moving down (every entry sits in a row
+     * without the limit that move would approach) can go to its lower bound
+     * if its cost is non-negative; likewise upwards. Empty columns are the
+     * special case without rows.
+     */
+    void dominatedColumn(std::size_t col, std::size_t& counter) {
+        bool downSafe = true;
+        bool upSafe = true;
+        forColumn(col, [&](std::size_t row, double a) {
+            const bool hasLower = !std::isinf(rowLower[row]);
+            const bool hasUpper = !std::isinf(rowUpper[row]);
+            downSafe = downSafe && !(a > 0 ? hasLower : hasUpper);
+            upSafe = upSafe && !(a > 0 ? hasUpper : hasLower);
+        });
+        const double cost = costs[col];
+        if (cost > 0 && downSafe) {
+            std::isinf(lower[col]) ? conclude(core::SolutionStatus::Unbounded) : removeColumn(col, lower[col], counter);
+        } else if (cost < 0 && upSafe) {
+            std::isinf(upper[col]) ? conclude(core::SolutionStatus::Unbounded) : removeColumn(col, upper[col], counter);
+        } else if (cost == 0 && downSafe && !std::isinf(lower[col])) {
+            removeColumn(col, lower[col], counter);
+        } else if (cost == 0 && upSafe && !std::isinf(upper[col])) {
+            removeColumn(col, upper[col], counter);
+        } else if (cost == 0 && downSafe && upSafe) {
+            // Free, costless and unconstrained.
+            removeColumn(col, 0.0, counter);
+        }
+    }
+
+    struct Signature {
+        std::uint64_t hash;
+        std::size_t row;
+        double scale;
+    };
+
+    // Rows equal up to a scalar factor keep one representative with the intersected limits.
+    void duplicateRowPass() {
+        std::vector<Signature> signatures;
+        for (std::size_t row = 0; row < rows; ++row) {
+            if (!rowActive[row] || rowCount[row] < 2) {
+                continue;
+            }
+            double scale = 0.0;
+            std::uint64_t hash = rowCount[row];
+            forRow(row, [&](std::size_t col, double a) {
+                if (scale == 0.0) {
+                    scale = a;
+                }
+                hash = mix(mix(hash, col), bitsOf(a / scale));
+            });
+            signatures.push_back({hash, row, scale});
+        }
+        std::sort(signatures.begin(), signatures.end(), [](const Signature& left, const Signature& right) {
+            return left.hash != right.hash ? left.hash < right.hash : left.row < right.row;
+        });
+        for (std::size_t begin = 0; begin < signatures.size() && !decided();) {
+            std::size_t end = begin + 1;
+            while (end < signatures.size() && signatures[end].hash == signatures[begin].hash) {
+                ++end;
+            }
+            for (std::size_t k = begin + 1; k < end && !decided(); ++k) {
+                for (std::size_t kept = begin; kept < k; ++kept) {
+                    if (rowActive[signatures[kept].row] && sameDirection(signatures[kept], signatures[k])) {
+                        mergeRows(signatures[kept], signatures[k]);
+                        break;
+                    }
+                }
+            }
+            begin = end;
+        }
+    }
+
+    bool sameDirection(const Signature& left, const Signature& right) const {
+        if (rowCount[left.row] != rowCount[right.row]) {
+            return false;
+        }
+        std::size_t a = program.rowStarts()[left.row];
+        std::size_t b = program.rowStarts()[right.row];
+        const std::size_t aEnd = program.rowStarts()[left.row + 1];
+        const std::size_t bEnd = program.rowStarts()[right.row + 1];
+        while (true) {
+            while (a < aEnd && !colActive[program.columnIndices()[a]]) {
+                ++a;
+            }
+            while (b < bEnd && !colActive[program.columnIndices()[b]]) {
+                ++b;
+            }
+            if (a == aEnd || b == bEnd) {
+                return a == aEnd && b == bEnd;
+            }
+            const double x = program.rowValues()[a] / left.scale;
+            const double y = program.rowValues()[b] / right.scale;
+            if (program.columnIndices()[a] != program.columnIndices()[b] ||
+                std::abs(x - y) > 1e-12 * std::max(1.0, std::abs(x))) {
+                return false;
+            }
+            ++a;
+            ++b;
+        }
+    }
+
+    // Row `duplicate` is λ times row `kept`; its limits move onto `kept`.
+    void mergeRows(const Signature& kept, const Signature& duplicate) {
+        const std::size_t row = kept.row;
+        const double lambda = duplicate.scale / kept.scale;
+        const double low = (lambda > 0 ? rowLower[duplicate.row] : rowUpper[duplicate.row]) / lambda;
+        const double high = (lambda > 0 ? rowUpper[duplicate.row] : rowLower[duplicate.row]) / lambda;
+        unsigned flags = 0;
+        if (low > rowLower[row]) {
+            rowLower[row] = low;
+            flags |= 1;
+        }
+        if (high < rowUpper[row]) {
+            rowUpper[row] = high;
+            flags |= 2;
+        }
+        if (rowLower[row] > rowUpper[row]) {
+            if (rowLower[row] - rowUpper[row] > tolerance(rowLower[row])) {
+                conclude(core::SolutionStatus::Infeasible);
+                return;
+            }
+            rowUpper[row] = rowLower[row];
+        }
+        rowActive[duplicate.row] = 0;
+        forRow(duplicate.row, [&](std::size_t col, double) { --colCount[col]; });
+        push(Operation::DuplicateRow, duplicate.row, 0, row, 0.0, lambda, flags);
+        ++stats.duplicateRows;
+    }
+
+    /**
+     * Row activity bounds: detects infeasible rows, drops rows the column
+     * bounds already satisfy and tightens column bounds to what the other
+     * columns of a row leave room for.
+     */
+    void activityPass() {
+        for (std::size_t row = 0; row < rows && !decided(); ++row) {
+            if (!rowActive[row] || rowCount[row] == 0) {
+                continue;
+            }
+            double minActivity = 0.0;
+            double maxActivity = 0.0;
+            std::size_t minInfinite = 0;
+            std::size_t maxInfinite = 0;
+            forRow(row, [&](std::size_t col, double a) {
+                const double low = a > 0 ? lower[col] : upper[col];
+                const double high = a > 0 ? upper[col] : lower[col];
+                std::isinf(low) ? ++minInfinite : (minActivity += a * low, 0);
+                std::isinf(high) ? ++maxInfinite : (maxActivity += a * high, 0);
+            });
+            const double rowLow = rowLower[row];
+            const double rowHigh = rowUpper[row];
+            if ((minInfinite == 0 && minActivity > rowHigh + tolerance(rowHigh)) ||
+                (maxInfinite == 0 && maxActivity < rowLow - tolerance(rowLow))) {
+                conclude(core::SolutionStatus::Infeasible);
+                return;
+            }
+            const bool lowerHolds = std::isinf(rowLow) || (minInfinite == 0 && minActivity >= rowLow - tolerance(rowLow));
+            const bool upperHolds =
+                std::isinf(rowHigh) || (maxInfinite == 0 && maxActivity <= rowHigh + tolerance(rowHigh));
+            if (lowerHolds && upperHolds) {
+                removeRow(row, stats.redundantRows);
+                continue;
+            }
+            if (!options.boundTightening) {
+                continue;
+            }
+            forRow(row, [&](std::size_t col, double a) {
+                if (decided()) {
+                    return;
+                }
+                const double low = a > 0 ? lower[col] : upper[col];
+                const double high = a > 0 ? upper[col] : lower[col];
+                // What the other columns contribute at least / at most.
+                const bool othersMinFinite = minInfinite == 0 || (minInfinite == 1 && std::isinf(low));
+                const bool othersMaxFinite = maxInfinite == 0 || (maxInfinite == 1 && std::isinf(high));
+                const double othersMin = minActivity - (std::isinf(low) ? 0.0 : a * low);
+                const double othersMax = maxActivity - (std::isinf(high) ? 0.0 : a * high);
+                // a x_j <= rowHigh - othersMin and a x_j >= rowLow - othersMax.
+                if (!std::isinf(rowHigh) && othersMinFinite) {
+                    consider(col, a > 0, (rowHigh - othersMin) / a, row, a);
+                }
+                if (!std::isinf(rowLow) && othersMaxFinite && !decided()) {
+                    consider(col, a < 0, (rowLow - othersMax) / a, row, a);
+                }
+            });
+        }
+    }
+
+    void consider(std::size_t col, bool isUpper, double bound, std::size_t row, double coefficient) {
+        if (std::abs(bound) > kLargestImpliedBound) {
+            return;
+        }
+        const double current = isUpper ? upper[col] : lower[col];
+        const bool tighter = isUpper ? bound < current : bound > current;
+        if (tighter && isSignificant(current, bound)) {
+            tighten(col, isUpper, bound, row, coefficient);
+            ++stats.tightenedBounds;
+        }
+    }
+
+    void buildReduced() {
+        core::LinearProgramBuilder builder;
+        builder.setName(program.name());
+        builder.setSense(program.sense());
+        builder.setObjectiveOffset(program.objectiveOffset() + result.senseSign_ * offset);
+
+        std::vector<std::size_t> newColumn(cols, 0);
+        for (std::size_t col = 0; col < cols; ++col) {
+            if (colActive[col]) {
+                newColumn[col] = result.keptColumns_.size();
+                result.keptColumns_.push_back(col);
+            }
+        }
+        for (std::size_t row = 0; row < rows; ++row) {
+            if (rowActive[row]) {
+                result.keptRows_.push_back(row);
+            }
+        }
+        std::size_t nonZeros = 0;
+        for (const std::size_t row : result.keptRows_) {
+            nonZeros += rowCount[row];
+        }
+        builder.reserve(result.keptRows_.size(), result.keptColumns_.size(), nonZeros);
+
+        const auto nameOf = [](const core::NameTable& names, std::size_t index) {
+            return index < names.size() ? names[index] : std::string_view();
+        };
+        for (const std::size_t col : result.keptColumns_) {
+            builder.addColumn(program.objective()[col], lower[col], upper[col], nameOf(program.columnNames(), col));
+        }
+        std::vector<std::size_t> indices;
+        std::vector<double> values;
+        for (const std::size_t row : result.keptRows_) {
+            indices.clear();
+            values.clear();
+            forRow(row, [&](std::size_t col, double a) {
+                indices.push_back(newColumn[col]);
+                values.push_back(a);
+            });
+            const double low = rowLower[row];
+            const double high = rowUpper[row];
+            const std::string_view name = nameOf(program.rowNames(), row);
+            if (std::isinf(low)) {
+                builder.addRow(core::RowSense::LessEqual, high, indices, values, name);
+            } else if (std::isinf(high)) {
+                builder.addRow(core::RowSense::GreaterEqual, low, indices, values, name);
+            } else if (high - low <= tolerance(low)) {
+                builder.addRow(core::RowSense::Equal, low, indices, values, name);
+            } else {
+                const std::size_t added = builder.addRow(core::RowSense::Ranged, low, indices, values, name);
+                builder.setRowRange(added, high - low);
+            }
+        }
+        result.reduced_ = builder.build();
+    }
+
+    const core::LinearProgram& program;
+    const Presolver::Options& options;
+    PresolveResult& result;
+    PresolveStats& stats;
+    const std::size_t rows;
+    const std::size_t cols;
+
+    std::vector<char> rowActive;
+    std::vector<char> colActive;
+    std::vector<std::size_t> rowCount;
+    std::vector<std::size_t> colCount;
+    std::vector<double> lower;
+    std::vector<double> upper;
+    std::vector<double> rowLower;
+    std::vector<double> rowUpper;
+    /// Costs of the minimization form.
+    std::vector<double> costs;
+    /// Objective contribution of removed columns, minimization form.
+    double offset{0.0};
+};
+
+} // namespace detail
+
+void writeReport(std::ostream& out, const PresolveStats& stats) {
+    out << "presolve: rows " << stats.rowsBefore << " -> " << stats.rowsAfter << ", columns " << stats.colsBefore
+        << " -> " << stats.colsAfter << ", non-zeros " << stats.nonZerosBefore << " -> " << stats.nonZerosAfter
+        << " in " << stats.seconds * 1e3 << " ms (" << stats.passes << " passes)\n"
+        << "  empty rows " << stats.emptyRows << ", empty columns " << stats.emptyColumns << ", singleton rows "
+        << stats.singletonRows << ", fixed columns " << stats.fixedColumns << "\n"
+        << "  duplicate rows " << stats.duplicateRows << ", dominated columns " << stats.dominatedColumns
+        << ", tightened bounds " << stats.tightenedBounds << ", redundant rows " << stats.redundantRows << '\n';
+}
+
+Presolver::Presolver(Options options) : options(options) {}
+
+const Presolver::Options& Presolver::getOptions() const {
+    return options;
+}
+
+PresolveResult Presolver::presolve(const core::LinearProgram& program) const {
+    const auto start = std::chrono::steady_clock::now();
+    PresolveResult result;
+    PresolveStats& stats = result.stats_;
+    stats.rowsBefore = program.rows();
+    stats.colsBefore = program.cols();
+    stats.nonZerosBefore = program.nonZeros();
+
+    detail::PresolveState(program, options, result).run();
+
+    stats.rowsAfter = result.reduced_.rows();
+    stats.colsAfter = result.reduced_.cols();
+    stats.nonZerosAfter = result.reduced_.nonZeros();
+    stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
+
+core::Solution<double> PresolveResult::postsolve(const core::Solution<double>& reduced) const {
+    core::Solution<double> solution;
+    solution.iterations = reduced.iterations;
+    if (status_ != core::SolutionStatus::NotSolved) {
+        solution.status = status_;
+        return solution;
+    }
+    solution.status = reduced.status;
+    if (reduced.values.size() != keptColumns_.size()) {
+        return solution;
+    }
+
+    const std::size_t cols = costs_.size();
+    const std::size_t rows = rows_;
+    std::vector<double> x(cols, 0.0);
+    std::vector<double> y(rows, 0.0);
+    for (std::size_t k = 0; k < keptColumns_.size(); ++k) {
+        x[keptColumns_[k]] = reduced.values[k];
+    }
+    if (reduced.duals.size() == keptRows_.size()) {
+        for (std::size_t k = 0; k < keptRows_.size(); ++k) {
+            y[keptRows_[k]] = senseSign_ * reduced.duals[k];
+        }
+    }
+
+    const auto reducedCost = [&](std::size_t col) {
+        double d = costs_[col];
+        for (std::size_t k = columnStarts_[col]; k < columnStarts_[col + 1]; ++k) {
+            d -= values_[k] * y[rowIndices_[k]];
+        }
+        return d;
+    };
+    for (auto step = steps_.rbegin(); step != steps_.rend(); ++step) {
+        switch (step->operation) {
+        case Operation::RemoveRow:
+            break;
+        case Operation::FixColumn:
+            x[step->col] = step->value;
+            break;
+        case Operation::TightenLower:
+        case Operation::TightenUpper: {
+            // If the column rests on a bound only the row implied, the row
+            // is tight and takes over the column's reduced cost.
+            if (std::abs(x[step->col] - step->value) > kOnBoundTolerance * (1.0 + std::abs(step->value))) {
+                break;
+            }
+            const double d = reducedCost(step->col);
+            if ((step->operation == Operation::TightenLower && d > 0) ||
+                (step->operation == Operation::TightenUpper && d < 0)) {
+                y[step->row] += d / step->coefficient;
+            }
+            break;
+        }
+        case Operation::DuplicateRow: {
+            // The kept row's dual belongs to the duplicate if its active limit came from there.
+            const double dual = y[step->other];
+            if ((dual > 0 && (step->flags & 1) != 0) || (dual < 0 && (step->flags & 2) != 0)) {
+                y[step->row] = dual / step->coefficient;
+                y[step->other] = 0.0;
+            }
+            break;
+        }
+        }
+    }
+
+    const core::BasisState& reducedState = reduced.basisState;
+    if (reducedState.columns.size() == keptColumns_.size() && reducedState.rows.size() == keptRows_.size()) {
+        using core::BasisStatus;
+        const auto onBound = [](double value, double bound) {
+            return !std::isinf(bound) && std::abs(value - bound) <= kOnBoundTolerance * (1.0 + std::abs(bound));
+        };
+        core::BasisState& state = solution.basisState;
+        state.columns.assign(cols, BasisStatus::Basic);
+        for (std::size_t col = 0; col < cols; ++col) {
+            if (onBound(x[col], columnLower_[col])) {
+                state.columns[col] = BasisStatus::AtLower;
+            } else if (onBound(x[col], columnUpper_[col])) {
+                state.columns[col] = BasisStatus::AtUpper;
+            }
+        }
+        // Kept columns that are basic stay basic even when they happen to
+        // sit on a bound; nonbasic ones off every original bound rested on
+        // a tightened bound and were already made basic above.
+        for (std::size_t k = 0; k < keptColumns_.size(); ++k) {
+            if (reducedState.columns[k] == BasisStatus::Basic) {
+                state.columns[keptColumns_[k]] = BasisStatus::Basic;
+            }
+        }
+        state.rows.assign(rows, BasisStatus::Basic);
+        for (std::size_t k = 0; k < keptRows_.size(); ++k) {
+            state.rows[keptRows_[k]] = reducedState.rows[k];
+        }
+        for (std::size_t row = 0; row < rows; ++row) {
+            if (y[row] > 0 || (y[row] < 0 && equalityRows_[row] != 0)) {
+                state.rows[row] = BasisStatus::AtLower;
+            } else if (y[row] < 0) {
+                state.rows[row] = BasisStatus::AtUpper;
+            }
+        }
+    }
+
+    solution.values = std::move(x);
+    solution.objective = objectiveOffset_;
+    solution.reducedCosts.resize(cols);
+    for (std::size_t col = 0; col < cols; ++col) {
+        solution.objective += senseSign_ * costs_[col] * solution.values[col];
+        solution.reducedCosts[col] = senseSign_ * reducedCost(col);
+    }
+    for (double& dual : y) {
+        dual *= senseSign_;
+    }
+    solution.duals = std::move(y);
+
+    std::vector<char> kept(rows, 0);
+    for (const std::size_t row : keptRows_) {
+        kept[row] = 1;
+    }
+    solution.basis.reserve(rows);
+    for (const std::size_t variable : reduced.basis) {
+        solution.basis.push_back(variable < keptColumns_.size() ? keptColumns_[variable]
+                                                                : cols + keptRows_[variable - keptColumns_.size()]);
+    }
+    for (std::size_t row = 0; row < rows; ++row) {
+        if (kept[row] == 0) {
+            solution.basis.push_back(cols + row);
+        }
+    }
+    return solution;
+}
+
+core::Solution<double> PresolveResult::solveEmpty() const {
+    core::Solution<double> empty;
+    empty.status = core::SolutionStatus::Optimal;
+    return postsolve(empty);
+}
+
+} // namespace limo::presolve
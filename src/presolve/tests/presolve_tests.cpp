@@ -0,0 +1,379 @@
+#include "limo/presolve/Presolve.hpp"
+
+#include "limo/core/LinearProgramBuilder.hpp"
+#include "limo/simplex/Conversion.hpp"
+#include "limo/simplex/ModifiedSimplexSolver.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <sstream>
+#include <vector>
+
+using limo::core::kInfinity;
+using limo::core::LinearProgram;
+using limo::core::LinearProgramBuilder;
+using limo::core::ObjectiveSense;
+using limo::core::RowSense;
+using limo::core::Solution;
+using limo::core::SolutionStatus;
+using limo::presolve::Presolver;
+
+namespace {
+
+using Indices = std::vector<std::size_t>;
+using Values = std::vector<double>;
+
+Solution<double> solve(const LinearProgram& program) {
+    const auto converted = limo::simplex::toStandardForm(program);
+    return converted.recover(limo::simplex::ModifiedSimplexSolver().solve(converted.form()));
+}
+
+Solution<double> warmSolve(const LinearProgram& program, const limo::core::BasisState& start) {
+    const auto converted = limo::simplex::toStandardForm(program);
+    return converted.recover(limo::simplex::ModifiedSimplexSolver().solve(converted.form(), converted.toFormBasis(start)));
+}
+
+Solution<double> presolveAndSolve(const LinearProgram& program, Presolver::Options options = {}) {
+    const auto result = Presolver(options).presolve(program);
+    if (result.status() != SolutionStatus::NotSolved) {
+        return result.postsolve({});
+    }
+    if (result.reduced().cols() == 0) {
+        return result.solveEmpty();
+    }
+    return result.postsolve(solve(result.reduced()));
+}
+
+void expectFeasible(const LinearProgram& program, const std::vector<double>& x) {
+    constexpr double kTolerance = 1e-6;
+    ASSERT_EQ(x.size(), program.cols());
+    for (std::size_t col = 0; col < program.cols(); ++col) {
+        EXPECT_GE(x[col], program.columnLower()[col] - kTolerance) << "column " << col;
+        EXPECT_LE(x[col], program.columnUpper()[col] + kTolerance) << "column " << col;
+    }
+    for (std::size_t row = 0; row < program.rows(); ++row) {
+        double activity = 0.0;
+        const auto entries = program.row(row);
+        for (std::size_t k = 0; k < entries.size(); ++k) {
+            activity += entries.values[k] * x[entries.indices[k]];
+        }
+        EXPECT_GE(activity, program.rowLower(row) - kTolerance) << "row " << row;
+        EXPECT_LE(activity, program.rowUpper(row) + kTolerance) << "row " << row;
+    }
+}
+
+// Checks d = c - Aᵀy for the postsolved duals against the program's data.
+void expectConsistentDuals(const LinearProgram& program, const Solution<double>& solution) {
+    ASSERT_EQ(solution.duals.size(), program.rows());
+    ASSERT_EQ(solution.reducedCosts.size(), program.cols());
+    for (std::size_t col = 0; col < program.cols(); ++col) {
+        double d = program.objective()[col];
+        const auto entries = program.column(col);
+        for (std::size_t k = 0; k < entries.size(); ++k) {
+            d -= entries.values[k] * solution.duals[entries.indices[k]];
+        }
+        EXPECT_NEAR(solution.reducedCosts[col], d, 1e-9);
+    }
+}
+
+// Complementary slackness: a column strictly inside its bounds has no
+// reduced cost, and a row strictly inside its limits has no dual.
+void expectComplementary(const LinearProgram& program, const Solution<double>& solution) {
+    constexpr double kTolerance = 1e-6;
+    const double sign = program.sense() == ObjectiveSense::Maximize ? -1.0 : 1.0;
+    for (std::size_t col = 0; col < program.cols(); ++col) {
+        const double x = solution.values[col];
+        const double d = sign * solution.reducedCosts[col];
+        const bool atLower = x <= program.columnLower()[col] + kTolerance;
+        const bool atUpper = x >= program.columnUpper()[col] - kTolerance;
+        EXPECT_TRUE(atLower || d <= kTolerance) << "column " << col << " d " << d;
+        EXPECT_TRUE(atUpper || d >= -kTolerance) << "column " << col << " d " << d;
+    }
+    for (std::size_t row = 0; row < program.rows(); ++row) {
+        double activity = 0.0;
+        const auto entries = program.row(row);
+        for (std::size_t k = 0; k < entries.size(); ++k) {
+            activity += entries.values[k] * solution.values[entries.indices[k]];
+        }
+        const double y = sign * solution.duals[row];
+        const bool atLower = activity <= program.rowLower(row) + kTolerance;
+        const bool atUpper = activity >= program.rowUpper(row) - kTolerance;
+        EXPECT_TRUE(atLower || y <= kTolerance) << "row " << row << " y " << y;
+        EXPECT_TRUE(atUpper || y >= -kTolerance) << "row " << row << " y " << y;
+    }
+}
+
+} // namespace
+
+TEST(PresolveTests, RemovesEmptyRowsAndColumns) {
+    // min x - y  s.t.  x + 0 >= 1 (row 0),  empty row 0 <= 3,  y in [0, 2] unused by rows.
+    LinearProgramBuilder builder;
+    const std::size_t x = builder.addColumn(1.0, 0.0, 10.0);
+    builder.addColumn(-1.0, 0.0, 2.0);
+    builder.addRow(RowSense::GreaterEqual, 1.0, Indices{x}, Values{1.0});
+    builder.addRow(RowSense::LessEqual, 3.0);
+    const LinearProgram program = builder.build();
+
+    const auto result = Presolver().presolve(program);
+    ASSERT_EQ(result.status(), SolutionStatus::NotSolved);
+    EXPECT_EQ(result.stats().emptyRows, 1u);
+    EXPECT_EQ(result.stats().singletonRows, 1u);
+    // y from the start, x once its singleton row became a bound.
+    EXPECT_EQ(result.stats().emptyColumns, 2u);
+    EXPECT_EQ(result.stats().rowsAfter, 0u);
+    EXPECT_EQ(result.stats().colsAfter, 0u);
+
+    const auto solution = result.solveEmpty();
+    ASSERT_EQ(solution.status, SolutionStatus::Optimal);
+    EXPECT_NEAR(solution.objective, -1.0, 1e-12);
+    EXPECT_NEAR(solution.values[0], 1.0, 1e-12);
+    EXPECT_NEAR(solution.values[1], 2.0, 1e-12);
+    // The singleton row x >= 1 holds x down, so it carries x's cost.
+    EXPECT_NEAR(solution.duals[0], 1.0, 1e-12);
+    EXPECT_NEAR(solution.reducedCosts[0], 0.0, 1e-12);
+    EXPECT_EQ(solution.basis.size(), program.rows());
+}
+
+TEST(PresolveTests, DetectsAnInfeasibleEmptyRow) {
+    LinearProgramBuilder builder;
+    builder.addColumn(1.0);
+    builder.addRow(RowSense::GreaterEqual, 2.0);
+    const auto result = Presolver().presolve(builder.build());
+    EXPECT_EQ(result.status(), SolutionStatus::Infeasible);
+    EXPECT_EQ(result.postsolve({}).status, SolutionStatus::Infeasible);
+}
+
+TEST(PresolveTests, TurnsSingletonRowsIntoBounds) {
+    // max x + y  s.t.  2x <= 8,  x + y <= 5,  -y >= -3
+    LinearProgramBuilder builder;
+    builder.setSense(ObjectiveSense::Maximize);
+    const std::size_t x = builder.addColumn(1.0);
+    const std::size_t y = builder.addColumn(1.0);
+    builder.addRow(RowSense::LessEqual, 8.0, Indices{x}, Values{2.0});
+    builder.addRow(RowSense::LessEqual, 5.0, Indices{x, y}, Values{1.0, 1.0});
+    builder.addRow(RowSense::GreaterEqual, -3.0, Indices{y}, Values{-1.0});
+    const LinearProgram program = builder.build();
+
+    Presolver::Options options;
+    options.boundTightening = false;
+    const auto result = Presolver(options).presolve(program);
+    ASSERT_EQ(result.status(), SolutionStatus::NotSolved);
+    EXPECT_EQ(result.stats().singletonRows, 2u);
+    ASSERT_EQ(result.reduced().rows(), 1u);
+    EXPECT_EQ(result.reduced().columnUpper()[0], 4.0);
+    EXPECT_EQ(result.reduced().columnUpper()[1], 3.0);
+
+    const auto solution = result.postsolve(solve(result.reduced()));
+    const auto direct = solve(program);
+    ASSERT_EQ(solution.status, SolutionStatus::Optimal);
+    EXPECT_NEAR(solution.objective, direct.objective, 1e-9);
+    expectFeasible(program, solution.values);
+    expectConsistentDuals(program, solution);
+}
+
+TEST(PresolveTests, SubstitutesFixedColumns) {
+    // min x + 2y + 3z  s.t.  x + y + z >= 6,  x - z <= 1,  y fixed at 2
+    LinearProgramBuilder builder;
+    const std::size_t x = builder.addColumn(1.0);
+    const std::size_t y = builder.addColumn(2.0, 2.0, 2.0);
+    const std::size_t z = builder.addColumn(3.0);
+    builder.addRow(RowSense::GreaterEqual, 6.0, Indices{x, y, z}, Values{1.0, 1.0, 1.0});
+    builder.addRow(RowSense::LessEqual, 1.0, Indices{x, z}, Values{1.0, -1.0});
+    const LinearProgram program = builder.build();
+
+    const auto result = Presolver().presolve(program);
+    ASSERT_EQ(result.status(), SolutionStatus::NotSolved);
+    EXPECT_EQ(result.stats().fixedColumns, 1u);
+    EXPECT_EQ(result.reduced().cols(), 2u);
+    EXPECT_NEAR(result.reduced().objectiveOffset(), 4.0, 1e-12);
+
+    const auto solution = result.postsolve(solve(result.reduced()));
+    ASSERT_EQ(solution.status, SolutionStatus::Optimal);
+    EXPECT_NEAR(solution.values[y], 2.0, 1e-12);
+    EXPECT_NEAR(solution.objective, solve(program).objective, 1e-9);
+    expectFeasible(program, solution.values);
+}
+
+TEST(PresolveTests, MergesDuplicateRows) {
+    // min -x - y  s.t.  x + 2y <= 8,  -2x - 4y >= -12 (i.e. x + 2y <= 6),  x - y <= 3
+    LinearProgramBuilder builder;
+    const std::size_t x = builder.addColumn(-1.0);
+    const std::size_t y = builder.addColumn(-1.0);
+    builder.addRow(RowSense::LessEqual, 8.0, Indices{x, y}, Values{1.0, 2.0});
+    builder.addRow(RowSense::GreaterEqual, -12.0, Indices{x, y}, Values{-2.0, -4.0});
+    builder.addRow(RowSense::LessEqual, 3.0, Indices{x, y}, Values{1.0, -1.0});
+    const LinearProgram program = builder.build();
+
+    Presolver::Options options;
+    options.boundTightening = false;
+    const auto result = Presolver(options).presolve(program);
+    ASSERT_EQ(result.status(), SolutionStatus::NotSolved);
+    EXPECT_EQ(result.stats().duplicateRows, 1u);
+    EXPECT_EQ(result.reduced().rows(), 2u);
+
+    const auto solution = result.postsolve(solve(result.reduced()));
+    const auto direct = solve(program);
+    ASSERT_EQ(solution.status, SolutionStatus::Optimal);
+    EXPECT_NEAR(solution.objective, direct.objective, 1e-9);
+    // The binding limit came from the second row, so its dual is the one that moves.
+    EXPECT_NEAR(solution.duals[0], 0.0, 1e-9);
+    EXPECT_NEAR(solution.duals[1], direct.duals[1], 1e-9);
+    EXPECT_NEAR(solution.duals[2], direct.duals[2], 1e-9);
+    expectConsistentDuals(program, solution);
+}
+
+TEST(PresolveTests, FixesDominatedColumnsAndReportsUnboundedOnes) {
+    // min x + y  s.t.  x - y <= 2 ;  x appears only with a positive
+    // coefficient in a <= row, so nothing stops it going down to 0. That
+    // leaves -y <= 2, which y >= 1 already satisfies.
+    LinearProgramBuilder builder;
+    const std::size_t x = builder.addColumn(1.0, 0.0, 5.0);
+    const std::size_t y = builder.addColumn(1.0, 1.0, 5.0);
+    builder.addRow(RowSense::LessEqual, 2.0, Indices{x, y}, Values{1.0, -1.0});
+    auto result = Presolver().presolve(builder.build());
+    ASSERT_EQ(result.status(), SolutionStatus::NotSolved);
+    EXPECT_EQ(result.stats().dominatedColumns, 1u);
+    EXPECT_EQ(result.stats().redundantRows, 1u);
+    const auto solution = result.solveEmpty();
+    EXPECT_NEAR(solution.objective, 1.0, 1e-12);
+
+    // Same shape with x free below.
+    LinearProgramBuilder unbounded;
+    const std::size_t u = unbounded.addColumn(1.0, -kInfinity, 5.0);
+    const std::size_t v = unbounded.addColumn(1.0, 1.0, 5.0);
+    unbounded.addRow(RowSense::LessEqual, 2.0, Indices{u, v}, Values{1.0, -1.0});
+    result = Presolver().presolve(unbounded.build());
+    EXPECT_EQ(result.status(), SolutionStatus::Unbounded);
+}
+
+TEST(PresolveTests, TightensBoundsAndDropsRedundantRows) {
+    // min -x - y  s.t.  x + y <= 4,  x - y <= 10 (redundant for x, y in [0, 4])
+    LinearProgramBuilder builder;
+    const std::size_t x = builder.addColumn(-1.0, 0.0, kInfinity);
+    const std::size_t y = builder.addColumn(-1.0, 0.0, kInfinity);
+    builder.addRow(RowSense::LessEqual, 4.0, Indices{x, y}, Values{1.0, 1.0});
+    builder.addRow(RowSense::LessEqual, 10.0, Indices{x, y}, Values{1.0, -1.0});
+    const LinearProgram program = builder.build();
+
+    const auto result = Presolver().presolve(program);
+    ASSERT_EQ(result.status(), SolutionStatus::NotSolved);
+    EXPECT_GE(result.stats().tightenedBounds, 2u);
+    EXPECT_EQ(result.stats().redundantRows, 1u);
+    ASSERT_EQ(result.reduced().rows(), 1u);
+    EXPECT_EQ(result.reduced().columnUpper()[0], 4.0);
+
+    const auto solution = result.postsolve(solve(result.reduced()));
+    ASSERT_EQ(solution.status, SolutionStatus::Optimal);
+    EXPECT_NEAR(solution.objective, -4.0, 1e-9);
+    expectFeasible(program, solution.values);
+    expectConsistentDuals(program, solution);
+}
+
+TEST(PresolveTests, DetectsInfeasibleActivities) {
+    // x + y >= 5 with x, y in [0, 2].
+    LinearProgramBuilder builder;
+    const std::size_t x = builder.addColumn(1.0, 0.0, 2.0);
+    const std::size_t y = builder.addColumn(1.0, 0.0, 2.0);
+    builder.addRow(RowSense::GreaterEqual, 5.0, Indices{x, y}, Values{1.0, 1.0});
+    EXPECT_EQ(Presolver().presolve(builder.build()).status(), SolutionStatus::Infeasible);
+}
+
+TEST(PresolveTests, WritesAReport) {
+    LinearProgramBuilder builder;
+    const std::size_t x = builder.addColumn(1.0, 0.0, 1.0);
+    builder.addRow(RowSense::LessEqual, 3.0, Indices{x}, Values{1.0});
+    const auto result = Presolver().presolve(builder.build());
+    std::ostringstream report;
+    limo::presolve::writeReport(report, result.stats());
+    EXPECT_NE(report.str().find("rows 1 -> 0"), std::string::npos);
+    EXPECT_NE(report.str().find("singleton rows 1"), std::string::npos);
+}
+
+TEST(PresolveTests, AgreesWithTheDirectSolveOnRandomPrograms) {
+    std::mt19937 random(20261016);
+    std::uniform_real_distribution<double> coefficient(-5.0, 5.0);
+    std::uniform_int_distribution<int> choice(0, 9);
+    std::size_t solved = 0;
+    for (int trial = 0; trial < 60; ++trial) {
+        const std::size_t cols = 3 + static_cast<std::size_t>(choice(random));
+        const std::size_t rows = 2 + static_cast<std::size_t>(choice(random));
+        LinearProgramBuilder builder;
+        builder.setSense(trial % 2 == 0 ? ObjectiveSense::Minimize : ObjectiveSense::Maximize);
+        // A known point keeps every program feasible.
+        std::vector<double> point(cols);
+        for (std::size_t col = 0; col < cols; ++col) {
+            point[col] = std::round(coefficient(random));
+            const int kind = choice(random);
+            const double lower = kind == 0 ? point[col] : point[col] - 1.0 - choice(random);
+            const double upper = kind == 0 ? point[col] : point[col] + 1.0 + choice(random);
+            builder.addColumn(std::round(coefficient(random)), lower, kind == 1 ? kInfinity : upper);
+        }
+        Indices previousIndices;
+        Values previousValues;
+        for (std::size_t row = 0; row < rows; ++row) {
+            Indices indices;
+            Values values;
+            const int kind = choice(random);
+            if (kind == 0 && !previousIndices.empty()) {
+                // A scaled copy of the previous row.
+                indices = previousIndices;
+                for (const double value : previousValues) {
+                    values.push_back(-2.0 * value);
+                }
+            } else {
+                const std::size_t length = kind == 1 ? 1 : cols;
+                for (std::size_t col = 0; col < cols && indices.size() < length; ++col) {
+                    const double value = std::round(coefficient(random));
+                    if (value != 0.0 && (kind == 1 || choice(random) < 6)) {
+                        indices.push_back(col);
+                        values.push_back(value);
+                    }
+                }
+            }
+            double activity = 0.0;
+            for (std::size_t k = 0; k < indices.size(); ++k) {
+                activity += values[k] * point[indices[k]];
+            }
+            const double slack = static_cast<double>(choice(random) % 3);
+            const int sense = choice(random) % 4;
+            if (sense == 0) {
+                builder.addRow(RowSense::LessEqual, activity + slack, indices, values);
+            } else if (sense == 1) {
+                builder.addRow(RowSense::GreaterEqual, activity - slack, indices, values);
+            } else if (sense == 2) {
+                builder.addRow(RowSense::Equal, activity, indices, values);
+            } else {
+                const std::size_t added = builder.addRow(RowSense::Ranged, activity - slack, indices, values);
+                builder.setRowRange(added, 2.0 * slack);
+            }
+            previousIndices = indices;
+            previousValues = values;
+        }
+        const LinearProgram program = builder.build();
+
+        const auto direct = solve(program);
+        const auto presolved = presolveAndSolve(program);
+        if (direct.status == SolutionStatus::Unbounded) {
+            EXPECT_EQ(presolved.status, SolutionStatus::Unbounded) << "trial " << trial;
+            continue;
+        }
+        ASSERT_EQ(direct.status, SolutionStatus::Optimal) << "trial " << trial;
+        ASSERT_EQ(presolved.status, SolutionStatus::Optimal) << "trial " << trial;
+        EXPECT_NEAR(presolved.objective, direct.objective, 1e-6 * (1.0 + std::abs(direct.objective)))
+            << "trial " << trial;
+        expectFeasible(program, presolved.values);
+        expectConsistentDuals(program, presolved);
+        expectComplementary(program, presolved);
+
+        // The postsolved statuses are a usable warm start for the original program.
+        ASSERT_EQ(presolved.basisState.columns.size(), program.cols()) << "trial " << trial;
+        const auto warm = warmSolve(program, presolved.basisState);
+        ASSERT_EQ(warm.status, SolutionStatus::Optimal) << "trial " << trial;
+        EXPECT_NEAR(warm.objective, direct.objective, 1e-6 * (1.0 + std::abs(direct.objective))) << "trial " << trial;
+        ++solved;
+    }
+    EXPECT_GT(solved, 30u);
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "limo/numerics/SparseMatrix.hpp"
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+/**
+ * Random problem data shared by the solver benchmarks here and in analysis.
+ */
+namespace limo::simplex::benchmarks {
+
+/**
+ * @brief Adds columns [0, cols) of a random sparse program to `builder`.
+ *
+ * Column c always has an entry in row c % rows, so no row is empty, and one
+ * in each other row with probability 1 / (sparsity + 1). Per column the
+ * draws are point(c), then entry(row, c) for each of its entries, then
+ * cost(c); rhs[row] accumulates entry * point, so b = A p and the point p
+ * is feasible. The callables may draw from `rng` themselves.
+ */
+template <typename T, typename Point, typename Entry, typename Cost>
+void addRandomColumns(std::mt19937& rng, typename numerics::SparseMatrix<T>::Builder& builder, std::size_t rows,
+                      std::size_t cols, int sparsity, std::vector<T>& rhs, std::vector<T>& costs, const Point& point,
+                      const Entry& entry, const Cost& cost) {
+    std::uniform_int_distribution<int> pattern(0, sparsity);
+    for (std::size_t col = 0; col < cols; ++col) {
+        const T value = point(col);
+        for (std::size_t row = 0; row < rows; ++row) {
+            if (pattern(rng) == 0 || row == col % rows) {
+                const T coefficient = entry(row, col);
+                builder.add(row, col, coefficient);
+                rhs[row] += coefficient * value;
+            }
+        }
+        costs[col] = cost(col);
+    }
+}
+
+} // namespace limo::simplex::benchmarks
@@ -0,0 +1,59 @@
+#include "limo/simplex/SimplexSolver.hpp"
+
+#include "BenchmarkProblems.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <optional>
+#include <random>
+#include <vector>
+
+using limo::numerics::SparseMatrix;
+using limo::numerics::fraction::Fraction;
+using limo::simplex::SimplexSolver;
+using limo::simplex::StandardForm;
+using limo::simplex::StartMethod;
+using limo::simplex::benchmarks::addRandomColumns;
+
+namespace {
+
+// Random feasible equalities with small integer data, so both scalar types
+// see the same instance: b = A p for an integral point p inside the box [0, 3].
+template <typename T>
+StandardForm<T> randomProblem(std::size_t rows, std::size_t cols) {
+    std::mt19937 rng(53);
+    std::uniform_int_distribution<int> coefficient(-3, 5);
+    std::uniform_int_distribution<int> point(0, 3);
+    typename SparseMatrix<T>::Builder builder(rows, cols);
+    std::vector<T> rhs(rows, T(0));
+    std::vector<T> costs(cols);
+    const auto draw = [&](auto&&...) { return T(coefficient(rng)); };
+    addRandomColumns(rng, builder, rows, cols, 2, rhs, costs, [&](std::size_t) { return T(point(rng)); }, draw, draw);
+    return {builder.build(), std::move(rhs), std::move(costs), std::vector<std::optional<T>>(cols, T(3))};
+}
+
+// range(0): rows (columns are three times as many), range(1): two-phase (0)
+// or symbolic Big-M (1) start. Reports the iteration count of the solve.
+template <typename T>
+void BM_TableauStart(benchmark::State& state) {
+    const auto rows = static_cast<std::size_t>(state.range(0));
+    const StandardForm<T> problem = randomProblem<T>(rows, 3 * rows);
+    typename SimplexSolver<T>::Options options;
+    options.start = state.range(1) != 0 ? StartMethod::BigM : StartMethod::TwoPhase;
+    const SimplexSolver<T> solver(options);
+
+    std::size_t iterations = 0;
+    for (auto _ : state) {
+        const auto solution = solver.solve(problem);
+        iterations = solution.iterations;
+        benchmark::DoNotOptimize(solution.status);
+    }
+    state.SetLabel(options.start == StartMethod::BigM ? "big-m" : "two-phase");
+    state.counters["iterations"] = static_cast<double>(iterations);
+}
+
+} // namespace
+
+BENCHMARK(BM_TableauStart<double>)->ArgsProduct({{20, 40, 80}, {0, 1}})->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TableauStart<Fraction>)->ArgsProduct({{10, 20}, {0, 1}})->Unit(benchmark::kMillisecond);
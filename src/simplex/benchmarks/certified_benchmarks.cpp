@@ -0,0 +1,76 @@
+#include "limo/simplex/CertifiedSolver.hpp"
+
+#include "BenchmarkProblems.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <vector>
+
+using limo::numerics::SparseMatrix;
+using limo::numerics::fraction::Fraction;
+using limo::simplex::CertifiedSolver;
+using limo::simplex::SimplexSolver;
+using limo::simplex::StandardForm;
+using limo::simplex::benchmarks::addRandomColumns;
+
+namespace {
+
+// Random feasible, bounded problem with small rational data: b = A p for a
+// point p inside the box [0, 3].
+StandardForm<Fraction> randomProblem(std::size_t rows, std::size_t cols) {
+    std::mt19937 rng(67);
+    std::uniform_int_distribution<int> coefficient(-3, 5);
+    std::uniform_int_distribution<int> denominator(1, 4);
+    std::uniform_int_distribution<int> point(0, 6);
+    SparseMatrix<Fraction>::Builder builder(rows, cols);
+    std::vector<Fraction> rhs(rows);
+    std::vector<Fraction> costs(cols);
+    const auto draw = [&](auto&&...) {
+        const int numerator = coefficient(rng);
+        return Fraction(numerator, denominator(rng));
+    };
+    addRandomColumns(
+        rng, builder, rows, cols, 2, rhs, costs, [&](std::size_t) { return Fraction(point(rng), 2); }, draw, draw);
+    return {builder.build(), std::move(rhs), std::move(costs), std::vector<std::optional<Fraction>>(cols, Fraction(3))};
+}
+
+// range(0): rows (columns are three times as many). Exact tableau solve.
+void BM_ExactSolve(benchmark::State& state) {
+    const auto rows = static_cast<std::size_t>(state.range(0));
+    const auto problem = randomProblem(rows, 3 * rows);
+    const SimplexSolver<Fraction> solver;
+    std::size_t iterations = 0;
+    for (auto _ : state) {
+        const auto solution = solver.solve(problem);
+        iterations = solution.iterations;
+        benchmark::DoNotOptimize(solution.status);
+    }
+    state.counters["iterations"] = static_cast<double>(iterations);
+}
+
+// Same problems: double solve plus exact certification of its basis.
+// Reports the exact pivots needed (0 when the basis verified as is).
+void BM_CertifiedSolve(benchmark::State& state) {
+    const auto rows = static_cast<std::size_t>(state.range(0));
+    const auto problem = randomProblem(rows, 3 * rows);
+    const CertifiedSolver solver;
+    std::size_t exactIterations = 0;
+    bool verified = false;
+    for (auto _ : state) {
+        const auto result = solver.solve(problem);
+        exactIterations = result.exactIterations;
+        verified = result.basisVerified;
+        benchmark::DoNotOptimize(result.solution.status);
+    }
+    state.SetLabel(verified ? "verified" : "repaired");
+    state.counters["exactIterations"] = static_cast<double>(exactIterations);
+}
+
+} // namespace
+
+BENCHMARK(BM_ExactSolve)->Arg(10)->Arg(20)->Arg(40)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_CertifiedSolve)->Arg(10)->Arg(20)->Arg(40)->Arg(80)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,102 @@
+#include "limo/simplex/ModifiedSimplexSolver.hpp"
+
+#include "BenchmarkProblems.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <optional>
+#include <random>
+#include <vector>
+
+using limo::numerics::SparseMatrix;
+using limo::simplex::ModifiedSimplexSolver;
+using limo::simplex::StandardForm;
+using limo::simplex::benchmarks::addRandomColumns;
+
+namespace {
+
+// Balanced transportation problem with `sources` supplies and as many
+// demands: every row is an equality and every column sits in two rows.
+StandardForm<double> transportationProblem(std::size_t sources, std::mt19937& rng) {
+    std::uniform_int_distribution<int> amount(10, 50);
+    std::uniform_real_distribution<double> cost(1.0, 10.0);
+    const std::size_t sinks = sources;
+    SparseMatrix<double>::Builder builder(sources + sinks, sources * sinks);
+    std::vector<double> rhs(sources + sinks, 0.0);
+    std::vector<double> costs(sources * sinks);
+    double supply = 0.0;
+    for (std::size_t i = 0; i < sources; ++i) {
+        rhs[i] = amount(rng);
+        supply += rhs[i];
+    }
+    for (std::size_t j = 0; j + 1 < sinks; ++j) {
+        rhs[sources + j] = supply / static_cast<double>(sinks);
+    }
+    rhs[sources + sinks - 1] = supply - static_cast<double>(sinks - 1) * (supply / static_cast<double>(sinks));
+    for (std::size_t i = 0; i < sources; ++i) {
+        for (std::size_t j = 0; j < sinks; ++j) {
+            const std::size_t col = i * sinks + j;
+            builder.add(i, col, 1.0);
+            builder.add(sources + j, col, 1.0);
+            costs[col] = cost(rng);
+        }
+    }
+    return {builder.build(), std::move(rhs), std::move(costs), {}};
+}
+
+// Random sparse equalities over boxed columns, half of the rows carrying a
+// slack: b = A p for a point p inside the box [0, 4].
+StandardForm<double> mixedProblem(std::size_t rows, std::mt19937& rng) {
+    std::uniform_real_distribution<double> coefficient(-1.0, 1.0);
+    std::uniform_real_distribution<double> point(0.0, 4.0);
+    const std::size_t structurals = 3 * rows;
+    const std::size_t slacks = rows / 2;
+    SparseMatrix<double>::Builder builder(rows, structurals + slacks);
+    std::vector<double> rhs(rows, 0.0);
+    std::vector<double> costs(structurals + slacks, 0.0);
+    addRandomColumns(
+        rng, builder, rows, structurals, 9, rhs, costs, [&](std::size_t) { return point(rng); },
+        [&](std::size_t, std::size_t) { return coefficient(rng); }, [&](std::size_t) { return coefficient(rng); });
+    for (std::size_t k = 0; k < slacks; ++k) {
+        builder.add(2 * k, structurals + k, 1.0);
+        rhs[2 * k] += 1.0;
+    }
+    std::vector<std::optional<double>> upper(structurals + slacks);
+    for (std::size_t col = 0; col < structurals; ++col) {
+        upper[col] = 4.0;
+    }
+    return {builder.build(), std::move(rhs), std::move(costs), std::move(upper)};
+}
+
+void run(benchmark::State& state, const StandardForm<double>& problem) {
+    ModifiedSimplexSolver::Options options;
+    options.crash = state.range(1) != 0;
+    const ModifiedSimplexSolver solver(options);
+    std::size_t iterations = 0;
+    for (auto _ : state) {
+        const auto solution = solver.solve(problem);
+        iterations = solution.iterations;
+        benchmark::DoNotOptimize(solution.objective);
+    }
+    state.SetLabel(options.crash ? "crash" : "artificial");
+    state.counters["iterations"] = static_cast<double>(iterations);
+}
+
+// range(0): sources (and sinks), range(1): all-artificial (0) or crash (1)
+// start. Reports the iteration count of phases 1 and 2 together.
+void BM_CrashTransportation(benchmark::State& state) {
+    std::mt19937 rng(37);
+    run(state, transportationProblem(static_cast<std::size_t>(state.range(0)), rng));
+}
+
+// range(0): rows, range(1): all-artificial (0) or crash (1) start.
+void BM_CrashMixedEqualities(benchmark::State& state) {
+    std::mt19937 rng(41);
+    run(state, mixedProblem(static_cast<std::size_t>(state.range(0)), rng));
+}
+
+} // namespace
+
+BENCHMARK(BM_CrashTransportation)->ArgsProduct({{10, 20, 40}, {0, 1}})->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_CrashMixedEqualities)->ArgsProduct({{40, 80, 160}, {0, 1}})->Unit(benchmark::kMillisecond);
@@ -0,0 +1,65 @@
+#include "limo/simplex/ModifiedSimplexSolver.hpp"
+#include "limo/simplex/ParallelScan.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <memory>
+#include <random>
+#include <vector>
+
+using limo::numerics::SparseMatrix;
+using limo::simplex::ModifiedSimplexSolver;
+using limo::simplex::StandardForm;
+using limo::thread_pool::ThreadPool;
+
+namespace {
+
+// 64 rows, range(0) columns with three non-zeros each and box bounds.
+StandardForm<double> wideProblem(std::size_t cols) {
+    const std::size_t rows = 64;
+    std::mt19937 rng(9);
+    std::uniform_int_distribution<std::size_t> row(0, rows - 1);
+    std::uniform_real_distribution<double> coefficient(0.5, 2.0);
+    std::uniform_real_distribution<double> cost(-1.0, 1.0);
+    SparseMatrix<double>::Builder builder(rows, cols);
+    builder.reserve(3 * cols);
+    std::vector<double> costs(cols);
+    for (std::size_t j = 0; j < cols; ++j) {
+        for (int k = 0; k < 3; ++k) {
+            builder.add(row(rng), j, coefficient(rng));
+        }
+        costs[j] = cost(rng);
+    }
+    StandardForm<double> problem{builder.build(), std::vector<double>(rows, 50.0), std::move(costs), {}};
+    problem.upperBounds.assign(cols, 1.0);
+    return problem;
+}
+
+// range(0): columns, range(1): pool threads (0 = sequential). Reports time per simplex iteration.
+void BM_WideRevisedIteration(benchmark::State& state) {
+    const StandardForm<double> problem = wideProblem(static_cast<std::size_t>(state.range(0)));
+    std::unique_ptr<ThreadPool> pool;
+    ModifiedSimplexSolver::Options options;
+    options.maxIterations = 200;
+    if (state.range(1) > 0) {
+        pool = std::make_unique<ThreadPool>(static_cast<std::size_t>(state.range(1)));
+        options.parallel.pool = pool.get();
+    }
+    const ModifiedSimplexSolver solver(options);
+    std::size_t iterations = 0;
+    for (auto _ : state) {
+        const auto solution = solver.solve(problem);
+        iterations += solution.iterations;
+        benchmark::DoNotOptimize(solution.objective);
+    }
+    state.counters["per_iteration"] =
+        benchmark::Counter(static_cast<double>(iterations), benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+}
+
+} // namespace
+
+BENCHMARK(BM_WideRevisedIteration)
+    ->ArgsProduct({{10000, 100000, 400000}, {0, 2, 4, 16}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
@@ -0,0 +1,79 @@
+#include "limo/simplex/ModifiedSimplexSolver.hpp"
+#include "limo/simplex/Pricing.hpp"
+#include "limo/simplex/SimplexSolver.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+using limo::numerics::SparseMatrix;
+using limo::simplex::ModifiedSimplexSolver;
+using limo::simplex::PricingRule;
+using limo::simplex::SimplexSolver;
+using limo::simplex::StandardForm;
+
+namespace {
+
+// Balanced sources x sinks transportation problem; degenerate by construction.
+StandardForm<double> transportationProblem(std::size_t sources, std::size_t sinks) {
+    std::mt19937 rng(11);
+    std::uniform_int_distribution<int> amount(1, 9);
+    std::uniform_int_distribution<int> cost(1, 50);
+    std::vector<double> rhs(sources + sinks, 0.0);
+    for (std::size_t i = 0; i < sources; ++i) {
+        rhs[i] = amount(rng) * static_cast<double>(sinks);
+        for (std::size_t j = 0; j < sinks; ++j) {
+            rhs[sources + j] += rhs[i] / static_cast<double>(sinks);
+        }
+    }
+    SparseMatrix<double>::Builder builder(sources + sinks, sources * sinks);
+    std::vector<double> costs;
+    for (std::size_t i = 0; i < sources; ++i) {
+        for (std::size_t j = 0; j < sinks; ++j) {
+            builder.add(i, i * sinks + j, 1.0);
+            builder.add(sources + j, i * sinks + j, 1.0);
+            costs.push_back(cost(rng));
+        }
+    }
+    return {builder.build(), std::move(rhs), std::move(costs), {}};
+}
+
+// range(0): sources = sinks, range(1): PricingRule. Reports the iteration count.
+void BM_RevisedPricing(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const StandardForm<double> problem = transportationProblem(size, size);
+    ModifiedSimplexSolver::Options options;
+    options.pricing = static_cast<PricingRule>(state.range(1));
+    const ModifiedSimplexSolver solver(options);
+    std::size_t iterations = 0;
+    for (auto _ : state) {
+        const auto solution = solver.solve(problem);
+        iterations = solution.iterations;
+        benchmark::DoNotOptimize(solution.objective);
+    }
+    state.SetLabel(limo::simplex::toString(options.pricing));
+    state.counters["iterations"] = static_cast<double>(iterations);
+}
+
+void BM_TableauPricing(benchmark::State& state) {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const StandardForm<double> problem = transportationProblem(size, size);
+    SimplexSolver<double>::Options options;
+    options.pricing = static_cast<PricingRule>(state.range(1));
+    const SimplexSolver<double> solver(options);
+    std::size_t iterations = 0;
+    for (auto _ : state) {
+        const auto solution = solver.solve(problem);
+        iterations = solution.iterations;
+        benchmark::DoNotOptimize(solution.objective);
+    }
+    state.SetLabel(limo::simplex::toString(options.pricing));
+    state.counters["iterations"] = static_cast<double>(iterations);
+}
+
+} // namespace
+
+BENCHMARK(BM_RevisedPricing)->ArgsProduct({{10, 20, 40}, {0, 1, 2, 3}})->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TableauPricing)->ArgsProduct({{10, 20, 40}, {0, 1, 2, 3}})->Unit(benchmark::kMillisecond);
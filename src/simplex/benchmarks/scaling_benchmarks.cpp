@@ -0,0 +1,83 @@
+#include "limo/simplex/ModifiedSimplexSolver.hpp"
+
+#include "BenchmarkProblems.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstddef>
+#include <exception>
+#include <optional>
+#include <random>
+#include <vector>
+
+using limo::numerics::SparseMatrix;
+using limo::simplex::ModifiedSimplexSolver;
+using limo::simplex::StandardForm;
+using limo::simplex::benchmarks::addRandomColumns;
+
+namespace {
+
+/**
+ * Random feasible, bounded problem (b = A p for a point p inside the box)
+ * whose rows and columns are then multiplied by random powers of ten in
+ * [10^-spread, 10^spread], as happens when a model mixes units.
+ */
+StandardForm<double> illScaledProblem(std::size_t rows, std::size_t cols, int spread) {
+    std::mt19937 rng(23);
+    std::uniform_real_distribution<double> coefficient(-1.0, 1.0);
+    std::uniform_int_distribution<int> exponent(-spread, spread);
+    std::vector<double> rowFactor(rows);
+    std::vector<double> colFactor(cols);
+    for (double& factor : rowFactor) {
+        factor = std::pow(10.0, exponent(rng));
+    }
+    for (double& factor : colFactor) {
+        factor = std::pow(10.0, exponent(rng));
+    }
+
+    SparseMatrix<double>::Builder builder(rows, cols);
+    std::vector<double> rhs(rows, 0.0);
+    std::vector<double> costs(cols);
+    // In unscaled units the point is 1 and the box [0, 4]; x = colFactor x'.
+    addRandomColumns(
+        rng, builder, rows, cols, 3, rhs, costs, [&](std::size_t col) { return colFactor[col]; },
+        [&](std::size_t row, std::size_t col) { return coefficient(rng) * rowFactor[row] / colFactor[col]; },
+        [&](std::size_t col) { return coefficient(rng) / colFactor[col]; });
+    std::vector<std::optional<double>> upper(cols);
+    for (std::size_t col = 0; col < cols; ++col) {
+        upper[col] = 4.0 * colFactor[col];
+    }
+    return {builder.build(), std::move(rhs), std::move(costs), std::move(upper)};
+}
+
+// range(0): rows (columns are three times as many), range(1): spread in
+// decades, range(2): scaling off (0) or on (1). Reports the iteration count.
+void BM_RevisedScaling(benchmark::State& state) {
+    const auto rows = static_cast<std::size_t>(state.range(0));
+    const StandardForm<double> problem = illScaledProblem(rows, 3 * rows, static_cast<int>(state.range(1)));
+    ModifiedSimplexSolver::Options options;
+    options.scaling = state.range(2) != 0;
+    const ModifiedSimplexSolver solver(options);
+    std::size_t iterations = 0;
+    double objective = 0.0;
+    for (auto _ : state) {
+        try {
+            const auto solution = solver.solve(problem);
+            iterations = solution.iterations;
+            objective = solution.objective;
+            benchmark::DoNotOptimize(solution.objective);
+        } catch (const std::exception& error) {
+            // Badly scaled unscaled runs can lose the basis to cancellation.
+            state.SkipWithError(error.what());
+            return;
+        }
+    }
+    state.SetLabel(options.scaling ? "scaled" : "unscaled");
+    state.counters["iterations"] = static_cast<double>(iterations);
+    state.counters["objective"] = objective;
+}
+
+} // namespace
+
+BENCHMARK(BM_RevisedScaling)->ArgsProduct({{40, 80, 160}, {0, 2, 4}, {0, 1}})->Unit(benchmark::kMillisecond);
@@ -0,0 +1,67 @@
+#include "limo/simplex/ModifiedSimplexSolver.hpp"
+
+#include "BenchmarkProblems.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <optional>
+#include <random>
+#include <vector>
+
+using limo::core::BasisState;
+using limo::numerics::SparseMatrix;
+using limo::simplex::ModifiedSimplexSolver;
+using limo::simplex::StandardForm;
+using limo::simplex::benchmarks::addRandomColumns;
+
+namespace {
+
+// Random feasible, bounded problem (b = A p for a point p inside the box [0, 4]).
+StandardForm<double> randomProblem(std::size_t rows, std::size_t cols, std::mt19937& rng) {
+    std::uniform_real_distribution<double> coefficient(-1.0, 1.0);
+    SparseMatrix<double>::Builder builder(rows, cols);
+    std::vector<double> rhs(rows, 0.0);
+    std::vector<double> costs(cols);
+    addRandomColumns(
+        rng, builder, rows, cols, 3, rhs, costs, [](std::size_t) { return 1.0; },
+        [&](std::size_t, std::size_t) { return coefficient(rng); }, [&](std::size_t) { return coefficient(rng); });
+    return {builder.build(), std::move(rhs), std::move(costs), std::vector<std::optional<double>>(cols, 4.0)};
+}
+
+// Moves every cost and right-hand side by up to `size` (relative).
+void perturb(StandardForm<double>& problem, double size, std::mt19937& rng) {
+    std::uniform_real_distribution<double> noise(1.0 - size, 1.0 + size);
+    for (double& cost : problem.costs) {
+        cost *= noise(rng);
+    }
+    for (double& value : problem.rhs) {
+        value *= noise(rng);
+    }
+}
+
+// range(0): rows (columns are three times as many), range(1): cold (0) or
+// warm (1) re-solve of a problem whose costs and rhs moved by up to 1%.
+// Reports the iteration count of the re-solve.
+void BM_RevisedResolve(benchmark::State& state) {
+    const auto rows = static_cast<std::size_t>(state.range(0));
+    const bool warm = state.range(1) != 0;
+    std::mt19937 rng(29);
+    StandardForm<double> problem = randomProblem(rows, 3 * rows, rng);
+    const ModifiedSimplexSolver solver;
+    const BasisState start = solver.solve(problem).basisState;
+    perturb(problem, 0.01, rng);
+
+    std::size_t iterations = 0;
+    for (auto _ : state) {
+        const auto solution = warm ? solver.solve(problem, start) : solver.solve(problem);
+        iterations = solution.iterations;
+        benchmark::DoNotOptimize(solution.objective);
+    }
+    state.SetLabel(warm ? "warm" : "cold");
+    state.counters["iterations"] = static_cast<double>(iterations);
+}
+
+} // namespace
+
+BENCHMARK(BM_RevisedResolve)->ArgsProduct({{40, 80, 160}, {0, 1}})->Unit(benchmark::kMillisecond);
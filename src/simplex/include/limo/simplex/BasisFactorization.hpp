@@ -0,0 +1,66 @@
+#pragma once
+
+#include "limo/numerics/LU.hpp"
+#include "limo/numerics/Matrix.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace limo::simplex {
+
+/**
+ * @brief Factorized simplex basis with product-form updates.
+ *
+ * Holds an LU factorization of the basis matrix B together with an eta
+ * file: every basis change appends one eta vector instead of touching the
+ * factors, so FTRAN (B⁻¹a) and BTRAN (B⁻ᵀc) cost O(m²) for the LU solves
+ * plus the non-zeros of the etas. Once refactorizationInterval updates
+ * have accumulated the owner should call factorize() on the current basis,
+ * which bounds both the eta file and the round-off it carries.
+ */
+class BasisFactorization {
+public:
+    explicit BasisFactorization(std::size_t refactorizationInterval = 64);
+
+    /**
+     * @brief Factors a new basis matrix and clears the eta file.
+     * @throws std::invalid_argument if the matrix is not square or is singular.
+     */
+    void factorize(const numerics::Matrix<double>& basisMatrix);
+
+    std::size_t size() const;
+    std::size_t updateCount() const;
+    bool needsRefactorization() const;
+
+    /**
+     * @brief x <- B⁻¹ x.
+     */
+    void ftran(std::vector<double>& x) const;
+
+    /**
+     * @brief y <- B⁻ᵀ y.
+     */
+    void btran(std::vector<double>& y) const;
+
+    /**
+     * @brief Replaces the basic variable of `row` by the column whose FTRAN
+     * result is `column` (that is, B⁻¹aq for the current basis).
+     * @throws std::invalid_argument if the pivot entry column[row] is zero.
+     */
+    void update(std::size_t row, const std::vector<double>& column);
+
+private:
+    struct Eta {
+        std::size_t row;
+        double pivot;
+        std::vector<std::size_t> indices;
+        std::vector<double> values;
+    };
+
+    std::size_t refactorizationInterval;
+    std::optional<numerics::LU<double>> lu;
+    std::vector<Eta> etas;
+};
+
+} // namespace limo::simplex
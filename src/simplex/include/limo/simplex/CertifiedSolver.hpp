@@ -0,0 +1,72 @@
+#pragma once
+
+#include "limo/core/Solution.hpp"
+#include "limo/numerics/Fraction.hpp"
+#include "limo/simplex/ModifiedSimplexSolver.hpp"
+#include "limo/simplex/SimplexSolver.hpp"
+#include "limo/simplex/StandardForm.hpp"
+
+#include <cstddef>
+
+namespace limo::simplex {
+
+/**
+ * @brief Floating-point solver CertifiedSolver takes its candidate basis from.
+ */
+enum class FloatingSolver {
+    /// ModifiedSimplexSolver.
+    Revised,
+    /// SimplexSolver<double>.
+    Tableau,
+};
+
+/**
+ * @brief Exact solution from CertifiedSolver and how it was reached.
+ */
+struct CertifiedSolution {
+    core::Solution<numerics::fraction::Fraction> solution;
+    /// Whether the floating-point basis checked out as is; otherwise exact
+    /// pivots from it produced `solution`.
+    bool basisVerified{false};
+    std::size_t floatingIterations{0};
+    std::size_t exactIterations{0};
+};
+
+/**
+ * @brief Mixed-precision solve of a Fraction StandardForm: exact answers at
+ * roughly floating-point cost.
+ *
+ * The problem is rounded to double and solved there. If that ends optimal,
+ * the final basis is checked in exact arithmetic: one LU<Fraction> of the
+ * basis gives the basic values B⁻¹(b - N x_N) and the duals B⁻ᵀc_B, which
+ * must lie within the bounds and price every nonbasic column out with the
+ * sign its bound allows. A basis that passes is optimal, and the solution is
+ * rebuilt exactly from it. Otherwise, and for every other floating-point
+ * outcome, SimplexSolver<Fraction> warm-starts from the floating-point basis,
+ * which usually leaves only a few exact pivots.
+ */
+class CertifiedSolver {
+public:
+    struct Options {
+        FloatingSolver floating{FloatingSolver::Revised};
+        ModifiedSimplexSolver::Options revised;
+        SimplexSolver<double>::Options tableau;
+        /// Options of the exact solver that repairs a basis that fails the check.
+        SimplexSolver<numerics::fraction::Fraction>::Options exact;
+    };
+
+    CertifiedSolver() = default;
+    explicit CertifiedSolver(Options options);
+
+    const Options& getOptions() const;
+
+    /**
+     * @throws std::invalid_argument if the problem is malformed (see StandardForm::validate).
+     */
+    CertifiedSolution solve(const StandardForm<numerics::fraction::Fraction>& problem) const;
+
+private:
+    Options options;
+};
+
+} // namespace limo::simplex
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "limo/core/LinearProgram.hpp"
+#include "limo/core/Solution.hpp"
+#include "limo/simplex/StandardForm.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace limo::simplex {
+
+/**
+ * @brief A LinearProgram rewritten as a StandardForm, with what is needed to
+ * map a solution of the latter back onto the former.
+ *
+ * Columns with a finite lower bound l are shifted (x = l + x'), columns with
+ * only a finite upper bound u are mirrored (x = u - x'), and free columns
+ * are split (x = x⁺ - x⁻). Inequality and ranged rows get one slack column
+ * each. Maximization problems are solved as minimization of -cᵀx.
+ */
+class ConvertedProgram {
+public:
+    const StandardForm<double>& form() const { return form_; }
+
+    /**
+     * @brief Maps a solution of form() to the columns, rows and sense of the
+     * original program.
+     *
+     * Values, duals and reduced costs are mapped when present; basis entries
+     * naming a slack column become the logical cols + i of its row. Basis
+     * statuses follow the column mappings, and a row's status is that of
+     * its slack translated to which limit its activity sits at; split free
+     * columns that are nonbasic report AtLower.
+     */
+    core::Solution<double> recover(const core::Solution<double>& solution) const;
+
+    /**
+     * @brief Maps basis statuses of the original program, e.g. the
+     * basisState of a recovered solution, onto form() as a warm start for
+     * its solvers.
+     * @throws std::invalid_argument if `state` does not have one status per
+     * column and row of the original program.
+     */
+    core::BasisState toFormBasis(const core::BasisState& state) const;
+
+private:
+    friend ConvertedProgram toStandardForm(const core::LinearProgram& program);
+
+    enum class Mapping {
+        Shifted,
+        Mirrored,
+        Split,
+    };
+
+    StandardForm<double> form_;
+    double senseSign_{1.0};
+    double objectiveOffset_{0.0};
+    std::vector<double> costs_;
+    std::vector<Mapping> mappings_;
+    /// Lower bound (Shifted) or upper bound (Mirrored) of every column; 0 for Split.
+    std::vector<double> shifts_;
+    /// First form column of every column; Split columns use the next one for x⁻.
+    std::vector<std::size_t> formColumns_;
+    /// Original column, or cols + i for the slack of row i, of every form column.
+    std::vector<std::size_t> origins_;
+    std::vector<core::RowSense> rowSenses_;
+    /// Form column of the slack of every row; unused for equality rows.
+    std::vector<std::size_t> slackColumns_;
+};
+
+/**
+ * @brief Rewrites `program` as minimize cᵀx subject to Ax = b, 0 <= x <= u.
+ */
+ConvertedProgram toStandardForm(const core::LinearProgram& program);
+
+} // namespace limo::simplex
@@ -1,13 +1,92 @@
 #pragma once
 
+#include "limo/basis/ArtificialBasisFinder.hpp"
 #include "limo/core/LinearProgram.hpp"
 #include "limo/core/Solution.hpp"
+#include "limo/numerics/Scaling.hpp"
+#include "limo/simplex/ParallelScan.hpp"
+#include "limo/simplex/Pricing.hpp"
+#include "limo/simplex/StandardForm.hpp"
+
+#include <cstddef>
 
 namespace limo::simplex {
 
+/**
+ * @brief Revised primal simplex method over a factorized basis.
+ *
+ * Instead of a full m x n tableau the solver keeps the constraint matrix in
+ * sparse form and only an LU factorization of the m x m basis, updated in
+ * product form after every pivot (see BasisFactorization). Memory is
+ * O(nnz(A) + m²) and each iteration costs one BTRAN, one pricing pass over
+ * the non-zeros of A, one FTRAN and a ratio test over the rows, which is
+ * what makes it suitable for problems with many more columns than rows.
+ *
+ * Upper bounds are handled implicitly (bounded simplex with bound flips).
+ * Feasibility is established by a phase 1 over one artificial per row;
+ * artificials still basic afterwards are pivoted out where possible and
+ * fixed at zero for phase 2. A cold start begins from the crash basis of
+ * basis::ArtificialBasisFinder, so phase 1 only has to drive out the
+ * artificials of rows the crash left uncovered; a warm start from an
+ * earlier basis replaces it and usually skips phase 1.
+ */
 class ModifiedSimplexSolver {
 public:
+    struct Options {
+        std::size_t maxIterations{100000};
+        /// Number of eta updates after which the basis is refactorized.
+        std::size_t refactorizationInterval{64};
+        double feasibilityTolerance{1e-9};
+        double optimalityTolerance{1e-9};
+        /// Smallest magnitude accepted as a pivot in the ratio test.
+        double pivotTolerance{1e-9};
+        /// Rule used to choose the entering column, see Pricing.hpp.
+        PricingRule pricing{PricingRule::Dantzig};
+        /// Columns per chunk for PricingRule::Partial; 0 sizes chunks from the problem.
+        std::size_t partialPricingChunk{0};
+        /// When set, supplies the pricing strategy instead of `pricing`.
+        PricingFactory<double> pricingFactory;
+        /// Splits pricing, the ratio test and the pivot row over a thread pool for wide problems.
+        ParallelOptions parallel;
+        /// Solves a row- and column-scaled copy of the problem and unscales the
+        /// solution; helps on badly scaled coefficients. Tolerances apply to the
+        /// scaled problem.
+        bool scaling{false};
+        numerics::ScalingOptions scalingOptions;
+        /// Starts cold solves from a crash basis instead of all artificials.
+        bool crash{true};
+        basis::ArtificialBasisFinder::Options crashOptions;
+    };
+
     ModifiedSimplexSolver() = default;
+    explicit ModifiedSimplexSolver(Options options);
+
+    const Options& getOptions() const;
+
+    /**
+     * @throws std::invalid_argument if the problem is malformed (see StandardForm::validate).
+     */
+    core::Solution<double> solve(const StandardForm<double>& problem) const;
+
+    /**
+     * @brief Solves starting from `start`, typically the basisState of an
+     * earlier solve of the same problem with changed costs or right-hand
+     * sides.
+     *
+     * The columns `start` marks basic are pivoted into the basis as far as
+     * they are independent; rows it marks basic keep their logical, and
+     * artificials fill the rest. Basic columns left outside their bounds are
+     * swapped out for artificials. If that basis is feasible, phase 1 is
+     * skipped; otherwise phase 1 starts from it. An empty `start` means a
+     * cold start.
+     *
+     * @throws std::invalid_argument if the problem is malformed, or `start` is
+     * neither empty nor has one status per column and row.
+     */
+    core::Solution<double> solve(const StandardForm<double>& problem, const core::BasisState& start) const;
+
+private:
+    Options options;
 };
 
 } // namespace limo::simplex
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "limo/thread_pool/ThreadPool.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <optional>
+#include <vector>
+
+namespace limo::simplex {
+
+/**
+ * @brief Where and from which size the per-iteration scans of a solver run in parallel.
+ *
+ * The solving thread scans chunks itself and runs queued pool tasks while it
+ * waits, so the pool may also be the one the solve runs on.
+ */
+struct ParallelOptions {
+    /// Workers for the scans; nullptr keeps every scan on the calling thread.
+    thread_pool::ThreadPool* pool{nullptr};
+    /// Scans over fewer elements than this stay sequential.
+    std::size_t cutoff{32768};
+
+    bool enabled(std::size_t count) const { return pool != nullptr && count >= cutoff; }
+};
+
+/**
+ * @brief Reduces `scan(begin, end)` over [0, count).
+ *
+ * The range is cut into one chunk per worker plus one, which the calling
+ * thread and the workers claim through ThreadPool::parallelFor. Chunk
+ * results are folded left to right with `combine(left, right)`, so if
+ * `combine` is associative the result does not depend on the number of
+ * chunks, i.e. on the thread count. Every chunk runs even if another one
+ * throws; the exception of the lowest failing chunk is rethrown.
+ */
+template <typename Scan, typename Combine>
+auto parallelReduce(const ParallelOptions& parallel, std::size_t count, const Scan& scan, const Combine& combine) {
+    if (!parallel.enabled(count)) {
+        return scan(std::size_t{0}, count);
+    }
+    using Result = decltype(scan(std::size_t{0}, count));
+    const std::size_t chunks = std::min(parallel.pool->size() + 1, count);
+    const std::size_t chunkSize = (count + chunks - 1) / chunks;
+
+    std::vector<std::optional<Result>> results(chunks);
+    std::vector<std::exception_ptr> errors(chunks);
+    parallel.pool->parallelFor(0, chunks, 1, [&](std::size_t first, std::size_t last) {
+        for (std::size_t chunk = first; chunk < last; ++chunk) {
+            const std::size_t begin = std::min(chunk * chunkSize, count);
+            try {
+                results[chunk] = scan(begin, std::min(begin + chunkSize, count));
+            } catch (...) {
+                errors[chunk] = std::current_exception();
+            }
+        }
+    });
+    for (const std::exception_ptr& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+    Result result = std::move(*results.front());
+    for (std::size_t chunk = 1; chunk < chunks; ++chunk) {
+        result = combine(std::move(result), std::move(*results[chunk]));
+    }
+    return result;
+}
+
+/**
+ * @brief Runs `body(begin, end)` over chunks of [0, count), in parallel above the cutoff.
+ */
+template <typename Body>
+void parallelFor(const ParallelOptions& parallel, std::size_t count, const Body& body) {
+    parallelReduce(
+        parallel, count,
+        [&body](std::size_t begin, std::size_t end) {
+            body(begin, end);
+            return true;
+        },
+        [](bool, bool) { return true; });
+}
+
+} // namespace limo::simplex
@@ -0,0 +1,368 @@
+#pragma once
+
+#include "limo/simplex/ParallelScan.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+namespace limo::simplex {
+
+/**
+ * @brief Rule used to choose the entering column.
+ */
+enum class PricingRule {
+    /// Largest dual infeasibility |d_j|.
+    Dantzig,
+    /// Dantzig over one chunk of columns at a time, resuming where the last scan stopped.
+    Partial,
+    /// Largest d_j² / w_j with Devex reference weights.
+    Devex,
+    /// Largest d_j² / γ_j with exact steepest-edge norms γ_j = 1 + ||B⁻¹a_j||².
+    SteepestEdge,
+};
+
+const char* toString(PricingRule rule);
+
+/**
+ * @brief Data of one basis change needed to update pricing weights.
+ *
+ * Variables are indexed as in the solver (structural columns followed by
+ * the logical column of every row).
+ */
+template <typename T>
+struct PivotWeights {
+    std::size_t entering;
+    std::size_t leaving;
+    /// Row r of B⁻¹A before the pivot, for every variable; pivotRow[entering] is the pivot.
+    const std::vector<T>& pivotRow;
+    /// Entering column α_q = B⁻¹a_q, one entry per row.
+    const std::vector<T>& pivotColumn;
+    /// Basic variable of every row before the pivot.
+    const std::vector<std::size_t>& basis;
+    /// α_jᵀα_q for every variable j, where α = B⁻¹A before the pivot. Only filled for steepest edge.
+    const std::vector<T>& columnProducts;
+};
+
+/**
+ * @brief Best column of a (partial) pricing scan.
+ */
+template <typename T>
+struct PricingCandidate {
+    std::optional<std::size_t> variable;
+    T value{};
+
+    void consider(std::size_t candidate, const T& candidateValue) {
+        if (!variable || value < candidateValue) {
+            variable = candidate;
+            value = candidateValue;
+        }
+    }
+
+    /// Keeps the larger value and, on ties, the left (lower-index) column;
+    /// associative, so chunked scans pick the same column as a sequential one.
+    static PricingCandidate combine(PricingCandidate left, PricingCandidate right) {
+        if (right.variable && (!left.variable || left.value < right.value)) {
+            return right;
+        }
+        return left;
+    }
+};
+
+/**
+ * @brief Chooses entering columns and maintains the weights that rule needs.
+ *
+ * The solver asks for a choice through a callback that returns the dual
+ * infeasibility |d_j| of a column, or nothing when the column may not
+ * enter. Strategies that only look at part of the columns (partial
+ * pricing) therefore never make the solver compute the other reduced costs.
+ * Full scans split across ParallelOptions::pool once they reach the cutoff,
+ * so the callback must be safe to call concurrently.
+ */
+template <typename T>
+class PricingStrategy {
+public:
+    using Infeasibility = std::function<std::optional<T>(std::size_t)>;
+
+    virtual ~PricingStrategy() = default;
+
+    virtual PricingRule rule() const = 0;
+
+    /// Whether update() needs PivotWeights::pivotRow.
+    virtual bool needsPivotRow() const { return false; }
+    /// Whether reset() should be followed by exact initial weights and update() needs columnProducts.
+    virtual bool needsExactWeights() const { return false; }
+
+    /**
+     * @brief Starts pricing over `variableCount` variables with unit weights.
+     */
+    virtual void reset(std::size_t variableCount) { (void)variableCount; }
+
+    /**
+     * @brief Sets the exact starting weight of one variable (steepest edge only).
+     */
+    virtual void setWeight(std::size_t variable, const T& weight) {
+        (void)variable;
+        (void)weight;
+    }
+
+    /**
+     * @return The entering variable, or nothing if no column is eligible.
+     */
+    virtual std::optional<std::size_t> select(std::size_t variableCount, const Infeasibility& infeasibility) = 0;
+
+    virtual void update(const PivotWeights<T>& pivot) { (void)pivot; }
+
+    void setParallel(const ParallelOptions& options) { parallel = options; }
+
+protected:
+    ParallelOptions parallel;
+};
+
+template <typename T>
+class DantzigPricing : public PricingStrategy<T> {
+public:
+    PricingRule rule() const override { return PricingRule::Dantzig; }
+
+    std::optional<std::size_t> select(std::size_t variableCount,
+                                      const typename PricingStrategy<T>::Infeasibility& infeasibility) override {
+        const auto scan = [&infeasibility](std::size_t begin, std::size_t end) {
+            PricingCandidate<T> best;
+            for (std::size_t j = begin; j < end; ++j) {
+                if (const std::optional<T> value = infeasibility(j)) {
+                    best.consider(j, *value);
+                }
+            }
+            return best;
+        };
+        return parallelReduce(this->parallel, variableCount, scan, PricingCandidate<T>::combine).variable;
+    }
+};
+
+/**
+ * @brief Dantzig pricing restricted to chunks of columns.
+ *
+ * Scans chunk after chunk, starting after the chunk the previous choice
+ * came from, and stops at the first chunk that contains an eligible
+ * column. Only when every chunk comes up empty is the basis optimal.
+ */
+template <typename T>
+class PartialPricing : public PricingStrategy<T> {
+public:
+    /**
+     * @param chunkSize Columns per chunk; 0 picks roughly sqrt(n) * 4.
+     */
+    explicit PartialPricing(std::size_t chunkSize = 0) : chunkSize(chunkSize) {}
+
+    PricingRule rule() const override { return PricingRule::Partial; }
+
+    void reset(std::size_t variableCount) override { (void)variableCount; cursor = 0; }
+
+    std::optional<std::size_t> select(std::size_t variableCount,
+                                      const typename PricingStrategy<T>::Infeasibility& infeasibility) override {
+        if (variableCount == 0) {
+            return std::nullopt;
+        }
+        const std::size_t chunk = chunkSize != 0 ? chunkSize : defaultChunk(variableCount);
+        std::size_t start = cursor % variableCount;
+        for (std::size_t scanned = 0; scanned < variableCount; scanned += chunk) {
+            const std::size_t count = std::min(chunk, variableCount - scanned);
+            PricingCandidate<T> best;
+            for (std::size_t k = 0; k < count; ++k) {
+                const std::size_t j = (start + k) % variableCount;
+                if (const std::optional<T> value = infeasibility(j)) {
+                    best.consider(j, *value);
+                }
+            }
+            start = (start + count) % variableCount;
+            if (best.variable) {
+                cursor = start;
+                return best.variable;
+            }
+        }
+        return std::nullopt;
+    }
+
+private:
+    std::size_t chunkSize;
+    std::size_t cursor{0};
+
+    static std::size_t defaultChunk(std::size_t variableCount) {
+        std::size_t root = 1;
+        while (root * root < variableCount) {
+            ++root;
+        }
+        return std::max<std::size_t>(root * 4, 16);
+    }
+};
+
+/**
+ * @brief Shared selection and storage for the weighted rules: picks the
+ * largest d_j² / w_j.
+ */
+template <typename T>
+class WeightedPricing : public PricingStrategy<T> {
+public:
+    bool needsPivotRow() const override { return true; }
+
+    void reset(std::size_t variableCount) override { weights.assign(variableCount, T{1}); }
+
+    void setWeight(std::size_t variable, const T& weight) override { weights[variable] = weight; }
+
+    std::optional<std::size_t> select(std::size_t variableCount,
+                                      const typename PricingStrategy<T>::Infeasibility& infeasibility) override {
+        if (weights.size() != variableCount) {
+            reset(variableCount);
+        }
+        const auto scan = [this, &infeasibility](std::size_t begin, std::size_t end) {
+            PricingCandidate<T> best;
+            for (std::size_t j = begin; j < end; ++j) {
+                if (const std::optional<T> value = infeasibility(j)) {
+                    best.consider(j, *value * *value / weights[j]);
+                }
+            }
+            return best;
+        };
+        return parallelReduce(this->parallel, variableCount, scan, PricingCandidate<T>::combine).variable;
+    }
+
+    const std::vector<T>& getWeights() const { return weights; }
+
+protected:
+    std::vector<T> weights;
+
+    static T maxOf(const T& left, const T& right) { return left < right ? right : left; }
+};
+
+/**
+ * @brief Devex pricing (Forrest and Goldfarb): approximate steepest-edge
+ * weights measured in a reference framework, the nonbasic variables at the
+ * time of the last reset. Only the pivot row and column are needed.
+ *
+ * The entering weight is refreshed from the part of α_q that lies in the
+ * framework; when the stored weight overestimates it by more than
+ * kResetRatio the framework is restarted from the current nonbasic set.
+ */
+template <typename T>
+class DevexPricing : public WeightedPricing<T> {
+public:
+    PricingRule rule() const override { return PricingRule::Devex; }
+
+    void reset(std::size_t variableCount) override {
+        WeightedPricing<T>::reset(variableCount);
+        reference.assign(variableCount, true);
+        referenceKnown = false;
+    }
+
+    void update(const PivotWeights<T>& pivot) override {
+        std::vector<T>& weights = this->weights;
+        if (!referenceKnown) {
+            // No basis change since the reset, so the current basis is the one it referred to.
+            for (std::size_t variable : pivot.basis) {
+                reference[variable] = false;
+            }
+            referenceKnown = true;
+        }
+        T enteringWeight = reference[pivot.entering] ? T{1} : T{};
+        for (std::size_t i = 0; i < pivot.basis.size(); ++i) {
+            if (reference[pivot.basis[i]]) {
+                enteringWeight = enteringWeight + pivot.pivotColumn[i] * pivot.pivotColumn[i];
+            }
+        }
+        enteringWeight = this->maxOf(enteringWeight, T{1});
+        const bool restart = T{kResetRatio} * enteringWeight < weights[pivot.entering];
+
+        const T& pivotValue = pivot.pivotRow[pivot.entering];
+        parallelFor(this->parallel, weights.size(), [&](std::size_t begin, std::size_t end) {
+            for (std::size_t j = begin; j < end; ++j) {
+                if (j == pivot.entering || pivot.pivotRow[j] == T{}) {
+                    continue;
+                }
+                const T ratio = pivot.pivotRow[j] / pivotValue;
+                weights[j] = this->maxOf(weights[j], ratio * ratio * enteringWeight);
+            }
+        });
+        weights[pivot.leaving] = this->maxOf(enteringWeight / (pivotValue * pivotValue), T{1});
+
+        if (restart) {
+            reset(weights.size());
+        }
+    }
+
+private:
+    static constexpr int kResetRatio = 3;
+
+    std::vector<bool> reference;
+    bool referenceKnown{false};
+};
+
+/**
+ * @brief Exact steepest-edge pricing with the Goldfarb-Reid recurrence:
+ *
+ *     γ_j <- max(γ_j - 2 ᾱ_j α_jᵀα_q + ᾱ_j² γ_q, 1 + ᾱ_j²),  ᾱ_j = α_rj / α_rq
+ *     γ_p <- max(γ_q / α_rq², 1) for the leaving variable p
+ *
+ * γ_q itself is recomputed from the pivot column. The solver provides
+ * exact starting weights and, per pivot, the products α_jᵀα_q (one extra
+ * BTRAN in the revised method).
+ */
+template <typename T>
+class SteepestEdgePricing : public WeightedPricing<T> {
+public:
+    PricingRule rule() const override { return PricingRule::SteepestEdge; }
+
+    bool needsExactWeights() const override { return true; }
+
+    void update(const PivotWeights<T>& pivot) override {
+        std::vector<T>& weights = this->weights;
+        const T& pivotValue = pivot.pivotRow[pivot.entering];
+        T enteringWeight{1};
+        for (const T& value : pivot.pivotColumn) {
+            enteringWeight = enteringWeight + value * value;
+        }
+        parallelFor(this->parallel, weights.size(), [&](std::size_t begin, std::size_t end) {
+            for (std::size_t j = begin; j < end; ++j) {
+                if (j == pivot.entering || pivot.pivotRow[j] == T{}) {
+                    continue;
+                }
+                const T ratio = pivot.pivotRow[j] / pivotValue;
+                const T updated =
+                    weights[j] - T{2} * ratio * pivot.columnProducts[j] + ratio * ratio * enteringWeight;
+                weights[j] = this->maxOf(updated, T{1} + ratio * ratio);
+            }
+        });
+        weights[pivot.leaving] = this->maxOf(enteringWeight / (pivotValue * pivotValue), T{1});
+    }
+};
+
+/**
+ * @brief Creates the strategy for a rule.
+ * @param partialChunk Chunk size for PricingRule::Partial (0 = automatic).
+ */
+template <typename T>
+std::unique_ptr<PricingStrategy<T>> makePricing(PricingRule rule, std::size_t partialChunk = 0) {
+    switch (rule) {
+    case PricingRule::Dantzig:
+        return std::make_unique<DantzigPricing<T>>();
+    case PricingRule::Partial:
+        return std::make_unique<PartialPricing<T>>(partialChunk);
+    case PricingRule::Devex:
+        return std::make_unique<DevexPricing<T>>();
+    case PricingRule::SteepestEdge:
+        return std::make_unique<SteepestEdgePricing<T>>();
+    }
+    throw std::invalid_argument("Unknown pricing rule");
+}
+
+/**
+ * @brief Builds a fresh strategy for every solve, in place of the one
+ * makePricing() picks for the solver's rule; for custom or wrapped rules.
+ */
+template <typename T>
+using PricingFactory = std::function<std::unique_ptr<PricingStrategy<T>>()>;
+
+} // namespace limo::simplex
@@ -1,13 +1,682 @@
 #pragma once
 
+#include "limo/basis/BigMBasisFinder.hpp"
 #include "limo/core/LinearProgram.hpp"
 #include "limo/core/Solution.hpp"
+#include "limo/numerics/Fraction.hpp"
+#include "limo/numerics/Matrix.hpp"
+#include "limo/simplex/ParallelScan.hpp"
+#include "limo/simplex/Pricing.hpp"
+#include "limo/simplex/StandardForm.hpp"
+#include "limo/simplex/Tolerance.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <vector>
 
 namespace limo::simplex {
 
+/**
+ * @brief How SimplexSolver gets from the artificial basis to a feasible one.
+ */
+enum class StartMethod {
+    /// Phase 1 minimizes the sum of the artificials, phase 2 then cᵀx.
+    TwoPhase,
+    /// One pass over the symbolic Big-M objective, see basis::BigMBasisFinder.
+    BigM,
+};
+
+/**
+ * @brief Dense-tableau primal simplex method.
+ *
+ * Keeps B⁻¹A for all structural and artificial columns plus the reduced
+ * cost row in one Matrix<T> and pivots with Matrix::eliminate_column, so
+ * every pivot is a single pass over the tableau. Upper bounds are handled
+ * implicitly (nonbasic columns sit at either bound) and the basic values
+ * are kept next to the tableau. Feasibility comes from a phase 1 over one
+ * artificial per row, as in ModifiedSimplexSolver, or with
+ * StartMethod::BigM from a single pass that carries a second reduced-cost
+ * row for the M parts and prices both rows lexicographically.
+ *
+ * All sign tests go through the Tolerance policy, chosen at compile time:
+ * epsilon comparisons for floating-point types and plain exact comparisons
+ * for Fraction, so neither build carries the other's code.
+ *
+ * @tparam T Scalar type of the tableau.
+ * @tparam Tolerance Comparison policy, see Tolerance.hpp.
+ */
+template <typename T, typename Tolerance = DefaultTolerance<T>>
 class SimplexSolver {
 public:
+    struct Options {
+        std::size_t maxIterations{100000};
+        /// Rule used to choose the entering column, see Pricing.hpp.
+        PricingRule pricing{PricingRule::Dantzig};
+        /// Columns per chunk for PricingRule::Partial; 0 sizes chunks from the problem.
+        std::size_t partialPricingChunk{0};
+        /// When set, supplies the pricing strategy instead of `pricing`.
+        PricingFactory<T> pricingFactory;
+        /// Splits pricing and the ratio test over a thread pool for wide problems.
+        ParallelOptions parallel;
+        StartMethod start{StartMethod::TwoPhase};
+    };
+
     SimplexSolver() = default;
+    explicit SimplexSolver(Options options) : options(options) {}
+
+    const Options& getOptions() const { return options; }
+
+    /**
+     * @throws std::invalid_argument if the problem is malformed (see StandardForm::validate).
+     */
+    core::Solution<T> solve(const StandardForm<T>& problem) const { return solve(problem, core::BasisState{}); }
+
+    /**
+     * @brief Solves starting from `start`, typically the basisState of an
+     * earlier solve of the same problem with changed costs or right-hand
+     * sides, as ModifiedSimplexSolver::solve does.
+     *
+     * @throws std::invalid_argument if the problem is malformed, or `start` is
+     * neither empty nor has one status per column and row.
+     */
+    core::Solution<T> solve(const StandardForm<T>& problem, const core::BasisState& start) const {
+        problem.validate();
+        if (!start.empty() && (start.columns.size() != problem.cols() || start.rows.size() != problem.rows())) {
+            throw std::invalid_argument("SimplexSolver starting basis must have one status per column and row");
+        }
+        Tableau tableau(problem, options);
+        return tableau.run(start);
+    }
+
+private:
+    Options options;
+
+    static constexpr std::size_t kNone = std::numeric_limits<std::size_t>::max();
+    // Consecutive degenerate pivots after which Bland's rule takes over.
+    static constexpr std::size_t kDegenerateLimit = 50;
+
+    enum class VariableState {
+        Basic,
+        AtLower,
+        AtUpper,
+    };
+
+    class Tableau {
+    public:
+        Tableau(const StandardForm<T>& problem, const Options& options)
+            : problem(problem),
+              options(options),
+              rows(problem.rows()),
+              cols(problem.cols()),
+              bigM(options.start == StartMethod::BigM),
+              table(rows + (bigM ? 2 : 1), cols + rows),
+              upper(cols + rows),
+              signs(rows, true),
+              state(cols + rows, VariableState::AtLower),
+              basis(rows),
+              basicValues(rows),
+              pricing(options.pricingFactory ? options.pricingFactory()
+                                             : makePricing<T>(options.pricing, options.partialPricingChunk)) {
+            pricing->setParallel(options.parallel);
+            for (std::size_t j = 0; j < cols; ++j) {
+                if (problem.hasUpperBound(j)) {
+                    upper[j] = *problem.upperBounds[j];
+                }
+                const auto indices = problem.constraints.column_indices(j);
+                const auto values = problem.constraints.column_values(j);
+                for (std::size_t k = 0; k < indices.size(); ++k) {
+                    table(indices[k], j) = values[k];
+                }
+            }
+            // Rows with a negative right-hand side are negated so every
+            // artificial starts at |b_i| with an identity basis.
+            for (std::size_t i = 0; i < rows; ++i) {
+                signs[i] = !(problem.rhs[i] < T{});
+                basicValues[i] = signs[i] ? problem.rhs[i] : T{} - problem.rhs[i];
+                if (!signs[i]) {
+                    table.scale_row(i, T{-1});
+                }
+                table(i, cols + i) = T{1};
+                basis[i] = cols + i;
+                state[cols + i] = VariableState::Basic;
+            }
+        }
+
+        // Solves from the artificial basis, or from `start` when it is not
+        // empty; a start that is feasible after repair() skips phase 1.
+        core::Solution<T> run(const core::BasisState& start) {
+            if (!start.empty()) {
+                crash(start);
+                repair();
+            }
+            if (bigM) {
+                return runBigM();
+            }
+            // Phase 1 reduced costs with cost 1 on every artificial.
+            priceOut(rows, [&](std::size_t j) { return j < cols ? T{} : T{1}; });
+            if (start.empty() || !artificialsCleared()) {
+                resetPricing();
+                const core::SolutionStatus phaseOne = iterate();
+                if (phaseOne == core::SolutionStatus::IterationLimit) {
+                    return finish(phaseOne);
+                }
+            }
+            if (!artificialsCleared()) {
+                return finish(core::SolutionStatus::Infeasible);
+            }
+
+            driveOutArtificials();
+            for (std::size_t i = 0; i < rows; ++i) {
+                upper[cols + i] = T{};
+            }
+            priceOut(rows, [&](std::size_t j) { return j < cols ? problem.costs[j] : T{}; });
+            resetPricing();
+            return finish(iterate());
+        }
+
+    private:
+        const StandardForm<T>& problem;
+        const Options& options;
+        std::size_t rows;
+        std::size_t cols;
+        // Prices lexicographically over the M parts in row rows + 1 and the
+        // real parts in row rows until the artificials are out.
+        bool bigM;
+        numerics::Matrix<T> table;
+        std::vector<std::optional<T>> upper;
+        std::vector<bool> signs;
+        std::vector<VariableState> state;
+        std::vector<std::size_t> basis;
+        std::vector<T> basicValues;
+        std::unique_ptr<PricingStrategy<T>> pricing;
+        std::vector<T> columnProducts;
+        std::size_t iterations{0};
+        std::size_t degenerateSteps{0};
+
+        T nonbasicValue(std::size_t variable) const {
+            return state[variable] == VariableState::AtUpper ? *upper[variable] : T{};
+        }
+
+        bool isFixed(std::size_t variable) const { return upper[variable] && !Tolerance::isPositive(*upper[variable]); }
+
+        // Whether no basic artificial is positive, i.e. the basic solution
+        // satisfies Ax = b.
+        bool artificialsCleared() const {
+            for (std::size_t i = 0; i < rows; ++i) {
+                if (basis[i] >= cols && Tolerance::isPositive(basicValues[i])) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // Writes the reduced costs d = c - c_B B⁻¹A for the cost `cost(j)` of
+        // every variable into cost row `target`.
+        template <typename Cost>
+        void priceOut(std::size_t target, Cost cost) {
+            for (std::size_t j = 0; j < cols + rows; ++j) {
+                table(target, j) = cost(j);
+            }
+            for (std::size_t i = 0; i < rows; ++i) {
+                const T basicCost = cost(basis[i]);
+                if (basicCost != T{}) {
+                    table.add_scaled_row(target, i, T{} - basicCost);
+                }
+            }
+        }
+
+        // One lexicographic pass over the Big-M objective. Artificials left
+        // basic at zero are then driven out as in the two-phase method; the
+        // real row alone finishes off whatever those pivots disturbed.
+        core::Solution<T> runBigM() {
+            const auto objective = basis::BigMBasisFinder::objective<T>(problem.costs, rows);
+            priceOut(rows + 1, [&](std::size_t j) { return objective[j].big; });
+            priceOut(rows, [&](std::size_t j) { return objective[j].real; });
+            resetPricing();
+            const core::SolutionStatus status = iterate();
+            if (status == core::SolutionStatus::IterationLimit) {
+                return finish(status);
+            }
+            if (!artificialsCleared()) {
+                return finish(core::SolutionStatus::Infeasible);
+            }
+            if (status == core::SolutionStatus::Unbounded) {
+                return finish(status);
+            }
+
+            driveOutArtificials();
+            for (std::size_t i = 0; i < rows; ++i) {
+                upper[cols + i] = T{};
+            }
+            bigM = false;
+            resetPricing();
+            return finish(iterate());
+        }
+
+        // Starts the pricing strategy on a new phase; the exact steepest-edge
+        // norms 1 + ||B⁻¹a_j||² are read off the tableau columns.
+        void resetPricing() {
+            pricing->reset(cols + rows);
+            if (!pricing->needsExactWeights()) {
+                return;
+            }
+            std::vector<T> weights(cols + rows, T{1});
+            for (std::size_t i = 0; i < rows; ++i) {
+                const auto row = table.row(i);
+                for (std::size_t j = 0; j < cols + rows; ++j) {
+                    if (row[j] != T{}) {
+                        weights[j] = weights[j] + row[j] * row[j];
+                    }
+                }
+            }
+            for (std::size_t j = 0; j < cols + rows; ++j) {
+                pricing->setWeight(j, weights[j]);
+            }
+        }
+
+        // Asks the pricing strategy for the entering column over the reduced
+        // cost row, or takes the first eligible column under Bland's rule
+        // while pivots are degenerate.
+        std::size_t price() {
+            const auto gainIn = [&](std::size_t costRow, std::size_t j) -> std::optional<T> {
+                if (state[j] == VariableState::Basic || isFixed(j)) {
+                    return std::nullopt;
+                }
+                const T& reducedCost = table(costRow, j);
+                if (state[j] == VariableState::AtLower) {
+                    return Tolerance::isNegative(reducedCost) ? std::optional<T>(T{} - reducedCost) : std::nullopt;
+                }
+                return Tolerance::isPositive(reducedCost) ? std::optional<T>(reducedCost) : std::nullopt;
+            };
+            if (bigM) {
+                return priceBigM(gainIn);
+            }
+            const auto gain = [&](std::size_t j) { return gainIn(rows, j); };
+            if (degenerateSteps >= kDegenerateLimit) {
+                for (std::size_t j = 0; j < cols + rows; ++j) {
+                    if (gain(j)) {
+                        return j;
+                    }
+                }
+                return kNone;
+            }
+            return pricing->select(cols + rows, gain).value_or(kNone);
+        }
+
+        // Lexicographic pricing: columns that lower the M part first. Once
+        // none does, the artificials are at their minimum; if that is
+        // positive the problem is infeasible, otherwise the real parts of
+        // the columns with a zero M part take over.
+        template <typename GainIn>
+        std::size_t priceBigM(const GainIn& gainIn) {
+            const auto big = [&](std::size_t j) { return gainIn(rows + 1, j); };
+            const auto real = [&](std::size_t j) {
+                return Tolerance::isZero(table(rows + 1, j)) ? gainIn(rows, j) : std::nullopt;
+            };
+            if (degenerateSteps >= kDegenerateLimit) {
+                const bool cleared = artificialsCleared();
+                for (std::size_t j = 0; j < cols + rows; ++j) {
+                    if (state[j] == VariableState::Basic || isFixed(j)) {
+                        continue;
+                    }
+                    const int sign =
+                        basis::BigMBasisFinder::sign<Tolerance>(basis::BigMCost<T>{table(rows + 1, j), table(rows, j)});
+                    const bool improves = state[j] == VariableState::AtLower ? sign < 0 : sign > 0;
+                    if (improves && (cleared || big(j))) {
+                        return j;
+                    }
+                }
+                return kNone;
+            }
+            if (const std::optional<std::size_t> entering = pricing->select(cols + rows, big)) {
+                return *entering;
+            }
+            return artificialsCleared() ? pricing->select(cols + rows, real).value_or(kNone) : kNone;
+        }
+
+        // Feeds the strategy row `row` and column `entering` of the tableau
+        // and, for steepest edge, the column products α_jᵀα_q. Must run
+        // before the pivot.
+        void updatePricing(std::size_t row, std::size_t entering) {
+            if (!pricing->needsPivotRow()) {
+                return;
+            }
+            const auto pivotRow = table.row(row);
+            const std::vector<T> rowValues(pivotRow.begin(), pivotRow.end());
+            std::vector<T> pivotColumn(rows);
+            for (std::size_t i = 0; i < rows; ++i) {
+                pivotColumn[i] = table(i, entering);
+            }
+            columnProducts.assign(pricing->needsExactWeights() ? cols + rows : 0, T{});
+            if (pricing->needsExactWeights()) {
+                for (std::size_t i = 0; i < rows; ++i) {
+                    if (pivotColumn[i] == T{}) {
+                        continue;
+                    }
+                    const auto values = table.row(i);
+                    for (std::size_t j = 0; j < cols + rows; ++j) {
+                        if (values[j] != T{}) {
+                            columnProducts[j] = columnProducts[j] + pivotColumn[i] * values[j];
+                        }
+                    }
+                }
+            }
+            pricing->update({entering, basis[row], rowValues, pivotColumn, basis, columnProducts});
+        }
+
+        struct Step {
+            std::size_t row{kNone};
+            std::optional<T> theta;
+            bool leavesAtUpper{false};
+            bool boundFlip{false};
+        };
+
+        // Blocking limit of row i for a step along column `entering`, or
+        // nothing if the row does not block.
+        std::optional<T> rowLimit(std::size_t i, std::size_t entering, bool increasing, bool& toUpper) const {
+            const T rate = increasing ? table(i, entering) : T{} - table(i, entering);
+            T limit;
+            if (Tolerance::isPositive(rate)) {
+                limit = basicValues[i] / rate;
+                toUpper = false;
+            } else if (Tolerance::isNegative(rate) && upper[basis[i]]) {
+                limit = (*upper[basis[i]] - basicValues[i]) / (T{} - rate);
+                toUpper = true;
+            } else {
+                return std::nullopt;
+            }
+            return limit < T{} ? T{} : limit;
+        }
+
+        // Bounded ratio test on column `entering` in two passes, so chunked
+        // scans agree with sequential ones: the smallest step θ first, then
+        // among the rows reaching it the larger pivot (the smallest basic
+        // index under Bland's rule), remaining ties going to the lowest row.
+        Step ratioTest(std::size_t entering, bool increasing) const {
+            const bool bland = degenerateSteps >= kDegenerateLimit;
+            const std::optional<T> theta = parallelReduce(
+                options.parallel, rows,
+                [&](std::size_t begin, std::size_t end) {
+                    std::optional<T> smallest;
+                    bool toUpper = false;
+                    for (std::size_t i = begin; i < end; ++i) {
+                        const std::optional<T> limit = rowLimit(i, entering, increasing, toUpper);
+                        if (limit && (!smallest || *limit < *smallest)) {
+                            smallest = limit;
+                        }
+                    }
+                    return smallest;
+                },
+                [](const std::optional<T>& left, const std::optional<T>& right) {
+                    return right && (!left || *right < *left) ? right : left;
+                });
+
+            const auto magnitude = [&](std::size_t row) {
+                const T& rate = table(row, entering);
+                return rate < T{} ? T{} - rate : rate;
+            };
+            const auto prefer = [&](const Step& candidate, const Step& current) {
+                if (current.row == kNone) {
+                    return candidate.row != kNone;
+                }
+                if (candidate.row == kNone) {
+                    return false;
+                }
+                return bland ? basis[candidate.row] < basis[current.row]
+                             : magnitude(current.row) < magnitude(candidate.row);
+            };
+            Step step;
+            if (theta) {
+                step = parallelReduce(
+                    options.parallel, rows,
+                    [&](std::size_t begin, std::size_t end) {
+                        Step best;
+                        bool toUpper = false;
+                        for (std::size_t i = begin; i < end; ++i) {
+                            const std::optional<T> limit = rowLimit(i, entering, increasing, toUpper);
+                            if (!limit || *theta < *limit) {
+                                continue;
+                            }
+                            const Step candidate{i, limit, toUpper, false};
+                            if (prefer(candidate, best)) {
+                                best = candidate;
+                            }
+                        }
+                        return best;
+                    },
+                    [&](const Step& left, const Step& right) { return prefer(right, left) ? right : left; });
+            }
+            if (upper[entering] && (!step.theta || !(*step.theta < *upper[entering]))) {
+                step.row = kNone;
+                step.theta = *upper[entering];
+                step.boundFlip = true;
+            }
+            return step;
+        }
+
+        void pivot(std::size_t row, std::size_t entering, const T& enteringValue, bool leavesAtUpper) {
+            const std::size_t leaving = basis[row];
+            state[leaving] = leavesAtUpper ? VariableState::AtUpper : VariableState::AtLower;
+            state[entering] = VariableState::Basic;
+            basis[row] = entering;
+            basicValues[row] = enteringValue;
+            table.eliminate_column(row, entering);
+        }
+
+        core::SolutionStatus iterate() {
+            degenerateSteps = 0;
+            while (true) {
+                if (iterations >= options.maxIterations) {
+                    return core::SolutionStatus::IterationLimit;
+                }
+                const std::size_t entering = price();
+                if (entering == kNone) {
+                    return core::SolutionStatus::Optimal;
+                }
+                const bool increasing = state[entering] == VariableState::AtLower;
+                const Step step = ratioTest(entering, increasing);
+                if (!step.theta) {
+                    return core::SolutionStatus::Unbounded;
+                }
+
+                ++iterations;
+                const T& theta = *step.theta;
+                degenerateSteps = Tolerance::isZero(theta) ? degenerateSteps + 1 : 0;
+                if (theta != T{}) {
+                    const T delta = increasing ? theta : T{} - theta;
+                    for (std::size_t i = 0; i < rows; ++i) {
+                        const T& rate = table(i, entering);
+                        if (rate != T{}) {
+                            basicValues[i] = basicValues[i] - delta * rate;
+                        }
+                    }
+                }
+                if (step.boundFlip) {
+                    state[entering] = increasing ? VariableState::AtUpper : VariableState::AtLower;
+                    continue;
+                }
+                const T enteringValue = increasing ? nonbasicValue(entering) + theta : nonbasicValue(entering) - theta;
+                updatePricing(step.row, entering);
+                pivot(step.row, entering, enteringValue, step.leavesAtUpper);
+            }
+        }
+
+        // Largest-magnitude entry of column `variable` over the rows `eligible`
+        // accepts; the first non-zero one for exact types, where every choice
+        // is equally accurate.
+        template <typename Eligible>
+        std::size_t pivotRowFor(std::size_t variable, Eligible eligible) const {
+            std::size_t best = kNone;
+            for (std::size_t i = 0; i < rows; ++i) {
+                const T& value = table(i, variable);
+                if (!eligible(i) || Tolerance::isZero(value)) {
+                    continue;
+                }
+                if constexpr (Tolerance::isExact) {
+                    return i;
+                } else if (best == kNone || std::abs(table(best, variable)) < std::abs(value)) {
+                    best = i;
+                }
+            }
+            return best;
+        }
+
+        // Moves nonbasic `entering` by theta and pivots it in at `row`.
+        void exchange(std::size_t row, std::size_t entering, const T& theta, bool leavesAtUpper) {
+            for (std::size_t i = 0; i < rows; ++i) {
+                const T& rate = table(i, entering);
+                if (i != row && rate != T{}) {
+                    basicValues[i] = basicValues[i] - theta * rate;
+                }
+            }
+            pivot(row, entering, nonbasicValue(entering) + theta, leavesAtUpper);
+        }
+
+        // Puts the columns `start` marks at their upper bound there and
+        // pivots the ones it marks basic into the artificial basis, each on
+        // the row of a still-basic artificial with the largest entry. A
+        // column without such a row depends on those already in and stays
+        // nonbasic; rows `start` marks basic keep their artificial.
+        void crash(const core::BasisState& start) {
+            for (std::size_t j = 0; j < cols; ++j) {
+                if (start.columns[j] != core::BasisStatus::AtUpper || !upper[j]) {
+                    continue;
+                }
+                state[j] = VariableState::AtUpper;
+                for (std::size_t i = 0; i < rows; ++i) {
+                    if (table(i, j) != T{}) {
+                        basicValues[i] = basicValues[i] - table(i, j) * *upper[j];
+                    }
+                }
+            }
+            for (std::size_t j = 0; j < cols; ++j) {
+                if (start.columns[j] != core::BasisStatus::Basic) {
+                    continue;
+                }
+                const std::size_t row = pivotRowFor(j, [&](std::size_t i) {
+                    return basis[i] >= cols && start.rows[basis[i] - cols] != core::BasisStatus::Basic;
+                });
+                if (row != kNone) {
+                    exchange(row, j, basicValues[row] / table(row, j), false);
+                }
+            }
+        }
+
+        // Turns the crashed basis into a valid phase 1 start. A basic column
+        // outside its bounds is swapped for a nonbasic artificial with a
+        // non-zero entry in its row and left at the bound it violates; every
+        // swap removes a structural column, so this ends. Basic artificials
+        // left negative then change sign, which negates their row.
+        void repair() {
+            while (true) {
+                std::size_t row = kNone;
+                for (std::size_t i = 0; i < rows && row == kNone; ++i) {
+                    const std::size_t variable = basis[i];
+                    if (variable < cols && (Tolerance::isNegative(basicValues[i]) ||
+                                            (upper[variable] && Tolerance::isPositive(basicValues[i] - *upper[variable])))) {
+                        row = i;
+                    }
+                }
+                if (row == kNone) {
+                    break;
+                }
+                std::size_t entering = kNone;
+                for (std::size_t k = 0; k < rows && entering == kNone; ++k) {
+                    if (state[cols + k] != VariableState::Basic && !Tolerance::isZero(table(row, cols + k))) {
+                        entering = cols + k;
+                    }
+                }
+                if (entering == kNone) {
+                    break;
+                }
+                const bool toUpper = !Tolerance::isNegative(basicValues[row]);
+                const T bound = toUpper ? *upper[basis[row]] : T{};
+                exchange(row, entering, (basicValues[row] - bound) / table(row, entering), toUpper);
+            }
+            for (std::size_t i = 0; i < rows; ++i) {
+                if (basis[i] >= cols && basicValues[i] < T{}) {
+                    const std::size_t artificial = basis[i] - cols;
+                    table.scale_row(i, T{-1});
+                    table(i, cols + artificial) = T{1};
+                    basicValues[i] = T{} - basicValues[i];
+                    signs[artificial] = !signs[artificial];
+                }
+            }
+        }
+
+        // Pivots basic artificials (all at zero after a feasible phase 1)
+        // out on any structural column with a non-zero entry in their row.
+        // Rows without one are redundant and keep their artificial.
+        void driveOutArtificials() {
+            for (std::size_t r = 0; r < rows; ++r) {
+                if (basis[r] < cols) {
+                    continue;
+                }
+                for (std::size_t j = 0; j < cols; ++j) {
+                    if (state[j] != VariableState::Basic && !Tolerance::isZero(table(r, j))) {
+                        pivot(r, j, nonbasicValue(j), false);
+                        break;
+                    }
+                }
+            }
+        }
+
+        core::Solution<T> finish(core::SolutionStatus status) const {
+            core::Solution<T> solution;
+            solution.status = status;
+            solution.iterations = iterations;
+            solution.basis = basis;
+            solution.values.resize(cols);
+            for (std::size_t j = 0; j < cols; ++j) {
+                solution.values[j] = nonbasicValue(j);
+            }
+            for (std::size_t i = 0; i < rows; ++i) {
+                if (basis[i] < cols) {
+                    solution.values[basis[i]] = basicValues[i];
+                }
+            }
+            for (std::size_t j = 0; j < cols; ++j) {
+                solution.objective += problem.costs[j] * solution.values[j];
+            }
+            const auto statusOf = [&](std::size_t variable) {
+                switch (state[variable]) {
+                case VariableState::Basic:
+                    return core::BasisStatus::Basic;
+                case VariableState::AtUpper:
+                    return core::BasisStatus::AtUpper;
+                case VariableState::AtLower:
+                    break;
+                }
+                return core::BasisStatus::AtLower;
+            };
+            solution.basisState.columns.resize(cols);
+            for (std::size_t j = 0; j < cols; ++j) {
+                solution.basisState.columns[j] = statusOf(j);
+            }
+            solution.basisState.rows.resize(rows);
+            for (std::size_t i = 0; i < rows; ++i) {
+                solution.basisState.rows[i] = statusOf(cols + i);
+            }
+            if (status == core::SolutionStatus::Optimal) {
+                // The artificial of row i has column ±e_i and cost 0, so its
+                // reduced cost is ∓y_i.
+                solution.duals.resize(rows);
+                for (std::size_t i = 0; i < rows; ++i) {
+                    const T& reducedCost = table(rows, cols + i);
+                    solution.duals[i] = signs[i] ? T{} - reducedCost : reducedCost;
+                }
+                solution.reducedCosts.assign(table.row(rows).begin(), table.row(rows).begin() + cols);
+            }
+            return solution;
+        }
+    };
 };
 
+extern template class SimplexSolver<double>;
+extern template class SimplexSolver<numerics::fraction::Fraction>;
+
 } // namespace limo::simplex
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "limo/numerics/SparseMatrix.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+namespace limo::simplex {
+
+/**
+ * @brief Linear program in the computational form the simplex solvers work on:
+ *
+ *     minimize cᵀx  subject to  Ax = b,  0 <= x <= u
+ *
+ * A is kept in CSC layout so pricing can walk columns. An upper bound per
+ * column is optional; an empty upperBounds vector means no column has one.
+ * Right-hand sides may have any sign.
+ *
+ * @tparam T Scalar type of the coefficients.
+ */
+template <typename T>
+struct StandardForm {
+    numerics::SparseMatrix<T> constraints;
+    std::vector<T> rhs;
+    std::vector<T> costs;
+    std::vector<std::optional<T>> upperBounds;
+
+    std::size_t rows() const { return constraints.rows(); }
+    std::size_t cols() const { return constraints.cols(); }
+
+    bool hasUpperBound(std::size_t col) const { return !upperBounds.empty() && upperBounds[col].has_value(); }
+
+    /**
+     * @throws std::invalid_argument if the vectors do not match the matrix
+     * dimensions, the matrix is not CSC, or an upper bound is negative.
+     */
+    void validate() const {
+        if (constraints.layout() != numerics::SparseLayout::Csc) {
+            throw std::invalid_argument("StandardForm constraints must be stored in CSC layout");
+        }
+        if (rhs.size() != rows()) {
+            throw std::invalid_argument("StandardForm rhs size must match the number of rows");
+        }
+        if (costs.size() != cols()) {
+            throw std::invalid_argument("StandardForm costs size must match the number of columns");
+        }
+        if (!upperBounds.empty() && upperBounds.size() != cols()) {
+            throw std::invalid_argument("StandardForm upper bounds size must match the number of columns");
+        }
+        for (const std::optional<T>& bound : upperBounds) {
+            if (bound && *bound < T{}) {
+                throw std::invalid_argument("StandardForm upper bounds must be non-negative");
+            }
+        }
+    }
+};
+
+} // namespace limo::simplex
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cmath>
+#include <type_traits>
+
+namespace limo::simplex {
+
+/**
+ * @brief Comparison policy for exact scalar types such as Fraction.
+ *
+ * Every test is a plain comparison against zero; there is no epsilon and
+ * no absolute value anywhere in the generated code.
+ */
+template <typename T>
+struct ExactTolerance {
+    static constexpr bool isExact = true;
+
+    static bool isZero(const T& value) { return value == T{}; }
+    static bool isPositive(const T& value) { return T{} < value; }
+    static bool isNegative(const T& value) { return value < T{}; }
+};
+
+/**
+ * @brief Comparison policy for floating-point scalars: values within
+ * epsilon of zero are treated as zero.
+ */
+template <typename T>
+struct EpsilonTolerance {
+    static constexpr bool isExact = false;
+    static constexpr T epsilon = static_cast<T>(1e-9);
+
+    static bool isZero(const T& value) { return std::abs(value) <= epsilon; }
+    static bool isPositive(const T& value) { return value > epsilon; }
+    static bool isNegative(const T& value) { return value < -epsilon; }
+};
+
+/**
+ * @brief Epsilon comparisons for floating-point types, exact ones otherwise.
+ */
+template <typename T>
+using DefaultTolerance = std::conditional_t<std::is_floating_point_v<T>, EpsilonTolerance<T>, ExactTolerance<T>>;
+
+} // namespace limo::simplex
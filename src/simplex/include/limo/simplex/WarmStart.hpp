@@ -0,0 +1,47 @@
+#pragma once
+
+#include "limo/simplex/BasisFactorization.hpp"
+
+#include "limo/core/Solution.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace limo::simplex {
+
+/**
+ * @brief Writes the constraint column of one variable into a zeroed vector
+ * with one entry per row.
+ */
+using ColumnLoader = std::function<void(std::vector<double>&, std::size_t)>;
+
+/**
+ * @brief Replaces the basic variable of a row by a starting column, given
+ * that column's FTRAN result; see crashBasis().
+ */
+using CrashPivot = std::function<void(std::size_t row, std::size_t column, const std::vector<double>& alpha)>;
+
+/**
+ * @brief Factors the basis matrix whose i-th column is that of basis[i].
+ * @throws std::invalid_argument if the basis is singular.
+ */
+void factorizeBasis(BasisFactorization& factorization, const std::vector<std::size_t>& basis,
+                    const ColumnLoader& loadColumn);
+
+/**
+ * @brief Pivots the columns `start` marks basic into a logical basis.
+ *
+ * Variables below `structurals` are structural columns and structurals + i
+ * is the logical of row i. Each column `start` marks basic enters on the
+ * row of a still-basic logical where its FTRAN'd column is largest, through
+ * `pivot`, which must update `basis` and `factorization`. A column without
+ * a pivot of at least max(pivotTolerance, 1e-7 times its largest entry)
+ * depends on those already in and stays nonbasic; rows `start` marks basic
+ * keep their logical. The caller refactors afterwards.
+ */
+void crashBasis(const core::BasisState& start, std::size_t structurals, const std::vector<std::size_t>& basis,
+                const BasisFactorization& factorization, double pivotTolerance, const ColumnLoader& loadColumn,
+                const CrashPivot& pivot);
+
+} // namespace limo::simplex
@@ -0,0 +1,83 @@
+#include "limo/simplex/BasisFactorization.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace limo::simplex {
+
+namespace {
+
+// Entries of an eta vector below this magnitude are dropped; they are pure
+// round-off of the FTRAN that produced the column.
+constexpr double kDropTolerance = 1e-14;
+
+} // namespace
+
+BasisFactorization::BasisFactorization(std::size_t refactorizationInterval)
+    : refactorizationInterval(std::max<std::size_t>(refactorizationInterval, 1)) {}
+
+void BasisFactorization::factorize(const numerics::Matrix<double>& basisMatrix) {
+    lu.emplace(basisMatrix);
+    etas.clear();
+}
+
+std::size_t BasisFactorization::size() const {
+    return lu ? lu->size() : 0;
+}
+
+std::size_t BasisFactorization::updateCount() const {
+    return etas.size();
+}
+
+bool BasisFactorization::needsRefactorization() const {
+    return etas.size() >= refactorizationInterval;
+}
+
+void BasisFactorization::ftran(std::vector<double>& x) const {
+    if (!lu) {
+        throw std::logic_error("BasisFactorization used before factorize()");
+    }
+    x = lu->solve(x);
+    // B_k = B_0 E_1 ... E_k, so B_k⁻¹ applies the inverse etas in order.
+    for (const Eta& eta : etas) {
+        const double pivotValue = x[eta.row] / eta.pivot;
+        if (pivotValue == 0.0) {
+            continue;
+        }
+        for (std::size_t k = 0; k < eta.indices.size(); ++k) {
+            x[eta.indices[k]] -= eta.values[k] * pivotValue;
+        }
+        x[eta.row] = pivotValue;
+    }
+}
+
+void BasisFactorization::btran(std::vector<double>& y) const {
+    if (!lu) {
+        throw std::logic_error("BasisFactorization used before factorize()");
+    }
+    for (auto eta = etas.rbegin(); eta != etas.rend(); ++eta) {
+        double sum = y[eta->row];
+        for (std::size_t k = 0; k < eta->indices.size(); ++k) {
+            sum -= eta->values[k] * y[eta->indices[k]];
+        }
+        y[eta->row] = sum / eta->pivot;
+    }
+    y = lu->solve_transpose(y);
+}
+
+void BasisFactorization::update(std::size_t row, const std::vector<double>& column) {
+    if (column[row] == 0.0) {
+        throw std::invalid_argument("BasisFactorization update requires a non-zero pivot");
+    }
+    Eta eta{row, column[row], {}, {}};
+    for (std::size_t i = 0; i < column.size(); ++i) {
+        if (i != row && std::abs(column[i]) > kDropTolerance) {
+            eta.indices.push_back(i);
+            eta.values.push_back(column[i]);
+        }
+    }
+    etas.push_back(std::move(eta));
+}
+
+} // namespace limo::simplex
@@ -0,0 +1,198 @@
+#include "limo/simplex/CertifiedSolver.hpp"
+
+#include "limo/numerics/LU.hpp"
+#include "limo/numerics/Matrix.hpp"
+
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace limo::simplex {
+
+namespace {
+
+using numerics::fraction::Fraction;
+
+StandardForm<double> roundToDouble(const StandardForm<Fraction>& problem) {
+    numerics::SparseMatrix<double>::Builder builder(problem.rows(), problem.cols());
+    for (std::size_t col = 0; col < problem.cols(); ++col) {
+        const auto indices = problem.constraints.column_indices(col);
+        const auto values = problem.constraints.column_values(col);
+        for (std::size_t k = 0; k < indices.size(); ++k) {
+            builder.add(indices[k], col, values[k].toDouble());
+        }
+    }
+    StandardForm<double> rounded{builder.build(), {}, {}, {}};
+    rounded.rhs.reserve(problem.rows());
+    for (const Fraction& value : problem.rhs) {
+        rounded.rhs.push_back(value.toDouble());
+    }
+    rounded.costs.reserve(problem.cols());
+    for (const Fraction& cost : problem.costs) {
+        rounded.costs.push_back(cost.toDouble());
+    }
+    rounded.upperBounds.reserve(problem.upperBounds.size());
+    for (const std::optional<Fraction>& bound : problem.upperBounds) {
+        rounded.upperBounds.push_back(bound ? std::optional<double>(bound->toDouble()) : std::nullopt);
+    }
+    return rounded;
+}
+
+// The exact solution of `problem` at the final basis of `candidate`, or
+// nothing if that basis is singular, infeasible or not optimal in exact
+// arithmetic.
+std::optional<core::Solution<Fraction>> certify(const StandardForm<Fraction>& problem,
+                                                const core::Solution<double>& candidate) {
+    const std::size_t rows = problem.rows();
+    const std::size_t cols = problem.cols();
+    if (candidate.basis.size() != rows || candidate.basisState.columns.size() != cols) {
+        return std::nullopt;
+    }
+    // Basis row of every variable, or rows if it is nonbasic.
+    std::vector<std::size_t> positions(cols + rows, rows);
+    for (std::size_t i = 0; i < rows; ++i) {
+        const std::size_t variable = candidate.basis[i];
+        if (variable >= cols + rows || positions[variable] != rows) {
+            return std::nullopt;
+        }
+        positions[variable] = i;
+    }
+    const auto atUpper = [&](std::size_t col) {
+        return positions[col] == rows && problem.hasUpperBound(col) &&
+               candidate.basisState.columns[col] == core::BasisStatus::AtUpper;
+    };
+
+    core::Solution<Fraction> solution;
+    solution.values.assign(cols, Fraction{});
+    std::vector<Fraction> residual(problem.rhs);
+    numerics::Matrix<Fraction> basisMatrix(rows, rows);
+    for (std::size_t col = 0; col < cols; ++col) {
+        const auto indices = problem.constraints.column_indices(col);
+        const auto values = problem.constraints.column_values(col);
+        if (positions[col] != rows) {
+            for (std::size_t k = 0; k < indices.size(); ++k) {
+                basisMatrix(indices[k], positions[col]) = values[k];
+            }
+        } else if (atUpper(col)) {
+            const Fraction& bound = *problem.upperBounds[col];
+            solution.values[col] = bound;
+            for (std::size_t k = 0; k < indices.size(); ++k) {
+                residual[indices[k]] -= values[k] * bound;
+            }
+        }
+    }
+    for (std::size_t i = 0; i < rows; ++i) {
+        if (candidate.basis[i] >= cols) {
+            basisMatrix(candidate.basis[i] - cols, i) = Fraction(1);
+        }
+    }
+    std::optional<numerics::LU<Fraction>> factorization;
+    try {
+        factorization.emplace(basisMatrix);
+    } catch (const std::invalid_argument&) {
+        return std::nullopt;
+    }
+
+    // Primal feasibility: x_B = B⁻¹(b - N x_N) within the bounds, and any
+    // logical left basic (a redundant row) exactly zero.
+    const std::vector<Fraction> basicValues = factorization->solve(residual);
+    for (std::size_t i = 0; i < rows; ++i) {
+        const std::size_t variable = candidate.basis[i];
+        const Fraction& value = basicValues[i];
+        if (variable >= cols) {
+            if (value != Fraction{}) {
+                return std::nullopt;
+            }
+            continue;
+        }
+        if (value < Fraction{} || (problem.hasUpperBound(variable) && *problem.upperBounds[variable] < value)) {
+            return std::nullopt;
+        }
+        solution.values[variable] = value;
+    }
+
+    // Dual feasibility: with y = B⁻ᵀc_B, every nonbasic d_j = c_j - a_jᵀy
+    // must be >= 0 at the lower bound and <= 0 at the upper one.
+    std::vector<Fraction> basicCosts(rows);
+    for (std::size_t i = 0; i < rows; ++i) {
+        if (candidate.basis[i] < cols) {
+            basicCosts[i] = problem.costs[candidate.basis[i]];
+        }
+    }
+    solution.duals = factorization->solve_transpose(basicCosts);
+    solution.reducedCosts.assign(cols, Fraction{});
+    for (std::size_t col = 0; col < cols; ++col) {
+        if (positions[col] != rows) {
+            continue;
+        }
+        const auto indices = problem.constraints.column_indices(col);
+        const auto values = problem.constraints.column_values(col);
+        Fraction reducedCost = problem.costs[col];
+        for (std::size_t k = 0; k < indices.size(); ++k) {
+            reducedCost -= values[k] * solution.duals[indices[k]];
+        }
+        const bool fixed = problem.hasUpperBound(col) && *problem.upperBounds[col] == Fraction{};
+        if (!fixed && (atUpper(col) ? Fraction{} < reducedCost : reducedCost < Fraction{})) {
+            return std::nullopt;
+        }
+        solution.reducedCosts[col] = std::move(reducedCost);
+    }
+
+    solution.status = core::SolutionStatus::Optimal;
+    for (std::size_t col = 0; col < cols; ++col) {
+        if (solution.values[col] != Fraction{}) {
+            solution.objective += problem.costs[col] * solution.values[col];
+        }
+    }
+    solution.basis = candidate.basis;
+    solution.basisState.columns.resize(cols);
+    for (std::size_t col = 0; col < cols; ++col) {
+        solution.basisState.columns[col] = positions[col] != rows ? core::BasisStatus::Basic
+                                           : atUpper(col)         ? core::BasisStatus::AtUpper
+                                                                  : core::BasisStatus::AtLower;
+    }
+    solution.basisState.rows.resize(rows);
+    for (std::size_t i = 0; i < rows; ++i) {
+        solution.basisState.rows[i] =
+            positions[cols + i] != rows ? core::BasisStatus::Basic : core::BasisStatus::AtLower;
+    }
+    return solution;
+}
+
+} // namespace
+
+CertifiedSolver::CertifiedSolver(Options options) : options(options) {}
+
+const CertifiedSolver::Options& CertifiedSolver::getOptions() const {
+    return options;
+}
+
+CertifiedSolution CertifiedSolver::solve(const StandardForm<Fraction>& problem) const {
+    problem.validate();
+    const StandardForm<double> rounded = roundToDouble(problem);
+    const core::Solution<double> floating = options.floating == FloatingSolver::Tableau
+                                                ? SimplexSolver<double>(options.tableau).solve(rounded)
+                                                : ModifiedSimplexSolver(options.revised).solve(rounded);
+
+    CertifiedSolution result;
+    result.floatingIterations = floating.iterations;
+    if (floating.status == core::SolutionStatus::Optimal) {
+        if (std::optional<core::Solution<Fraction>> exact = certify(problem, floating)) {
+            result.solution = std::move(*exact);
+            result.solution.iterations = floating.iterations;
+            result.basisVerified = true;
+            return result;
+        }
+    }
+
+    const bool usable =
+        floating.basisState.columns.size() == problem.cols() && floating.basisState.rows.size() == problem.rows();
+    result.solution = SimplexSolver<Fraction>(options.exact).solve(problem, usable ? floating.basisState
+                                                                                     : core::BasisState{});
+    result.exactIterations = result.solution.iterations;
+    result.solution.iterations += floating.iterations;
+    return result;
+}
+
+} // namespace limo::simplex
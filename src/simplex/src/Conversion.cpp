@@ -0,0 +1,226 @@
+#include "limo/simplex/Conversion.hpp"
+
+#include <cmath>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+namespace limo::simplex {
+
+ConvertedProgram toStandardForm(const core::LinearProgram& program) {
+    using core::RowSense;
+
+    ConvertedProgram converted;
+    const std::size_t rows = program.rows();
+    const std::size_t cols = program.cols();
+    converted.senseSign_ = program.sense() == core::ObjectiveSense::Maximize ? -1.0 : 1.0;
+    converted.objectiveOffset_ = program.objectiveOffset();
+    converted.costs_.assign(program.objective().begin(), program.objective().end());
+    converted.mappings_.resize(cols);
+    converted.shifts_.resize(cols);
+    converted.formColumns_.resize(cols);
+
+    std::vector<double> rhs(program.rhs().begin(), program.rhs().end());
+    std::vector<double>& costs = converted.form_.costs;
+    std::vector<std::optional<double>>& upperBounds = converted.form_.upperBounds;
+    std::vector<std::size_t>& origins = converted.origins_;
+
+    for (std::size_t col = 0; col < cols; ++col) {
+        const double lower = program.columnLower()[col];
+        const double upper = program.columnUpper()[col];
+        const double cost = converted.senseSign_ * program.objective()[col];
+        converted.formColumns_[col] = costs.size();
+        if (std::isfinite(lower)) {
+            converted.mappings_[col] = ConvertedProgram::Mapping::Shifted;
+            converted.shifts_[col] = lower;
+            costs.push_back(cost);
+            upperBounds.push_back(std::isfinite(upper) ? std::optional<double>(upper - lower) : std::nullopt);
+        } else if (std::isfinite(upper)) {
+            converted.mappings_[col] = ConvertedProgram::Mapping::Mirrored;
+            converted.shifts_[col] = upper;
+            costs.push_back(-cost);
+            upperBounds.emplace_back();
+        } else {
+            converted.mappings_[col] = ConvertedProgram::Mapping::Split;
+            costs.push_back(cost);
+            costs.push_back(-cost);
+            upperBounds.emplace_back();
+            upperBounds.emplace_back();
+            origins.push_back(col);
+        }
+        origins.push_back(col);
+        // Move the shift's contribution to the right-hand side.
+        const double shift = converted.shifts_[col];
+        if (shift != 0.0) {
+            const core::SparseVectorView entries = program.column(col);
+            for (std::size_t k = 0; k < entries.size(); ++k) {
+                rhs[entries.indices[k]] -= entries.values[k] * shift;
+            }
+        }
+    }
+
+    converted.rowSenses_.assign(program.rowSenses().begin(), program.rowSenses().end());
+    std::vector<std::size_t>& slackColumns = converted.slackColumns_;
+    slackColumns.assign(rows, 0);
+    for (std::size_t row = 0; row < rows; ++row) {
+        const RowSense sense = program.rowSenses()[row];
+        if (sense == RowSense::Equal) {
+            continue;
+        }
+        slackColumns[row] = costs.size();
+        costs.push_back(0.0);
+        upperBounds.push_back(sense == RowSense::Ranged ? std::optional<double>(program.rowRanges()[row]) : std::nullopt);
+        origins.push_back(cols + row);
+    }
+
+    numerics::SparseMatrix<double>::Builder builder(rows, costs.size());
+    builder.reserve(program.nonZeros() + rows);
+    for (std::size_t col = 0; col < cols; ++col) {
+        const core::SparseVectorView entries = program.column(col);
+        const std::size_t formColumn = converted.formColumns_[col];
+        const bool mirrored = converted.mappings_[col] == ConvertedProgram::Mapping::Mirrored;
+        const bool split = converted.mappings_[col] == ConvertedProgram::Mapping::Split;
+        for (std::size_t k = 0; k < entries.size(); ++k) {
+            const double value = mirrored ? -entries.values[k] : entries.values[k];
+            builder.add(entries.indices[k], formColumn, value);
+            if (split) {
+                builder.add(entries.indices[k], formColumn + 1, -value);
+            }
+        }
+    }
+    for (std::size_t row = 0; row < rows; ++row) {
+        // aᵢx + s = b for <=, aᵢx - s = b for >= and ranged rows (s in [0, range]).
+        const RowSense sense = program.rowSenses()[row];
+        if (sense != RowSense::Equal) {
+            builder.add(row, slackColumns[row], sense == RowSense::LessEqual ? 1.0 : -1.0);
+        }
+    }
+    converted.form_.constraints = builder.build(numerics::SparseLayout::Csc);
+    converted.form_.rhs = std::move(rhs);
+    return converted;
+}
+
+core::Solution<double> ConvertedProgram::recover(const core::Solution<double>& solution) const {
+    const std::size_t cols = mappings_.size();
+    const std::size_t formCols = form_.cols();
+
+    core::Solution<double> recovered;
+    recovered.status = solution.status;
+    recovered.iterations = solution.iterations;
+
+    if (solution.values.size() == formCols) {
+        recovered.values.resize(cols);
+        recovered.objective = objectiveOffset_;
+        for (std::size_t col = 0; col < cols; ++col) {
+            const double value = solution.values[formColumns_[col]];
+            switch (mappings_[col]) {
+            case Mapping::Shifted:
+                recovered.values[col] = shifts_[col] + value;
+                break;
+            case Mapping::Mirrored:
+                recovered.values[col] = shifts_[col] - value;
+                break;
+            case Mapping::Split:
+                recovered.values[col] = value - solution.values[formColumns_[col] + 1];
+                break;
+            }
+            recovered.objective += costs_[col] * recovered.values[col];
+        }
+    }
+    if (!solution.duals.empty()) {
+        recovered.duals.resize(solution.duals.size());
+        for (std::size_t row = 0; row < solution.duals.size(); ++row) {
+            recovered.duals[row] = senseSign_ * solution.duals[row];
+        }
+    }
+    if (solution.reducedCosts.size() == formCols) {
+        recovered.reducedCosts.resize(cols);
+        for (std::size_t col = 0; col < cols; ++col) {
+            const double sign = mappings_[col] == Mapping::Mirrored ? -senseSign_ : senseSign_;
+            recovered.reducedCosts[col] = sign * solution.reducedCosts[formColumns_[col]];
+        }
+    }
+    recovered.basis.reserve(solution.basis.size());
+    for (const std::size_t variable : solution.basis) {
+        recovered.basis.push_back(variable < formCols ? origins_[variable] : cols + (variable - formCols));
+    }
+
+    const core::BasisState& formState = solution.basisState;
+    if (formState.columns.size() == formCols && formState.rows.size() == rowSenses_.size()) {
+        using core::BasisStatus;
+        core::BasisState& state = recovered.basisState;
+        state.columns.resize(cols);
+        for (std::size_t col = 0; col < cols; ++col) {
+            const BasisStatus status = formState.columns[formColumns_[col]];
+            switch (mappings_[col]) {
+            case Mapping::Shifted:
+                state.columns[col] = status;
+                break;
+            case Mapping::Mirrored:
+                state.columns[col] = status == BasisStatus::Basic ? status : BasisStatus::AtUpper;
+                break;
+            case Mapping::Split:
+                state.columns[col] = status == BasisStatus::Basic ||
+                                             formState.columns[formColumns_[col] + 1] == BasisStatus::Basic
+                                         ? BasisStatus::Basic
+                                         : BasisStatus::AtLower;
+                break;
+            }
+        }
+        state.rows.resize(rowSenses_.size());
+        for (std::size_t row = 0; row < rowSenses_.size(); ++row) {
+            if (rowSenses_[row] == core::RowSense::Equal) {
+                state.rows[row] = formState.rows[row] == BasisStatus::Basic ? BasisStatus::Basic : BasisStatus::AtLower;
+                continue;
+            }
+            // A slack at zero puts a <= row at its upper limit and the others
+            // (a x - s = b) at their lower one; a ranged slack at its range
+            // puts the row at its upper limit.
+            const BasisStatus slack = formState.columns[slackColumns_[row]];
+            if (slack == BasisStatus::Basic) {
+                state.rows[row] = BasisStatus::Basic;
+            } else if (rowSenses_[row] == core::RowSense::LessEqual || slack == BasisStatus::AtUpper) {
+                state.rows[row] = BasisStatus::AtUpper;
+            } else {
+                state.rows[row] = BasisStatus::AtLower;
+            }
+        }
+    }
+    return recovered;
+}
+
+core::BasisState ConvertedProgram::toFormBasis(const core::BasisState& state) const {
+    using core::BasisStatus;
+    const std::size_t cols = mappings_.size();
+    const std::size_t rows = rowSenses_.size();
+    if (state.columns.size() != cols || state.rows.size() != rows) {
+        throw std::invalid_argument("ConvertedProgram basis must have one status per column and row");
+    }
+
+    core::BasisState formState;
+    formState.columns.assign(form_.cols(), BasisStatus::AtLower);
+    formState.rows.assign(rows, BasisStatus::AtLower);
+    for (std::size_t col = 0; col < cols; ++col) {
+        const BasisStatus status = state.columns[col];
+        const std::size_t formColumn = formColumns_[col];
+        if (status == BasisStatus::Basic) {
+            // x⁺ carries a basic split column; the solver repairs a negative value.
+            formState.columns[formColumn] = BasisStatus::Basic;
+        } else if (mappings_[col] == Mapping::Shifted && status == BasisStatus::AtUpper) {
+            formState.columns[formColumn] = BasisStatus::AtUpper;
+        }
+    }
+    for (std::size_t row = 0; row < rows; ++row) {
+        const BasisStatus status = state.rows[row];
+        if (rowSenses_[row] == core::RowSense::Equal) {
+            formState.rows[row] = status == BasisStatus::Basic ? BasisStatus::Basic : BasisStatus::AtLower;
+        } else if (status == BasisStatus::Basic) {
+            formState.columns[slackColumns_[row]] = BasisStatus::Basic;
+        } else if (rowSenses_[row] == core::RowSense::Ranged && status == BasisStatus::AtUpper) {
+            formState.columns[slackColumns_[row]] = BasisStatus::AtUpper;
+        }
+    }
+    return formState;
+}
+
+} // namespace limo::simplex
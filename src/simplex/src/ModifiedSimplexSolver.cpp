@@ -1 +1,655 @@
 #include "limo/simplex/ModifiedSimplexSolver.hpp"
+
+#include "limo/simplex/BasisFactorization.hpp"
+#include "limo/simplex/WarmStart.hpp"
+
+#include "limo/numerics/Scaling.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+namespace limo::simplex {
+
+namespace {
+
+constexpr std::size_t kNone = std::numeric_limits<std::size_t>::max();
+constexpr double kInfinity = std::numeric_limits<double>::infinity();
+
+// Consecutive degenerate pivots after which pricing switches to Bland's rule
+// until the objective moves again, which rules out cycling.
+constexpr std::size_t kDegenerateLimit = 50;
+
+enum class VariableState {
+    Basic,
+    AtLower,
+    AtUpper,
+};
+
+/**
+ * State of one solve. Variables 0..n-1 are the structural columns, n + i is
+ * the artificial of row i with column sign(b_i) e_i, so every artificial
+ * starts out at |b_i| >= 0.
+ */
+class RevisedSimplex {
+public:
+    RevisedSimplex(const StandardForm<double>& problem, const ModifiedSimplexSolver::Options& options)
+        : problem(problem),
+          options(options),
+          rows(problem.rows()),
+          cols(problem.cols()),
+          signs(rows, 1.0),
+          upper(cols + rows, kInfinity),
+          costs(cols + rows, 0.0),
+          state(cols + rows, VariableState::AtLower),
+          basis(rows),
+          basicValues(rows),
+          factorization(options.refactorizationInterval),
+          pricing(options.pricingFactory ? options.pricingFactory()
+                                         : makePricing<double>(options.pricing, options.partialPricingChunk)) {
+        for (std::size_t j = 0; j < cols; ++j) {
+            if (problem.hasUpperBound(j)) {
+                upper[j] = *problem.upperBounds[j];
+            }
+        }
+        pricing->setParallel(options.parallel);
+        for (std::size_t i = 0; i < rows; ++i) {
+            signs[i] = problem.rhs[i] < 0.0 ? -1.0 : 1.0;
+            basis[i] = cols + i;
+            state[cols + i] = VariableState::Basic;
+        }
+    }
+
+    /**
+     * Solves from the artificial basis, or from `start` when it is not
+     * empty. A start that is primal feasible after repair() skips phase 1.
+     */
+    core::Solution<double> run(const core::BasisState& start) {
+        for (std::size_t i = 0; i < rows; ++i) {
+            costs[cols + i] = 1.0;
+        }
+        if (start.empty()) {
+            refactorize();
+        } else {
+            crash(start);
+            repair();
+        }
+        const double infeasibilityLimit = options.feasibilityTolerance * std::max(1.0, largestRhs());
+        if (start.empty() || phaseOneInfeasibility() > infeasibilityLimit) {
+            resetPricing();
+            const core::SolutionStatus status = iterate();
+            if (status == core::SolutionStatus::IterationLimit) {
+                return finish(status);
+            }
+        }
+        if (phaseOneInfeasibility() > infeasibilityLimit) {
+            return finish(core::SolutionStatus::Infeasible);
+        }
+
+        driveOutArtificials();
+        for (std::size_t i = 0; i < rows; ++i) {
+            costs[cols + i] = 0.0;
+            upper[cols + i] = 0.0;
+        }
+        for (std::size_t j = 0; j < cols; ++j) {
+            costs[j] = problem.costs[j];
+        }
+        refactorize();
+        resetPricing();
+        return finish(iterate());
+    }
+
+private:
+    const StandardForm<double>& problem;
+    const ModifiedSimplexSolver::Options& options;
+    std::size_t rows;
+    std::size_t cols;
+    std::vector<double> signs;
+    std::vector<double> upper;
+    std::vector<double> costs;
+    std::vector<VariableState> state;
+    std::vector<std::size_t> basis;
+    std::vector<double> basicValues;
+    BasisFactorization factorization;
+    std::unique_ptr<PricingStrategy<double>> pricing;
+    // Scratch space for the pricing weight updates.
+    std::vector<double> pivotRow;
+    std::vector<double> columnProducts;
+    std::size_t iterations{0};
+    std::size_t degenerateSteps{0};
+
+    bool isArtificial(std::size_t variable) const { return variable >= cols; }
+
+    double nonbasicValue(std::size_t variable) const {
+        return state[variable] == VariableState::AtUpper ? upper[variable] : 0.0;
+    }
+
+    double columnDot(const std::vector<double>& y, std::size_t variable) const {
+        if (isArtificial(variable)) {
+            return signs[variable - cols] * y[variable - cols];
+        }
+        const auto indices = problem.constraints.column_indices(variable);
+        const auto values = problem.constraints.column_values(variable);
+        double sum = 0.0;
+        for (std::size_t k = 0; k < indices.size(); ++k) {
+            sum += values[k] * y[indices[k]];
+        }
+        return sum;
+    }
+
+    void addColumn(std::vector<double>& target, std::size_t variable, double factor) const {
+        if (isArtificial(variable)) {
+            target[variable - cols] += factor * signs[variable - cols];
+            return;
+        }
+        const auto indices = problem.constraints.column_indices(variable);
+        const auto values = problem.constraints.column_values(variable);
+        for (std::size_t k = 0; k < indices.size(); ++k) {
+            target[indices[k]] += factor * values[k];
+        }
+    }
+
+    // Refactors the current basis and recomputes the basic values from
+    // scratch, which also discards the drift accumulated by the updates.
+    void refactorize() {
+        factorizeBasis(factorization, basis,
+                       [this](std::vector<double>& column, std::size_t variable) { addColumn(column, variable, 1.0); });
+
+        basicValues = problem.rhs;
+        for (std::size_t j = 0; j < cols + rows; ++j) {
+            if (state[j] == VariableState::AtUpper) {
+                addColumn(basicValues, j, -upper[j]);
+            }
+        }
+        factorization.ftran(basicValues);
+    }
+
+    std::vector<double> duals() const {
+        std::vector<double> y(rows);
+        for (std::size_t i = 0; i < rows; ++i) {
+            y[i] = costs[basis[i]];
+        }
+        factorization.btran(y);
+        return y;
+    }
+
+    // Fixed variables (upper bound zero, e.g. artificials in phase 2) never enter.
+    bool canEnter(std::size_t variable, double reducedCost) const {
+        if (upper[variable] <= 0.0) {
+            return false;
+        }
+        switch (state[variable]) {
+        case VariableState::AtLower:
+            return reducedCost < -options.optimalityTolerance;
+        case VariableState::AtUpper:
+            return reducedCost > options.optimalityTolerance;
+        case VariableState::Basic:
+            break;
+        }
+        return false;
+    }
+
+    // Starts the pricing strategy on a new phase. Steepest edge gets its
+    // exact reference norms 1 + ||B⁻¹a_j||² with one FTRAN per nonbasic column.
+    void resetPricing() {
+        pricing->reset(cols + rows);
+        if (!pricing->needsExactWeights()) {
+            return;
+        }
+        std::vector<double> alpha(rows);
+        for (std::size_t j = 0; j < cols + rows; ++j) {
+            if (state[j] == VariableState::Basic) {
+                continue;
+            }
+            std::fill(alpha.begin(), alpha.end(), 0.0);
+            addColumn(alpha, j, 1.0);
+            factorization.ftran(alpha);
+            pricing->setWeight(j, 1.0 + squaredNorm(alpha));
+        }
+    }
+
+    static double squaredNorm(const std::vector<double>& vector) {
+        double sum = 0.0;
+        for (double value : vector) {
+            sum += value * value;
+        }
+        return sum;
+    }
+
+    // Asks the pricing strategy for the entering column, or takes the first
+    // eligible one under Bland's rule while the solve is stalling on
+    // degenerate pivots.
+    std::size_t price(const std::vector<double>& y) {
+        if (degenerateSteps >= kDegenerateLimit) {
+            for (std::size_t j = 0; j < cols + rows; ++j) {
+                if (state[j] != VariableState::Basic && canEnter(j, costs[j] - columnDot(y, j))) {
+                    return j;
+                }
+            }
+            return kNone;
+        }
+        const std::optional<std::size_t> entering =
+            pricing->select(cols + rows, [&](std::size_t j) -> std::optional<double> {
+                if (state[j] == VariableState::Basic) {
+                    return std::nullopt;
+                }
+                const double reducedCost = costs[j] - columnDot(y, j);
+                if (!canEnter(j, reducedCost)) {
+                    return std::nullopt;
+                }
+                return std::abs(reducedCost);
+            });
+        return entering.value_or(kNone);
+    }
+
+    // Feeds the strategy the pivot row e_rᵀB⁻¹A and, for steepest edge, the
+    // products a_jᵀB⁻ᵀα_q. Must run before the basis changes.
+    void updatePricing(std::size_t row, std::size_t entering, const std::vector<double>& alpha) {
+        if (!pricing->needsPivotRow()) {
+            return;
+        }
+        const bool exact = pricing->needsExactWeights();
+        std::vector<double> rho(rows, 0.0);
+        rho[row] = 1.0;
+        factorization.btran(rho);
+        std::vector<double> tau;
+        if (exact) {
+            tau = alpha;
+            factorization.btran(tau);
+        }
+        pivotRow.assign(cols + rows, 0.0);
+        columnProducts.assign(exact ? cols + rows : 0, 0.0);
+        parallelFor(options.parallel, cols + rows, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t j = begin; j < end; ++j) {
+                if (state[j] == VariableState::Basic) {
+                    continue;
+                }
+                pivotRow[j] = columnDot(rho, j);
+                if (exact) {
+                    columnProducts[j] = columnDot(tau, j);
+                }
+            }
+        });
+        pivotRow[entering] = alpha[row];
+        pricing->update({entering, basis[row], pivotRow, alpha, basis, columnProducts});
+    }
+
+    struct Step {
+        std::size_t row{kNone};
+        double theta{kInfinity};
+        bool leavesAtUpper{false};
+        bool boundFlip{false};
+    };
+
+    // Blocking limit of row i for a step along `direction`, or nothing if
+    // the row does not block.
+    std::optional<double> rowLimit(const std::vector<double>& alpha, std::size_t i, double direction,
+                                   bool& toUpper) const {
+        const double rate = direction * alpha[i];
+        if (rate > options.pivotTolerance) {
+            toUpper = false;
+            return std::max(basicValues[i] / rate, 0.0);
+        }
+        if (rate < -options.pivotTolerance && upper[basis[i]] < kInfinity) {
+            toUpper = true;
+            return std::max((upper[basis[i]] - basicValues[i]) / -rate, 0.0);
+        }
+        return std::nullopt;
+    }
+
+    // Bounded ratio test in two passes, so that splitting the rows into
+    // chunks cannot change the outcome: first the smallest step θ, then among
+    // the rows blocking within 1e-12 of θ the largest pivot for stability (the
+    // smallest variable index under Bland's rule), remaining ties going to the
+    // lowest row.
+    Step ratioTest(const std::vector<double>& alpha, std::size_t entering, double direction) const {
+        const bool bland = degenerateSteps >= kDegenerateLimit;
+        const double theta = parallelReduce(
+            options.parallel, rows,
+            [&](std::size_t begin, std::size_t end) {
+                double smallest = kInfinity;
+                bool toUpper = false;
+                for (std::size_t i = begin; i < end; ++i) {
+                    if (const std::optional<double> limit = rowLimit(alpha, i, direction, toUpper)) {
+                        smallest = std::min(smallest, *limit);
+                    }
+                }
+                return smallest;
+            },
+            [](double left, double right) { return std::min(left, right); });
+
+        const auto prefer = [&](const Step& candidate, const Step& current) {
+            if (current.row == kNone) {
+                return candidate.row != kNone;
+            }
+            if (candidate.row == kNone) {
+                return false;
+            }
+            if (bland) {
+                return basis[candidate.row] < basis[current.row];
+            }
+            return std::abs(alpha[candidate.row]) > std::abs(alpha[current.row]);
+        };
+        Step step;
+        if (theta < kInfinity) {
+            step = parallelReduce(
+                options.parallel, rows,
+                [&](std::size_t begin, std::size_t end) {
+                    Step best;
+                    bool toUpper = false;
+                    for (std::size_t i = begin; i < end; ++i) {
+                        const std::optional<double> limit = rowLimit(alpha, i, direction, toUpper);
+                        if (!limit || *limit > theta + 1e-12) {
+                            continue;
+                        }
+                        const Step candidate{i, *limit, toUpper, false};
+                        if (prefer(candidate, best)) {
+                            best = candidate;
+                        }
+                    }
+                    return best;
+                },
+                [&](const Step& left, const Step& right) { return prefer(right, left) ? right : left; });
+        }
+        if (upper[entering] < kInfinity && upper[entering] <= step.theta) {
+            step.row = kNone;
+            step.theta = upper[entering];
+            step.boundFlip = true;
+        }
+        return step;
+    }
+
+    void pivot(std::size_t row, std::size_t entering, const std::vector<double>& alpha, double enteringValue,
+               bool leavesAtUpper) {
+        const std::size_t leaving = basis[row];
+        state[leaving] = leavesAtUpper ? VariableState::AtUpper : VariableState::AtLower;
+        state[entering] = VariableState::Basic;
+        basis[row] = entering;
+        basicValues[row] = enteringValue;
+        factorization.update(row, alpha);
+        if (factorization.needsRefactorization()) {
+            refactorize();
+        }
+    }
+
+    core::SolutionStatus iterate() {
+        degenerateSteps = 0;
+        std::vector<double> alpha(rows);
+        while (true) {
+            if (iterations >= options.maxIterations) {
+                return core::SolutionStatus::IterationLimit;
+            }
+            const std::size_t entering = price(duals());
+            if (entering == kNone) {
+                return core::SolutionStatus::Optimal;
+            }
+
+            std::fill(alpha.begin(), alpha.end(), 0.0);
+            addColumn(alpha, entering, 1.0);
+            factorization.ftran(alpha);
+
+            const double direction = state[entering] == VariableState::AtLower ? 1.0 : -1.0;
+            const Step step = ratioTest(alpha, entering, direction);
+            if (step.theta == kInfinity) {
+                return core::SolutionStatus::Unbounded;
+            }
+
+            ++iterations;
+            degenerateSteps = step.theta <= options.feasibilityTolerance ? degenerateSteps + 1 : 0;
+            for (std::size_t i = 0; i < rows; ++i) {
+                basicValues[i] -= direction * step.theta * alpha[i];
+            }
+            if (step.boundFlip) {
+                state[entering] =
+                    state[entering] == VariableState::AtLower ? VariableState::AtUpper : VariableState::AtLower;
+                continue;
+            }
+            const double enteringValue = nonbasicValue(entering) + direction * step.theta;
+            updatePricing(step.row, entering, alpha);
+            pivot(step.row, entering, alpha, enteringValue, step.leavesAtUpper);
+        }
+    }
+
+    // Pivots the columns `start` marks basic into the artificial basis; see
+    // crashBasis() for which columns make it in.
+    void crash(const core::BasisState& start) {
+        for (std::size_t j = 0; j < cols; ++j) {
+            if (start.columns[j] == core::BasisStatus::AtUpper && upper[j] < kInfinity) {
+                state[j] = VariableState::AtUpper;
+            }
+        }
+        refactorize();
+        crashBasis(
+            start, cols, basis, factorization, options.pivotTolerance,
+            [this](std::vector<double>& column, std::size_t variable) { addColumn(column, variable, 1.0); },
+            [this](std::size_t row, std::size_t column, const std::vector<double>& alpha) {
+                pivot(row, column, alpha, 0.0, false);
+            });
+        refactorize();
+    }
+
+    // Turns the crashed basis into a valid phase 1 start. A basic column
+    // outside its bounds is swapped for the nonbasic artificial with the
+    // largest entry in its row of B⁻¹ and left at the bound it violates;
+    // every swap removes a structural column, so this ends. Artificials
+    // left with negative values then change sign.
+    void repair() {
+        std::vector<double> rowOfInverse(rows);
+        while (true) {
+            std::size_t row = kNone;
+            for (std::size_t i = 0; i < rows && row == kNone; ++i) {
+                const std::size_t variable = basis[i];
+                if (!isArtificial(variable) && (basicValues[i] < -options.feasibilityTolerance ||
+                                                basicValues[i] > upper[variable] + options.feasibilityTolerance)) {
+                    row = i;
+                }
+            }
+            if (row == kNone) {
+                break;
+            }
+            std::fill(rowOfInverse.begin(), rowOfInverse.end(), 0.0);
+            rowOfInverse[row] = 1.0;
+            factorization.btran(rowOfInverse);
+            std::size_t entering = kNone;
+            double best = 0.0;
+            for (std::size_t k = 0; k < rows; ++k) {
+                if (state[cols + k] != VariableState::Basic && std::abs(rowOfInverse[k]) > best) {
+                    best = std::abs(rowOfInverse[k]);
+                    entering = cols + k;
+                }
+            }
+            if (entering == kNone) {
+                break;
+            }
+            const std::size_t leaving = basis[row];
+            state[leaving] = basicValues[row] < 0.0 ? VariableState::AtLower : VariableState::AtUpper;
+            state[entering] = VariableState::Basic;
+            basis[row] = entering;
+            refactorize();
+        }
+        bool flipped = false;
+        for (std::size_t i = 0; i < rows; ++i) {
+            if (isArtificial(basis[i]) && basicValues[i] < 0.0) {
+                signs[basis[i] - cols] = -signs[basis[i] - cols];
+                flipped = true;
+            }
+        }
+        if (flipped) {
+            refactorize();
+        }
+    }
+
+    double phaseOneInfeasibility() const {
+        double sum = 0.0;
+        for (std::size_t i = 0; i < rows; ++i) {
+            if (isArtificial(basis[i])) {
+                sum += std::abs(basicValues[i]);
+            }
+        }
+        return sum;
+    }
+
+    double largestRhs() const {
+        double largest = 0.0;
+        for (double value : problem.rhs) {
+            largest = std::max(largest, std::abs(value));
+        }
+        return largest;
+    }
+
+    // Replaces artificials that are still basic (at zero) by structural
+    // columns with a non-zero entry in their row of B⁻¹A. Rows without such
+    // a column are redundant and keep their artificial, fixed at zero.
+    void driveOutArtificials() {
+        std::vector<double> rowOfInverse(rows);
+        std::vector<double> alpha(rows);
+        for (std::size_t r = 0; r < rows; ++r) {
+            if (!isArtificial(basis[r])) {
+                continue;
+            }
+            std::fill(rowOfInverse.begin(), rowOfInverse.end(), 0.0);
+            rowOfInverse[r] = 1.0;
+            factorization.btran(rowOfInverse);
+
+            std::size_t entering = kNone;
+            double best = options.pivotTolerance;
+            for (std::size_t j = 0; j < cols; ++j) {
+                if (state[j] == VariableState::Basic) {
+                    continue;
+                }
+                const double value = std::abs(columnDot(rowOfInverse, j));
+                if (value > best) {
+                    best = value;
+                    entering = j;
+                }
+            }
+            if (entering == kNone) {
+                continue;
+            }
+            std::fill(alpha.begin(), alpha.end(), 0.0);
+            addColumn(alpha, entering, 1.0);
+            factorization.ftran(alpha);
+            pivot(r, entering, alpha, nonbasicValue(entering), false);
+        }
+    }
+
+    core::Solution<double> finish(core::SolutionStatus status) const {
+        core::Solution<double> solution;
+        solution.status = status;
+        solution.iterations = iterations;
+        solution.basis = basis;
+        solution.values.assign(cols, 0.0);
+        for (std::size_t j = 0; j < cols; ++j) {
+            solution.values[j] = nonbasicValue(j);
+        }
+        for (std::size_t i = 0; i < rows; ++i) {
+            if (!isArtificial(basis[i])) {
+                solution.values[basis[i]] = basicValues[i];
+            }
+        }
+        for (std::size_t j = 0; j < cols; ++j) {
+            solution.objective += problem.costs[j] * solution.values[j];
+        }
+        const auto statusOf = [&](std::size_t variable) {
+            switch (state[variable]) {
+            case VariableState::Basic:
+                return core::BasisStatus::Basic;
+            case VariableState::AtUpper:
+                return core::BasisStatus::AtUpper;
+            case VariableState::AtLower:
+                break;
+            }
+            return core::BasisStatus::AtLower;
+        };
+        solution.basisState.columns.resize(cols);
+        for (std::size_t j = 0; j < cols; ++j) {
+            solution.basisState.columns[j] = statusOf(j);
+        }
+        solution.basisState.rows.resize(rows);
+        for (std::size_t i = 0; i < rows; ++i) {
+            solution.basisState.rows[i] = statusOf(cols + i);
+        }
+        if (status == core::SolutionStatus::Optimal) {
+            solution.duals = duals();
+            solution.reducedCosts.resize(cols);
+            for (std::size_t j = 0; j < cols; ++j) {
+                solution.reducedCosts[j] = problem.costs[j] - columnDot(solution.duals, j);
+            }
+        }
+        return solution;
+    }
+};
+
+// The crash basis of `problem` as a start for RevisedSimplex::run: its
+// columns are basic and its artificial rows keep their logical.
+core::BasisState crashStart(const StandardForm<double>& problem, const basis::ArtificialBasisFinder::Options& options) {
+    const basis::CrashBasis crash =
+        basis::ArtificialBasisFinder(options).find(problem.constraints, problem.rhs, problem.costs, problem.upperBounds);
+    core::BasisState start;
+    start.columns.assign(problem.cols(), core::BasisStatus::AtLower);
+    start.rows.assign(problem.rows(), core::BasisStatus::AtLower);
+    for (std::size_t i = 0; i < problem.rows(); ++i) {
+        if (crash.rows[i] == basis::CrashBasis::kArtificial) {
+            start.rows[i] = core::BasisStatus::Basic;
+        } else {
+            start.columns[crash.rows[i]] = core::BasisStatus::Basic;
+        }
+    }
+    return start;
+}
+
+} // namespace
+
+ModifiedSimplexSolver::ModifiedSimplexSolver(Options options) : options(options) {}
+
+const ModifiedSimplexSolver::Options& ModifiedSimplexSolver::getOptions() const {
+    return options;
+}
+
+core::Solution<double> ModifiedSimplexSolver::solve(const StandardForm<double>& problem) const {
+    return solve(problem, core::BasisState{});
+}
+
+core::Solution<double> ModifiedSimplexSolver::solve(const StandardForm<double>& problem,
+                                                    const core::BasisState& start) const {
+    problem.validate();
+    if (!start.empty() && (start.columns.size() != problem.cols() || start.rows.size() != problem.rows())) {
+        throw std::invalid_argument("ModifiedSimplexSolver starting basis must have one status per column and row");
+    }
+    const bool crash = start.empty() && options.crash;
+    if (!options.scaling) {
+        return RevisedSimplex(problem, options).run(crash ? crashStart(problem, options.crashOptions) : start);
+    }
+
+    // Solve min (Cc)ᵀx̂ s.t. (RAC)x̂ = Rb, x̂ <= C⁻¹u and map back x = Cx̂, y = Rŷ, d = C⁻¹d̂.
+    StandardForm<double> scaled = problem;
+    const numerics::ScaleFactors<double> factors = numerics::scale(scaled.constraints, options.scalingOptions);
+    numerics::unscale_rows(scaled.rhs, factors);
+    numerics::unscale_columns(scaled.costs, factors);
+    for (std::size_t j = 0; j < scaled.upperBounds.size(); ++j) {
+        if (scaled.upperBounds[j]) {
+            *scaled.upperBounds[j] /= factors.cols[j];
+        }
+    }
+
+    core::Solution<double> solution =
+        RevisedSimplex(scaled, options).run(crash ? crashStart(scaled, options.crashOptions) : start);
+    numerics::unscale_columns(solution.values, factors);
+    solution.objective = 0.0;
+    for (std::size_t j = 0; j < problem.cols(); ++j) {
+        solution.objective += problem.costs[j] * solution.values[j];
+    }
+    if (!solution.duals.empty()) {
+        numerics::unscale_rows(solution.duals, factors);
+    }
+    for (std::size_t j = 0; j < solution.reducedCosts.size(); ++j) {
+        solution.reducedCosts[j] /= factors.cols[j];
+    }
+    return solution;
+}
+
+} // namespace limo::simplex
@@ -0,0 +1,19 @@
+#include "limo/simplex/Pricing.hpp"
+
+namespace limo::simplex {
+
+const char* toString(PricingRule rule) {
+    switch (rule) {
+    case PricingRule::Dantzig:
+        return "dantzig";
+    case PricingRule::Partial:
+        return "partial";
+    case PricingRule::Devex:
+        return "devex";
+    case PricingRule::SteepestEdge:
+        return "steepest edge";
+    }
+    return "unknown";
+}
+
+} // namespace limo::simplex
@@ -1 +1,8 @@
 #include "limo/simplex/SimplexSolver.hpp"
+
+namespace limo::simplex {
+
+template class SimplexSolver<double>;
+template class SimplexSolver<numerics::fraction::Fraction>;
+
+} // namespace limo::simplex
@@ -0,0 +1,71 @@
+#include "limo/simplex/WarmStart.hpp"
+
+#include "limo/numerics/Matrix.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace limo::simplex {
+
+namespace {
+
+constexpr std::size_t kNone = std::numeric_limits<std::size_t>::max();
+
+// Smallest pivot, relative to the largest entry of the FTRAN'd column, with
+// which a starting column is pivoted into the basis.
+constexpr double kCrashPivotTolerance = 1e-7;
+
+} // namespace
+
+void factorizeBasis(BasisFactorization& factorization, const std::vector<std::size_t>& basis,
+                    const ColumnLoader& loadColumn) {
+    const std::size_t rows = basis.size();
+    numerics::Matrix<double> basisMatrix(rows, rows);
+    std::vector<double> column(rows);
+    for (std::size_t i = 0; i < rows; ++i) {
+        std::fill(column.begin(), column.end(), 0.0);
+        loadColumn(column, basis[i]);
+        for (std::size_t r = 0; r < rows; ++r) {
+            basisMatrix(r, i) = column[r];
+        }
+    }
+    factorization.factorize(basisMatrix);
+}
+
+void crashBasis(const core::BasisState& start, std::size_t structurals, const std::vector<std::size_t>& basis,
+                const BasisFactorization& factorization, double pivotTolerance, const ColumnLoader& loadColumn,
+                const CrashPivot& pivot) {
+    const std::size_t rows = basis.size();
+    std::vector<double> alpha(rows);
+    for (std::size_t j = 0; j < start.columns.size(); ++j) {
+        if (start.columns[j] != core::BasisStatus::Basic) {
+            continue;
+        }
+        std::fill(alpha.begin(), alpha.end(), 0.0);
+        loadColumn(alpha, j);
+        factorization.ftran(alpha);
+        double largest = 0.0;
+        for (const double value : alpha) {
+            largest = std::max(largest, std::abs(value));
+        }
+        std::size_t row = kNone;
+        double best = std::max(pivotTolerance, kCrashPivotTolerance * largest);
+        for (std::size_t i = 0; i < rows; ++i) {
+            if (basis[i] < structurals) {
+                continue;
+            }
+            const std::size_t logical = basis[i] - structurals;
+            const bool keepsLogical = logical < start.rows.size() && start.rows[logical] == core::BasisStatus::Basic;
+            if (!keepsLogical && std::abs(alpha[i]) > best) {
+                best = std::abs(alpha[i]);
+                row = i;
+            }
+        }
+        if (row != kNone) {
+            pivot(row, j, alpha);
+        }
+    }
+}
+
+} // namespace limo::simplex
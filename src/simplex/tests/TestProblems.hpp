@@ -0,0 +1,92 @@
+#pragma once
+
+#include "limo/simplex/StandardForm.hpp"
+
+#include "limo/numerics/Matrix.hpp"
+#include "limo/numerics/SparseMatrix.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * Small StandardForm programs shared by the solver test suites. T is
+ * spelled out (makeProblem<Fraction>) for anything but double.
+ */
+namespace limo::simplex::testing {
+
+template <typename T = double>
+StandardForm<T> makeProblem(const numerics::Matrix<std::type_identity_t<T>>& constraints,
+                            std::vector<std::type_identity_t<T>> rhs, std::vector<std::type_identity_t<T>> costs,
+                            std::vector<std::optional<std::type_identity_t<T>>> upperBounds = {}) {
+    return {numerics::SparseMatrix<T>::from_dense(constraints), std::move(rhs), std::move(costs),
+            std::move(upperBounds)};
+}
+
+// max 3x + 5y  s.t.  x <= 4, 2y <= 12, 3x + 2y <= 18, written with slacks.
+template <typename T = double>
+StandardForm<T> textbookProblem() {
+    return makeProblem<T>({{1, 0, 1, 0, 0}, {0, 2, 0, 1, 0}, {3, 2, 0, 0, 1}}, {4, 12, 18}, {-3, -5, 0, 0, 0});
+}
+
+// Ships from two plants with capacities 20 and 35 (slacks s1, s2) to three
+// markets demanding exactly 10, 25 and 15, at unit costs 8 6 10 / 9 12 13.
+// Columns are x11 x12 x13 x21 x22 x23 s1 s2. The optimum 465 ships x12 = 20,
+// x21 = 10, x22 = 5, x23 = 15 and leaves s2 = 5; it is unique and not
+// degenerate, with duals (-6, 0, 9, 12, 13).
+template <typename T = double>
+StandardForm<T> transportationProblem() {
+    return makeProblem<T>({{1, 1, 1, 0, 0, 0, 1, 0},
+                           {0, 0, 0, 1, 1, 1, 0, 1},
+                           {1, 0, 0, 1, 0, 0, 0, 0},
+                           {0, 1, 0, 0, 1, 0, 0, 0},
+                           {0, 0, 1, 0, 0, 1, 0, 0}},
+                          {20, 35, 10, 25, 15}, {8, 6, 10, 9, 12, 13, 0, 0});
+}
+
+/**
+ * Shape of randomFeasibleProblem(): coefficients and costs k / d with k in
+ * [lowest, highest] and d in [1, maxDenominator], every column boxed in
+ * [0, upperBound], and the right-hand side A x̂ for the point
+ * x̂_c = pointOffset + (c % 3) * pointStep inside that box.
+ */
+template <typename T = double>
+struct RandomProblemShape {
+    int lowest{-4};
+    int highest{6};
+    int maxDenominator{1};
+    T upperBound{4};
+    T pointOffset{0};
+    T pointStep{1};
+};
+
+// Dense random program, feasible through x̂ and bounded by its box, so every
+// solver must reach an optimum. Draws only from `rng`, so a seed fixes it.
+template <typename T = double>
+StandardForm<T> randomFeasibleProblem(std::mt19937& rng, std::size_t rows, std::size_t cols,
+                                      const RandomProblemShape<std::type_identity_t<T>>& shape = {}) {
+    std::uniform_int_distribution<int> numerator(shape.lowest, shape.highest);
+    std::uniform_int_distribution<int> denominator(1, shape.maxDenominator);
+    const auto draw = [&]() {
+        const T value(numerator(rng));
+        return shape.maxDenominator > 1 ? value / T(denominator(rng)) : value;
+    };
+    numerics::Matrix<T> constraints(rows, cols);
+    std::vector<T> rhs(rows, T{});
+    std::vector<T> costs(cols);
+    for (std::size_t c = 0; c < cols; ++c) {
+        costs[c] = draw();
+        const T point = shape.pointOffset + T(static_cast<int>(c % 3)) * shape.pointStep;
+        for (std::size_t r = 0; r < rows; ++r) {
+            constraints(r, c) = draw();
+            rhs[r] = rhs[r] + constraints(r, c) * point;
+        }
+    }
+    return makeProblem<T>(constraints, std::move(rhs), std::move(costs),
+                          std::vector<std::optional<T>>(cols, shape.upperBound));
+}
+
+} // namespace limo::simplex::testing
@@ -0,0 +1,75 @@
+#include "limo/simplex/BasisFactorization.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using limo::numerics::Matrix;
+using limo::simplex::BasisFactorization;
+
+namespace {
+
+std::vector<double> multiply(const Matrix<double>& matrix, const std::vector<double>& x) {
+    std::vector<double> result(matrix.rows(), 0.0);
+    for (std::size_t r = 0; r < matrix.rows(); ++r) {
+        for (std::size_t c = 0; c < matrix.cols(); ++c) {
+            result[r] += matrix(r, c) * x[c];
+        }
+    }
+    return result;
+}
+
+void expectNear(const std::vector<double>& actual, const std::vector<double>& expected) {
+    ASSERT_EQ(actual.size(), expected.size());
+    for (std::size_t i = 0; i < actual.size(); ++i) {
+        EXPECT_NEAR(actual[i], expected[i], 1e-10) << "index " << i;
+    }
+}
+
+} // namespace
+
+TEST(BasisFactorizationTests, UpdatesMatchAFreshFactorization) {
+    Matrix<double> basis = {{2.0, 0.0, 1.0}, {1.0, 3.0, 0.0}, {0.0, 1.0, 4.0}};
+    BasisFactorization factorization(2);
+    factorization.factorize(basis);
+    EXPECT_EQ(factorization.size(), 3u);
+
+    const std::vector<std::vector<double>> entering = {{1.0, 1.0, 1.0}, {0.0, 2.0, -1.0}};
+    const std::size_t rows[] = {1, 0};
+    for (std::size_t step = 0; step < entering.size(); ++step) {
+        std::vector<double> alpha = entering[step];
+        factorization.ftran(alpha);
+        factorization.update(rows[step], alpha);
+        for (std::size_t r = 0; r < 3; ++r) {
+            basis(r, rows[step]) = entering[step][r];
+        }
+    }
+    EXPECT_EQ(factorization.updateCount(), 2u);
+    EXPECT_TRUE(factorization.needsRefactorization());
+
+    const std::vector<double> rhs = {1.0, -2.0, 0.5};
+    std::vector<double> x = rhs;
+    factorization.ftran(x);
+    expectNear(multiply(basis, x), rhs);
+
+    std::vector<double> y = rhs;
+    factorization.btran(y);
+    expectNear(multiply(basis.transpose(), y), rhs);
+
+    factorization.factorize(basis);
+    EXPECT_EQ(factorization.updateCount(), 0u);
+    std::vector<double> fresh = rhs;
+    factorization.ftran(fresh);
+    expectNear(fresh, x);
+}
+
+TEST(BasisFactorizationTests, RejectsMisuse) {
+    BasisFactorization factorization;
+    std::vector<double> x = {1.0};
+    EXPECT_THROW(factorization.ftran(x), std::logic_error);
+    EXPECT_THROW(factorization.btran(x), std::logic_error);
+    EXPECT_THROW(factorization.factorize(Matrix<double>{{1.0, 1.0}, {1.0, 1.0}}), std::invalid_argument);
+
+    factorization.factorize(Matrix<double>{{1.0, 0.0}, {0.0, 1.0}});
+    EXPECT_THROW(factorization.update(0, {0.0, 1.0}), std::invalid_argument);
+}
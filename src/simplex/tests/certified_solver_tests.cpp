@@ -0,0 +1,125 @@
+#include "limo/simplex/CertifiedSolver.hpp"
+
+#include "TestProblems.hpp"
+
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using limo::core::BasisStatus;
+using limo::core::SolutionStatus;
+using limo::numerics::fraction::Fraction;
+using limo::simplex::CertifiedSolver;
+using limo::simplex::FloatingSolver;
+using limo::simplex::SimplexSolver;
+using limo::simplex::testing::makeProblem;
+using limo::simplex::testing::randomFeasibleProblem;
+using limo::simplex::testing::RandomProblemShape;
+using limo::simplex::testing::textbookProblem;
+using limo::simplex::testing::transportationProblem;
+
+TEST(CertifiedSolverTests, VerifiesTheFloatingPointBasis) {
+    for (const FloatingSolver floating : {FloatingSolver::Revised, FloatingSolver::Tableau}) {
+        CertifiedSolver::Options options;
+        options.floating = floating;
+        const auto result = CertifiedSolver(options).solve(textbookProblem<Fraction>());
+
+        ASSERT_EQ(result.solution.status, SolutionStatus::Optimal);
+        EXPECT_TRUE(result.basisVerified);
+        EXPECT_EQ(result.exactIterations, 0u);
+        EXPECT_GT(result.floatingIterations, 0u);
+        EXPECT_EQ(result.solution.objective, Fraction(-36));
+        EXPECT_EQ(result.solution.values[0], Fraction(2));
+        EXPECT_EQ(result.solution.values[1], Fraction(6));
+        EXPECT_EQ(result.solution.duals, (std::vector<Fraction>{Fraction(0), Fraction(-3, 2), Fraction(-1)}));
+        EXPECT_EQ(result.solution.reducedCosts[3], Fraction(3, 2));
+        EXPECT_EQ(result.solution.basisState.columns[0], BasisStatus::Basic);
+        EXPECT_EQ(result.solution.basisState.columns[3], BasisStatus::AtLower);
+    }
+}
+
+TEST(CertifiedSolverTests, ReturnsExactRationalValues) {
+    // min -x1 - x2  s.t.  3 x1 + x2 <= 7/3,  x1 + 3 x2 <= 2,  x2 <= 1/3: thirds
+    // that double cannot hold, yet the vertex (2/3, 1/3) with x2 at its upper
+    // bound and its duals come out exact.
+    const auto problem = makeProblem<Fraction>({{3, 1, 1, 0}, {1, 3, 0, 1}}, {Fraction(7, 3), Fraction(2)},
+                                               {Fraction(-1), Fraction(-1), Fraction(0), Fraction(0)},
+                                               {std::nullopt, Fraction(1, 3), std::nullopt, std::nullopt});
+    const auto result = CertifiedSolver().solve(problem);
+    const auto exact = SimplexSolver<Fraction>().solve(problem);
+    ASSERT_EQ(result.solution.status, SolutionStatus::Optimal);
+    EXPECT_TRUE(result.basisVerified);
+    EXPECT_EQ(result.solution.values[0], Fraction(2, 3));
+    EXPECT_EQ(result.solution.values[1], Fraction(1, 3));
+    EXPECT_EQ(result.solution.basisState.columns[1], BasisStatus::AtUpper);
+    EXPECT_EQ(result.solution.objective, exact.objective);
+    EXPECT_EQ(result.solution.values, exact.values);
+    EXPECT_EQ(result.solution.duals, exact.duals);
+}
+
+TEST(CertifiedSolverTests, CertifiesTheTransportationProblem) {
+    const auto result = CertifiedSolver().solve(transportationProblem<Fraction>());
+    ASSERT_EQ(result.solution.status, SolutionStatus::Optimal);
+    EXPECT_TRUE(result.basisVerified);
+    EXPECT_EQ(result.solution.objective, Fraction(465));
+    const std::vector<Fraction> values{0, 20, 0, 10, 5, 15, 0, 5};
+    EXPECT_EQ(result.solution.values, values);
+    const std::vector<Fraction> duals{-6, 0, 9, 12, 13};
+    EXPECT_EQ(result.solution.duals, duals);
+    EXPECT_EQ(result.solution.basisState.columns[6], BasisStatus::AtLower);
+    EXPECT_EQ(result.solution.basisState.columns[7], BasisStatus::Basic);
+}
+
+TEST(CertifiedSolverTests, RepairsABasisThatFailsTheCheck) {
+    // The cost of y is below that of x by 10⁻¹⁸, which rounds away in double:
+    // the floating-point solve stops at x = 1, and only exact pivots find y.
+    const Fraction cheaper(-1000000000000000001, 1000000000000000000);
+    const auto problem = makeProblem<Fraction>({{1, 1, 1}}, {1}, {Fraction(-1), cheaper, Fraction(0)});
+    const auto result = CertifiedSolver().solve(problem);
+    ASSERT_EQ(result.solution.status, SolutionStatus::Optimal);
+    EXPECT_FALSE(result.basisVerified);
+    EXPECT_GT(result.exactIterations, 0u);
+    EXPECT_EQ(result.solution.values[1], Fraction(1));
+    EXPECT_EQ(result.solution.objective, cheaper);
+
+    // An iteration limit in double hands its basis over as well.
+    CertifiedSolver::Options limited;
+    limited.revised.maxIterations = 1;
+    const auto repaired = CertifiedSolver(limited).solve(textbookProblem<Fraction>());
+    ASSERT_EQ(repaired.solution.status, SolutionStatus::Optimal);
+    EXPECT_FALSE(repaired.basisVerified);
+    EXPECT_EQ(repaired.solution.objective, Fraction(-36));
+}
+
+TEST(CertifiedSolverTests, CertifiesInfeasibleAndUnboundedProblems) {
+    EXPECT_EQ(CertifiedSolver().solve(makeProblem<Fraction>({{1, 1}}, {-1}, {1, 1})).solution.status,
+              SolutionStatus::Infeasible);
+    EXPECT_EQ(CertifiedSolver().solve(makeProblem<Fraction>({{1, -1}}, {1}, {-1, 0})).solution.status,
+              SolutionStatus::Unbounded);
+    EXPECT_THROW(CertifiedSolver().solve(makeProblem<Fraction>({{1, 1}}, {1, 2}, {1, 1})), std::invalid_argument);
+}
+
+TEST(CertifiedSolverTests, AgreesWithTheExactSolverOnRandomProblems) {
+    std::mt19937 rng(61);
+    RandomProblemShape<Fraction> shape;
+    shape.lowest = -3;
+    shape.highest = 5;
+    shape.maxDenominator = 7;
+    shape.upperBound = Fraction(3);
+    shape.pointStep = Fraction(1, 2);
+    std::size_t verified = 0;
+    for (int trial = 0; trial < 15; ++trial) {
+        const auto problem = randomFeasibleProblem<Fraction>(rng, 5, 12, shape);
+        const auto result = CertifiedSolver().solve(problem);
+        const auto exact = SimplexSolver<Fraction>().solve(problem);
+        ASSERT_EQ(result.solution.status, exact.status) << "trial " << trial;
+        ASSERT_EQ(result.solution.status, SolutionStatus::Optimal) << "trial " << trial;
+        EXPECT_EQ(result.solution.objective, exact.objective) << "trial " << trial;
+        EXPECT_EQ(problem.constraints.multiply(result.solution.values), problem.rhs) << "trial " << trial;
+        verified += result.basisVerified ? 1 : 0;
+    }
+    EXPECT_GE(verified, 12u);
+}
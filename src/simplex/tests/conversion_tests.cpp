@@ -0,0 +1,125 @@
+#include "limo/simplex/Conversion.hpp"
+#include "limo/simplex/ModifiedSimplexSolver.hpp"
+#include "limo/simplex/SimplexSolver.hpp"
+
+#include "limo/core/LinearProgramBuilder.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <vector>
+
+using limo::core::BasisStatus;
+using limo::core::kInfinity;
+using limo::core::LinearProgram;
+using limo::core::LinearProgramBuilder;
+using limo::core::ObjectiveSense;
+using limo::core::RowSense;
+using limo::core::SolutionStatus;
+using limo::simplex::ModifiedSimplexSolver;
+using limo::simplex::SimplexSolver;
+using limo::simplex::toStandardForm;
+
+namespace {
+
+// max 3x + 5y  s.t.  x <= 4,  2y <= 12,  3x + 2y <= 18
+LinearProgram textbook() {
+    LinearProgramBuilder builder;
+    builder.setSense(ObjectiveSense::Maximize);
+    const std::size_t x = builder.addColumn(3.0);
+    const std::size_t y = builder.addColumn(5.0);
+    builder.addRow(RowSense::LessEqual, 4.0, std::vector<std::size_t>{x}, std::vector<double>{1.0});
+    builder.addRow(RowSense::LessEqual, 12.0, std::vector<std::size_t>{y}, std::vector<double>{2.0});
+    builder.addRow(RowSense::LessEqual, 18.0, std::vector<std::size_t>{x, y}, std::vector<double>{3.0, 2.0});
+    return builder.build();
+}
+
+} // namespace
+
+TEST(ConversionTests, SolvesAMaximizationThroughTheStandardForm) {
+    const auto converted = toStandardForm(textbook());
+    EXPECT_EQ(converted.form().rows(), 3u);
+    EXPECT_EQ(converted.form().cols(), 5u);
+    converted.form().validate();
+
+    const auto solution = converted.recover(ModifiedSimplexSolver().solve(converted.form()));
+    ASSERT_EQ(solution.status, SolutionStatus::Optimal);
+    EXPECT_NEAR(solution.objective, 36.0, 1e-9);
+    ASSERT_EQ(solution.values.size(), 2u);
+    EXPECT_NEAR(solution.values[0], 2.0, 1e-9);
+    EXPECT_NEAR(solution.values[1], 6.0, 1e-9);
+    // Shadow prices of the maximization: one more unit of plant 2 or 3 is worth 1.5 or 1.
+    EXPECT_NEAR(solution.duals[1], 1.5, 1e-9);
+    EXPECT_NEAR(solution.duals[2], 1.0, 1e-9);
+    for (const std::size_t variable : solution.basis) {
+        EXPECT_LT(variable, 2u + 3u);
+    }
+}
+
+TEST(ConversionTests, HandlesFreeMirroredShiftedColumnsAndRangedRows) {
+    // min -2x - z + y + 0.5  s.t.  1 <= x + z <= 5,  x <= 4,  y - x >= -10
+    // with x free, z <= 2 and y >= -1.
+    LinearProgramBuilder builder;
+    builder.setObjectiveOffset(0.5);
+    const std::size_t x = builder.addColumn(-2.0, -kInfinity, kInfinity);
+    const std::size_t z = builder.addColumn(-1.0, -kInfinity, 2.0);
+    const std::size_t y = builder.addColumn(1.0, -1.0, kInfinity);
+    const std::size_t range = builder.addRow(RowSense::LessEqual, 1.0, std::vector<std::size_t>{x, z},
+                                             std::vector<double>{1.0, 1.0});
+    builder.setRowRange(range, 4.0);
+    builder.addRow(RowSense::LessEqual, 4.0, std::vector<std::size_t>{x}, std::vector<double>{1.0});
+    builder.addRow(RowSense::GreaterEqual, -10.0, std::vector<std::size_t>{y, x}, std::vector<double>{1.0, -1.0});
+    const auto converted = toStandardForm(builder.build());
+    converted.form().validate();
+    EXPECT_EQ(converted.form().cols(), 4u + 3u);
+
+    const auto revised = converted.recover(ModifiedSimplexSolver().solve(converted.form()));
+    const auto tableau = converted.recover(SimplexSolver<double>().solve(converted.form()));
+    for (const auto& solution : {revised, tableau}) {
+        ASSERT_EQ(solution.status, SolutionStatus::Optimal);
+        EXPECT_NEAR(solution.objective, -9.5, 1e-9);
+        EXPECT_NEAR(solution.values[x], 4.0, 1e-9);
+        EXPECT_NEAR(solution.values[z], 1.0, 1e-9);
+        EXPECT_NEAR(solution.values[y], -1.0, 1e-9);
+    }
+}
+
+TEST(ConversionTests, MapsBasisStatusesBothWays) {
+    // The ranged program above: x + z sits at its upper limit 5, x <= 4 binds,
+    // y - x >= -10 is slack and y rests at its lower bound.
+    LinearProgramBuilder builder;
+    const std::size_t x = builder.addColumn(-2.0, -kInfinity, kInfinity);
+    const std::size_t z = builder.addColumn(-1.0, -kInfinity, 2.0);
+    const std::size_t y = builder.addColumn(1.0, -1.0, kInfinity);
+    const std::size_t range = builder.addRow(RowSense::LessEqual, 1.0, std::vector<std::size_t>{x, z},
+                                             std::vector<double>{1.0, 1.0});
+    builder.setRowRange(range, 4.0);
+    builder.addRow(RowSense::LessEqual, 4.0, std::vector<std::size_t>{x}, std::vector<double>{1.0});
+    builder.addRow(RowSense::GreaterEqual, -10.0, std::vector<std::size_t>{y, x}, std::vector<double>{1.0, -1.0});
+    const auto converted = toStandardForm(builder.build());
+
+    const auto solution = converted.recover(ModifiedSimplexSolver().solve(converted.form()));
+    ASSERT_EQ(solution.status, SolutionStatus::Optimal);
+    const auto& state = solution.basisState;
+    ASSERT_EQ(state.columns.size(), 3u);
+    ASSERT_EQ(state.rows.size(), 3u);
+    EXPECT_EQ(state.columns[x], BasisStatus::Basic);
+    EXPECT_EQ(state.columns[z], BasisStatus::Basic);
+    EXPECT_EQ(state.columns[y], BasisStatus::AtLower);
+    EXPECT_EQ(state.rows[0], BasisStatus::AtUpper);
+    EXPECT_EQ(state.rows[1], BasisStatus::AtUpper);
+    EXPECT_EQ(state.rows[2], BasisStatus::Basic);
+
+    const auto start = converted.toFormBasis(state);
+    const auto revised = ModifiedSimplexSolver().solve(converted.form(), start);
+    const auto tableau = SimplexSolver<double>().solve(converted.form(), start);
+    for (const auto& warm : {revised, tableau}) {
+        ASSERT_EQ(warm.status, SolutionStatus::Optimal);
+        EXPECT_EQ(warm.iterations, 0u);
+        EXPECT_NEAR(converted.recover(warm).objective, solution.objective, 1e-9);
+    }
+
+    limo::core::BasisState wrong = state;
+    wrong.columns.pop_back();
+    EXPECT_THROW(converted.toFormBasis(wrong), std::invalid_argument);
+}
@@ -0,0 +1,317 @@
+#include "limo/simplex/ModifiedSimplexSolver.hpp"
+
+#include "TestProblems.hpp"
+
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <random>
+#include <vector>
+
+using limo::core::BasisState;
+using limo::core::BasisStatus;
+using limo::core::SolutionStatus;
+using limo::numerics::Matrix;
+using limo::simplex::ModifiedSimplexSolver;
+using limo::simplex::StandardForm;
+using limo::simplex::testing::makeProblem;
+using limo::simplex::testing::textbookProblem;
+using limo::simplex::testing::transportationProblem;
+
+TEST(ModifiedSimplexSolverTests, SolvesTextbookProblem) {
+    const auto solution = ModifiedSimplexSolver().solve(textbookProblem());
+
+    ASSERT_EQ(solution.status, SolutionStatus::Optimal);
+    EXPECT_TRUE(solution.isOptimal());
+    EXPECT_NEAR(solution.objective, -36.0, 1e-9);
+    EXPECT_NEAR(solution.values[0], 2.0, 1e-9);
+    EXPECT_NEAR(solution.values[1], 6.0, 1e-9);
+    ASSERT_EQ(solution.duals.size(), 3u);
+    EXPECT_NEAR(solution.duals[0], 0.0, 1e-9);
+    EXPECT_NEAR(solution.duals[1], -1.5, 1e-9);
+    EXPECT_NEAR(solution.duals[2], -1.0, 1e-9);
+    EXPECT_EQ(solution.basis.size(), 3u);
+    EXPECT_GT(solution.iterations, 0u);
+    for (double reducedCost : solution.reducedCosts) {
+        EXPECT_GE(reducedCost, -1e-9);
+    }
+}
+
+TEST(ModifiedSimplexSolverTests, SolvesTransportationProblem) {
+    // Equality rows need phase 1 with or without the crash basis.
+    for (const bool crash : {false, true}) {
+        ModifiedSimplexSolver::Options options;
+        options.crash = crash;
+        const auto solution = ModifiedSimplexSolver(options).solve(transportationProblem());
+
+        ASSERT_EQ(solution.status, SolutionStatus::Optimal);
+        EXPECT_NEAR(solution.objective, 465.0, 1e-9);
+        const std::vector<double> expectedValues{0, 20, 0, 10, 5, 15, 0, 5};
+        const std::vector<double> expectedDuals{-6, 0, 9, 12, 13};
+        for (std::size_t j = 0; j < expectedValues.size(); ++j) {
+            EXPECT_NEAR(solution.values[j], expectedValues[j], 1e-9) << "column " << j;
+        }
+        for (std::size_t i = 0; i < expectedDuals.size(); ++i) {
+            EXPECT_NEAR(solution.duals[i], expectedDuals[i], 1e-9) << "row " << i;
+        }
+        EXPECT_NEAR(solution.reducedCosts[0], 5.0, 1e-9);
+        EXPECT_NEAR(solution.reducedCosts[2], 3.0, 1e-9);
+        EXPECT_NEAR(solution.reducedCosts[6], 6.0, 1e-9);
+    }
+}
+
+TEST(ModifiedSimplexSolverTests, DetectsInfeasibleAndUnboundedProblems) {
+    const auto infeasible = ModifiedSimplexSolver().solve(makeProblem({{1, 1}}, {-1}, {1, 1}));
+    EXPECT_EQ(infeasible.status, SolutionStatus::Infeasible);
+    EXPECT_STREQ(limo::core::toString(infeasible.status), "infeasible");
+
+    const auto unbounded = ModifiedSimplexSolver().solve(makeProblem({{1, -1}}, {1}, {-1, 0}));
+    EXPECT_EQ(unbounded.status, SolutionStatus::Unbounded);
+
+    ModifiedSimplexSolver::Options options;
+    options.maxIterations = 1;
+    const auto limited = ModifiedSimplexSolver(options).solve(textbookProblem());
+    EXPECT_EQ(limited.status, SolutionStatus::IterationLimit);
+    EXPECT_EQ(limited.iterations, 1u);
+}
+
+TEST(ModifiedSimplexSolverTests, HandlesUpperBoundsNegativeRhsAndRedundantRows) {
+    // min -x1 - x2  s.t.  x1 + x2 + s = 3,  x1 <= 1,  x2 <= 1.5
+    const auto bounded = ModifiedSimplexSolver().solve(
+        makeProblem({{1, 1, 1}}, {3}, {-1, -1, 0}, {1.0, 1.5, std::nullopt}));
+    ASSERT_EQ(bounded.status, SolutionStatus::Optimal);
+    EXPECT_NEAR(bounded.objective, -2.5, 1e-9);
+    EXPECT_NEAR(bounded.values[0], 1.0, 1e-9);
+    EXPECT_NEAR(bounded.values[1], 1.5, 1e-9);
+
+    // min x1 + 2 x2  s.t.  -x1 - x2 = -2,  2 x1 + 2 x2 = 4
+    const auto redundant = ModifiedSimplexSolver().solve(makeProblem({{-1, -1}, {2, 2}}, {-2, 4}, {1, 2}));
+    ASSERT_EQ(redundant.status, SolutionStatus::Optimal);
+    EXPECT_NEAR(redundant.objective, 2.0, 1e-9);
+    EXPECT_NEAR(redundant.values[0], 2.0, 1e-9);
+}
+
+TEST(ModifiedSimplexSolverTests, RandomProblemsSatisfyOptimalityConditions) {
+    std::mt19937 rng(5);
+    std::uniform_int_distribution<int> coefficient(-4, 6);
+    std::uniform_int_distribution<int> sparsity(0, 2);
+    ModifiedSimplexSolver::Options options;
+    options.refactorizationInterval = 3;
+    const ModifiedSimplexSolver solver(options);
+
+    for (int trial = 0; trial < 20; ++trial) {
+        const std::size_t rows = 6;
+        const std::size_t cols = 14;
+        Matrix<double> constraints(rows, cols);
+        std::vector<double> point(cols);
+        for (std::size_t c = 0; c < cols; ++c) {
+            point[c] = static_cast<double>(c % 3);
+            for (std::size_t r = 0; r < rows; ++r) {
+                constraints(r, c) = sparsity(rng) == 0 ? coefficient(rng) : 0.0;
+            }
+        }
+        // Feasible by construction (b = A p with p >= 0) and bounded (costs >= 0 on a box).
+        std::vector<double> rhs(rows, 0.0);
+        for (std::size_t r = 0; r < rows; ++r) {
+            for (std::size_t c = 0; c < cols; ++c) {
+                rhs[r] += constraints(r, c) * point[c];
+            }
+        }
+        std::vector<double> costs(cols);
+        std::vector<std::optional<double>> upper(cols);
+        for (std::size_t c = 0; c < cols; ++c) {
+            costs[c] = coefficient(rng);
+            upper[c] = 4.0;
+        }
+
+        const auto problem = makeProblem(constraints, rhs, costs, upper);
+        const auto solution = solver.solve(problem);
+        ASSERT_EQ(solution.status, SolutionStatus::Optimal) << "trial " << trial;
+
+        const std::vector<double> activity = problem.constraints.multiply(solution.values);
+        for (std::size_t r = 0; r < rows; ++r) {
+            EXPECT_NEAR(activity[r], rhs[r], 1e-8);
+        }
+        for (std::size_t c = 0; c < cols; ++c) {
+            EXPECT_GE(solution.values[c], -1e-9);
+            EXPECT_LE(solution.values[c], 4.0 + 1e-9);
+            // Complementary slackness for a box: d_j > 0 at lower, d_j < 0 at upper.
+            if (solution.reducedCosts[c] > 1e-7) {
+                EXPECT_NEAR(solution.values[c], 0.0, 1e-8);
+            } else if (solution.reducedCosts[c] < -1e-7) {
+                EXPECT_NEAR(solution.values[c], 4.0, 1e-8);
+            }
+        }
+    }
+}
+
+TEST(ModifiedSimplexSolverTests, RejectsMalformedProblems) {
+    StandardForm<double> problem = textbookProblem();
+    problem.rhs.pop_back();
+    EXPECT_THROW(ModifiedSimplexSolver().solve(problem), std::invalid_argument);
+
+    problem = textbookProblem();
+    problem.upperBounds.assign(5, -1.0);
+    EXPECT_THROW(ModifiedSimplexSolver().solve(problem), std::invalid_argument);
+
+    problem = textbookProblem();
+    problem.constraints = problem.constraints.to_csr();
+    EXPECT_THROW(ModifiedSimplexSolver().solve(problem), std::invalid_argument);
+}
+
+TEST(ModifiedSimplexSolverTests, ScalingReturnsTheUnscaledSolution) {
+    // The textbook problem with row 2 multiplied by 1000 and x measured in thousandths.
+    const auto problem = makeProblem({{1e-3, 0, 1, 0, 0}, {0, 2000, 0, 1, 0}, {3e-3, 2, 0, 0, 1}}, {4, 12000, 18},
+                                     {-3e-3, -5, 0, 0, 0}, {8000.0, std::nullopt, std::nullopt, std::nullopt, 1e6});
+    ModifiedSimplexSolver::Options options;
+    options.scaling = true;
+    const auto scaled = ModifiedSimplexSolver(options).solve(problem);
+    const auto plain = ModifiedSimplexSolver().solve(problem);
+
+    ASSERT_EQ(scaled.status, SolutionStatus::Optimal);
+    EXPECT_NEAR(scaled.objective, -36.0, 1e-9);
+    EXPECT_NEAR(scaled.values[0], 2000.0, 1e-6);
+    EXPECT_NEAR(scaled.values[1], 6.0, 1e-9);
+    ASSERT_EQ(scaled.duals.size(), 3u);
+    for (std::size_t i = 0; i < 3; ++i) {
+        EXPECT_NEAR(scaled.duals[i], plain.duals[i], 1e-9);
+    }
+    for (std::size_t j = 0; j < 5; ++j) {
+        EXPECT_NEAR(scaled.reducedCosts[j], plain.reducedCosts[j], 1e-9);
+    }
+}
+
+TEST(ModifiedSimplexSolverTests, ReportsTheFinalBasisStatus) {
+    const auto solution = ModifiedSimplexSolver().solve(
+        makeProblem({{2, 2, 1}}, {5}, {-1, -1, 0}, {1.0, 3.0, std::nullopt}));
+
+    ASSERT_EQ(solution.status, SolutionStatus::Optimal);
+    ASSERT_EQ(solution.basisState.columns.size(), 3u);
+    ASSERT_EQ(solution.basisState.rows.size(), 1u);
+    std::size_t basic = 0;
+    for (std::size_t j = 0; j < 3; ++j) {
+        const BasisStatus status = solution.basisState.columns[j];
+        basic += status == BasisStatus::Basic ? 1 : 0;
+        if (status == BasisStatus::AtLower) {
+            EXPECT_NEAR(solution.values[j], 0.0, 1e-9);
+        } else if (status == BasisStatus::AtUpper) {
+            EXPECT_NEAR(solution.values[j], j == 0 ? 1.0 : 3.0, 1e-9);
+        }
+    }
+    EXPECT_EQ(basic, 1u);
+    EXPECT_EQ(solution.basisState.rows[0], BasisStatus::AtLower);
+}
+
+TEST(ModifiedSimplexSolverTests, WarmStartsAfterCostAndRhsPerturbations) {
+    std::mt19937 rng(17);
+    std::uniform_int_distribution<int> coefficient(-4, 6);
+    std::uniform_real_distribution<double> noise(-0.05, 0.05);
+    const ModifiedSimplexSolver solver;
+
+    for (int trial = 0; trial < 10; ++trial) {
+        const std::size_t rows = 12;
+        const std::size_t cols = 30;
+        Matrix<double> constraints(rows, cols);
+        std::vector<double> rhs(rows, 0.0);
+        for (std::size_t r = 0; r < rows; ++r) {
+            for (std::size_t c = 0; c < cols; ++c) {
+                constraints(r, c) = coefficient(rng);
+                rhs[r] += constraints(r, c) * 1.5;
+            }
+        }
+        std::vector<double> costs(cols);
+        for (double& cost : costs) {
+            cost = coefficient(rng);
+        }
+        auto problem = makeProblem(constraints, rhs, costs, std::vector<std::optional<double>>(cols, 4.0));
+        const auto base = solver.solve(problem);
+        ASSERT_EQ(base.status, SolutionStatus::Optimal) << "trial " << trial;
+
+        for (double& cost : problem.costs) {
+            cost += noise(rng);
+        }
+        for (double& value : problem.rhs) {
+            value += noise(rng);
+        }
+        const auto cold = solver.solve(problem);
+        const auto warm = solver.solve(problem, base.basisState);
+        ASSERT_EQ(cold.status, SolutionStatus::Optimal) << "trial " << trial;
+        ASSERT_EQ(warm.status, SolutionStatus::Optimal) << "trial " << trial;
+        EXPECT_NEAR(warm.objective, cold.objective, 1e-7);
+        EXPECT_LE(warm.iterations, cold.iterations);
+
+        const std::vector<double> activity = problem.constraints.multiply(warm.values);
+        for (std::size_t r = 0; r < rows; ++r) {
+            EXPECT_NEAR(activity[r], problem.rhs[r], 1e-8);
+        }
+
+        // Restarting from the optimal basis of the same problem needs no pivots.
+        const auto again = solver.solve(problem, warm.basisState);
+        ASSERT_EQ(again.status, SolutionStatus::Optimal);
+        EXPECT_EQ(again.iterations, 0u);
+        EXPECT_NEAR(again.objective, cold.objective, 1e-7);
+    }
+}
+
+TEST(ModifiedSimplexSolverTests, RepairsSingularAndInfeasibleStarts) {
+    const auto problem = textbookProblem();
+    // Columns 0 and 2 are both basic in the start but the slack of row 1 has
+    // no partner: the crash leaves that row's artificial in the basis.
+    BasisState start;
+    start.columns = {BasisStatus::Basic, BasisStatus::AtLower, BasisStatus::Basic, BasisStatus::Basic,
+                     BasisStatus::Basic};
+    start.rows.assign(3, BasisStatus::AtLower);
+    const auto solution = ModifiedSimplexSolver().solve(problem, start);
+    ASSERT_EQ(solution.status, SolutionStatus::Optimal);
+    EXPECT_NEAR(solution.objective, -36.0, 1e-9);
+
+    // x = 4 at its upper bound pushes the slack of row 2 negative.
+    auto bounded = makeProblem({{1, 0, 1, 0, 0}, {0, 2, 0, 1, 0}, {3, 2, 0, 0, 1}}, {4, 12, 18}, {-3, -5, 0, 0, 0},
+                               {4.0, std::nullopt, std::nullopt, std::nullopt, std::nullopt});
+    start.columns = {BasisStatus::AtUpper, BasisStatus::Basic, BasisStatus::Basic, BasisStatus::AtLower,
+                     BasisStatus::Basic};
+    const auto repaired = ModifiedSimplexSolver().solve(bounded, start);
+    ASSERT_EQ(repaired.status, SolutionStatus::Optimal);
+    EXPECT_NEAR(repaired.objective, -36.0, 1e-9);
+
+    start.rows.pop_back();
+    EXPECT_THROW(ModifiedSimplexSolver().solve(problem, start), std::invalid_argument);
+}
+
+TEST(ModifiedSimplexSolverTests, CrashStartReachesTheSameOptimum) {
+    // A chain of flow balances: the crash covers every row, so phase 1 has
+    // nothing left to do.
+    const auto chain = makeProblem({{1, 0, 0, -1}, {-1, 1, 0, 0}, {0, -1, 1, 0}}, {3, 1, 2}, {1, 1, 1, 2});
+    ModifiedSimplexSolver::Options noCrash;
+    noCrash.crash = false;
+    const auto crashed = ModifiedSimplexSolver().solve(chain);
+    const auto artificial = ModifiedSimplexSolver(noCrash).solve(chain);
+    ASSERT_EQ(crashed.status, SolutionStatus::Optimal);
+    ASSERT_EQ(artificial.status, SolutionStatus::Optimal);
+    EXPECT_NEAR(crashed.objective, artificial.objective, 1e-9);
+    EXPECT_LT(crashed.iterations, artificial.iterations);
+
+    std::mt19937 rng(23);
+    std::uniform_int_distribution<int> coefficient(-4, 6);
+    for (int trial = 0; trial < 10; ++trial) {
+        const std::size_t rows = 10;
+        const std::size_t cols = 25;
+        Matrix<double> constraints(rows, cols);
+        std::vector<double> rhs(rows, 0.0);
+        std::vector<double> costs(cols);
+        for (std::size_t c = 0; c < cols; ++c) {
+            costs[c] = coefficient(rng);
+            for (std::size_t r = 0; r < rows; ++r) {
+                constraints(r, c) = c < 20 ? coefficient(rng) : (r == c - 20 ? 1.0 : 0.0);
+                rhs[r] += constraints(r, c) * static_cast<double>(c % 3);
+            }
+        }
+        const auto problem = makeProblem(constraints, rhs, costs, std::vector<std::optional<double>>(cols, 4.0));
+        const auto withCrash = ModifiedSimplexSolver().solve(problem);
+        const auto without = ModifiedSimplexSolver(noCrash).solve(problem);
+        ASSERT_EQ(withCrash.status, without.status) << "trial " << trial;
+        if (without.status == SolutionStatus::Optimal) {
+            EXPECT_NEAR(withCrash.objective, without.objective, 1e-7) << "trial " << trial;
+        }
+    }
+}
@@ -0,0 +1,186 @@
+#include "limo/simplex/ModifiedSimplexSolver.hpp"
+#include "limo/simplex/ParallelScan.hpp"
+#include "limo/simplex/SimplexSolver.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using limo::core::SolutionStatus;
+using limo::numerics::SparseMatrix;
+using limo::simplex::ModifiedSimplexSolver;
+using limo::simplex::ParallelOptions;
+using limo::simplex::PricingRule;
+using limo::simplex::SimplexSolver;
+using limo::simplex::StandardForm;
+using limo::thread_pool::ThreadPool;
+
+namespace {
+
+// Wide random problem with many equal costs, so pricing and ratio ties are common.
+StandardForm<double> wideProblem(std::size_t rows, std::size_t cols) {
+    std::mt19937 rng(21);
+    std::uniform_int_distribution<int> coefficient(1, 3);
+    std::uniform_int_distribution<int> cost(-2, 2);
+    std::uniform_int_distribution<int> pick(0, 3);
+    SparseMatrix<double>::Builder builder(rows, cols);
+    std::vector<double> costs(cols);
+    std::vector<double> rhs(rows, 0.0);
+    for (std::size_t j = 0; j < cols; ++j) {
+        builder.add(j % rows, j, coefficient(rng));
+        for (std::size_t i = 0; i < rows; ++i) {
+            if (pick(rng) == 0) {
+                builder.add(i, j, coefficient(rng));
+            }
+        }
+        costs[j] = cost(rng);
+    }
+    for (std::size_t i = 0; i < rows; ++i) {
+        rhs[i] = 10.0 + static_cast<double>(i % 4);
+    }
+    StandardForm<double> problem{builder.build(), rhs, costs, {}};
+    problem.upperBounds.assign(cols, 5.0);
+    return problem;
+}
+
+// Dantzig pricing that counts the scans it was allowed to split over a pool.
+class CountingPricing : public limo::simplex::DantzigPricing<double> {
+public:
+    explicit CountingPricing(std::size_t& splitScans) : splitScans(splitScans) {}
+
+    std::optional<std::size_t> select(std::size_t variableCount, const Infeasibility& infeasibility) override {
+        if (parallel.enabled(variableCount)) {
+            ++splitScans;
+        }
+        return DantzigPricing::select(variableCount, infeasibility);
+    }
+
+private:
+    std::size_t& splitScans;
+};
+
+} // namespace
+
+TEST(ParallelScanTests, ReduceMatchesSequentialForEveryPoolSize) {
+    std::vector<int> values(1000);
+    std::mt19937 rng(4);
+    for (int& value : values) {
+        value = static_cast<int>(rng() % 50);
+    }
+    // First index of the maximum: the tie-breaking the pricing scans rely on.
+    const auto scan = [&](std::size_t begin, std::size_t end) {
+        std::size_t best = begin;
+        for (std::size_t i = begin; i < end; ++i) {
+            if (values[best] < values[i]) {
+                best = i;
+            }
+        }
+        return best;
+    };
+    const auto combine = [&](std::size_t left, std::size_t right) { return values[left] < values[right] ? right : left; };
+    const std::size_t expected = scan(0, values.size());
+
+    for (std::size_t threads : {1u, 2u, 3u, 7u}) {
+        ThreadPool pool(threads);
+        const ParallelOptions parallel{&pool, 1};
+        EXPECT_EQ(limo::simplex::parallelReduce(parallel, values.size(), scan, combine), expected) << threads;
+    }
+}
+
+TEST(ParallelScanTests, SmallScansStayOnTheCallingThread) {
+    ThreadPool pool(2);
+    const ParallelOptions parallel{&pool, 100};
+    EXPECT_FALSE(parallel.enabled(99));
+    EXPECT_TRUE(parallel.enabled(100));
+    EXPECT_FALSE(ParallelOptions{}.enabled(1000000));
+
+    std::atomic<int> calls{0};
+    limo::simplex::parallelFor(parallel, 99, [&](std::size_t begin, std::size_t end) {
+        EXPECT_EQ(begin, 0u);
+        EXPECT_EQ(end, 99u);
+        ++calls;
+    });
+    EXPECT_EQ(calls.load(), 1);
+
+    std::vector<int> touched(500, 0);
+    limo::simplex::parallelFor(parallel, touched.size(), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            ++touched[i];
+        }
+    });
+    for (int count : touched) {
+        EXPECT_EQ(count, 1);
+    }
+}
+
+TEST(ParallelScanTests, PropagatesExceptionsAfterAllChunksFinish) {
+    ThreadPool pool(3);
+    const ParallelOptions parallel{&pool, 1};
+    std::atomic<int> finished{0};
+    const auto run = [&] {
+        limo::simplex::parallelFor(parallel, 400, [&](std::size_t begin, std::size_t) {
+            if (begin != 0) {
+                ++finished;
+                throw std::runtime_error("chunk failed");
+            }
+            ++finished;
+        });
+    };
+    EXPECT_THROW(run(), std::runtime_error);
+    EXPECT_EQ(finished.load(), 4);
+}
+
+TEST(ParallelScanTests, SolversTakeTheSamePathForEveryThreadCount) {
+    const StandardForm<double> problem = wideProblem(12, 400);
+    for (PricingRule rule : {PricingRule::Dantzig, PricingRule::Devex, PricingRule::SteepestEdge}) {
+        ModifiedSimplexSolver::Options revisedOptions;
+        revisedOptions.pricing = rule;
+        const auto revised = ModifiedSimplexSolver(revisedOptions).solve(problem);
+        SimplexSolver<double>::Options tableauOptions;
+        tableauOptions.pricing = rule;
+        const auto tableau = SimplexSolver<double>(tableauOptions).solve(problem);
+        ASSERT_EQ(revised.status, SolutionStatus::Optimal);
+        ASSERT_EQ(tableau.status, SolutionStatus::Optimal);
+
+        for (std::size_t threads : {1u, 2u, 5u}) {
+            ThreadPool pool(threads);
+            revisedOptions.parallel = {&pool, 1};
+            tableauOptions.parallel = {&pool, 1};
+            const auto parallelRevised = ModifiedSimplexSolver(revisedOptions).solve(problem);
+            const auto parallelTableau = SimplexSolver<double>(tableauOptions).solve(problem);
+
+            EXPECT_EQ(parallelRevised.iterations, revised.iterations) << threads;
+            EXPECT_EQ(parallelRevised.basis, revised.basis) << threads;
+            EXPECT_EQ(parallelRevised.values, revised.values) << threads;
+            EXPECT_EQ(parallelTableau.iterations, tableau.iterations) << threads;
+            EXPECT_EQ(parallelTableau.basis, tableau.basis) << threads;
+            EXPECT_EQ(parallelTableau.values, tableau.values) << threads;
+        }
+    }
+}
+
+TEST(ParallelScanTests, BothSolversHandThePoolToTheirPricing) {
+    const StandardForm<double> problem = wideProblem(12, 400);
+    ThreadPool pool(2);
+    // Only the 412-column pricing scans reach the cutoff, not the 12-row ratio test.
+    const ParallelOptions parallel{&pool, 100};
+
+    std::size_t revisedSplits = 0;
+    ModifiedSimplexSolver::Options revisedOptions;
+    revisedOptions.parallel = parallel;
+    revisedOptions.pricingFactory = [&]() { return std::make_unique<CountingPricing>(revisedSplits); };
+    EXPECT_EQ(ModifiedSimplexSolver(revisedOptions).solve(problem).status, SolutionStatus::Optimal);
+    EXPECT_GT(revisedSplits, 0u);
+
+    std::size_t tableauSplits = 0;
+    SimplexSolver<double>::Options tableauOptions;
+    tableauOptions.parallel = parallel;
+    tableauOptions.pricingFactory = [&]() { return std::make_unique<CountingPricing>(tableauSplits); };
+    EXPECT_EQ(SimplexSolver<double>(tableauOptions).solve(problem).status, SolutionStatus::Optimal);
+    EXPECT_GT(tableauSplits, 0u);
+}
@@ -0,0 +1,230 @@
+#include "limo/simplex/ModifiedSimplexSolver.hpp"
+#include "limo/simplex/Pricing.hpp"
+#include "limo/simplex/SimplexSolver.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <optional>
+#include <random>
+#include <utility>
+#include <vector>
+
+using limo::core::SolutionStatus;
+using limo::numerics::Matrix;
+using limo::numerics::SparseMatrix;
+using limo::numerics::fraction::Fraction;
+using limo::simplex::DevexPricing;
+using limo::simplex::ModifiedSimplexSolver;
+using limo::simplex::PartialPricing;
+using limo::simplex::PivotWeights;
+using limo::simplex::PricingRule;
+using limo::simplex::SimplexSolver;
+using limo::simplex::StandardForm;
+using limo::simplex::SteepestEdgePricing;
+
+namespace {
+
+const std::vector<PricingRule> kRules = {PricingRule::Dantzig, PricingRule::Partial, PricingRule::Devex,
+                                         PricingRule::SteepestEdge};
+
+// Balanced transportation problem: ship supply[i] from every source to meet
+// demand[j] at every sink, x_ij >= 0. Highly degenerate, one redundant row.
+StandardForm<double> transportationProblem(std::size_t sources, std::size_t sinks, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> amount(1, 9);
+    std::uniform_int_distribution<int> cost(1, 20);
+    std::vector<double> supply(sources);
+    std::vector<double> demand(sinks, 0.0);
+    for (std::size_t i = 0; i < sources; ++i) {
+        supply[i] = amount(rng) * static_cast<double>(sinks);
+        for (std::size_t j = 0; j < sinks; ++j) {
+            demand[j] += supply[i] / static_cast<double>(sinks);
+        }
+    }
+
+    SparseMatrix<double>::Builder builder(sources + sinks, sources * sinks);
+    std::vector<double> costs;
+    for (std::size_t i = 0; i < sources; ++i) {
+        for (std::size_t j = 0; j < sinks; ++j) {
+            const std::size_t column = i * sinks + j;
+            builder.add(i, column, 1.0);
+            builder.add(sources + j, column, 1.0);
+            costs.push_back(cost(rng));
+        }
+    }
+    std::vector<double> rhs = supply;
+    rhs.insert(rhs.end(), demand.begin(), demand.end());
+    return {builder.build(), std::move(rhs), std::move(costs), {}};
+}
+
+std::vector<Fraction> column(const Matrix<Fraction>& tableau, std::size_t j) {
+    std::vector<Fraction> values(tableau.rows());
+    for (std::size_t i = 0; i < tableau.rows(); ++i) {
+        values[i] = tableau(i, j);
+    }
+    return values;
+}
+
+Fraction weight(const Matrix<Fraction>& tableau, std::size_t j) {
+    Fraction sum(1);
+    for (const Fraction& value : column(tableau, j)) {
+        sum += value * value;
+    }
+    return sum;
+}
+
+} // namespace
+
+TEST(PricingTests, DantzigAndWeightedRulesPickTheExpectedColumn) {
+    const std::vector<std::optional<double>> infeasibility = {std::nullopt, 1.0, 3.0, 2.0};
+    const auto lookup = [&](std::size_t j) { return infeasibility[j]; };
+
+    auto dantzig = limo::simplex::makePricing<double>(PricingRule::Dantzig);
+    EXPECT_EQ(dantzig->rule(), PricingRule::Dantzig);
+    EXPECT_EQ(dantzig->select(4, lookup), 2u);
+    EXPECT_FALSE(dantzig->select(1, lookup).has_value());
+
+    // Weights turn the choice around: 3² / 10 < 2² / 1.
+    SteepestEdgePricing<double> steepest;
+    steepest.reset(4);
+    steepest.setWeight(2, 10.0);
+    EXPECT_EQ(steepest.select(4, lookup), 3u);
+    EXPECT_TRUE(steepest.needsExactWeights());
+    EXPECT_STREQ(limo::simplex::toString(PricingRule::SteepestEdge), "steepest edge");
+}
+
+TEST(PricingTests, PartialPricingScansChunksInRotation) {
+    std::vector<std::optional<double>> infeasibility(9);
+    infeasibility[1] = 1.0;
+    infeasibility[4] = 5.0;
+    infeasibility[5] = 2.0;
+    const auto lookup = [&](std::size_t j) { return infeasibility[j]; };
+
+    PartialPricing<double> partial(3);
+    EXPECT_EQ(partial.select(9, lookup), 1u);
+    // The next scan starts at the second chunk and takes its best column.
+    EXPECT_EQ(partial.select(9, lookup), 4u);
+    // Chunk [6, 9) is empty, so the scan wraps around to [0, 3).
+    EXPECT_EQ(partial.select(9, lookup), 1u);
+
+    infeasibility.assign(9, std::nullopt);
+    EXPECT_FALSE(partial.select(9, lookup).has_value());
+}
+
+TEST(PricingTests, SteepestEdgeRecurrenceMatchesRecomputedNorms) {
+    // A tableau B⁻¹A whose last three columns are the current (identity) basis.
+    std::mt19937 rng(3);
+    std::uniform_int_distribution<int> entry(-3, 3);
+    const std::size_t rows = 3;
+    const std::size_t variables = 8;
+    Matrix<Fraction> tableau(rows, variables);
+    std::vector<std::size_t> basis = {5, 6, 7};
+    for (std::size_t i = 0; i < rows; ++i) {
+        for (std::size_t j = 0; j < 5; ++j) {
+            tableau(i, j) = Fraction(entry(rng));
+        }
+        tableau(i, basis[i]) = Fraction(1);
+    }
+
+    SteepestEdgePricing<Fraction> pricing;
+    pricing.reset(variables);
+    for (std::size_t j = 0; j < variables; ++j) {
+        pricing.setWeight(j, weight(tableau, j));
+    }
+
+    for (const auto& [row, entering] : {std::pair<std::size_t, std::size_t>{0, 1}, {2, 3}, {1, 0}}) {
+        ASSERT_NE(tableau(row, entering), Fraction(0));
+        const std::vector<Fraction> alpha = column(tableau, entering);
+        std::vector<Fraction> pivotRow(variables);
+        std::vector<Fraction> products(variables);
+        for (std::size_t j = 0; j < variables; ++j) {
+            pivotRow[j] = tableau(row, j);
+            for (std::size_t i = 0; i < rows; ++i) {
+                products[j] += tableau(i, j) * alpha[i];
+            }
+        }
+        pricing.update(PivotWeights<Fraction>{entering, basis[row], pivotRow, alpha, basis, products});
+        tableau.eliminate_column(row, entering);
+        basis[row] = entering;
+
+        for (std::size_t j = 0; j < variables; ++j) {
+            if (std::find(basis.begin(), basis.end(), j) == basis.end()) {
+                EXPECT_EQ(pricing.getWeights()[j], weight(tableau, j)) << "variable " << j;
+            }
+        }
+    }
+}
+
+TEST(PricingTests, DevexWeightsFollowTheReferenceFramework) {
+    // Variables 0..2 are nonbasic (the reference framework), 3 and 4 basic.
+    DevexPricing<double> devex;
+    devex.reset(5);
+    const std::vector<std::size_t> basis = {3, 4};
+    const std::vector<double> pivotRow = {2.0, 0.5, 0.0, 1.0, 0.0};
+    const std::vector<double> pivotColumn = {2.0, 3.0};
+    const std::vector<double> products;
+    devex.update(PivotWeights<double>{0, 3, pivotRow, pivotColumn, basis, products});
+
+    // The entering column has no entries on reference variables, so w_q = 1.
+    const std::vector<double>& weights = devex.getWeights();
+    EXPECT_DOUBLE_EQ(weights[1], 1.0);
+    EXPECT_DOUBLE_EQ(weights[2], 1.0);
+    EXPECT_DOUBLE_EQ(weights[3], 1.0);
+
+    // Now variable 0 is basic in row 0 and part of the framework: entering
+    // variable 1 has w_q = 1 + 2² = 5 and passes it on through the pivot row.
+    const std::vector<std::size_t> nextBasis = {0, 4};
+    const std::vector<double> nextRow = {1.0, 1.0, 2.0, 0.5, 0.0};
+    devex.update(PivotWeights<double>{1, 0, nextRow, pivotColumn, nextBasis, products});
+    EXPECT_DOUBLE_EQ(weights[2], 20.0);
+    EXPECT_DOUBLE_EQ(weights[3], 1.25);
+    EXPECT_DOUBLE_EQ(weights[0], 5.0);
+}
+
+TEST(PricingTests, EveryRuleReachesTheSameOptimumInBothSolvers) {
+    for (unsigned seed = 0; seed < 4; ++seed) {
+        const StandardForm<double> problem = transportationProblem(4, 6, seed);
+        std::optional<double> reference;
+        for (PricingRule rule : kRules) {
+            ModifiedSimplexSolver::Options revisedOptions;
+            revisedOptions.pricing = rule;
+            revisedOptions.partialPricingChunk = rule == PricingRule::Partial ? 5 : 0;
+            revisedOptions.refactorizationInterval = 4;
+            const auto revised = ModifiedSimplexSolver(revisedOptions).solve(problem);
+
+            SimplexSolver<double>::Options tableauOptions;
+            tableauOptions.pricing = rule;
+            const auto tableau = SimplexSolver<double>(tableauOptions).solve(problem);
+
+            ASSERT_EQ(revised.status, SolutionStatus::Optimal) << limo::simplex::toString(rule);
+            ASSERT_EQ(tableau.status, SolutionStatus::Optimal) << limo::simplex::toString(rule);
+            if (!reference) {
+                reference = revised.objective;
+            }
+            EXPECT_NEAR(revised.objective, *reference, 1e-7) << limo::simplex::toString(rule);
+            EXPECT_NEAR(tableau.objective, *reference, 1e-7) << limo::simplex::toString(rule);
+            const std::vector<double> activity = problem.constraints.multiply(revised.values);
+            for (std::size_t r = 0; r < problem.rows(); ++r) {
+                EXPECT_NEAR(activity[r], problem.rhs[r], 1e-8);
+            }
+        }
+    }
+}
+
+TEST(PricingTests, ExactSolverSupportsEveryRule) {
+    Matrix<Fraction> dense{{Fraction(1), Fraction(0), Fraction(1), Fraction(0), Fraction(0)},
+                           {Fraction(0), Fraction(2), Fraction(0), Fraction(1), Fraction(0)},
+                           {Fraction(3), Fraction(2), Fraction(0), Fraction(0), Fraction(1)}};
+    const StandardForm<Fraction> problem{SparseMatrix<Fraction>::from_dense(dense),
+                                         {Fraction(4), Fraction(12), Fraction(18)},
+                                         {Fraction(-3), Fraction(-5), Fraction(0), Fraction(0), Fraction(0)},
+                                         {}};
+    for (PricingRule rule : kRules) {
+        SimplexSolver<Fraction>::Options options;
+        options.pricing = rule;
+        const auto solution = SimplexSolver<Fraction>(options).solve(problem);
+        ASSERT_EQ(solution.status, SolutionStatus::Optimal) << limo::simplex::toString(rule);
+        EXPECT_EQ(solution.objective, Fraction(-36)) << limo::simplex::toString(rule);
+    }
+}
@@ -0,0 +1,227 @@
+#include "limo/simplex/ModifiedSimplexSolver.hpp"
+#include "limo/simplex/SimplexSolver.hpp"
+
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+using limo::core::BasisState;
+using limo::core::BasisStatus;
+using limo::core::SolutionStatus;
+using limo::numerics::Matrix;
+using limo::numerics::SparseMatrix;
+using limo::numerics::fraction::Fraction;
+using limo::simplex::ModifiedSimplexSolver;
+using limo::simplex::SimplexSolver;
+using limo::simplex::StandardForm;
+
+namespace {
+
+template <typename T>
+StandardForm<T> makeProblem(const Matrix<int>& constraints, const std::vector<int>& rhs, const std::vector<int>& costs,
+                            const std::vector<std::optional<int>>& upperBounds = {}) {
+    Matrix<T> dense(constraints.rows(), constraints.cols());
+    for (std::size_t r = 0; r < constraints.rows(); ++r) {
+        for (std::size_t c = 0; c < constraints.cols(); ++c) {
+            dense(r, c) = T(constraints(r, c));
+        }
+    }
+    StandardForm<T> problem{SparseMatrix<T>::from_dense(dense), {}, {}, {}};
+    for (int value : rhs) {
+        problem.rhs.push_back(T(value));
+    }
+    for (int value : costs) {
+        problem.costs.push_back(T(value));
+    }
+    for (const std::optional<int>& bound : upperBounds) {
+        problem.upperBounds.push_back(bound ? std::optional<T>(T(*bound)) : std::nullopt);
+    }
+    return problem;
+}
+
+template <typename T>
+void expectValues(const std::vector<T>& actual, const std::vector<T>& expected) {
+    ASSERT_EQ(actual.size(), expected.size());
+    for (std::size_t i = 0; i < actual.size(); ++i) {
+        if constexpr (std::is_floating_point_v<T>) {
+            EXPECT_NEAR(actual[i], expected[i], 1e-9);
+        } else {
+            EXPECT_EQ(actual[i], expected[i]);
+        }
+    }
+}
+
+template <typename T>
+class SimplexSolverTests : public ::testing::Test {};
+
+using ScalarTypes = ::testing::Types<double, Fraction>;
+TYPED_TEST_SUITE(SimplexSolverTests, ScalarTypes);
+
+} // namespace
+
+TYPED_TEST(SimplexSolverTests, SolvesTextbookProblem) {
+    using T = TypeParam;
+    const auto problem =
+        makeProblem<T>({{1, 0, 1, 0, 0}, {0, 2, 0, 1, 0}, {3, 2, 0, 0, 1}}, {4, 12, 18}, {-3, -5, 0, 0, 0});
+    const auto solution = SimplexSolver<T>().solve(problem);
+
+    ASSERT_EQ(solution.status, SolutionStatus::Optimal);
+    EXPECT_EQ(solution.objective, T(-36));
+    EXPECT_EQ(solution.values[0], T(2));
+    EXPECT_EQ(solution.values[1], T(6));
+    expectValues(solution.duals, {T(0), T(-3) / T(2), T(-1)});
+    EXPECT_EQ(solution.basis.size(), 3u);
+    EXPECT_GT(solution.iterations, 0u);
+}
+
+TYPED_TEST(SimplexSolverTests, DetectsInfeasibleUnboundedAndIterationLimit) {
+    using T = TypeParam;
+    EXPECT_EQ(SimplexSolver<T>().solve(makeProblem<T>({{1, 1}}, {-1}, {1, 1})).status, SolutionStatus::Infeasible);
+    EXPECT_EQ(SimplexSolver<T>().solve(makeProblem<T>({{1, -1}}, {1}, {-1, 0})).status, SolutionStatus::Unbounded);
+
+    typename SimplexSolver<T>::Options options;
+    options.maxIterations = 1;
+    const auto limited =
+        SimplexSolver<T>(options).solve(makeProblem<T>({{1, 0, 1, 0}, {0, 1, 0, 1}}, {4, 6}, {-1, -1, 0, 0}));
+    EXPECT_EQ(limited.status, SolutionStatus::IterationLimit);
+}
+
+TYPED_TEST(SimplexSolverTests, HandlesUpperBoundsNegativeRhsAndRedundantRows) {
+    using T = TypeParam;
+    const auto bounded =
+        SimplexSolver<T>().solve(makeProblem<T>({{2, 2, 1}}, {5}, {-1, -1, 0}, {1, 3, std::nullopt}));
+    ASSERT_EQ(bounded.status, SolutionStatus::Optimal);
+    EXPECT_EQ(bounded.objective, T(-5) / T(2));
+
+    const auto redundant = SimplexSolver<T>().solve(makeProblem<T>({{-1, -1}, {2, 2}}, {-2, 4}, {1, 2}));
+    ASSERT_EQ(redundant.status, SolutionStatus::Optimal);
+    EXPECT_EQ(redundant.objective, T(2));
+    EXPECT_EQ(redundant.values[0], T(2));
+}
+
+TYPED_TEST(SimplexSolverTests, WarmStartsFromAnOptimalBasis) {
+    using T = TypeParam;
+    const auto problem =
+        makeProblem<T>({{1, 0, 1, 0, 0}, {0, 2, 0, 1, 0}, {3, 2, 0, 0, 1}}, {4, 12, 18}, {-3, -5, 0, 0, 0});
+    const auto cold = SimplexSolver<T>().solve(problem);
+    ASSERT_EQ(cold.status, SolutionStatus::Optimal);
+    ASSERT_EQ(cold.basisState.columns.size(), 5u);
+    EXPECT_EQ(cold.basisState.columns[0], BasisStatus::Basic);
+    EXPECT_EQ(cold.basisState.columns[1], BasisStatus::Basic);
+    EXPECT_EQ(cold.basisState.columns[3], BasisStatus::AtLower);
+
+    const auto warm = SimplexSolver<T>().solve(problem, cold.basisState);
+    ASSERT_EQ(warm.status, SolutionStatus::Optimal);
+    EXPECT_EQ(warm.iterations, 0u);
+    EXPECT_EQ(warm.objective, T(-36));
+
+    // With 2y <= 8 and 3x + 2y <= 24 the old basis puts x at 16/3, past
+    // x <= 4, so its slack turns negative and the repair has to run.
+    auto tightened = problem;
+    tightened.rhs[1] = T(8);
+    tightened.rhs[2] = T(24);
+    const auto repaired = SimplexSolver<T>().solve(tightened, cold.basisState);
+    ASSERT_EQ(repaired.status, SolutionStatus::Optimal);
+    EXPECT_EQ(repaired.objective, SimplexSolver<T>().solve(tightened).objective);
+
+    BasisState wrong = cold.basisState;
+    wrong.rows.pop_back();
+    EXPECT_THROW(SimplexSolver<T>().solve(problem, wrong), std::invalid_argument);
+}
+
+TYPED_TEST(SimplexSolverTests, BigMStartAgreesWithTwoPhase) {
+    using T = TypeParam;
+    typename SimplexSolver<T>::Options options;
+    options.start = limo::simplex::StartMethod::BigM;
+    const SimplexSolver<T> bigM(options);
+
+    const auto textbook =
+        makeProblem<T>({{1, 0, 1, 0, 0}, {0, 2, 0, 1, 0}, {3, 2, 0, 0, 1}}, {4, 12, 18}, {-3, -5, 0, 0, 0});
+    const auto solution = bigM.solve(textbook);
+    ASSERT_EQ(solution.status, SolutionStatus::Optimal);
+    EXPECT_EQ(solution.objective, T(-36));
+    expectValues(solution.duals, {T(0), T(-3) / T(2), T(-1)});
+
+    EXPECT_EQ(bigM.solve(makeProblem<T>({{1, 1}}, {-1}, {1, 1})).status, SolutionStatus::Infeasible);
+    EXPECT_EQ(bigM.solve(makeProblem<T>({{1, -1}}, {1}, {-1, 0})).status, SolutionStatus::Unbounded);
+    // Infeasible with a cost that would be unbounded on its own.
+    EXPECT_EQ(bigM.solve(makeProblem<T>({{1, -1, 0}, {1, -1, 0}}, {1, 2}, {0, 0, -1})).status,
+              SolutionStatus::Infeasible);
+
+    const auto bounded = bigM.solve(makeProblem<T>({{2, 2, 1}}, {5}, {-1, -1, 0}, {1, 3, std::nullopt}));
+    ASSERT_EQ(bounded.status, SolutionStatus::Optimal);
+    EXPECT_EQ(bounded.objective, T(-5) / T(2));
+    const auto redundant = bigM.solve(makeProblem<T>({{-1, -1}, {2, 2}}, {-2, 4}, {1, 2}));
+    ASSERT_EQ(redundant.status, SolutionStatus::Optimal);
+    EXPECT_EQ(redundant.objective, T(2));
+
+    const auto warm = bigM.solve(textbook, solution.basisState);
+    ASSERT_EQ(warm.status, SolutionStatus::Optimal);
+    EXPECT_EQ(warm.iterations, 0u);
+
+    std::mt19937 rng(13);
+    std::uniform_int_distribution<int> coefficient(-3, 5);
+    for (int trial = 0; trial < 10; ++trial) {
+        const std::size_t rows = 4;
+        const std::size_t cols = 9;
+        Matrix<int> constraints(rows, cols);
+        std::vector<int> rhs(rows, 0);
+        std::vector<int> costs(cols);
+        for (std::size_t c = 0; c < cols; ++c) {
+            costs[c] = coefficient(rng);
+            for (std::size_t r = 0; r < rows; ++r) {
+                constraints(r, c) = coefficient(rng);
+                rhs[r] += constraints(r, c) * static_cast<int>(c % 2);
+            }
+        }
+        const auto problem = makeProblem<T>(constraints, rhs, costs, std::vector<std::optional<int>>(cols, 3));
+        const auto twoPhase = SimplexSolver<T>().solve(problem);
+        const auto single = bigM.solve(problem);
+        ASSERT_EQ(single.status, twoPhase.status) << "trial " << trial;
+        if constexpr (std::is_floating_point_v<T>) {
+            EXPECT_NEAR(single.objective, twoPhase.objective, 1e-9) << "trial " << trial;
+        } else {
+            EXPECT_EQ(single.objective, twoPhase.objective) << "trial " << trial;
+        }
+    }
+}
+
+TEST(SimplexSolverExactTests, ReturnsExactRationalOptimum) {
+    // min -x1 - x2  s.t.  3 x1 + x2 <= 7,  x1 + 3 x2 <= 6: both rows bind at a non-integral vertex.
+    const auto problem = makeProblem<Fraction>({{3, 1, 1, 0}, {1, 3, 0, 1}}, {7, 6}, {-1, -1, 0, 0});
+    const auto solution = SimplexSolver<Fraction>().solve(problem);
+    ASSERT_EQ(solution.status, SolutionStatus::Optimal);
+    EXPECT_EQ(solution.values[0], Fraction(15, 8));
+    EXPECT_EQ(solution.values[1], Fraction(11, 8));
+    EXPECT_EQ(solution.objective, Fraction(-13, 4));
+    EXPECT_EQ(solution.duals, (std::vector<Fraction>{Fraction(-1, 4), Fraction(-1, 4)}));
+}
+
+TEST(SimplexSolverDoubleTests, AgreesWithRevisedSimplexOnRandomProblems) {
+    std::mt19937 rng(9);
+    std::uniform_int_distribution<int> coefficient(-3, 5);
+    for (int trial = 0; trial < 20; ++trial) {
+        const std::size_t rows = 5;
+        const std::size_t cols = 11;
+        Matrix<int> constraints(rows, cols);
+        std::vector<int> rhs(rows, 0);
+        std::vector<int> costs(cols);
+        std::vector<std::optional<int>> upper(cols, 5);
+        for (std::size_t c = 0; c < cols; ++c) {
+            costs[c] = coefficient(rng);
+            for (std::size_t r = 0; r < rows; ++r) {
+                constraints(r, c) = coefficient(rng);
+                rhs[r] += constraints(r, c) * static_cast<int>(c % 2);
+            }
+        }
+        const auto problem = makeProblem<double>(constraints, rhs, costs, upper);
+        const auto tableau = SimplexSolver<double>().solve(problem);
+        const auto revised = ModifiedSimplexSolver().solve(problem);
+        ASSERT_EQ(tableau.status, SolutionStatus::Optimal) << "trial " << trial;
+        ASSERT_EQ(revised.status, SolutionStatus::Optimal) << "trial " << trial;
+        EXPECT_NEAR(tableau.objective, revised.objective, 1e-7) << "trial " << trial;
+    }
+}
@@ -0,0 +1,84 @@
+#include "limo/simplex/WarmStart.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+using limo::core::BasisState;
+using limo::core::BasisStatus;
+using limo::simplex::BasisFactorization;
+using limo::simplex::crashBasis;
+using limo::simplex::factorizeBasis;
+
+namespace {
+
+// Columns of the structurals followed by the logicals e_i.
+struct Crash {
+    std::vector<std::vector<double>> columns;
+    std::vector<std::size_t> basis;
+    BasisFactorization factorization;
+
+    explicit Crash(std::vector<std::vector<double>> structurals) : columns(std::move(structurals)) {
+        const std::size_t rows = columns.front().size();
+        for (std::size_t i = 0; i < rows; ++i) {
+            basis.push_back(columns.size() + i);
+        }
+    }
+
+    void load(std::vector<double>& column, std::size_t variable) const {
+        if (variable < columns.size()) {
+            column = columns[variable];
+        } else {
+            column[variable - columns.size()] = 1.0;
+        }
+    }
+
+    void run(const BasisState& start, double pivotTolerance = 1e-9) {
+        const auto loader = [this](std::vector<double>& column, std::size_t variable) { load(column, variable); };
+        factorizeBasis(factorization, basis, loader);
+        crashBasis(start, columns.size(), basis, factorization, pivotTolerance, loader,
+                   [this](std::size_t row, std::size_t column, const std::vector<double>& alpha) {
+                       basis[row] = column;
+                       factorization.update(row, alpha);
+                   });
+    }
+};
+
+} // namespace
+
+TEST(WarmStartTests, SkipsDependentColumnsAndKeptLogicals) {
+    // Column 1 is twice column 0; row 2 keeps its logical, so column 2 goes to row 1.
+    Crash crash({{1.0, 0.0, 0.0}, {2.0, 0.0, 0.0}, {0.0, 1.0, 3.0}});
+    const BasisState start{{BasisStatus::Basic, BasisStatus::Basic, BasisStatus::Basic},
+                           {BasisStatus::AtLower, BasisStatus::AtLower, BasisStatus::Basic}};
+    crash.run(start);
+    EXPECT_EQ(crash.basis, (std::vector<std::size_t>{0, 2, 5}));
+
+    // The updated factorization matches the crashed basis.
+    std::vector<double> x = {1.0, 2.0, 9.0};
+    crash.factorization.ftran(x);
+    EXPECT_NEAR(x[0], 1.0, 1e-12);
+    EXPECT_NEAR(x[1], 2.0, 1e-12);
+    EXPECT_NEAR(x[2], 3.0, 1e-12);
+}
+
+TEST(WarmStartTests, RejectsSmallPivots) {
+    // Row 0 keeps its logical, which leaves column 0 only a pivot far below
+    // its largest entry; column 1 is below the absolute tolerance.
+    Crash crash({{1.0, 1e-9}, {0.0, 1e-3}});
+    const BasisState start{{BasisStatus::Basic, BasisStatus::Basic}, {BasisStatus::Basic, BasisStatus::AtLower}};
+    crash.run(start, 1e-2);
+    EXPECT_EQ(crash.basis, (std::vector<std::size_t>{2, 3}));
+
+    crash.run(start, 1e-4);
+    EXPECT_EQ(crash.basis, (std::vector<std::size_t>{2, 1}));
+}
+
+TEST(WarmStartTests, AcceptsShortStarts) {
+    // Statuses missing from `start` leave their columns nonbasic and their rows free.
+    Crash crash({{0.0, 2.0}, {1.0, 1.0}});
+    crash.run(BasisState{{BasisStatus::Basic}, {}});
+    EXPECT_EQ(crash.basis, (std::vector<std::size_t>{2, 0}));
+}
@@ -0,0 +1,200 @@
+#include "limo/thread_pool/ThreadPool.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+using limo::thread_pool::ThreadPool;
+
+namespace {
+
+/**
+ * The previous ThreadPool design, kept as a baseline: one std::queue and
+ * one mutex shared by every producer and worker.
+ */
+class SingleQueuePool {
+public:
+    explicit SingleQueuePool(std::size_t threadCount) {
+        for (std::size_t i = 0; i < threadCount; ++i) {
+            workers.emplace_back([this]() { workerLoop(); });
+        }
+    }
+
+    ~SingleQueuePool() {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        cv.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    template <typename F>
+    std::future<std::invoke_result_t<F>> submit(F&& f) {
+        using ReturnType = std::invoke_result_t<F>;
+        auto task = std::make_shared<std::packaged_task<ReturnType()>>(std::forward<F>(f));
+        std::future<ReturnType> result = task->get_future();
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            tasks.push([task]() { (*task)(); });
+        }
+        cv.notify_one();
+        return result;
+    }
+
+private:
+    void workerLoop() {
+        while (true) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                cv.wait(lock, [this]() { return stopping || !tasks.empty(); });
+                if (stopping && tasks.empty()) {
+                    return;
+                }
+                task = std::move(tasks.front());
+                tasks.pop();
+            }
+            task();
+        }
+    }
+
+    std::vector<std::thread> workers;
+    std::queue<std::function<void()>> tasks;
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool stopping{false};
+};
+
+constexpr int kTasks = 4096;
+
+// range(0): worker threads. One producer submits many tiny tasks, then waits for all of them.
+template <typename Pool>
+void BM_SubmitTinyTasks(benchmark::State& state) {
+    Pool pool(static_cast<std::size_t>(state.range(0)));
+    std::vector<decltype(pool.submit([]() {}))> futures;
+    futures.reserve(kTasks);
+    std::atomic<int> sink{0};
+    for (auto _ : state) {
+        futures.clear();
+        for (int i = 0; i < kTasks; ++i) {
+            futures.push_back(pool.submit([&sink]() { sink.fetch_add(1, std::memory_order_relaxed); }));
+        }
+        for (auto& future : futures) {
+            future.get();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * kTasks);
+}
+
+// range(0): worker threads. Every worker fans out tiny tasks from inside the
+// pool, the pattern of per-column pricing chunks.
+template <typename Pool>
+void BM_NestedFanOut(benchmark::State& state) {
+    const auto threads = static_cast<std::size_t>(state.range(0));
+    Pool pool(threads);
+    constexpr int kBranches = 64;
+    constexpr int kLeaves = kTasks / kBranches;
+    for (auto _ : state) {
+        std::atomic<int> remaining{kTasks};
+        std::promise<void> done;
+        std::future<void> finished = done.get_future();
+        for (int b = 0; b < kBranches; ++b) {
+            pool.submit([&pool, &remaining, &done]() {
+                for (int l = 0; l < kLeaves; ++l) {
+                    pool.submit([&remaining, &done]() {
+                        if (remaining.fetch_sub(1) == 1) {
+                            done.set_value();
+                        }
+                    });
+                }
+            });
+        }
+        finished.wait();
+    }
+    state.SetItemsProcessed(state.iterations() * kTasks);
+}
+
+// range(0): worker threads. Fire-and-forget submission: no promise, no future.
+void BM_PostTinyTasks(benchmark::State& state) {
+    ThreadPool pool(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        std::atomic<int> remaining{kTasks};
+        std::promise<void> done;
+        std::future<void> finished = done.get_future();
+        for (int i = 0; i < kTasks; ++i) {
+            pool.post([&remaining, &done]() {
+                if (remaining.fetch_sub(1) == 1) {
+                    done.set_value();
+                }
+            });
+        }
+        finished.wait();
+    }
+    state.SetItemsProcessed(state.iterations() * kTasks);
+}
+
+constexpr std::size_t kLoopLength = 1 << 20;
+
+// range(0): worker threads. A cheap loop split into one future per chunk,
+// the way pooled kernels were written before the bulk primitives.
+void BM_LoopWithFutures(benchmark::State& state) {
+    ThreadPool pool(static_cast<std::size_t>(state.range(0)));
+    std::vector<float> data(kLoopLength, 1.0f);
+    const std::size_t chunks = 4 * pool.size();
+    const std::size_t chunkSize = (kLoopLength + chunks - 1) / chunks;
+    for (auto _ : state) {
+        std::vector<limo::thread_pool::Future<void>> pending;
+        for (std::size_t begin = 0; begin < kLoopLength; begin += chunkSize) {
+            const std::size_t end = std::min(begin + chunkSize, kLoopLength);
+            pending.push_back(pool.submit([&data, begin, end]() {
+                for (std::size_t i = begin; i < end; ++i) {
+                    data[i] = data[i] * 0.5f + 1.0f;
+                }
+            }));
+        }
+        for (auto& future : pending) {
+            future.get();
+        }
+        benchmark::DoNotOptimize(data.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kLoopLength));
+}
+
+// range(0): worker threads. The same loop through ThreadPool::parallelFor.
+void BM_LoopWithParallelFor(benchmark::State& state) {
+    ThreadPool pool(static_cast<std::size_t>(state.range(0)));
+    std::vector<float> data(kLoopLength, 1.0f);
+    for (auto _ : state) {
+        pool.parallelFor(0, kLoopLength, 4096, [&data](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                data[i] = data[i] * 0.5f + 1.0f;
+            }
+        });
+        benchmark::DoNotOptimize(data.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kLoopLength));
+}
+
+} // namespace
+
+BENCHMARK(BM_PostTinyTasks)->RangeMultiplier(2)->Range(1, 32)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_SubmitTinyTasks, SingleQueuePool)->RangeMultiplier(2)->Range(1, 32)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_SubmitTinyTasks, ThreadPool)->RangeMultiplier(2)->Range(1, 32)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_NestedFanOut, SingleQueuePool)->RangeMultiplier(2)->Range(1, 32)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_NestedFanOut, ThreadPool)->RangeMultiplier(2)->Range(1, 32)->UseRealTime();
+BENCHMARK(BM_LoopWithFutures)->RangeMultiplier(2)->Range(1, 32)->UseRealTime();
+BENCHMARK(BM_LoopWithParallelFor)->RangeMultiplier(2)->Range(1, 32)->UseRealTime();
@@ -0,0 +1,260 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <future>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace limo::thread_pool {
+
+namespace detail {
+
+/**
+ * Blocks for future states, recycled through per-thread caches that spill to
+ * and refill from a shared list, so a steady stream of submissions stops
+ * calling the global allocator even when results are released on another
+ * thread than the one that created them.
+ */
+void* allocateState(std::size_t size);
+void deallocateState(void* block, std::size_t size) noexcept;
+
+template <typename T>
+class SharedState {
+public:
+    using Stored = std::conditional_t<std::is_void_v<T>, std::monostate, T>;
+
+    static SharedState* create() {
+        static_assert(alignof(Stored) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "over-aligned results are not supported");
+        return ::new (allocateState(sizeof(SharedState))) SharedState();
+    }
+
+    void retain() noexcept { refs.fetch_add(1, std::memory_order_relaxed); }
+
+    void release() noexcept {
+        if (refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            this->~SharedState();
+            deallocateState(this, sizeof(SharedState));
+        }
+    }
+
+    bool isReady() const noexcept { return ready.load(std::memory_order_acquire) != 0; }
+
+    void wait() const noexcept {
+        while (ready.load(std::memory_order_acquire) == 0) {
+            ready.wait(0, std::memory_order_acquire);
+        }
+    }
+
+    template <typename... Value>
+    void setValue(Value&&... value) {
+        this->value.emplace(std::forward<Value>(value)...);
+        publish();
+    }
+
+    void setException(std::exception_ptr exception) {
+        error = std::move(exception);
+        publish();
+    }
+
+    Stored take() {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        return std::move(*value);
+    }
+
+private:
+    SharedState() = default;
+
+    void publish() noexcept {
+        ready.store(1, std::memory_order_release);
+        ready.notify_all();
+    }
+
+    std::atomic<std::uint32_t> refs{1};
+    std::atomic<std::uint32_t> ready{0};
+    std::exception_ptr error;
+    std::optional<Stored> value;
+};
+
+} // namespace detail
+
+/**
+ * @brief Result of a task submitted to ThreadPool.
+ *
+ * A leaner replacement for std::future: the shared state is a refcounted
+ * block from a recycled pool, readiness is one atomic flag waited on with
+ * C++20 atomic wait (no mutex or condition variable), and get() can be
+ * called once.
+ */
+template <typename T>
+class Future {
+public:
+    Future() noexcept = default;
+
+    Future(Future&& other) noexcept : state(std::exchange(other.state, nullptr)) {}
+
+    Future& operator=(Future&& other) noexcept {
+        if (this != &other) {
+            reset();
+            state = std::exchange(other.state, nullptr);
+        }
+        return *this;
+    }
+
+    Future(const Future&) = delete;
+    Future& operator=(const Future&) = delete;
+
+    ~Future() { reset(); }
+
+    bool valid() const noexcept { return state != nullptr; }
+
+    /**
+     * @throws std::future_error if the future has no state.
+     */
+    bool isReady() const {
+        requireState();
+        return state->isReady();
+    }
+
+    /**
+     * @throws std::future_error if the future has no state.
+     */
+    void wait() const {
+        requireState();
+        state->wait();
+    }
+
+    /**
+     * @brief Waits for the result and hands it over; the future is invalid afterwards.
+     * @throws Whatever the task threw, or std::future_error if the future has no state.
+     */
+    T get() {
+        wait();
+        detail::SharedState<T>* taken = std::exchange(state, nullptr);
+        struct Release {
+            detail::SharedState<T>* state;
+            ~Release() { state->release(); }
+        } release{taken};
+        if constexpr (std::is_void_v<T>) {
+            taken->take();
+        } else {
+            return taken->take();
+        }
+    }
+
+private:
+    template <typename>
+    friend class Promise;
+
+    explicit Future(detail::SharedState<T>* state) noexcept : state(state) {}
+
+    void requireState() const {
+        if (state == nullptr) {
+            throw std::future_error(std::future_errc::no_state);
+        }
+    }
+
+    void reset() noexcept {
+        if (state != nullptr) {
+            std::exchange(state, nullptr)->release();
+        }
+    }
+
+    detail::SharedState<T>* state{nullptr};
+};
+
+/**
+ * @brief Producer side of a Future. A promise destroyed without a result
+ * leaves std::future_errc::broken_promise in its future.
+ */
+template <typename T>
+class Promise {
+public:
+    Promise() : state(detail::SharedState<T>::create()) {}
+
+    Promise(Promise&& other) noexcept
+        : state(std::exchange(other.state, nullptr)),
+          futureRetrieved(other.futureRetrieved),
+          satisfied(other.satisfied) {}
+
+    Promise& operator=(Promise&&) = delete;
+    Promise(const Promise&) = delete;
+    Promise& operator=(const Promise&) = delete;
+
+    ~Promise() {
+        if (state == nullptr) {
+            return;
+        }
+        if (!satisfied) {
+            state->setException(std::make_exception_ptr(std::future_error(std::future_errc::broken_promise)));
+        }
+        state->release();
+    }
+
+    /**
+     * @throws std::future_error if the future was already retrieved.
+     */
+    Future<T> getFuture() {
+        if (futureRetrieved) {
+            throw std::future_error(std::future_errc::future_already_retrieved);
+        }
+        futureRetrieved = true;
+        state->retain();
+        return Future<T>(state);
+    }
+
+    /**
+     * @throws std::future_error if a result was already set.
+     */
+    template <typename... Value>
+    void setValue(Value&&... value) {
+        markSatisfied();
+        state->setValue(std::forward<Value>(value)...);
+    }
+
+    /**
+     * @throws std::future_error if a result was already set.
+     */
+    void setException(std::exception_ptr exception) {
+        markSatisfied();
+        state->setException(std::move(exception));
+    }
+
+    /**
+     * @brief Runs `callable` and stores its result, or the exception it threw.
+     */
+    template <typename Callable>
+    void fulfil(Callable&& callable) {
+        try {
+            if constexpr (std::is_void_v<T>) {
+                std::forward<Callable>(callable)();
+                setValue();
+            } else {
+                setValue(std::forward<Callable>(callable)());
+            }
+        } catch (...) {
+            setException(std::current_exception());
+        }
+    }
+
+private:
+    void markSatisfied() {
+        if (satisfied) {
+            throw std::future_error(std::future_errc::promise_already_satisfied);
+        }
+        satisfied = true;
+    }
+
+    detail::SharedState<T>* state;
+    bool futureRetrieved{false};
+    bool satisfied{false};
+};
+
+} // namespace limo::thread_pool
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <vector>
+
+// Set by the LIMO_THREAD_POOL_STATS CMake option. When 0 every
+// instrumentation hook in ThreadPool is discarded at compile time.
+#ifndef LIMO_THREAD_POOL_STATS
+#define LIMO_THREAD_POOL_STATS 0
+#endif
+
+namespace limo::thread_pool {
+
+inline constexpr bool kStatsEnabled = LIMO_THREAD_POOL_STATS != 0;
+
+/**
+ * @brief Histogram of durations with power-of-two nanosecond buckets.
+ *
+ * Bucket 0 holds [0, 2) ns and bucket i > 0 holds [2^i, 2^(i+1)) ns; the
+ * last bucket also takes everything longer.
+ */
+struct LatencyHistogram {
+    static constexpr std::size_t kBuckets = 40;
+
+    std::array<std::uint64_t, kBuckets> counts{};
+
+    static std::size_t bucketOf(std::uint64_t nanoseconds);
+    /// Exclusive upper bound of `bucket` in nanoseconds.
+    static std::uint64_t upperBound(std::size_t bucket);
+
+    std::uint64_t total() const;
+    /**
+     * @brief Upper bound of the bucket holding the q-quantile, 0 <= q <= 1.
+     * Returns 0 for an empty histogram.
+     */
+    std::uint64_t quantile(double q) const;
+
+    LatencyHistogram& operator+=(const LatencyHistogram& other);
+};
+
+/**
+ * @brief What one thread did for the pool.
+ */
+struct WorkerStats {
+    std::uint64_t tasksRun{0};
+    /// Tasks taken from another thread's deque.
+    std::uint64_t steals{0};
+    /// Time spent running tasks. Tasks run while waiting inside a task are not counted twice.
+    std::chrono::nanoseconds busy{0};
+    /// Time spent asleep waiting for tasks.
+    std::chrono::nanoseconds idle{0};
+};
+
+/**
+ * @brief Snapshot of a ThreadPool's instrumentation, see ThreadPool::stats().
+ *
+ * Counters are read one by one while the pool keeps running, so a snapshot
+ * of a busy pool is approximate: totals may be off by the tasks in flight.
+ */
+struct PoolStats {
+    /// False when the pool was built without LIMO_THREAD_POOL_STATS; only queueDepth is filled then.
+    bool enabled{kStatsEnabled};
+    /// Tasks queued and not yet started.
+    std::size_t queueDepth{0};
+    std::size_t peakQueueDepth{0};
+    /// Time from enqueue to the start of the task.
+    LatencyHistogram waitLatency;
+    /// Time from the start to the end of the task.
+    LatencyHistogram runTime;
+    /// One entry per worker thread.
+    std::vector<WorkerStats> workers;
+    /// Tasks run by threads outside the pool while waiting in a bulk primitive.
+    WorkerStats external;
+
+    std::uint64_t tasksRun() const;
+};
+
+/**
+ * @brief Writes a human-readable report of `stats`.
+ */
+void writeStats(std::ostream& out, const PoolStats& stats);
+
+} // namespace limo::thread_pool
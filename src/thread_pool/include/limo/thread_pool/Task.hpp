@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace limo::thread_pool {
+
+/**
+ * @brief Move-only `void()` callable with small-buffer storage.
+ *
+ * Callables up to kInlineSize bytes that can be moved without throwing are
+ * stored inside the Task itself, so wrapping a lambda with a few captures
+ * never touches the heap. Larger callables fall back to one allocation.
+ * Unlike std::function the callable does not need to be copyable, which
+ * lets it own a promise.
+ */
+class Task {
+public:
+    static constexpr std::size_t kInlineSize = 64;
+
+    Task() noexcept = default;
+
+    template <typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, Task>>>
+    Task(F&& f) {
+        using Callable = std::decay_t<F>;
+        if constexpr (fitsInline<Callable>()) {
+            ::new (static_cast<void*>(storage)) Callable(std::forward<F>(f));
+            ops = &inlineOps<Callable>;
+        } else {
+            *reinterpret_cast<Callable**>(storage) = new Callable(std::forward<F>(f));
+            ops = &heapOps<Callable>;
+        }
+    }
+
+    Task(Task&& other) noexcept : ops(other.ops) {
+        if (ops != nullptr) {
+            ops->relocate(other.storage, storage);
+            other.ops = nullptr;
+        }
+    }
+
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            reset();
+            if (other.ops != nullptr) {
+                other.ops->relocate(other.storage, storage);
+                ops = other.ops;
+                other.ops = nullptr;
+            }
+        }
+        return *this;
+    }
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    ~Task() { reset(); }
+
+    explicit operator bool() const noexcept { return ops != nullptr; }
+
+    /// Whether the callable lives in the inline buffer (no allocation was made).
+    bool isInline() const noexcept { return ops != nullptr && ops->isInline; }
+
+    void operator()() { ops->invoke(storage); }
+
+    template <typename Callable>
+    static constexpr bool fitsInline() {
+        return sizeof(Callable) <= kInlineSize && alignof(Callable) <= alignof(std::max_align_t) &&
+               std::is_nothrow_move_constructible_v<Callable>;
+    }
+
+private:
+    struct Ops {
+        void (*invoke)(void* storage);
+        // Move-constructs into `to` and destroys the source.
+        void (*relocate)(void* from, void* to) noexcept;
+        void (*destroy)(void* storage) noexcept;
+        bool isInline;
+    };
+
+    template <typename Callable>
+    static constexpr Ops inlineOps{
+        [](void* storage) { std::invoke(*static_cast<Callable*>(storage)); },
+        [](void* from, void* to) noexcept {
+            ::new (to) Callable(std::move(*static_cast<Callable*>(from)));
+            static_cast<Callable*>(from)->~Callable();
+        },
+        [](void* storage) noexcept { static_cast<Callable*>(storage)->~Callable(); },
+        true,
+    };
+
+    template <typename Callable>
+    static constexpr Ops heapOps{
+        [](void* storage) { std::invoke(**static_cast<Callable**>(storage)); },
+        [](void* from, void* to) noexcept { *static_cast<Callable**>(to) = *static_cast<Callable**>(from); },
+        [](void* storage) noexcept { delete *static_cast<Callable**>(storage); },
+        false,
+    };
+
+    void reset() noexcept {
+        if (ops != nullptr) {
+            ops->destroy(storage);
+            ops = nullptr;
+        }
+    }
+
+    alignas(std::max_align_t) unsigned char storage[kInlineSize];
+    const Ops* ops{nullptr};
+};
+
+} // namespace limo::thread_pool
@@ -1,10 +1,19 @@
 #pragma once
 
+#include "limo/thread_pool/Future.hpp"
+#include "limo/thread_pool/Stats.hpp"
+#include "limo/thread_pool/Task.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <cstddef>
+#include <exception>
 #include <functional>
-#include <future>
+#include <latch>
+#include <memory>
 #include <mutex>
-#include <queue>
 #include <stdexcept>
 #include <thread>
 #include <type_traits>
@@ -12,18 +21,98 @@
 
 namespace limo::thread_pool {
 
+namespace detail {
+
+/**
+ * Keeps the first exception thrown by any participant of a bulk operation;
+ * read after the operation's latch, which orders it.
+ */
+class FirstError {
+public:
+    void capture() noexcept {
+        if (!failed.exchange(true)) {
+            error = std::current_exception();
+        }
+    }
+
+    bool hasFailed() const noexcept { return failed.load(std::memory_order_relaxed); }
+
+    void rethrow() const {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+private:
+    std::atomic<bool> failed{false};
+    std::exception_ptr error;
+};
+
+/**
+ * Shared cursor of a parallelFor: participants claim guided chunks of
+ * max(grain, remaining / (2 * participants)) elements, so chunks start
+ * large and shrink towards the end of the range where balance matters.
+ */
+class RangeCursor {
+public:
+    RangeCursor(std::size_t begin, std::size_t end, std::size_t grain, std::size_t participants)
+        : next(begin), end(end), grain(grain), participants(participants) {}
+
+    template <typename F>
+    void run(F& fn, FirstError& error) {
+        std::size_t start = next.load(std::memory_order_relaxed);
+        while (start < end) {
+            const std::size_t size = std::min(end - start, std::max(grain, (end - start) / (2 * participants)));
+            if (!next.compare_exchange_weak(start, start + size, std::memory_order_relaxed)) {
+                continue;
+            }
+            try {
+                fn(start, start + size);
+            } catch (...) {
+                error.capture();
+                next.store(end, std::memory_order_relaxed);
+            }
+            start = next.load(std::memory_order_relaxed);
+        }
+    }
+
+private:
+    std::atomic<std::size_t> next;
+    std::size_t end;
+    std::size_t grain;
+    std::size_t participants;
+};
+
+} // namespace detail
+
 /**
- * @brief A simple thread pool for executing tasks concurrently.
+ * @brief A work-stealing thread pool for executing tasks concurrently.
  *
  * Allows submitting tasks that return futures, managing a pool of worker threads
  * to execute them. Supports graceful shutdown to finish queued tasks before stopping.
  *
+ * Every worker owns a deque guarded by its own mutex. The owner pushes and
+ * pops at the back (newest first, which keeps nested work cache-warm) and
+ * idle workers steal from the front of other deques. Tasks submitted from a
+ * worker go to that worker's deque; tasks from other threads are spread
+ * round-robin. Idle workers sleep on a condition variable that producers
+ * only touch when someone is actually sleeping.
+ *
+ * Besides single tasks the pool offers bulk primitives (parallelFor,
+ * parallelReduce, submitBatch) that enqueue their work under one lock per
+ * deque, let the calling thread take part, and wait on a single latch.
+ * While it waits, the caller runs queued tasks itself, so the primitives
+ * may be nested inside tasks of the same pool.
+ *
+ * Built with LIMO_THREAD_POOL_STATS, the pool also records queue depth,
+ * wait and run time histograms and per-thread utilization, readable with
+ * stats(). Each thread writes only its own counters; without the option
+ * the hooks compile to nothing.
+ *
  * @author Volodymyr Shpyrka
  */
 class ThreadPool {
 public:
-    using Task = std::function<void()>;
-
     explicit ThreadPool(std::size_t threadCount = std::thread::hardware_concurrency());
     ~ThreadPool();
 
@@ -35,6 +124,14 @@ public:
     std::size_t size() const;
     void shutdown();
 
+    /**
+     * @brief Snapshot of the pool's instrumentation.
+     *
+     * Without LIMO_THREAD_POOL_STATS only the current queue depth is
+     * filled in and PoolStats::enabled is false.
+     */
+    PoolStats stats() const;
+
     /**
      * @brief Submit a callable for execution on the thread pool - variadic template.
      *
@@ -42,43 +139,276 @@ public:
      * and its arguments, schedules it on the pool, and returns a future to retrieve the
      * result when the task finishes.
      *
-     * std::packaged_task<ReturnType()> wraps a zero-argument callable that returns ReturnType;
-     * it stores the result so the associated std::future<ReturnType> can retrieve it.
-     * 
+     * The callable and its arguments are moved into a Task together with a Promise for the
+     * result. Small callables fit in the Task's inline buffer and the promise's state comes
+     * from a recycled pool, so in steady state submitting does not allocate.
+     *
      * @tparam F Callable type. May be a function pointer, lambda, or functor.
      * @tparam Args Argument types forwarded to the callable.
      *
      * The return type of the callable is deduced as:
-     * - ReturnType = std::invoke_result_t<F, Args...>
-     * - The returned future is std::future<ReturnType>
+     * - ReturnType = std::invoke_result_t<F&, Args&...> (arguments are stored and passed as lvalues)
+     * - The returned future is Future<ReturnType>
      *
      * @param f Callable to execute.
      * @param args Arguments passed to the callable.
-     * @return std::future<ReturnType> Future representing the result of the task.
+     * @return Future<ReturnType> Future representing the result of the task.
      * @throws std::runtime_error if the pool is shutting down and cannot accept tasks.
      */
     template <typename F, typename... Args>
-    std::future<std::invoke_result_t<F, Args...>> submit(F&& f, Args&&... args) {
-        using ReturnType = std::invoke_result_t<F, Args...>;
-        std::shared_ptr<std::packaged_task<ReturnType()>>
-        task = std::make_shared<std::packaged_task<ReturnType()>>(
-            std::bind(std::forward<F>(f), std::forward<Args>(args)...)
-        );
-        std::future<ReturnType> result = task->get_future();
-
-        enqueue([task]() { (*task)(); });
+    Future<std::invoke_result_t<std::decay_t<F>&, std::decay_t<Args>&...>> submit(F&& f, Args&&... args) {
+        using ReturnType = std::invoke_result_t<std::decay_t<F>&, std::decay_t<Args>&...>;
+        Promise<ReturnType> promise;
+        Future<ReturnType> result = promise.getFuture();
+
+        enqueue(Task([promise = std::move(promise), f = std::forward<F>(f),
+                      ... args = std::forward<Args>(args)]() mutable {
+            promise.fulfil([&]() -> ReturnType { return std::invoke(f, args...); });
+        }));
         return result;
     }
 
+    /**
+     * @brief Fire-and-forget variant of submit(): no future, no promise.
+     *
+     * An exception escaping the callable calls std::terminate, as it would
+     * on a std::thread.
+     *
+     * @throws std::runtime_error if the pool is shutting down and cannot accept tasks.
+     */
+    template <typename F, typename... Args>
+    void post(F&& f, Args&&... args) {
+        enqueue(Task([f = std::forward<F>(f), ... args = std::forward<Args>(args)]() mutable noexcept {
+            std::invoke(f, args...);
+        }));
+    }
+
+    /**
+     * @brief Runs fn(chunkBegin, chunkEnd) over disjoint chunks covering [begin, end).
+     *
+     * Chunks hold at least `grain` elements and are claimed from a shared
+     * cursor by the calling thread and up to size() helper tasks, with
+     * guided sizes: large first, finer towards the end. Returns when the
+     * whole range is done. After an exception the remaining chunks are
+     * skipped and the first exception is rethrown. A pool that is shutting
+     * down leaves the whole range to the calling thread.
+     */
+    template <typename F>
+    void parallelFor(std::size_t begin, std::size_t end, std::size_t grain, F&& fn) {
+        if (begin >= end) {
+            return;
+        }
+        grain = std::max<std::size_t>(grain, 1);
+        const std::size_t chunks = (end - begin + grain - 1) / grain;
+        const std::size_t helpers = std::min(workers.size(), chunks - 1);
+        if (helpers == 0) {
+            fn(begin, end);
+            return;
+        }
+        detail::FirstError error;
+        detail::RangeCursor cursor(begin, end, grain, helpers + 1);
+        std::latch done(static_cast<std::ptrdiff_t>(helpers));
+        const bool accepted = enqueueBulk(helpers, [&](std::size_t) {
+            return Task([&cursor, &fn, &error, &done]() noexcept {
+                cursor.run(fn, error);
+                done.count_down();
+            });
+        });
+        cursor.run(fn, error);
+        if (accepted) {
+            waitHelping(done);
+        }
+        error.rethrow();
+    }
+
+    /**
+     * @brief Reduces [begin, end): map(chunkBegin, chunkEnd) per chunk of exactly
+     * `grain` elements (the last may be shorter), folded in index order with
+     * combine(accumulated, chunkResult) starting from `identity`.
+     *
+     * The chunk boundaries depend only on the range and the grain, so the
+     * result is the same for every thread count, even for non-associative
+     * operations such as floating-point sums.
+     */
+    template <typename T, typename Map, typename Combine>
+    T parallelReduce(std::size_t begin, std::size_t end, std::size_t grain, T identity, Map&& map,
+                     Combine&& combine) {
+        if (begin >= end) {
+            return identity;
+        }
+        grain = std::max<std::size_t>(grain, 1);
+        const std::size_t chunks = (end - begin + grain - 1) / grain;
+        if (chunks == 1) {
+            return combine(std::move(identity), map(begin, end));
+        }
+        std::vector<T> partial(chunks, identity);
+        parallelFor(0, chunks, 1, [&](std::size_t first, std::size_t last) {
+            for (std::size_t c = first; c < last; ++c) {
+                const std::size_t chunkBegin = begin + c * grain;
+                partial[c] = map(chunkBegin, std::min(chunkBegin + grain, end));
+            }
+        });
+        T result = std::move(identity);
+        for (T& value : partial) {
+            result = combine(std::move(result), std::move(value));
+        }
+        return result;
+    }
+
+    /**
+     * @brief Runs fn(0), ..., fn(count - 1) as separate tasks and waits for all of them.
+     *
+     * Meant for a batch of independent, coarse jobs: all tasks are enqueued
+     * at once (one lock per deque, one wake-up) so idle workers can steal
+     * them individually, and the calling thread executes queued tasks until
+     * the batch's latch opens. Once a job has thrown, jobs that have not
+     * started yet are skipped and the first exception is rethrown. A pool
+     * that is shutting down leaves the whole batch to the calling thread.
+     */
+    template <typename F>
+    void submitBatch(std::size_t count, F&& fn) {
+        if (count == 0) {
+            return;
+        }
+        detail::FirstError error;
+        std::latch done(static_cast<std::ptrdiff_t>(count));
+        auto runOne = [&fn, &error](std::size_t index) noexcept {
+            if (error.hasFailed()) {
+                return;
+            }
+            try {
+                fn(index);
+            } catch (...) {
+                error.capture();
+            }
+        };
+        const bool accepted = enqueueBulk(count, [&](std::size_t index) {
+            return Task([&runOne, &done, index]() noexcept {
+                runOne(index);
+                done.count_down();
+            });
+        });
+        if (accepted) {
+            waitHelping(done);
+        } else {
+            for (std::size_t index = 0; index < count; ++index) {
+                runOne(index);
+            }
+        }
+        error.rethrow();
+    }
+
 private:
+    using Clock = std::chrono::steady_clock;
+    struct NoStamp {};
+
+    // A queued task and, with stats compiled in, when it was enqueued.
+    struct QueuedTask {
+        Task task;
+        [[no_unique_address]] std::conditional_t<kStatsEnabled, Clock::time_point, NoStamp> queuedAt{};
+    };
+
+    static auto enqueueStamp() {
+        if constexpr (kStatsEnabled) {
+            return Clock::now();
+        } else {
+            return NoStamp{};
+        }
+    }
+
+    // Growable ring buffer of tasks. Unlike std::deque it keeps its storage
+    // once grown, so pushing and popping in steady state never allocates.
+    class TaskRing {
+    public:
+        bool empty() const { return count == 0; }
+        void pushBack(QueuedTask task);
+        QueuedTask popBack();
+        QueuedTask popFront();
+
+    private:
+        std::vector<QueuedTask> slots;
+        std::size_t head{0};
+        std::size_t count{0};
+    };
+
+    struct alignas(64) WorkerQueue {
+        std::mutex mutex;
+        TaskRing tasks;
+    };
+
     void enqueue(Task task);
-    void workerLoop();
+
+    // Enqueues makeTask(0), ..., makeTask(count - 1) spread over the deques,
+    // starting with the calling worker's own, and locking one deque at a
+    // time for its share. The batch is accepted or refused as a whole:
+    // shutdown() waits for batches that got in before it. Returns false,
+    // enqueuing nothing, once the pool is stopping. The tasks point into the
+    // caller's frame, so a half-enqueued batch cannot be unwound: running
+    // out of memory here terminates.
+    template <typename MakeTask>
+    bool enqueueBulk(std::size_t count, const MakeTask& makeTask) noexcept {
+        if (!beginBulk()) {
+            return false;
+        }
+        const auto stamp = enqueueStamp();
+        const std::size_t first = bulkStart(count);
+        const std::size_t shares = std::min(count, queues.size());
+        for (std::size_t share = 0; share < shares; ++share) {
+            WorkerQueue& queue = *queues[(first + share) % queues.size()];
+            std::size_t pushed = 0;
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            for (std::size_t i = share; i < count; i += queues.size()) {
+                queue.tasks.pushBack(QueuedTask{makeTask(i), stamp});
+                ++pushed;
+            }
+            recordDepth(pending.fetch_add(pushed) + pushed);
+        }
+        endBulk();
+        wakeSleepers(count);
+        return true;
+    }
+
+    // Registers a bulk enqueue with shutdown(); false if the pool is stopping.
+    bool beginBulk() noexcept;
+    void endBulk() noexcept;
+    // Deque that receives the first share of a batch of `count` tasks.
+    std::size_t bulkStart(std::size_t count) noexcept;
+
+    void recordDepth(std::size_t depth) noexcept {
+        if constexpr (kStatsEnabled) {
+            std::size_t peak = peakDepth.load(std::memory_order_relaxed);
+            while (depth > peak && !peakDepth.compare_exchange_weak(peak, depth, std::memory_order_relaxed)) {
+            }
+        }
+    }
+
+    void wakeSleepers(std::size_t count);
+    // Blocks until `done` opens, running queued tasks in the meantime.
+    void waitHelping(std::latch& done);
+    bool runQueuedTask();
+    void runTask(QueuedTask& queued, bool stolen);
+    void workerLoop(std::size_t index);
+    bool popLocal(std::size_t index, QueuedTask& task);
+    bool steal(std::size_t thief, QueuedTask& task);
+
+    // Counters owned by one thread each; defined in ThreadPool.cpp.
+    struct StatsSlot;
 
     std::vector<std::thread> workers;
-    std::queue<Task> tasks;
-    mutable std::mutex mutex;
+    std::vector<std::unique_ptr<WorkerQueue>> queues;
+    // Tasks sitting in any deque; changed under the owning deque's mutex.
+    std::atomic<std::size_t> pending{0};
+    std::atomic<std::size_t> nextQueue{0};
+    // Bulk enqueues between beginBulk() and endBulk().
+    std::atomic<std::size_t> bulkInFlight{0};
+    std::atomic<std::size_t> sleepers{0};
+    std::atomic<bool> stopping{false};
+    std::mutex sleepMutex;
     std::condition_variable cv;
-    bool stopping{false};
+    // Stats only: the highest `pending` seen, and one slot per worker plus a
+    // last, shared one for threads outside the pool.
+    std::atomic<std::size_t> peakDepth{0};
+    std::vector<std::unique_ptr<StatsSlot>> statsSlots;
 };
 
 } // namespace limo::thread_pool
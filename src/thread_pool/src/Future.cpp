@@ -0,0 +1,95 @@
+#include "limo/thread_pool/Future.hpp"
+
+#include <mutex>
+#include <vector>
+
+namespace limo::thread_pool::detail {
+
+namespace {
+
+constexpr std::size_t kGranularity = 64;
+constexpr std::size_t kSizeClasses = 4;
+constexpr std::size_t kCacheCapacity = 64;
+constexpr std::size_t kBatch = kCacheCapacity / 2;
+
+std::size_t sizeClass(std::size_t size) {
+    return (size + kGranularity - 1) / kGranularity - 1;
+}
+
+// Blocks handed between threads: caches that overflow spill half their
+// blocks here, empty caches refill from here.
+struct SharedBlocks {
+    std::mutex mutex;
+    std::vector<void*> blocks[kSizeClasses];
+    std::size_t created[kSizeClasses]{};
+};
+
+SharedBlocks& sharedBlocks() {
+    // Leaked on purpose: thread caches may still flush into it during static destruction.
+    static SharedBlocks* blocks = new SharedBlocks();
+    return *blocks;
+}
+
+struct ThreadCache {
+    void* blocks[kSizeClasses][kCacheCapacity];
+    std::size_t counts[kSizeClasses]{};
+
+    ~ThreadCache() {
+        SharedBlocks& shared = sharedBlocks();
+        std::lock_guard<std::mutex> lock(shared.mutex);
+        for (std::size_t c = 0; c < kSizeClasses; ++c) {
+            shared.blocks[c].insert(shared.blocks[c].end(), blocks[c], blocks[c] + counts[c]);
+        }
+    }
+};
+
+thread_local ThreadCache cache;
+
+} // namespace
+
+void* allocateState(std::size_t size) {
+    const std::size_t c = sizeClass(size);
+    if (c >= kSizeClasses) {
+        return ::operator new(size);
+    }
+    if (cache.counts[c] == 0) {
+        SharedBlocks& shared = sharedBlocks();
+        std::lock_guard<std::mutex> lock(shared.mutex);
+        std::vector<void*>& blocks = shared.blocks[c];
+        while (cache.counts[c] < kBatch && !blocks.empty()) {
+            cache.blocks[c][cache.counts[c]++] = blocks.back();
+            blocks.pop_back();
+        }
+        if (cache.counts[c] == 0) {
+            // Keeping room for every block ever made means spilling never reallocates.
+            if (++shared.created[c] > blocks.capacity()) {
+                blocks.reserve(2 * shared.created[c]);
+            }
+            return ::operator new((c + 1) * kGranularity);
+        }
+    }
+    return cache.blocks[c][--cache.counts[c]];
+}
+
+void deallocateState(void* block, std::size_t size) noexcept {
+    const std::size_t c = sizeClass(size);
+    if (c >= kSizeClasses) {
+        ::operator delete(block);
+        return;
+    }
+    if (cache.counts[c] == kCacheCapacity) {
+        SharedBlocks& shared = sharedBlocks();
+        std::lock_guard<std::mutex> lock(shared.mutex);
+        try {
+            shared.blocks[c].insert(shared.blocks[c].end(), cache.blocks[c] + kBatch,
+                                    cache.blocks[c] + kCacheCapacity);
+            cache.counts[c] = kBatch;
+        } catch (...) {
+            ::operator delete(block);
+            return;
+        }
+    }
+    cache.blocks[c][cache.counts[c]++] = block;
+}
+
+} // namespace limo::thread_pool::detail
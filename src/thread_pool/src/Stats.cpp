@@ -0,0 +1,123 @@
+#include "limo/thread_pool/Stats.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+#include <string>
+
+namespace limo::thread_pool {
+
+namespace {
+
+std::string formatDuration(std::uint64_t nanoseconds) {
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(1);
+    if (nanoseconds < 1000) {
+        out << nanoseconds << " ns";
+    } else if (nanoseconds < 1000000) {
+        out << static_cast<double>(nanoseconds) / 1e3 << " us";
+    } else if (nanoseconds < 1000000000) {
+        out << static_cast<double>(nanoseconds) / 1e6 << " ms";
+    } else {
+        out << static_cast<double>(nanoseconds) / 1e9 << " s";
+    }
+    return out.str();
+}
+
+void writeHistogram(std::ostream& out, const char* name, const LatencyHistogram& histogram) {
+    out << "  " << std::left << std::setw(14) << name << std::right;
+    if (histogram.total() == 0) {
+        out << "no samples\n";
+        return;
+    }
+    out << "p50 < " << formatDuration(histogram.quantile(0.5)) << ", p90 < " << formatDuration(histogram.quantile(0.9))
+        << ", p99 < " << formatDuration(histogram.quantile(0.99)) << ", max < "
+        << formatDuration(histogram.quantile(1.0)) << '\n';
+}
+
+void writeWorker(std::ostream& out, const std::string& name, const WorkerStats& worker) {
+    const auto busy = static_cast<double>(worker.busy.count());
+    const auto idle = static_cast<double>(worker.idle.count());
+    const double utilization = busy + idle > 0 ? 100.0 * busy / (busy + idle) : 0.0;
+    out << "  " << std::left << std::setw(9) << name << std::right << std::setw(10) << worker.tasksRun << std::setw(9)
+        << worker.steals << std::setw(12) << formatDuration(static_cast<std::uint64_t>(worker.busy.count()))
+        << std::setw(12) << formatDuration(static_cast<std::uint64_t>(worker.idle.count())) << std::setw(8)
+        << std::fixed << std::setprecision(1) << utilization << "%\n";
+}
+
+} // namespace
+
+std::size_t LatencyHistogram::bucketOf(std::uint64_t nanoseconds) {
+    if (nanoseconds < 2) {
+        return 0;
+    }
+    return std::min<std::size_t>(std::bit_width(nanoseconds) - 1, kBuckets - 1);
+}
+
+std::uint64_t LatencyHistogram::upperBound(std::size_t bucket) {
+    return std::uint64_t{2} << bucket;
+}
+
+std::uint64_t LatencyHistogram::total() const {
+    std::uint64_t sum = 0;
+    for (std::uint64_t count : counts) {
+        sum += count;
+    }
+    return sum;
+}
+
+std::uint64_t LatencyHistogram::quantile(double q) const {
+    const std::uint64_t samples = total();
+    if (samples == 0) {
+        return 0;
+    }
+    // Smallest bucket whose cumulative count reaches ceil(q * samples), at least one sample.
+    const auto rank = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(std::ceil(q * static_cast<double>(samples))));
+    std::uint64_t seen = 0;
+    for (std::size_t bucket = 0; bucket < kBuckets; ++bucket) {
+        seen += counts[bucket];
+        if (seen >= rank) {
+            return upperBound(bucket);
+        }
+    }
+    return upperBound(kBuckets - 1);
+}
+
+LatencyHistogram& LatencyHistogram::operator+=(const LatencyHistogram& other) {
+    for (std::size_t bucket = 0; bucket < kBuckets; ++bucket) {
+        counts[bucket] += other.counts[bucket];
+    }
+    return *this;
+}
+
+std::uint64_t PoolStats::tasksRun() const {
+    std::uint64_t sum = external.tasksRun;
+    for (const WorkerStats& worker : workers) {
+        sum += worker.tasksRun;
+    }
+    return sum;
+}
+
+void writeStats(std::ostream& out, const PoolStats& stats) {
+    if (!stats.enabled) {
+        out << "thread pool stats: disabled (configure with -DLIMO_THREAD_POOL_STATS=ON)\n"
+            << "  queue depth:  " << stats.queueDepth << '\n';
+        return;
+    }
+    out << "thread pool stats\n"
+        << "  queue depth:  " << stats.queueDepth << " (peak " << stats.peakQueueDepth << ")\n"
+        << "  tasks run:    " << stats.tasksRun() << '\n';
+    writeHistogram(out, "wait latency", stats.waitLatency);
+    writeHistogram(out, "run time", stats.runTime);
+    out << "  " << std::left << std::setw(9) << "thread" << std::right << std::setw(10) << "tasks" << std::setw(9)
+        << "steals" << std::setw(12) << "busy" << std::setw(12) << "idle" << std::setw(9) << "util" << '\n';
+    for (std::size_t i = 0; i < stats.workers.size(); ++i) {
+        writeWorker(out, "worker " + std::to_string(i), stats.workers[i]);
+    }
+    writeWorker(out, "external", stats.external);
+}
+
+} // namespace limo::thread_pool
@@ -1,15 +1,109 @@
 #include "limo/thread_pool/ThreadPool.hpp"
 
+#include <algorithm>
+#include <array>
+
 namespace limo::thread_pool {
 
+namespace {
+
+// The pool and deque index of the worker running on this thread, if any.
+struct WorkerContext {
+    const ThreadPool* pool{nullptr};
+    std::size_t index{0};
+    // Tasks currently running on this thread, nested ones included; stats only.
+    std::size_t running{0};
+};
+
+thread_local WorkerContext currentWorker;
+
+#if LIMO_THREAD_POOL_STATS
+std::uint64_t nanoseconds(std::chrono::steady_clock::duration duration) {
+    return static_cast<std::uint64_t>(std::max<std::int64_t>(
+        0, std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()));
+}
+#endif
+
+} // namespace
+
+struct alignas(64) ThreadPool::StatsSlot {
+    explicit StatsSlot(bool shared) : shared(shared) {}
+
+    // A worker's slot has a single writer, so a plain load and store is
+    // enough; the slot shared by outside threads needs read-modify-write.
+    void add(std::atomic<std::uint64_t>& counter, std::uint64_t delta) noexcept {
+        if (shared) {
+            counter.fetch_add(delta, std::memory_order_relaxed);
+        } else {
+            counter.store(counter.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+        }
+    }
+
+    WorkerStats read(LatencyHistogram& waitLatency, LatencyHistogram& runTime) const {
+        WorkerStats result;
+        result.tasksRun = tasksRun.load(std::memory_order_relaxed);
+        result.steals = steals.load(std::memory_order_relaxed);
+        result.busy = std::chrono::nanoseconds(busy.load(std::memory_order_relaxed));
+        result.idle = std::chrono::nanoseconds(idle.load(std::memory_order_relaxed));
+        for (std::size_t bucket = 0; bucket < LatencyHistogram::kBuckets; ++bucket) {
+            waitLatency.counts[bucket] += wait[bucket].load(std::memory_order_relaxed);
+            runTime.counts[bucket] += run[bucket].load(std::memory_order_relaxed);
+        }
+        return result;
+    }
+
+    const bool shared;
+    std::atomic<std::uint64_t> tasksRun{0};
+    std::atomic<std::uint64_t> steals{0};
+    std::atomic<std::uint64_t> busy{0};
+    std::atomic<std::uint64_t> idle{0};
+    std::array<std::atomic<std::uint64_t>, LatencyHistogram::kBuckets> wait{};
+    std::array<std::atomic<std::uint64_t>, LatencyHistogram::kBuckets> run{};
+};
+
+void ThreadPool::TaskRing::pushBack(QueuedTask task) {
+    if (count == slots.size()) {
+        std::vector<QueuedTask> grown(std::max<std::size_t>(16, slots.size() * 2));
+        for (std::size_t i = 0; i < count; ++i) {
+            grown[i] = std::move(slots[(head + i) % slots.size()]);
+        }
+        slots = std::move(grown);
+        head = 0;
+    }
+    slots[(head + count) % slots.size()] = std::move(task);
+    ++count;
+}
+
+ThreadPool::QueuedTask ThreadPool::TaskRing::popBack() {
+    --count;
+    return std::move(slots[(head + count) % slots.size()]);
+}
+
+ThreadPool::QueuedTask ThreadPool::TaskRing::popFront() {
+    QueuedTask task = std::move(slots[head]);
+    head = (head + 1) % slots.size();
+    --count;
+    return task;
+}
+
 ThreadPool::ThreadPool(std::size_t threadCount) {
     if (threadCount == 0) {
         threadCount = 1;
     }
 
+    queues.reserve(threadCount);
+    for (std::size_t i = 0; i < threadCount; ++i) {
+        queues.push_back(std::make_unique<WorkerQueue>());
+    }
+#if LIMO_THREAD_POOL_STATS
+    statsSlots.reserve(threadCount + 1);
+    for (std::size_t i = 0; i <= threadCount; ++i) {
+        statsSlots.push_back(std::make_unique<StatsSlot>(i == threadCount));
+    }
+#endif
     workers.reserve(threadCount);
     for (std::size_t i = 0; i < threadCount; ++i) {
-        workers.emplace_back([this]() { workerLoop(); });
+        workers.emplace_back([this, i]() { workerLoop(i); });
     }
 }
 
@@ -21,13 +115,41 @@ std::size_t ThreadPool::size() const {
     return workers.size();
 }
 
+PoolStats ThreadPool::stats() const {
+    PoolStats result;
+    result.queueDepth = pending.load();
+#if LIMO_THREAD_POOL_STATS
+    result.peakQueueDepth = peakDepth.load(std::memory_order_relaxed);
+    result.workers.reserve(workers.size());
+    for (std::size_t i = 0; i < workers.size(); ++i) {
+        result.workers.push_back(statsSlots[i]->read(result.waitLatency, result.runTime));
+    }
+    result.external = statsSlots.back()->read(result.waitLatency, result.runTime);
+#endif
+    return result;
+}
+
 void ThreadPool::shutdown() {
+    // Taking every deque lock orders the flag against in-flight enqueues:
+    // each one either lands before it (and is drained) or sees it and throws.
+    std::vector<std::unique_lock<std::mutex>> locks;
+    locks.reserve(queues.size());
+    for (auto& queue : queues) {
+        locks.emplace_back(queue->mutex);
+    }
+    const bool wasStopping = stopping.exchange(true);
+    locks.clear();
+    if (wasStopping) {
+        return;
+    }
+    // Bulk enqueues lock one deque at a time; those that got in before the
+    // flag finish before the workers are told to stop. Workers that leave
+    // early only give up their share to the batch's own caller.
+    for (std::size_t inFlight = bulkInFlight.load(); inFlight != 0; inFlight = bulkInFlight.load()) {
+        bulkInFlight.wait(inFlight);
+    }
     {
-        std::unique_lock<std::mutex> lock(mutex);
-        if (stopping) {
-            return;
-        }
-        stopping = true;
+        std::lock_guard<std::mutex> lock(sleepMutex);
     }
     cv.notify_all();
 
@@ -37,29 +159,179 @@ void ThreadPool::shutdown() {
 }
 
 void ThreadPool::enqueue(Task task) {
+    const std::size_t target = currentWorker.pool == this
+                                   ? currentWorker.index
+                                   : nextQueue.fetch_add(1, std::memory_order_relaxed) % queues.size();
     {
-        std::unique_lock<std::mutex> lock(mutex);
-        if (stopping) {
+        WorkerQueue& queue = *queues[target];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (stopping.load()) {
             throw std::runtime_error("ThreadPool is stopping");
         }
-        tasks.push(std::move(task));
+        queue.tasks.pushBack(QueuedTask{std::move(task), enqueueStamp()});
+        recordDepth(pending.fetch_add(1) + 1);
     }
-    cv.notify_one();
+    wakeSleepers(1);
 }
 
-void ThreadPool::workerLoop() {
-    while (true) {
-        Task task;
-        {
-            std::unique_lock<std::mutex> lock(mutex);
-            cv.wait(lock, [this]() { return stopping || !tasks.empty(); });
-            if (stopping && tasks.empty()) {
-                return;
+bool ThreadPool::beginBulk() noexcept {
+    // Paired with shutdown(), which sets `stopping` before reading
+    // `bulkInFlight`: either it waits for this batch or we see the flag.
+    bulkInFlight.fetch_add(1);
+    if (stopping.load()) {
+        endBulk();
+        return false;
+    }
+    return true;
+}
+
+void ThreadPool::endBulk() noexcept {
+    if (bulkInFlight.fetch_sub(1) == 1 && stopping.load()) {
+        bulkInFlight.notify_all();
+    }
+}
+
+std::size_t ThreadPool::bulkStart(std::size_t count) noexcept {
+    return currentWorker.pool == this ? currentWorker.index
+                                      : nextQueue.fetch_add(count, std::memory_order_relaxed) % queues.size();
+}
+
+void ThreadPool::wakeSleepers(std::size_t count) {
+    // A worker about to sleep increments `sleepers` before re-checking
+    // `pending` under sleepMutex, so either it sees the new tasks or we see it.
+    if (sleepers.load() == 0) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+    }
+    if (count == 1) {
+        cv.notify_one();
+    } else {
+        cv.notify_all();
+    }
+}
+
+bool ThreadPool::runQueuedTask() {
+    QueuedTask task;
+    if (currentWorker.pool == this) {
+        if (popLocal(currentWorker.index, task)) {
+            runTask(task, false);
+            return true;
+        }
+        if (steal(currentWorker.index, task)) {
+            runTask(task, true);
+            return true;
+        }
+        return false;
+    }
+    if (steal(queues.size() - 1, task) || popLocal(queues.size() - 1, task)) {
+        runTask(task, true);
+        return true;
+    }
+    return false;
+}
+
+void ThreadPool::runTask(QueuedTask& queued, [[maybe_unused]] bool stolen) {
+#if LIMO_THREAD_POOL_STATS
+    StatsSlot& slot = currentWorker.pool == this ? *statsSlots[currentWorker.index] : *statsSlots.back();
+    const Clock::time_point start = Clock::now();
+    slot.add(slot.wait[LatencyHistogram::bucketOf(nanoseconds(start - queued.queuedAt))], 1);
+
+    ++currentWorker.running;
+    queued.task();
+    --currentWorker.running;
+
+    const std::uint64_t elapsed = nanoseconds(Clock::now() - start);
+    slot.add(slot.run[LatencyHistogram::bucketOf(elapsed)], 1);
+    slot.add(slot.tasksRun, 1);
+    if (stolen) {
+        slot.add(slot.steals, 1);
+    }
+    // A task run while another one waits is already inside that one's run time.
+    if (currentWorker.running == 0) {
+        slot.add(slot.busy, elapsed);
+    }
+#else
+    queued.task();
+#endif
+}
+
+void ThreadPool::waitHelping(std::latch& done) {
+    while (!done.try_wait()) {
+        if (!runQueuedTask()) {
+            // Whatever is left is already running on other threads.
+            done.wait();
+            return;
+        }
+    }
+}
+
+bool ThreadPool::popLocal(std::size_t index, QueuedTask& task) {
+    WorkerQueue& queue = *queues[index];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty()) {
+        return false;
+    }
+    task = queue.tasks.popBack();
+    pending.fetch_sub(1);
+    return true;
+}
+
+bool ThreadPool::steal(std::size_t thief, QueuedTask& task) {
+    // First pass skips deques that are busy right now; if one was skipped,
+    // a second pass waits for the locks rather than spinning back here.
+    bool skipped = false;
+    for (int pass = 0; pass < 2; ++pass) {
+        for (std::size_t offset = 1; offset < queues.size(); ++offset) {
+            WorkerQueue& queue = *queues[(thief + offset) % queues.size()];
+            std::unique_lock<std::mutex> lock(queue.mutex, std::defer_lock);
+            if (pass == 0 && !lock.try_lock()) {
+                skipped = true;
+                continue;
+            }
+            if (pass == 1) {
+                lock.lock();
             }
-            task = std::move(tasks.front());
-            tasks.pop();
+            if (queue.tasks.empty()) {
+                continue;
+            }
+            task = queue.tasks.popFront();
+            pending.fetch_sub(1);
+            return true;
+        }
+        if (!skipped) {
+            break;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::workerLoop(std::size_t index) {
+    currentWorker = {this, index, 0};
+    while (true) {
+        QueuedTask task;
+        if (popLocal(index, task)) {
+            runTask(task, false);
+            continue;
+        }
+        if (steal(index, task)) {
+            runTask(task, true);
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        sleepers.fetch_add(1);
+#if LIMO_THREAD_POOL_STATS
+        const Clock::time_point asleep = Clock::now();
+        cv.wait(lock, [this]() { return stopping.load() || pending.load() > 0; });
+        statsSlots[index]->add(statsSlots[index]->idle, nanoseconds(Clock::now() - asleep));
+#else
+        cv.wait(lock, [this]() { return stopping.load() || pending.load() > 0; });
+#endif
+        sleepers.fetch_sub(1);
+        if (stopping.load() && pending.load() == 0) {
+            return;
         }
-        task();
     }
 }
 
@@ -0,0 +1,119 @@
+#include "limo/thread_pool/ThreadPool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+using limo::thread_pool::Future;
+using limo::thread_pool::ThreadPool;
+
+namespace {
+
+std::atomic<long> allocations{0};
+
+// Parks every worker, then queues a full round behind them so each ring
+// reaches its peak depth no matter how fast the workers would have drained it.
+void growRings(ThreadPool& pool, std::size_t workers, int tasks) {
+    std::atomic<std::size_t> parked{0};
+    std::atomic<bool> release{false};
+    std::atomic<int> remaining{tasks};
+    for (std::size_t i = 0; i < workers; ++i) {
+        pool.post([&parked, &release]() {
+            parked.fetch_add(1);
+            while (!release.load()) {
+            }
+            parked.fetch_sub(1);
+        });
+    }
+    while (parked.load() != workers) {
+    }
+    for (int i = 0; i < tasks; ++i) {
+        pool.post([&remaining]() { remaining.fetch_sub(1); });
+    }
+    release.store(true);
+    // The blockers spin on this frame, so it must outlive them.
+    while (remaining.load() != 0 || parked.load() != 0) {
+    }
+}
+
+} // namespace
+
+// Counts every global allocation made by any thread of this test binary.
+void* operator new(std::size_t size) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* block = std::malloc(size == 0 ? 1 : size)) {
+        return block;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* block) noexcept {
+    std::free(block);
+}
+
+void operator delete(void* block, std::size_t) noexcept {
+    std::free(block);
+}
+
+TEST(AllocationTests, SubmittingSmallTasksDoesNotAllocateInSteadyState) {
+    ThreadPool pool(2);
+    std::vector<Future<int>> futures;
+    futures.reserve(256);
+    std::atomic<int> sum{0};
+
+    const auto round = [&]() {
+        futures.clear();
+        for (int i = 0; i < 256; ++i) {
+            futures.push_back(pool.submit([i]() { return i; }));
+        }
+        for (auto& future : futures) {
+            sum.fetch_add(future.get());
+        }
+    };
+    // Warm-up grows the worker rings and fills the future-state caches. The
+    // wide round leaves spare states for those each worker keeps cached.
+    growRings(pool, 2, 256);
+    std::vector<Future<int>> wide;
+    for (int i = 0; i < 512; ++i) {
+        wide.push_back(pool.submit([]() { return 0; }));
+    }
+    for (auto& future : wide) {
+        future.get();
+    }
+    for (int i = 0; i < 20; ++i) {
+        round();
+    }
+
+    const long before = allocations.load();
+    for (int i = 0; i < 20; ++i) {
+        round();
+    }
+    EXPECT_EQ(allocations.load() - before, 0);
+    EXPECT_EQ(sum.load(), 40 * (255 * 256 / 2));
+}
+
+TEST(AllocationTests, PostingSmallTasksDoesNotAllocateInSteadyState) {
+    ThreadPool pool(2);
+    std::atomic<int> remaining{0};
+    const auto round = [&]() {
+        remaining.store(256);
+        for (int i = 0; i < 256; ++i) {
+            pool.post([&remaining]() { remaining.fetch_sub(1); });
+        }
+        while (remaining.load() != 0) {
+        }
+    };
+    growRings(pool, 2, 256);
+    for (int i = 0; i < 20; ++i) {
+        round();
+    }
+
+    const long before = allocations.load();
+    for (int i = 0; i < 20; ++i) {
+        round();
+    }
+    EXPECT_EQ(allocations.load() - before, 0);
+}
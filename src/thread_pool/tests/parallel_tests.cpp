@@ -0,0 +1,185 @@
+#include "limo/thread_pool/ThreadPool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using limo::thread_pool::ThreadPool;
+
+TEST(ParallelTests, ParallelForCoversTheRangeExactlyOnce) {
+    for (std::size_t threads : {1u, 2u, 5u}) {
+        ThreadPool pool(threads);
+        std::vector<int> touched(10007, 0);
+        pool.parallelFor(3, touched.size(), 16, [&](std::size_t begin, std::size_t end) {
+            EXPECT_LT(begin, end);
+            if (end != touched.size()) {
+                EXPECT_GE(end - begin, 16u);
+            }
+            for (std::size_t i = begin; i < end; ++i) {
+                ++touched[i];
+            }
+        });
+        for (std::size_t i = 0; i < touched.size(); ++i) {
+            EXPECT_EQ(touched[i], i < 3 ? 0 : 1) << threads << ' ' << i;
+        }
+    }
+}
+
+TEST(ParallelTests, ParallelForRunsSmallRangesOnTheCallingThread) {
+    ThreadPool pool(4);
+    const std::thread::id caller = std::this_thread::get_id();
+    int calls = 0;
+    pool.parallelFor(0, 10, 64, [&](std::size_t begin, std::size_t end) {
+        EXPECT_EQ(std::this_thread::get_id(), caller);
+        EXPECT_EQ(begin, 0u);
+        EXPECT_EQ(end, 10u);
+        ++calls;
+    });
+    pool.parallelFor(5, 5, 1, [&](std::size_t, std::size_t) { ++calls; });
+    EXPECT_EQ(calls, 1);
+}
+
+TEST(ParallelTests, ParallelReduceIsIndependentOfTheThreadCount) {
+    // Floating-point sums are not associative: equal results need equal chunking.
+    std::vector<double> values(50000);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        values[i] = 1.0 / static_cast<double>(i + 1);
+    }
+    const auto sum = [&](ThreadPool& pool) {
+        return pool.parallelReduce(
+            0, values.size(), 1000, 0.0,
+            [&](std::size_t begin, std::size_t end) {
+                return std::accumulate(values.begin() + begin, values.begin() + end, 0.0);
+            },
+            [](double left, double right) { return left + right; });
+    };
+    ThreadPool reference(1);
+    const double expected = sum(reference);
+    EXPECT_NEAR(expected, std::accumulate(values.begin(), values.end(), 0.0), 1e-9);
+    for (std::size_t threads : {2u, 3u, 7u}) {
+        ThreadPool pool(threads);
+        EXPECT_EQ(sum(pool), expected) << threads;
+    }
+}
+
+TEST(ParallelTests, ParallelReduceFoldsChunksInOrder) {
+    ThreadPool pool(3);
+    const std::vector<std::size_t> starts = pool.parallelReduce(
+        10, 105, 10, std::vector<std::size_t>{},
+        [](std::size_t begin, std::size_t) { return std::vector<std::size_t>{begin}; },
+        [](std::vector<std::size_t> left, const std::vector<std::size_t>& right) {
+            left.insert(left.end(), right.begin(), right.end());
+            return left;
+        });
+    EXPECT_EQ(starts, (std::vector<std::size_t>{10, 20, 30, 40, 50, 60, 70, 80, 90, 100}));
+}
+
+TEST(ParallelTests, ParallelForRethrowsTheFirstExceptionAfterAllParticipantsStop) {
+    ThreadPool pool(3);
+    std::atomic<int> running{0};
+    const auto run = [&] {
+        pool.parallelFor(0, 1000, 1, [&](std::size_t begin, std::size_t) {
+            ++running;
+            if (begin >= 500) {
+                --running;
+                throw std::runtime_error("chunk failed");
+            }
+            --running;
+        });
+    };
+    EXPECT_THROW(run(), std::runtime_error);
+    EXPECT_EQ(running.load(), 0);
+
+    // The pool is still usable afterwards.
+    std::atomic<std::size_t> total{0};
+    pool.parallelFor(0, 100, 1, [&](std::size_t begin, std::size_t end) { total += end - begin; });
+    EXPECT_EQ(total.load(), 100u);
+}
+
+TEST(ParallelTests, SubmitBatchRunsEveryIndexOnce) {
+    ThreadPool pool(3);
+    std::vector<std::atomic<int>> calls(257);
+    pool.submitBatch(calls.size(), [&](std::size_t index) { ++calls[index]; });
+    for (const auto& count : calls) {
+        EXPECT_EQ(count.load(), 1);
+    }
+    pool.submitBatch(0, [](std::size_t) { FAIL(); });
+}
+
+TEST(ParallelTests, SubmitBatchRethrowsAfterTheWholeBatchSettles) {
+    ThreadPool pool(2);
+    std::atomic<int> started{0};
+    const auto run = [&] {
+        pool.submitBatch(64, [&](std::size_t index) {
+            ++started;
+            if (index == 0) {
+                throw std::invalid_argument("job failed");
+            }
+        });
+    };
+    EXPECT_THROW(run(), std::invalid_argument);
+    EXPECT_GE(started.load(), 1);
+    EXPECT_LE(started.load(), 64);
+}
+
+TEST(ParallelTests, PrimitivesNestInsideTasksOfTheSamePool) {
+    // Every worker blocks in an outer batch job; the inner loops can only
+    // finish because waiting threads run queued tasks themselves.
+    ThreadPool pool(2);
+    std::atomic<std::size_t> total{0};
+    pool.submitBatch(8, [&](std::size_t) {
+        pool.parallelFor(0, 1000, 10, [&](std::size_t begin, std::size_t end) {
+            const std::size_t inner = pool.parallelReduce(
+                begin, end, 3, std::size_t{0}, [](std::size_t b, std::size_t e) { return e - b; },
+                [](std::size_t left, std::size_t right) { return left + right; });
+            total += inner;
+        });
+    });
+    EXPECT_EQ(total.load(), 8000u);
+}
+
+TEST(ParallelTests, StoppedPoolLeavesTheWorkToTheCaller) {
+    ThreadPool pool(2);
+    pool.shutdown();
+    std::vector<int> touched(100, 0);
+    pool.parallelFor(0, touched.size(), 1, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            ++touched[i];
+        }
+    });
+    pool.submitBatch(touched.size(), [&](std::size_t index) { ++touched[index]; });
+    for (int count : touched) {
+        EXPECT_EQ(count, 2);
+    }
+}
+
+TEST(ParallelTests, ConcurrentBatchesAndShutdownRunEveryIndexOnce) {
+    ThreadPool pool(4);
+    std::atomic<bool> failed{false};
+    std::vector<std::thread> submitters;
+    for (int s = 0; s < 4; ++s) {
+        submitters.emplace_back([&]() {
+            for (int round = 0; round < 200; ++round) {
+                std::vector<std::atomic<int>> runs(37);
+                pool.submitBatch(runs.size(), [&](std::size_t index) { ++runs[index]; });
+                for (const auto& count : runs) {
+                    if (count.load() != 1) {
+                        failed = true;
+                    }
+                }
+            }
+        });
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    pool.shutdown();
+    for (auto& submitter : submitters) {
+        submitter.join();
+    }
+    EXPECT_FALSE(failed.load());
+}
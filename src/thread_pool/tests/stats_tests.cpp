@@ -0,0 +1,207 @@
+#include "limo/thread_pool/Stats.hpp"
+#include "limo/thread_pool/ThreadPool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using limo::thread_pool::Future;
+using limo::thread_pool::LatencyHistogram;
+using limo::thread_pool::PoolStats;
+using limo::thread_pool::ThreadPool;
+
+static_assert(limo::thread_pool::kStatsEnabled, "stats tests must be built with LIMO_THREAD_POOL_STATS=1");
+
+TEST(StatsTests, HistogramBucketsArePowersOfTwo) {
+    EXPECT_EQ(LatencyHistogram::bucketOf(0), 0u);
+    EXPECT_EQ(LatencyHistogram::bucketOf(1), 0u);
+    EXPECT_EQ(LatencyHistogram::bucketOf(2), 1u);
+    EXPECT_EQ(LatencyHistogram::bucketOf(3), 1u);
+    EXPECT_EQ(LatencyHistogram::bucketOf(1024), 10u);
+    EXPECT_EQ(LatencyHistogram::bucketOf(~std::uint64_t{0}), LatencyHistogram::kBuckets - 1);
+    EXPECT_EQ(LatencyHistogram::upperBound(0), 2u);
+    EXPECT_EQ(LatencyHistogram::upperBound(10), 2048u);
+
+    LatencyHistogram histogram;
+    EXPECT_EQ(histogram.quantile(0.5), 0u);
+    histogram.counts[3] = 90;
+    histogram.counts[10] = 9;
+    histogram.counts[20] = 1;
+    EXPECT_EQ(histogram.total(), 100u);
+    EXPECT_EQ(histogram.quantile(0.0), LatencyHistogram::upperBound(3));
+    EXPECT_EQ(histogram.quantile(0.9), LatencyHistogram::upperBound(3));
+    EXPECT_EQ(histogram.quantile(0.95), LatencyHistogram::upperBound(10));
+    EXPECT_EQ(histogram.quantile(1.0), LatencyHistogram::upperBound(20));
+
+    histogram += histogram;
+    EXPECT_EQ(histogram.total(), 200u);
+}
+
+TEST(StatsTests, CountsEveryTaskOnce) {
+    ThreadPool pool(3);
+    std::vector<Future<int>> results;
+    for (int i = 0; i < 500; ++i) {
+        results.push_back(pool.submit([i]() { return i; }));
+    }
+    for (auto& result : results) {
+        result.get();
+    }
+    pool.submitBatch(100, [](std::size_t) {});
+    pool.shutdown();
+
+    const PoolStats stats = pool.stats();
+    EXPECT_TRUE(stats.enabled);
+    ASSERT_EQ(stats.workers.size(), 3u);
+    EXPECT_EQ(stats.tasksRun(), 600u);
+    EXPECT_EQ(stats.waitLatency.total(), 600u);
+    EXPECT_EQ(stats.runTime.total(), 600u);
+    EXPECT_EQ(stats.queueDepth, 0u);
+    EXPECT_GE(stats.peakQueueDepth, 1u);
+}
+
+TEST(StatsTests, TracksQueueDepthBehindABlockedWorker) {
+    ThreadPool pool(1);
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::promise<void> started;
+    pool.post([&started, released]() {
+        started.set_value();
+        released.wait();
+    });
+    started.get_future().wait();
+    for (int i = 0; i < 50; ++i) {
+        pool.post([]() {});
+    }
+
+    PoolStats stats = pool.stats();
+    EXPECT_EQ(stats.queueDepth, 50u);
+    EXPECT_EQ(stats.peakQueueDepth, 50u);
+
+    release.set_value();
+    pool.shutdown();
+    stats = pool.stats();
+    EXPECT_EQ(stats.queueDepth, 0u);
+    EXPECT_EQ(stats.peakQueueDepth, 50u);
+    EXPECT_EQ(stats.workers[0].tasksRun, 51u);
+    EXPECT_EQ(stats.workers[0].steals, 0u);
+    // The 50 tasks waited at least as long as the blocking one ran.
+    EXPECT_GE(stats.waitLatency.quantile(0.5), stats.runTime.quantile(0.5));
+}
+
+TEST(StatsTests, CountsStealsAndBusyAndIdleTime) {
+    ThreadPool pool(2);
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::atomic<int> children{0};
+    Future<void> parent = pool.submit([&]() {
+        // Queued on this worker's own deque; only the other worker can take them.
+        for (int i = 0; i < 8; ++i) {
+            pool.post([&children]() { ++children; });
+        }
+        released.wait();
+    });
+    while (children.load() < 8) {
+        std::this_thread::yield();
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    release.set_value();
+    parent.get();
+    pool.shutdown();
+
+    const PoolStats stats = pool.stats();
+    std::uint64_t steals = 0;
+    std::chrono::nanoseconds busy{0};
+    std::chrono::nanoseconds idle{0};
+    for (const auto& worker : stats.workers) {
+        steals += worker.steals;
+        busy += worker.busy;
+        idle += worker.idle;
+    }
+    EXPECT_GE(steals, 8u);
+    EXPECT_GE(busy, std::chrono::milliseconds(5));
+    EXPECT_GT(idle.count(), 0);
+}
+
+TEST(StatsTests, AttributesTasksRunByWaitingOutsideThreads) {
+    ThreadPool pool(1);
+    std::atomic<bool> release{false};
+    std::promise<void> started;
+    pool.post([&]() {
+        started.set_value();
+        while (!release.load()) {
+            std::this_thread::yield();
+        }
+    });
+    started.get_future().wait();
+
+    // The only worker is blocked, so the calling thread runs the whole batch.
+    pool.submitBatch(4, [](std::size_t) {});
+    release = true;
+    pool.shutdown();
+
+    const PoolStats stats = pool.stats();
+    EXPECT_EQ(stats.external.tasksRun, 4u);
+    EXPECT_EQ(stats.external.steals, 4u);
+    EXPECT_EQ(stats.workers[0].tasksRun, 1u);
+}
+
+TEST(StatsTests, BatchesFromAWorkerStartOnItsOwnDeque) {
+    ThreadPool pool(2);
+    std::atomic<bool> parked{false};
+    std::atomic<bool> release{false};
+    pool.post([&]() {
+        parked = true;
+        while (!release.load()) {
+            std::this_thread::yield();
+        }
+    });
+    while (!parked.load()) {
+        std::this_thread::yield();
+    }
+
+    // With the other worker parked, a task on any other deque would be stolen.
+    const auto steals = [&pool]() {
+        std::uint64_t total = 0;
+        for (const auto& worker : pool.stats().workers) {
+            total += worker.steals;
+        }
+        return total;
+    };
+    std::uint64_t stolen = 0;
+    pool.submit([&]() {
+        const std::uint64_t before = steals();
+        pool.submitBatch(1, [](std::size_t) {});
+        stolen = steals() - before;
+    }).get();
+    release = true;
+    pool.shutdown();
+
+    EXPECT_EQ(stolen, 0u);
+}
+
+TEST(StatsTests, WritesAReport) {
+    ThreadPool pool(2);
+    pool.submit([]() {}).get();
+
+    std::ostringstream out;
+    limo::thread_pool::writeStats(out, pool.stats());
+    const std::string report = out.str();
+    EXPECT_NE(report.find("queue depth"), std::string::npos);
+    EXPECT_NE(report.find("wait latency"), std::string::npos);
+    EXPECT_NE(report.find("worker 1"), std::string::npos);
+    EXPECT_NE(report.find("external"), std::string::npos);
+
+    PoolStats disabled;
+    disabled.enabled = false;
+    disabled.queueDepth = 7;
+    out.str("");
+    limo::thread_pool::writeStats(out, disabled);
+    EXPECT_NE(out.str().find("disabled"), std::string::npos);
+    EXPECT_NE(out.str().find('7'), std::string::npos);
+}
@@ -0,0 +1,84 @@
+#include "limo/thread_pool/Future.hpp"
+#include "limo/thread_pool/Task.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+
+using limo::thread_pool::Future;
+using limo::thread_pool::Promise;
+using limo::thread_pool::Task;
+
+TEST(TaskTests, StoresSmallCallablesInline) {
+    int calls = 0;
+    Task task([&calls]() { ++calls; });
+    EXPECT_TRUE(task);
+    EXPECT_TRUE(task.isInline());
+    task();
+    task();
+    EXPECT_EQ(calls, 2);
+
+    std::array<char, 2 * Task::kInlineSize> big{};
+    big[0] = 3;
+    Task large([big, &calls]() { calls += big[0]; });
+    EXPECT_FALSE(large.isInline());
+    large();
+    EXPECT_EQ(calls, 5);
+}
+
+TEST(TaskTests, IsMoveOnlyAndDestroysItsCallableOnce) {
+    auto counter = std::make_shared<int>(0);
+    {
+        Task first([owned = std::make_unique<int>(7), counter]() { *counter += *owned; });
+        EXPECT_EQ(counter.use_count(), 2);
+        Task second(std::move(first));
+        EXPECT_FALSE(first);
+        second();
+        Task third;
+        third = std::move(second);
+        third();
+        EXPECT_EQ(counter.use_count(), 2);
+    }
+    EXPECT_EQ(*counter, 14);
+    EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(FutureTests, DeliversValuesAndExceptionsAcrossThreads) {
+    Promise<std::string> promise;
+    Future<std::string> future = promise.getFuture();
+    EXPECT_TRUE(future.valid());
+    EXPECT_FALSE(future.isReady());
+    std::thread producer([promise = std::move(promise)]() mutable { promise.setValue("done"); });
+    EXPECT_EQ(future.get(), "done");
+    EXPECT_FALSE(future.valid());
+    producer.join();
+
+    Promise<void> failing;
+    Future<void> failed = failing.getFuture();
+    failing.fulfil([]() { throw std::logic_error("task failed"); });
+    EXPECT_TRUE(failed.isReady());
+    EXPECT_THROW(failed.get(), std::logic_error);
+}
+
+TEST(FutureTests, ReportsMisuseLikeStdFuture) {
+    Future<int> empty;
+    EXPECT_FALSE(empty.valid());
+    EXPECT_THROW(empty.wait(), std::future_error);
+
+    Future<int> broken;
+    {
+        Promise<int> promise;
+        broken = promise.getFuture();
+        EXPECT_THROW(promise.getFuture(), std::future_error);
+    }
+    EXPECT_THROW(broken.get(), std::future_error);
+
+    Promise<int> promise;
+    promise.setValue(1);
+    EXPECT_THROW(promise.setValue(2), std::future_error);
+}
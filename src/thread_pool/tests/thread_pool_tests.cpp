@@ -6,12 +6,14 @@
 #include <chrono>
 #include <memory>
 #include <thread>
+#include <vector>
 
+using limo::thread_pool::Future;
 using limo::thread_pool::ThreadPool;
 
 TEST(ThreadPoolTests, ExecutesSubmittedTasks) {
     ThreadPool pool(2);
-    std::future<int> future = pool.submit([]() { return 42; });
+    Future<int> future = pool.submit([]() { return 42; });
     EXPECT_EQ(future.get(), 42);
 }
 
@@ -19,9 +21,9 @@ TEST(ThreadPoolTests, RunsMultipleTasks) {
     ThreadPool pool(3);
     std::atomic<int> counter{0};
 
-    std::future<void> f1 = pool.submit([&counter]() { counter.fetch_add(1); });
-    std::future<void> f2 = pool.submit([&counter]() { counter.fetch_add(1); });
-    std::future<void> f3 = pool.submit([&counter]() { counter.fetch_add(1); });
+    Future<void> f1 = pool.submit([&counter]() { counter.fetch_add(1); });
+    Future<void> f2 = pool.submit([&counter]() { counter.fetch_add(1); });
+    Future<void> f3 = pool.submit([&counter]() { counter.fetch_add(1); });
 
     f1.get();
     f2.get();
@@ -47,7 +49,7 @@ TEST(ThreadPoolTests, ShutdownProcessesQueuedTasks) {
     ThreadPool pool(1);
     std::atomic<int> counter{0};
 
-    std::future<void> future = pool.submit([&counter]() { counter.fetch_add(1); });
+    Future<void> future = pool.submit([&counter]() { counter.fetch_add(1); });
     pool.shutdown();
 
     EXPECT_NO_THROW(future.get());
@@ -59,7 +61,7 @@ TEST(ThreadPoolTests, WorkersWaitUntilTasksArrive) {
     std::atomic<int> value{0};
 
     std::this_thread::sleep_for(std::chrono::milliseconds(10));
-    std::future<int> future = pool.submit([&value]() { value.store(7); return 7; });
+    Future<int> future = pool.submit([&value]() { value.store(7); return 7; });
 
     EXPECT_EQ(future.get(), 7);
     EXPECT_EQ(value.load(), 7);
@@ -74,7 +76,7 @@ TEST(ThreadPoolTests, SubmitsCallableWithArguments) {
     ThreadPool pool(2);
     std::function<int(int, int)> add = [](int a, int b) { return a + b; };
 
-    std::future<int> future = pool.submit(add, 3, 4);
+    Future<int> future = pool.submit(add, 3, 4);
 
     EXPECT_EQ(future.get(), 7);
 }
@@ -83,9 +85,104 @@ TEST(ThreadPoolTests, SubmitsSharedPtrArgument) {
     ThreadPool pool(1);
     std::shared_ptr<int> payload = std::make_shared<int>(5);
 
-    std::future<int> future = pool.submit(
+    Future<int> future = pool.submit(
         [](const std::shared_ptr<int>& value) { return *value * 2; }, payload);
 
     EXPECT_EQ(future.get(), 10);
     EXPECT_EQ(*payload, 5);
 }
+
+TEST(ThreadPoolTests, IdleWorkersStealTasksQueuedByABlockedWorker) {
+    ThreadPool pool(3);
+    std::atomic<int> completed{0};
+
+    // The outer task queues its children on its own deque and then blocks
+    // on them, so they can only run if other workers steal them.
+    Future<int> outer = pool.submit([&pool, &completed]() {
+        std::vector<Future<void>> children;
+        for (int i = 0; i < 16; ++i) {
+            children.push_back(pool.submit([&completed]() { completed.fetch_add(1); }));
+        }
+        for (auto& child : children) {
+            child.get();
+        }
+        return completed.load();
+    });
+
+    EXPECT_EQ(outer.get(), 16);
+}
+
+TEST(ThreadPoolTests, ConcurrentSubmittersAndShutdownRunEveryAcceptedTask) {
+    ThreadPool pool(4);
+    std::atomic<int> executed{0};
+    std::atomic<int> accepted{0};
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < 4; ++p) {
+        producers.emplace_back([&]() {
+            for (int i = 0; i < 2000; ++i) {
+                try {
+                    pool.submit([&executed]() { executed.fetch_add(1); });
+                    accepted.fetch_add(1);
+                } catch (const std::runtime_error&) {
+                    return;
+                }
+            }
+        });
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    pool.shutdown();
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    EXPECT_EQ(executed.load(), accepted.load());
+}
+
+TEST(ThreadPoolTests, NestedFanOutCompletes) {
+    ThreadPool pool(2);
+    std::atomic<int> leaves{0};
+
+    std::vector<Future<void>> branches;
+    for (int i = 0; i < 8; ++i) {
+        branches.push_back(pool.submit([&pool, &leaves]() {
+            for (int j = 0; j < 8; ++j) {
+                pool.submit([&leaves]() { leaves.fetch_add(1); });
+            }
+        }));
+    }
+    for (auto& branch : branches) {
+        branch.get();
+    }
+    pool.shutdown();
+
+    EXPECT_EQ(leaves.load(), 64);
+}
+
+TEST(ThreadPoolTests, PostRunsTasksWithoutAFuture) {
+    ThreadPool pool(2);
+    std::atomic<int> counter{0};
+    auto owned = std::make_unique<int>(3);
+
+    pool.post([owned = std::move(owned), &counter]() { counter.fetch_add(*owned); });
+    pool.post([&counter](int amount) { counter.fetch_add(amount); }, 4);
+    pool.shutdown();
+
+    EXPECT_EQ(counter.load(), 7);
+    EXPECT_THROW(pool.post([]() {}), std::runtime_error);
+}
+
+TEST(ThreadPoolTests, SubmitPropagatesExceptionsThroughTheFuture) {
+    ThreadPool pool(1);
+    Future<int> future = pool.submit([]() -> int { throw std::invalid_argument("bad input"); });
+    EXPECT_THROW(future.get(), std::invalid_argument);
+}
+
+TEST(ThreadPoolTests, StatsSnapshotMatchesTheBuildConfiguration) {
+    ThreadPool pool(2);
+    pool.submit([]() {}).get();
+    const limo::thread_pool::PoolStats stats = pool.stats();
+    EXPECT_EQ(stats.enabled, limo::thread_pool::kStatsEnabled);
+    EXPECT_EQ(stats.queueDepth, 0u);
+    EXPECT_EQ(stats.workers.size(), limo::thread_pool::kStatsEnabled ? 2u : 0u);
+}